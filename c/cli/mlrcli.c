@@ -107,6 +107,7 @@ static void main_usage_see_also(FILE* o, char* argv0);
 static void print_type_arithmetic_info(FILE* o, char* argv0);
 static void usage_all_verbs(char* argv0);
 static void usage_unrecognized_verb(char* argv0, char* arg);
+static void optimize_mapper_chain(sllv_t* pmapper_list);
 
 static void check_arg_count(char** argv, int argi, int argc, int n);
 static mapper_setup_t* look_up_mapper_setup(char* verb);
@@ -263,6 +264,7 @@ cli_opts_t* parse_command_line(int argc, char** argv) {
 			break;
 		argi++;
 	}
+	optimize_mapper_chain(popts->pmapper_list);
 
 	for ( ; argi < argc; argi++) {
 		slls_append(popts->filenames, argv[argi], NO_FREE);
@@ -291,6 +293,34 @@ cli_opts_t* parse_command_line(int argc, char** argv) {
 	return popts;
 }
 
+// ----------------------------------------------------------------
+// Replaces mapper pairs with equivalent single mappers where that saves work: so far, sort then head
+// becomes a top-n mapper which doesn't retain all records.
+static void optimize_mapper_chain(sllv_t* pmapper_list) {
+	for (sllve_t* pe = pmapper_list->phead; pe != NULL && pe->pnext != NULL; pe = pe->pnext) {
+		sllve_t* pnext = pe->pnext;
+		mapper_t* pmapper = pe->pvvalue;
+		mapper_t* pnext_mapper = pnext->pvvalue;
+
+		unsigned long long head_count = 0LL;
+		slls_t* pgroup_by_field_names = NULL;
+		if (!mapper_head_get_params(pnext_mapper, &head_count, &pgroup_by_field_names))
+			continue;
+		mapper_t* pfused = mapper_sort_fuse_head(pmapper, head_count, pgroup_by_field_names);
+		if (pfused == NULL)
+			continue;
+
+		pmapper->pfree_func(pmapper);
+		pnext_mapper->pfree_func(pnext_mapper);
+		pe->pvvalue = pfused;
+		pe->pnext = pnext->pnext;
+		if (pmapper_list->ptail == pnext)
+			pmapper_list->ptail = pe;
+		pmapper_list->length--;
+		free(pnext);
+	}
+}
+
 // ----------------------------------------------------------------
 void cli_opts_free(cli_opts_t* popts) {
 	if (popts == NULL)
@@ -828,6 +858,11 @@ static void main_usage_other_options(FILE* o, char* argv0) {
 	fprintf(o, "                     urand()/urandint()/urand32().\n");
 	fprintf(o, "  --nr-progress-mod {m}, with m a positive integer: print filename and record\n");
 	fprintf(o, "                     count to stderr every m input records.\n");
+	fprintf(o, "  --sample-fraction {f}, with f in (0,1]: read only records starting in a\n");
+	fprintf(o, "                     random fraction f of the 64KB blocks of each input file,\n");
+	fprintf(o, "                     for approximate answers over large files. DKVP and NIDX\n");
+	fprintf(o, "                     files only, read with mmap. See also the --scale options\n");
+	fprintf(o, "                     of stats1 and histogram.\n");
 	fprintf(o, "  --from {filename}  Use this to specify an input file before the verb(s),\n");
 	fprintf(o, "                     rather than after. May be used more than once. Example:\n");
 	fprintf(o, "                     \"%s --from a.dat --from b.dat cat\" is the same as\n", argv0);
@@ -938,6 +973,7 @@ void cli_reader_opts_init(cli_reader_opts_t* preader_opts) {
 	preader_opts->allow_repeat_ips               = NEITHER_TRUE_NOR_FALSE;
 	preader_opts->use_implicit_csv_header        = NEITHER_TRUE_NOR_FALSE;
 	preader_opts->use_mmap_for_read              = NEITHER_TRUE_NOR_FALSE;
+	preader_opts->sample_fraction                = 1.0;
 
 	preader_opts->prepipe                        = NULL;
 }
@@ -1338,6 +1374,19 @@ int cli_handle_reader_options(char** argv, int argc, int *pargi, cli_reader_opts
 		preader_opts->use_mmap_for_read = FALSE;
 		argi += 1;
 
+	} else if (streq(argv[argi], "--sample-fraction")) {
+		check_arg_count(argv, argi, argc, 2);
+		double sample_fraction = 0.0;
+		if (!mlr_try_float_from_string(argv[argi+1], &sample_fraction)
+			|| !(sample_fraction > 0.0 && sample_fraction <= 1.0))
+		{
+			fprintf(stderr, "%s: --sample-fraction argument must be a number in (0,1]; got \"%s\".\n",
+				MLR_GLOBALS.bargv0, argv[argi+1]);
+			exit(1);
+		}
+		preader_opts->sample_fraction = sample_fraction;
+		argi += 2;
+
 	} else if (streq(argv[argi], "--prepipe")) {
 		check_arg_count(argv, argi, argc, 2);
 		preader_opts->prepipe = argv[argi+1];
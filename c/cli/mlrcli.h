@@ -26,6 +26,8 @@ typedef struct _cli_reader_opts_t {
 	int   allow_repeat_ips;
 	int   use_implicit_csv_header;
 	int   use_mmap_for_read;
+	// In (0,1] with 1 meaning all records: see --sample-fraction.
+	double sample_fraction;
 
 	// Command for popen on input, e.g. "zcat -cf <". Can be null in which case
 	// files are read directly rather than through a pipe.
@@ -0,0 +1,50 @@
+#include <string.h>
+#include "lib/mlrutil.h"
+#include "containers/bloom_filter.h"
+
+#define BLOOM_BITS_PER_ELEMENT 10
+#define BLOOM_NUM_PROBES       7
+
+// ----------------------------------------------------------------
+bloom_filter_t* bloom_filter_alloc(unsigned long long expected_num_elements) {
+	unsigned long long num_bits = 64;
+	while (num_bits < BLOOM_BITS_PER_ELEMENT * expected_num_elements)
+		num_bits *= 2;
+	bloom_filter_t* pfilter = mlr_malloc_or_die(sizeof(bloom_filter_t));
+	pfilter->bits = mlr_malloc_or_die(num_bits / 8);
+	memset(pfilter->bits, 0, num_bits / 8);
+	pfilter->mask = num_bits - 1;
+	pfilter->num_probes = BLOOM_NUM_PROBES;
+	return pfilter;
+}
+
+void bloom_filter_free(bloom_filter_t* pfilter) {
+	if (pfilter == NULL)
+		return;
+	free(pfilter->bits);
+	free(pfilter);
+}
+
+// ----------------------------------------------------------------
+// Double hashing: probe i is at h1 + i*h2. Both are remixes of the hash, since FNV's low bits, which the
+// mask keeps, are weakly mixed. h2 is odd so that it's coprime to the power-of-two size.
+
+void bloom_filter_add(bloom_filter_t* pfilter, unsigned long long hash) {
+	hash = bloom_hash_mix(hash);
+	unsigned long long h2 = bloom_hash_mix(hash) | 1;
+	for (int i = 0; i < pfilter->num_probes; i++, hash += h2) {
+		unsigned long long bit = hash & pfilter->mask;
+		pfilter->bits[bit >> 6] |= 1ULL << (bit & 63);
+	}
+}
+
+int bloom_filter_may_contain(bloom_filter_t* pfilter, unsigned long long hash) {
+	hash = bloom_hash_mix(hash);
+	unsigned long long h2 = bloom_hash_mix(hash) | 1;
+	for (int i = 0; i < pfilter->num_probes; i++, hash += h2) {
+		unsigned long long bit = hash & pfilter->mask;
+		if ((pfilter->bits[bit >> 6] & (1ULL << (bit & 63))) == 0)
+			return FALSE;
+	}
+	return TRUE;
+}
@@ -0,0 +1,57 @@
+// ================================================================
+// Bloom filter over strings or string tuples, e.g. join-field values: a
+// compact set which answers "definitely absent" or "possibly present". Sized
+// for about ten bits per element and seven probes, for about a 1% false-
+// positive rate.
+//
+// Callers hash tuples a value at a time with bloom_hash_append, from wherever
+// the values are, e.g. straight from a record without collecting them first.
+// ================================================================
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+#include "containers/slls.h"
+
+#define BLOOM_HASH_SEED 0xcbf29ce484222325ULL
+
+typedef struct _bloom_filter_t {
+	unsigned long long* bits;
+	unsigned long long  mask; // Number of bits, a power of two, minus one
+	int                 num_probes;
+} bloom_filter_t;
+
+bloom_filter_t* bloom_filter_alloc(unsigned long long expected_num_elements);
+void bloom_filter_free(bloom_filter_t* pfilter);
+void bloom_filter_add(bloom_filter_t* pfilter, unsigned long long hash);
+int  bloom_filter_may_contain(bloom_filter_t* pfilter, unsigned long long hash);
+
+// FNV-1a over the string and its terminator, so that ("ab","c") and ("a","bc") hash differently.
+static inline unsigned long long bloom_hash_append(unsigned long long hash, char* s) {
+	for (unsigned char* p = (unsigned char*)s; ; p++) {
+		hash = (hash ^ *p) * 0x100000001b3ULL;
+		if (*p == 0)
+			return hash;
+	}
+}
+
+// The same for a tuple already in a list. This is the hash function for persisted hashes too, e.g. in join
+// indexes, so it mustn't change.
+static inline unsigned long long bloom_hash_values(slls_t* pvalues) {
+	unsigned long long hash = BLOOM_HASH_SEED;
+	for (sllse_t* pe = pvalues->phead; pe != NULL; pe = pe->pnext)
+		hash = bloom_hash_append(hash, pe->value);
+	return hash;
+}
+
+// Remixes a hash (splitmix64's finalizer) so that all its bits depend on all the input, e.g. before masking
+// off low bits of an FNV hash for a table index.
+static inline unsigned long long bloom_hash_mix(unsigned long long hash) {
+	hash ^= hash >> 30;
+	hash *= 0xbf58476d1ce4e5b9ULL;
+	hash ^= hash >> 27;
+	hash *= 0x94d049bb133111ebULL;
+	hash ^= hash >> 31;
+	return hash;
+}
+
+#endif // BLOOM_FILTER_H
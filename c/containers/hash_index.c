@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lib/mlrutil.h"
+#include "containers/hash_index.h"
+
+// ----------------------------------------------------------------
+void hash_index_init(hash_index_t* pindex) {
+	pindex->ctrl       = NULL;
+	pindex->slots      = NULL;
+	pindex->group_mask = 0;
+}
+
+void hash_index_uninit(hash_index_t* pindex) {
+	free(pindex->ctrl); // The slots are in the same allocation.
+	hash_index_init(pindex);
+}
+
+static int hash_index_num_slots(hash_index_t* pindex) {
+	return (pindex->ctrl == NULL) ? 0 : (pindex->group_mask + 1) * HASH_INDEX_GROUP_SIZE;
+}
+
+// At most 7/8 full.
+static int hash_index_capacity(int num_slots) {
+	return num_slots - num_slots / 8;
+}
+
+// ----------------------------------------------------------------
+int hash_index_reset(hash_index_t* pindex, int min_capacity) {
+	int num_groups = 1;
+	while (hash_index_capacity(num_groups * HASH_INDEX_GROUP_SIZE) < min_capacity)
+		num_groups *= 2;
+	int num_slots = num_groups * HASH_INDEX_GROUP_SIZE;
+	if (num_slots != hash_index_num_slots(pindex)) {
+		free(pindex->ctrl);
+		pindex->ctrl = mlr_malloc_or_die(num_slots * (1 + sizeof(int)));
+		pindex->slots = (int*)(pindex->ctrl + num_slots);
+		pindex->group_mask = num_groups - 1;
+	}
+	memset(pindex->ctrl, HASH_INDEX_EMPTY, num_slots);
+	return hash_index_capacity(num_slots);
+}
+
+void hash_index_clear(hash_index_t* pindex) {
+	if (pindex->ctrl != NULL)
+		memset(pindex->ctrl, HASH_INDEX_EMPTY, hash_index_num_slots(pindex));
+}
+
+// ----------------------------------------------------------------
+// Without removes, the entry goes in the first empty slot along its probe sequence: lookups for it stop no
+// earlier than there.
+void hash_index_insert(hash_index_t* pindex, unsigned hash, int entry_index) {
+	hash_index_probe_t probe;
+	hash_index_probe_start(&probe, pindex, hash);
+	while (probe.empties == 0) {
+		probe.stride++;
+		probe.group = (probe.group + probe.stride) & pindex->group_mask;
+		hash_index_load_group(&probe);
+	}
+	hash_index_insert_at_probe(&probe, entry_index);
+}
+
+// ----------------------------------------------------------------
+int hash_index_count(hash_index_t* pindex) {
+	int count = 0;
+	int num_slots = hash_index_num_slots(pindex);
+	for (int i = 0; i < num_slots; i++)
+		if (pindex->ctrl[i] != HASH_INDEX_EMPTY)
+			count++;
+	return count;
+}
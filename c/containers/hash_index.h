@@ -0,0 +1,126 @@
+// ================================================================
+// Hash index for the lhms* maps (see lhm.h), in the SwissTable style: the maps
+// keep their entries in a dense array in insertion order, and this maps hashes
+// to entry indices.
+//
+// * Slots are in groups of 16, with one control byte per slot: EMPTY, or the
+//   low seven bits of the slot's (remixed) hash. A probe checks a whole group
+//   at once, with SSE2 where available, and compares keys only for slots
+//   whose control byte matches.
+// * Groups are probed triangularly (g, g+1, g+3, g+6, ...), which visits every
+//   group since their number is a power of two. A lookup stops at the first
+//   group with an empty slot.
+// * Entries are never removed, so there are no tombstones. The index is at
+//   most 7/8 full; the maps grow by rebuilding it from their stored hashes.
+// ================================================================
+
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define HASH_INDEX_GROUP_SIZE 16
+#define HASH_INDEX_EMPTY      0x80
+
+typedef struct _hash_index_t {
+	unsigned char* ctrl;       // One byte per slot
+	int*           slots;      // Entry index per slot
+	unsigned       group_mask; // Number of groups, a power of two, minus one
+} hash_index_t;
+
+typedef struct _hash_index_probe_t {
+	hash_index_t* pindex;
+	unsigned      group;
+	unsigned      stride;
+	unsigned char h2;
+	unsigned      matches; // Bit per slot in the group whose control byte matches h2
+	unsigned      empties; // Bit per empty slot in the group
+} hash_index_probe_t;
+
+// The index is unallocated until the first reset; probes of it find nothing.
+void hash_index_init(hash_index_t* pindex);
+void hash_index_uninit(hash_index_t* pindex);
+// Empties the index and sizes it for at least min_capacity entries. Returns its capacity, i.e. how many
+// entries it can take before the next reset.
+int  hash_index_reset(hash_index_t* pindex, int min_capacity);
+// Empties the index, keeping its size.
+void hash_index_clear(hash_index_t* pindex);
+// The caller must first check there is room, and that no entry with an equal key is indexed.
+void hash_index_insert(hash_index_t* pindex, unsigned hash, int entry_index);
+// For unit-test hooks.
+int  hash_index_count(hash_index_t* pindex);
+
+// ----------------------------------------------------------------
+// Remixes a hash (murmur3's finalizer), since the callers' djb2 hashes are weakly mixed in their low bits.
+static inline unsigned hash_index_mix(unsigned hash) {
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bU;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35U;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+static inline void hash_index_load_group(hash_index_probe_t* pprobe) {
+	unsigned char* ctrl = &pprobe->pindex->ctrl[pprobe->group * HASH_INDEX_GROUP_SIZE];
+#ifdef __SSE2__
+	__m128i bytes = _mm_loadu_si128((const __m128i*)ctrl);
+	pprobe->matches = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)pprobe->h2)));
+	pprobe->empties = _mm_movemask_epi8(bytes);
+#else
+	pprobe->matches = 0;
+	pprobe->empties = 0;
+	for (int i = 0; i < HASH_INDEX_GROUP_SIZE; i++) {
+		if (ctrl[i] == pprobe->h2)
+			pprobe->matches |= 1U << i;
+		else if (ctrl[i] == HASH_INDEX_EMPTY)
+			pprobe->empties |= 1U << i;
+	}
+#endif
+}
+
+// Usage:
+//   hash_index_probe_t probe;
+//   hash_index_probe_start(&probe, pindex, hash);
+//   for (int i = hash_index_probe_next(&probe); i >= 0; i = hash_index_probe_next(&probe))
+//     ... compare the key of entry i ...
+static inline void hash_index_probe_start(hash_index_probe_t* pprobe, hash_index_t* pindex, unsigned hash) {
+	hash = hash_index_mix(hash);
+	pprobe->pindex = pindex;
+	pprobe->group  = (hash >> 7) & pindex->group_mask;
+	pprobe->stride = 0;
+	pprobe->h2     = hash & 0x7f;
+	if (pindex->ctrl == NULL) {
+		pprobe->matches = 0;
+		pprobe->empties = 1;
+		return;
+	}
+	hash_index_load_group(pprobe);
+}
+
+// Returns the index of the next candidate entry, or -1 when there are no more.
+static inline int hash_index_probe_next(hash_index_probe_t* pprobe) {
+	while (pprobe->matches == 0) {
+		if (pprobe->empties != 0)
+			return -1;
+		pprobe->stride++;
+		pprobe->group = (pprobe->group + pprobe->stride) & pprobe->pindex->group_mask;
+		hash_index_load_group(pprobe);
+	}
+	int i = __builtin_ctz(pprobe->matches);
+	pprobe->matches &= pprobe->matches - 1;
+	return pprobe->pindex->slots[pprobe->group * HASH_INDEX_GROUP_SIZE + i];
+}
+
+// After hash_index_probe_next has returned -1, inserts at the first empty slot the probe came to, which is
+// where hash_index_insert would put it: this saves probing again when putting a new key. The index must not
+// have been reset since, and must have room.
+static inline void hash_index_insert_at_probe(hash_index_probe_t* pprobe, int entry_index) {
+	int slot = pprobe->group * HASH_INDEX_GROUP_SIZE + __builtin_ctz(pprobe->empties);
+	pprobe->pindex->ctrl[slot]  = pprobe->h2;
+	pprobe->pindex->slots[slot] = entry_index;
+}
+
+#endif // HASH_INDEX_H
@@ -2,10 +2,13 @@
 #include "lib/mlrutil.h"
 #include "containers/header_keeper.h"
 
+static unsigned long long header_keeper_next_schema_id = 1LL;
+
 header_keeper_t* header_keeper_alloc(char* line, slls_t* pkeys) {
 	header_keeper_t* pheader_keeper = mlr_malloc_or_die(sizeof(header_keeper_t));
-	pheader_keeper->line  = line;
-	pheader_keeper->pkeys = pkeys;
+	pheader_keeper->line      = line;
+	pheader_keeper->pkeys     = pkeys;
+	pheader_keeper->schema_id = header_keeper_next_schema_id++;
 
 	return pheader_keeper;
 }
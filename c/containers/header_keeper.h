@@ -11,6 +11,9 @@
 typedef struct _header_keeper_t {
 	char*   line;
 	slls_t* pkeys;
+	// Unique per header keeper within the process, and never zero. Readers stamp it on records whose
+	// field names are exactly this header: see schema_id in lrec.h.
+	unsigned long long schema_id;
 } header_keeper_t;
 
 header_keeper_t* header_keeper_alloc(char* line, slls_t* pkeys);
@@ -0,0 +1,94 @@
+#include <string.h>
+#include <math.h>
+#include "lib/mlrutil.h"
+#include "containers/bloom_filter.h"
+#include "containers/hyperloglog.h"
+
+// ----------------------------------------------------------------
+hll_t* hll_alloc(int precision) {
+	MLR_INTERNAL_CODING_ERROR_IF(precision < HLL_MIN_PRECISION || precision > HLL_MAX_PRECISION);
+	hll_t* phll = mlr_malloc_or_die(sizeof(hll_t));
+	phll->precision = precision;
+	phll->num_registers = 1 << precision;
+	phll->registers = mlr_malloc_or_die(phll->num_registers);
+	memset(phll->registers, 0, phll->num_registers);
+	return phll;
+}
+
+void hll_free(hll_t* phll) {
+	if (phll == NULL)
+		return;
+	free(phll->registers);
+	free(phll);
+}
+
+// ----------------------------------------------------------------
+// The hash is remixed since callers' hashes, e.g. FNV, may be weakly mixed. The top precision bits pick the
+// register; the register keeps the maximum, over its hashes, of one plus the number of leading zeros in the
+// remaining bits.
+void hll_add(hll_t* phll, unsigned long long hash) {
+	hash = bloom_hash_mix(hash);
+
+	int index = (int)(hash >> (64 - phll->precision));
+	unsigned long long rest = hash << phll->precision;
+	int max_rank = 64 - phll->precision + 1;
+	int rank = (rest == 0ULL) ? max_rank : __builtin_clzll(rest) + 1;
+	if (rank > max_rank)
+		rank = max_rank;
+	if (rank > phll->registers[index])
+		phll->registers[index] = rank;
+}
+
+void hll_merge(hll_t* pdst, hll_t* psrc) {
+	MLR_INTERNAL_CODING_ERROR_IF(pdst->precision != psrc->precision);
+	for (int i = 0; i < pdst->num_registers; i++)
+		if (psrc->registers[i] > pdst->registers[i])
+			pdst->registers[i] = psrc->registers[i];
+}
+
+// ----------------------------------------------------------------
+// Ertl's sigma and tau series, correcting for registers which are zero, resp. saturated.
+static double hll_sigma(double x) {
+	if (x == 1.0)
+		return INFINITY;
+	double y = 1.0;
+	double z = x;
+	double z_prev;
+	do {
+		x *= x;
+		z_prev = z;
+		z += x * y;
+		y += y;
+	} while (z != z_prev);
+	return z;
+}
+
+static double hll_tau(double x) {
+	if (x == 0.0 || x == 1.0)
+		return 0.0;
+	double y = 1.0;
+	double z = 1.0 - x;
+	double z_prev;
+	do {
+		x = sqrt(x);
+		z_prev = z;
+		y *= 0.5;
+		z -= (1.0 - x) * (1.0 - x) * y;
+	} while (z != z_prev);
+	return z / 3.0;
+}
+
+double hll_estimate(hll_t* phll) {
+	int q = 64 - phll->precision;
+	double m = phll->num_registers;
+	double counts[64 + 2];
+	memset(counts, 0, sizeof(counts));
+	for (int i = 0; i < phll->num_registers; i++)
+		counts[phll->registers[i]] += 1.0;
+
+	double z = m * hll_tau(1.0 - counts[q+1] / m);
+	for (int k = q; k >= 1; k--)
+		z = 0.5 * (z + counts[k]);
+	z += m * hll_sigma(counts[0] / m);
+	return m * m / (2.0 * log(2.0) * z);
+}
@@ -0,0 +1,38 @@
+// ================================================================
+// HyperLogLog sketch for approximate distinct counts, e.g. mlr count-distinct
+// -n --approx: 2^precision one-byte registers, regardless of the number of
+// distinct values. Callers add 64-bit hashes of the values; see
+// bloom_hash_append for hashing string tuples.
+//
+// The estimate uses Ertl's improved estimator ("New cardinality estimation
+// algorithms for HyperLogLog sketches", 2017), which, like HyperLogLog++'s
+// bias correction, is accurate from small to large cardinalities, but needs no
+// empirical tables. The relative standard error is about 1.04/sqrt(2^precision),
+// e.g. 0.8% at the default precision of 14, using 16KB.
+//
+// Sketches of the same precision merge by register-wise max, e.g. to combine
+// counts over several inputs.
+// ================================================================
+
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#define HLL_MIN_PRECISION     4
+#define HLL_MAX_PRECISION     18
+#define HLL_DEFAULT_PRECISION 14
+
+typedef struct _hll_t {
+	int            precision;
+	int            num_registers;
+	unsigned char* registers;
+} hll_t;
+
+// The precision must be in [HLL_MIN_PRECISION, HLL_MAX_PRECISION].
+hll_t* hll_alloc(int precision);
+void hll_free(hll_t* phll);
+void hll_add(hll_t* phll, unsigned long long hash);
+// Both must have the same precision.
+void hll_merge(hll_t* pdst, hll_t* psrc);
+double hll_estimate(hll_t* phll);
+
+#endif // HYPERLOGLOG_H
@@ -0,0 +1,346 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/lrec_spill.h"
+#include "containers/bloom_filter.h"
+#include "containers/join_bucket_keeper.h"
+#include "containers/join_index.h"
+
+#define JOIN_INDEX_MAGIC      0x33304958494a4c4dULL // "MLJIXI03" little-endian
+#define JOIN_INDEX_BYTE_ORDER 0x0102030405060708ULL
+
+typedef enum _join_index_header_word_t {
+	JIH_MAGIC = 0,
+	JIH_BYTE_ORDER,
+	JIH_SOURCE_SIZE,
+	JIH_SOURCE_MTIME,
+	JIH_SOURCE_MTIME_NSEC,
+	JIH_SOURCE_INODE,
+	JIH_SIGNATURE_LENGTH,
+	JIH_NUM_BUCKETS,
+	JIH_BUCKETS_OFFSET,
+	JIH_TABLE_SIZE,
+	JIH_TABLE_OFFSET,
+	JIH_UNKEYED_OFFSET,
+	JIH_NUM_UNKEYED,
+	JIH_LENGTH,
+	JIH_NUM_WORDS
+} join_index_header_word_t;
+
+#define JOIN_INDEX_HEADER_LENGTH (JIH_NUM_WORDS * sizeof(unsigned long long))
+
+// Whether a bucket's key and records, or the unkeyed records, have been checked yet.
+typedef enum _join_index_check_t {
+	JIC_UNCHECKED = 0,
+	JIC_VALID,
+	JIC_MALFORMED
+} join_index_check_t;
+
+// ----------------------------------------------------------------
+// Sub-second modification times, so that a left file rewritten within the same second is still seen as changed.
+static unsigned long long join_index_mtime_nsec(struct stat* psource_stat) {
+#ifdef __APPLE__
+	return psource_stat->st_mtimespec.tv_nsec;
+#else
+	return psource_stat->st_mtim.tv_nsec;
+#endif
+}
+
+// ================================================================
+// The index is only a cache, so failing to write it isn't fatal: e.g. the directory may not be writable.
+static void join_index_write_warning(char* func, char* path) {
+	perror(func);
+	fprintf(stderr, "%s: could not write join index \"%s\"; continuing without it.\n", MLR_GLOBALS.bargv0, path);
+}
+
+static void fwrite_padding(FILE* fp) {
+	for (long offset = ftell(fp); offset % sizeof(unsigned long long) != 0; offset++)
+		putc(0, fp);
+}
+
+void join_index_write(char* path, struct stat* psource_stat, char* signature,
+	lhmslv_t* pbuckets_by_join_field_values, sllv_t* punkeyed_records)
+{
+	char* temp_path = mlr_paste_2_strings(path, ".XXXXXX");
+	int fd = mkstemp(temp_path);
+	if (fd < 0) {
+		join_index_write_warning("mkstemp", path);
+		free(temp_path);
+		return;
+	}
+	FILE* fp = fdopen(fd, "wb");
+	if (fp == NULL) {
+		join_index_write_warning("fdopen", temp_path);
+		close(fd);
+		unlink(temp_path);
+		free(temp_path);
+		return;
+	}
+
+	unsigned long long header[JIH_NUM_WORDS];
+	memset(header, 0, sizeof(header));
+	fwrite(header, sizeof(header), 1, fp); // Placeholder until the offsets are known
+	int signature_length = strlen(signature);
+	fwrite(signature, 1, signature_length, fp);
+
+	unsigned long long num_buckets = pbuckets_by_join_field_values->num_occupied;
+	join_index_bucket_t* buckets = mlr_malloc_or_die((num_buckets + 1) * sizeof(join_index_bucket_t));
+	unsigned long long i = 0;
+	for (lhmslve_t* pe = pbuckets_by_join_field_values->phead; pe != NULL; pe = pe->pnext, i++) {
+		join_bucket_t* pbucket = pe->pvvalue;
+		join_index_bucket_t* pentry = &buckets[i];
+		pentry->hash           = bloom_hash_values(pbucket->pleft_field_values);
+		pentry->records_offset = ftell(fp);
+		pentry->num_records    = pbucket->precords->length;
+		for (sllve_t* pf = pbucket->precords->phead; pf != NULL; pf = pf->pnext)
+			lrec_spill_write(fp, pf->pvvalue);
+		pentry->key_offset     = ftell(fp);
+		for (sllse_t* pf = pbucket->pleft_field_values->phead; pf != NULL; pf = pf->pnext)
+			fwrite(pf->value, 1, strlen(pf->value) + 1, fp);
+		pentry->key_length     = ftell(fp) - pentry->key_offset;
+	}
+
+	header[JIH_UNKEYED_OFFSET] = ftell(fp);
+	header[JIH_NUM_UNKEYED]    = punkeyed_records->length;
+	for (sllve_t* pe = punkeyed_records->phead; pe != NULL; pe = pe->pnext)
+		lrec_spill_write(fp, pe->pvvalue);
+
+	fwrite_padding(fp);
+	header[JIH_BUCKETS_OFFSET] = ftell(fp);
+	fwrite(buckets, sizeof(join_index_bucket_t), num_buckets, fp);
+
+	// At most half full, for short probes.
+	unsigned long long table_size = 16;
+	while (table_size < 2 * num_buckets)
+		table_size *= 2;
+	unsigned long long* table = mlr_malloc_or_die(table_size * sizeof(unsigned long long));
+	memset(table, 0, table_size * sizeof(unsigned long long));
+	for (i = 0; i < num_buckets; i++) {
+		unsigned long long slot = bloom_hash_mix(buckets[i].hash) & (table_size - 1);
+		while (table[slot] != 0)
+			slot = (slot + 1) & (table_size - 1);
+		table[slot] = i + 1;
+	}
+	header[JIH_TABLE_OFFSET] = ftell(fp);
+	header[JIH_TABLE_SIZE]   = table_size;
+	fwrite(table, sizeof(unsigned long long), table_size, fp);
+
+	header[JIH_MAGIC]             = JOIN_INDEX_MAGIC;
+	header[JIH_BYTE_ORDER]        = JOIN_INDEX_BYTE_ORDER;
+	header[JIH_SOURCE_SIZE]       = psource_stat->st_size;
+	header[JIH_SOURCE_MTIME]      = psource_stat->st_mtime;
+	header[JIH_SOURCE_MTIME_NSEC] = join_index_mtime_nsec(psource_stat);
+	header[JIH_SOURCE_INODE]      = psource_stat->st_ino;
+	header[JIH_SIGNATURE_LENGTH]  = signature_length;
+	header[JIH_NUM_BUCKETS]       = num_buckets;
+	header[JIH_LENGTH]            = ftell(fp);
+	rewind(fp);
+	fwrite(header, sizeof(header), 1, fp);
+
+	int failed = ferror(fp);
+	if (fclose(fp) != 0 || failed) {
+		join_index_write_warning("fwrite", temp_path);
+		unlink(temp_path);
+	} else if (rename(temp_path, path) != 0) {
+		join_index_write_warning("rename", path);
+		unlink(temp_path);
+	}
+
+	free(table);
+	free(buckets);
+	free(temp_path);
+}
+
+// ================================================================
+// Checks the header and the bucket and hash tables, which lookups rely on. Bucket keys and records are checked
+// when first used: see join_index_bucket_is_valid.
+static int join_index_is_valid(join_index_t* pindex, unsigned long long* header, struct stat* psource_stat,
+	char* signature)
+{
+	unsigned long long length = pindex->length;
+	if (header[JIH_MAGIC] != JOIN_INDEX_MAGIC || header[JIH_BYTE_ORDER] != JOIN_INDEX_BYTE_ORDER)
+		return FALSE;
+	if (header[JIH_LENGTH] != length)
+		return FALSE;
+	if (header[JIH_SOURCE_SIZE] != (unsigned long long)psource_stat->st_size
+		|| header[JIH_SOURCE_MTIME] != (unsigned long long)psource_stat->st_mtime
+		|| header[JIH_SOURCE_MTIME_NSEC] != join_index_mtime_nsec(psource_stat)
+		|| header[JIH_SOURCE_INODE] != (unsigned long long)psource_stat->st_ino)
+		return FALSE;
+
+	unsigned long long signature_length = strlen(signature);
+	if (header[JIH_SIGNATURE_LENGTH] != signature_length)
+		return FALSE;
+	if (JOIN_INDEX_HEADER_LENGTH + signature_length > length)
+		return FALSE;
+	if (memcmp(pindex->data + JOIN_INDEX_HEADER_LENGTH, signature, signature_length) != 0)
+		return FALSE;
+
+	unsigned long long num_buckets = header[JIH_NUM_BUCKETS];
+	unsigned long long buckets_offset = header[JIH_BUCKETS_OFFSET];
+	unsigned long long table_size = header[JIH_TABLE_SIZE];
+	unsigned long long table_offset = header[JIH_TABLE_OFFSET];
+	if (buckets_offset % sizeof(unsigned long long) != 0 || table_offset % sizeof(unsigned long long) != 0)
+		return FALSE;
+	if (num_buckets > length / sizeof(join_index_bucket_t)
+		|| buckets_offset + num_buckets * sizeof(join_index_bucket_t) > length)
+		return FALSE;
+	if (table_size == 0 || (table_size & (table_size - 1)) != 0 || table_size <= num_buckets
+		|| table_size > length / sizeof(unsigned long long)
+		|| table_offset + table_size * sizeof(unsigned long long) > length)
+		return FALSE;
+	if (header[JIH_UNKEYED_OFFSET] > length)
+		return FALSE;
+	unsigned long long* table = (unsigned long long*)(pindex->data + table_offset);
+	for (unsigned long long i = 0; i < table_size; i++)
+		if (table[i] > num_buckets)
+			return FALSE;
+
+	pindex->num_buckets    = num_buckets;
+	pindex->buckets        = (join_index_bucket_t*)(pindex->data + buckets_offset);
+	pindex->table_size     = table_size;
+	pindex->table          = table;
+	pindex->unkeyed_offset = header[JIH_UNKEYED_OFFSET];
+	pindex->num_unkeyed    = header[JIH_NUM_UNKEYED];
+	return TRUE;
+}
+
+join_index_t* join_index_open(char* path, struct stat* psource_stat, char* signature) {
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	struct stat index_stat;
+	if (fstat(fd, &index_stat) != 0 || index_stat.st_size < (off_t)JOIN_INDEX_HEADER_LENGTH) {
+		close(fd);
+		return NULL;
+	}
+	char* data = mmap(NULL, index_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return NULL;
+
+	join_index_t* pindex = mlr_malloc_or_die(sizeof(join_index_t));
+	memset(pindex, 0, sizeof(join_index_t));
+	pindex->path   = mlr_strdup_or_die(path);
+	pindex->inode  = index_stat.st_ino;
+	pindex->data   = data;
+	pindex->length = index_stat.st_size;
+	if (!join_index_is_valid(pindex, (unsigned long long*)data, psource_stat, signature)) {
+		join_index_free(pindex);
+		return NULL;
+	}
+	pindex->bucket_checks = mlr_malloc_or_die(pindex->num_buckets + 1);
+	memset(pindex->bucket_checks, JIC_UNCHECKED, pindex->num_buckets + 1);
+	return pindex;
+}
+
+void join_index_free(join_index_t* pindex) {
+	if (pindex == NULL)
+		return;
+	munmap(pindex->data, pindex->length);
+	free(pindex->bucket_checks);
+	free(pindex->path);
+	free(pindex);
+}
+
+// ----------------------------------------------------------------
+// Removes the index, unless it has already been replaced, e.g. rebuilt by another run, so that the next run
+// rebuilds it. The mapping stays valid meanwhile.
+static void join_index_discard(join_index_t* pindex) {
+	if (!pindex->warned) {
+		fprintf(stderr, "%s: join index \"%s\" is malformed; ignoring the bad parts and removing it.\n",
+			MLR_GLOBALS.bargv0, pindex->path);
+		pindex->warned = TRUE;
+	}
+	struct stat index_stat;
+	if (stat(pindex->path, &index_stat) == 0 && index_stat.st_ino == pindex->inode)
+		unlink(pindex->path);
+}
+
+// Returns FALSE if any of the records is malformed, so that decoding them later can't fail.
+static int join_index_records_are_valid(join_index_t* pindex, unsigned long long offset,
+	unsigned long long num_records)
+{
+	if (offset > pindex->length)
+		return FALSE;
+	char* p = pindex->data + offset;
+	char* end = pindex->data + pindex->length;
+	for (unsigned long long i = 0; i < num_records; i++)
+		if (!lrec_spill_check(p, end, &p))
+			return FALSE;
+	return TRUE;
+}
+
+static int join_index_bucket_is_valid(join_index_t* pindex, unsigned long long bucket_index) {
+	char* pcheck = &pindex->bucket_checks[bucket_index];
+	if (*pcheck == JIC_UNCHECKED) {
+		join_index_bucket_t* pentry = &pindex->buckets[bucket_index];
+		unsigned long long length = pindex->length;
+		*pcheck = JIC_VALID;
+		if (pentry->key_length == 0 || pentry->key_offset > length || pentry->key_length > length - pentry->key_offset
+			|| pindex->data[pentry->key_offset + pentry->key_length - 1] != 0
+			|| !join_index_records_are_valid(pindex, pentry->records_offset, pentry->num_records))
+		{
+			*pcheck = JIC_MALFORMED;
+			join_index_discard(pindex);
+		}
+	}
+	return *pcheck == JIC_VALID;
+}
+
+// ================================================================
+static int join_index_key_matches(join_index_t* pindex, join_index_bucket_t* pentry, slls_t* pfield_values) {
+	char* p = pindex->data + pentry->key_offset;
+	char* end = p + pentry->key_length;
+	for (sllse_t* pe = pfield_values->phead; pe != NULL; pe = pe->pnext) {
+		if (p >= end || !streq(p, pe->value))
+			return FALSE;
+		p += strlen(p) + 1;
+	}
+	return p == end;
+}
+
+long long join_index_find(join_index_t* pindex, slls_t* pfield_values) {
+	unsigned long long hash = bloom_hash_values(pfield_values);
+	unsigned long long mask = pindex->table_size - 1;
+	for (unsigned long long slot = bloom_hash_mix(hash) & mask; pindex->table[slot] != 0; slot = (slot + 1) & mask) {
+		unsigned long long bucket_index = pindex->table[slot] - 1;
+		join_index_bucket_t* pentry = &pindex->buckets[bucket_index];
+		if (pentry->hash == hash && join_index_bucket_is_valid(pindex, bucket_index)
+			&& join_index_key_matches(pindex, pentry, pfield_values))
+			return bucket_index;
+	}
+	return -1;
+}
+
+static void join_index_append_records(join_index_t* pindex, unsigned long long offset,
+	unsigned long long num_records, sllv_t* precords)
+{
+	char* p = pindex->data + offset;
+	char* end = pindex->data + pindex->length;
+	for (unsigned long long i = 0; i < num_records; i++)
+		sllv_append(precords, lrec_spill_decode(p, end, &p));
+}
+
+void join_index_append_bucket_records(join_index_t* pindex, long long bucket_index, sllv_t* precords) {
+	join_index_bucket_t* pentry = &pindex->buckets[bucket_index];
+	if (join_index_bucket_is_valid(pindex, bucket_index))
+		join_index_append_records(pindex, pentry->records_offset, pentry->num_records, precords);
+}
+
+void join_index_append_unkeyed_records(join_index_t* pindex, sllv_t* precords) {
+	if (pindex->unkeyed_check == JIC_UNCHECKED) {
+		pindex->unkeyed_check = JIC_VALID;
+		if (!join_index_records_are_valid(pindex, pindex->unkeyed_offset, pindex->num_unkeyed)) {
+			pindex->unkeyed_check = JIC_MALFORMED;
+			join_index_discard(pindex);
+		}
+	}
+	if (pindex->unkeyed_check == JIC_VALID)
+		join_index_append_records(pindex, pindex->unkeyed_offset, pindex->num_unkeyed, precords);
+}
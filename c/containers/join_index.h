@@ -0,0 +1,81 @@
+// ================================================================
+// Persistent index of a join left file, for mlr join -u --index: a sidecar
+// file which is memory-mapped on later runs, so that startup needn't parse
+// and hash the whole left file, and only left records which pair are decoded.
+//
+// The sidecar holds the left records themselves, in the spill encoding of
+// lrec_spill.h, grouped by join-field values, so it doesn't depend on the
+// left file's format and decoding needs no separator handling. Layout, with
+// all integers 64-bit in native byte order:
+// * Header: magic, byte-order check, the left file's size, mtime in seconds
+//   and nanoseconds, and inode, and the lengths and offsets of what follows.
+// * Signature: a caller-supplied string, e.g. the left-file format options
+//   and join-field names. An index is reused only if it matches.
+// * Per bucket (distinct join-field values, in order of first appearance):
+//   its records, then its values as consecutive NUL-terminated strings.
+// * Left records lacking some join field, in order.
+// * Bucket table: hash (bloom_hash_values in bloom_filter.h), key offset and
+//   length, records offset and count.
+// * Open-addressing hash table with linear probing: a power-of-two number of
+//   slots, indexed by the remixed hash (bloom_hash_mix), each 0 for empty else
+//   one plus a bucket-table index.
+//
+// A stale index, or one whose header or tables are malformed, is rebuilt
+// rather than trusted. Opening checks only those, so as not to read the
+// whole file: each bucket's key and records are checked when the bucket is
+// first used. A malformed bucket is then treated as missing, with a warning,
+// and the index file is removed so that the next run rebuilds it.
+// ================================================================
+
+#ifndef JOIN_INDEX_H
+#define JOIN_INDEX_H
+#include <sys/stat.h>
+#include "containers/slls.h"
+#include "containers/sllv.h"
+#include "containers/lhmslv.h"
+
+typedef struct _join_index_bucket_t {
+	unsigned long long hash;
+	unsigned long long key_offset;
+	unsigned long long key_length;
+	unsigned long long records_offset;
+	unsigned long long num_records;
+} join_index_bucket_t;
+
+typedef struct _join_index_t {
+	char*                path;
+	ino_t                inode;
+	char*                data;
+	unsigned long long   length;
+	unsigned long long   num_buckets;
+	unsigned long long   table_size;
+	unsigned long long*  table;
+	join_index_bucket_t* buckets;
+	unsigned long long   unkeyed_offset;
+	unsigned long long   num_unkeyed;
+	// Per bucket, then for the unkeyed records: see join_index_check_t in join_index.c.
+	char*                bucket_checks;
+	char                 unkeyed_check;
+	int                  warned;
+} join_index_t;
+
+// Returns NULL if the index file is missing, or doesn't match the left file's stat or the signature, or its
+// header or tables are malformed.
+join_index_t* join_index_open(char* path, struct stat* psource_stat, char* signature);
+void join_index_free(join_index_t* pindex);
+
+// The buckets are the unsorted join's: join_bucket_t's keyed by left-field values, in order of first
+// appearance. The unkeyed records are those lacking some join field. Written to a temp file then renamed
+// into place, so readers never see a partial index. On I/O error, e.g. in a directory which isn't writable,
+// warns and leaves no index, as it's only a cache.
+void join_index_write(char* path, struct stat* psource_stat, char* signature,
+	lhmslv_t* pbuckets_by_join_field_values, sllv_t* punkeyed_records);
+
+// Returns the bucket index, or -1 if the values aren't in the left file or their bucket is malformed.
+long long join_index_find(join_index_t* pindex, slls_t* pfield_values);
+// Decodes the bucket's records, appending them to the list. A malformed bucket, or malformed unkeyed records,
+// append nothing.
+void join_index_append_bucket_records(join_index_t* pindex, long long bucket_index, sllv_t* precords);
+void join_index_append_unkeyed_records(join_index_t* pindex, sllv_t* precords);
+
+#endif // JOIN_INDEX_H
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lib/mlrutil.h"
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
+
+// ----------------------------------------------------------------
+void lhm_init(lhm_t* pmap) {
+	pmap->num_occupied  = 0;
+	pmap->num_allocated = 0;
+	pmap->entries       = NULL;
+	hash_index_init(&pmap->index);
+	pmap->phead         = NULL;
+	pmap->ptail         = NULL;
+}
+
+void lhm_uninit(lhm_t* pmap) {
+	free(pmap->entries);
+	hash_index_uninit(&pmap->index);
+	lhm_init(pmap);
+}
+
+void lhm_clear(lhm_t* pmap) {
+	pmap->num_occupied = 0;
+	hash_index_clear(&pmap->index);
+	pmap->phead        = NULL;
+	pmap->ptail        = NULL;
+}
+
+// ----------------------------------------------------------------
+// The entries may move, so they are relinked; the index, once there is one, is rebuilt from their stored hashes.
+void lhm_enlarge(lhm_t* pmap, size_t entry_size) {
+	if (pmap->num_allocated < LHM_MAX_UNINDEXED)
+		pmap->num_allocated = LHM_MAX_UNINDEXED;
+	else
+		pmap->num_allocated = hash_index_reset(&pmap->index, 2 * pmap->num_allocated);
+	pmap->entries = mlr_realloc_or_die(pmap->entries, pmap->num_allocated * entry_size);
+
+	char* entries = pmap->entries;
+	lhme_t* pprev = NULL;
+	for (int i = 0; i < pmap->num_occupied; i++) {
+		lhme_t* pe = (lhme_t*)(entries + i * entry_size);
+		pe->pprev = pprev;
+		pe->pnext = NULL;
+		if (pprev == NULL)
+			pmap->phead = pe;
+		else
+			pprev->pnext = pe;
+		pprev = pe;
+		if (pmap->index.ctrl != NULL)
+			hash_index_insert(&pmap->index, pe->hash, i);
+	}
+	pmap->ptail = pprev;
+}
+
+// ----------------------------------------------------------------
+void lhm_print(lhm_t* pmap, lhm_print_entry_func_t* pprint_entry_func) {
+	printf("| num_occupied: %d | num_allocated: %d | phead: %p | ptail %p\n",
+		pmap->num_occupied, pmap->num_allocated, pmap->phead, pmap->ptail);
+	printf("+\n");
+	for (lhme_t* pe = pmap->phead; pe != NULL; pe = pe->pnext) {
+		printf("| prev: %p curr: %p next: %p | hash: %08x | ", pe->pprev, pe, pe->pnext, pe->hash);
+		pprint_entry_func(pe);
+	}
+}
+
+// ----------------------------------------------------------------
+static int lhm_is_indexed(lhm_t* pmap, unsigned hash, int entry_index) {
+	if (pmap->index.ctrl == NULL)
+		return TRUE;
+	hash_index_probe_t probe;
+	hash_index_probe_start(&probe, &pmap->index, hash);
+	for (int i = hash_index_probe_next(&probe); i >= 0; i = hash_index_probe_next(&probe))
+		if (i == entry_index)
+			return TRUE;
+	return FALSE;
+}
+
+int lhm_check_counts(lhm_t* pmap, size_t entry_size) {
+	if (pmap->index.ctrl != NULL) {
+		int nidx = hash_index_count(&pmap->index);
+		if (nidx != pmap->num_occupied) {
+			fprintf(stderr,
+				"occupancy-count mismatch:  indexed %d != cached  %d.\n",
+					nidx, pmap->num_occupied);
+			return FALSE;
+		}
+	}
+	char* entries = pmap->entries;
+	lhme_t* pprev = NULL;
+	int i = 0;
+	for (lhme_t* pe = pmap->phead; pe != NULL; pprev = pe, pe = pe->pnext, i++) {
+		if (i >= pmap->num_occupied || pe != (lhme_t*)(entries + i * entry_size) || pe->pprev != pprev
+			|| !lhm_is_indexed(pmap, pe->hash, i))
+		{
+			fprintf(stderr, "entry %d is misplaced.\n", i);
+			return FALSE;
+		}
+	}
+	if (i != pmap->num_occupied || pmap->ptail != pprev) {
+		fprintf(stderr,
+			"list-length mismatch:  actual %d != cached  %d.\n",
+				i, pmap->num_occupied);
+		return FALSE;
+	}
+	return TRUE;
+}
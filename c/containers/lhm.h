@@ -0,0 +1,115 @@
+// ================================================================
+// Insertion-ordered hash map with entries of any type: the shared
+// implementation of the lhms* maps (lhmss, lhmsi, lhmsll, lhmsv, lhmslv,
+// lhms2v, lhmsmv), which are thin typed wrappers around it.
+//
+// * Entries are kept in a dense array in insertion order. They are also
+//   linked, for iteration from phead or ptail. Entry pointers are invalidated
+//   when a put grows the map.
+// * Up to LHM_MAX_UNINDEXED entries, lookups scan the array, comparing the
+//   stored hashes before the keys. Beyond that, a SwissTable-style hash index
+//   (see hash_index.h) maps hashes to entries. Small maps, e.g. of a record's
+//   field names, so never allocate an index, and a hit costs one load fewer.
+// * Each typed entry begins with the members of lhme_t, with its own type for
+//   the links, and each typed map has the layout of lhm_t, with its own entry
+//   type for the pointers. The wrappers pass their entry size and a function
+//   matching an entry's key against a key.
+//
+// Entries are never removed.
+// ================================================================
+
+#ifndef LHM_H
+#define LHM_H
+
+#include <stddef.h>
+#include "containers/hash_index.h"
+
+#define LHM_MAX_UNINDEXED 8
+
+typedef struct _lhme_t {
+	unsigned hash;
+	struct _lhme_t* pprev;
+	struct _lhme_t* pnext;
+} lhme_t;
+
+typedef struct _lhm_t {
+	int          num_occupied;
+	int          num_allocated;
+	void*        entries;
+	hash_index_t index; // Unallocated until the map has more than LHM_MAX_UNINDEXED entries
+	lhme_t*      phead;
+	lhme_t*      ptail;
+} lhm_t;
+
+// Whether the entry's key equals the key, in whatever form the typed map takes keys.
+typedef int lhm_key_matches_func_t(void* pentry, void* pkey);
+// For printing: the typed part of an entry, after its links and hash.
+typedef void lhm_print_entry_func_t(void* pentry);
+
+// The entries and index are allocated on first put, since Miller constructs an awful lot of maps which stay
+// empty or small.
+void lhm_init(lhm_t* pmap);
+// Frees the entries and index, but not what the entries point to.
+void lhm_uninit(lhm_t* pmap);
+// Empties the map, keeping its allocations.
+void lhm_clear(lhm_t* pmap);
+
+// Grows the entries, and the index once there are more than LHM_MAX_UNINDEXED of them. For lhm_append.
+void lhm_enlarge(lhm_t* pmap, size_t entry_size);
+
+void lhm_print(lhm_t* pmap, lhm_print_entry_func_t* pprint_entry_func);
+// Unit-test hook: checks the links and that each entry is indexed.
+int lhm_check_counts(lhm_t* pmap, size_t entry_size);
+
+// ----------------------------------------------------------------
+// Returns the entry with the key and hash, else NULL, leaving the probe where lhm_append inserts. Inline so
+// that the wrappers' key-match functions are called directly.
+static inline void* lhm_find(lhm_t* pmap, size_t entry_size, void* pkey, unsigned hash,
+	lhm_key_matches_func_t* pkey_matches_func, hash_index_probe_t* pprobe)
+{
+	char* entries = pmap->entries;
+	if (pmap->index.ctrl == NULL) {
+		for (int i = 0; i < pmap->num_occupied; i++) {
+			lhme_t* pe = (lhme_t*)(entries + i * entry_size);
+			if (pe->hash == hash && pkey_matches_func(pe, pkey))
+				return pe;
+		}
+		// lhm_append doesn't use the probe until there is an index; this is so the compiler can tell.
+		*pprobe = (hash_index_probe_t) { 0 };
+		return NULL;
+	}
+	hash_index_probe_start(pprobe, &pmap->index, hash);
+	for (int i = hash_index_probe_next(pprobe); i >= 0; i = hash_index_probe_next(pprobe)) {
+		lhme_t* pe = (lhme_t*)(entries + i * entry_size);
+		if (pe->hash == hash && pkey_matches_func(pe, pkey))
+			return pe;
+	}
+	return NULL;
+}
+
+// After lhm_find has returned NULL for the hash, with the same probe: appends an entry with the hash, linked
+// at the tail, and returns it for the caller to set the key and value.
+static inline void* lhm_append(lhm_t* pmap, size_t entry_size, unsigned hash, hash_index_probe_t* pprobe) {
+	if (pmap->num_occupied < pmap->num_allocated) {
+		if (pmap->index.ctrl != NULL)
+			hash_index_insert_at_probe(pprobe, pmap->num_occupied);
+	} else {
+		lhm_enlarge(pmap, entry_size);
+		if (pmap->index.ctrl != NULL)
+			hash_index_insert(&pmap->index, hash, pmap->num_occupied);
+	}
+
+	lhme_t* pe = (lhme_t*)((char*)pmap->entries + pmap->num_occupied * entry_size);
+	pe->hash  = hash;
+	pe->pprev = pmap->ptail;
+	pe->pnext = NULL;
+	if (pmap->ptail == NULL)
+		pmap->phead = pe;
+	else
+		pmap->ptail->pnext = pe;
+	pmap->ptail = pe;
+	pmap->num_occupied++;
+	return pe;
+}
+
+#endif // LHM_H
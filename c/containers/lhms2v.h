@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-pair-to-void-star linked hash map with
-// linear probing for collisions.
+// Insertion-ordered string-pair-to-void-star hash map: a typed wrapper around lhm_t
+// (see lhm.h).
 //
 // John Kerl 2014-12-22
 //
@@ -16,30 +16,31 @@
 #ifndef LHMS2V_H
 #define LHMS2V_H
 
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
 #include "containers/free_flags.h"
 
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhms2ve_t {
-	int   ideal_index;
+	unsigned hash;
+	struct _lhms2ve_t *pprev;
+	struct _lhms2ve_t *pnext;
 	char* key1;
 	char* key2;
 	void* pvvalue;
 	char  free_flags;
-	struct _lhms2ve_t *pprev;
-	struct _lhms2ve_t *pnext;
 } lhms2ve_t;
 
-typedef unsigned char lhms2ve_state_t;
-
 // ----------------------------------------------------------------
+// Has the layout of lhm_t.
 typedef struct _lhms2v_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhms2ve_t*       entries;
-	lhms2ve_state_t* states;
-	lhms2ve_t*       phead;
-	lhms2ve_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhms2ve_t*   entries;
+	hash_index_t index;
+	lhms2ve_t*   phead;
+	lhms2ve_t*   ptail;
 } lhms2v_t;
 
 lhms2v_t* lhms2v_alloc();
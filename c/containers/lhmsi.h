@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-to-int linked hash map with linear
-// probing for collisions.
+// Insertion-ordered string-to-int hash map: a typed wrapper around lhm_t
+// (see lhm.h).
 //
 // John Kerl 2012-08-13
 //
@@ -16,26 +16,28 @@
 #ifndef LHMSI_H
 #define LHMSI_H
 
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
+
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhmsie_t {
-	int   ideal_index;
+	unsigned hash;
+	struct _lhmsie_t *pprev;
+	struct _lhmsie_t *pnext;
 	char* key;
 	int value;
 	char  free_flags;
-	struct _lhmsie_t *pprev;
-	struct _lhmsie_t *pnext;
 } lhmsie_t;
 
-typedef unsigned char lhmsie_state_t;
-
+// Has the layout of lhm_t.
 typedef struct _lhmsi_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmsie_t*       entries;
-	lhmsie_state_t* states;
-	lhmsie_t*       phead;
-	lhmsie_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhmsie_t*    entries;
+	hash_index_t index;
+	lhmsie_t*    phead;
+	lhmsie_t*    ptail;
 } lhmsi_t;
 
 // ----------------------------------------------------------------
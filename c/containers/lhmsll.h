@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-to-int linked hash map with linear
-// probing for collisions.
+// Insertion-ordered string-to-long-long hash map: a typed wrapper around lhm_t
+// (see lhm.h).
 //
 // John Kerl 2012-08-13
 //
@@ -16,26 +16,28 @@
 #ifndef LHMSLL_H
 #define LHMSLL_H
 
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
+
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhmslle_t {
-	int   ideal_index;
+	unsigned hash;
+	struct _lhmslle_t *pprev;
+	struct _lhmslle_t *pnext;
 	char* key;
 	long long value;
 	char  free_flags;
-	struct _lhmslle_t *pprev;
-	struct _lhmslle_t *pnext;
 } lhmslle_t;
 
-typedef unsigned char lhmslle_state_t;
-
+// Has the layout of lhm_t.
 typedef struct _lhmsll_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmslle_t*       entries;
-	lhmslle_state_t* states;
-	lhmslle_t*       phead;
-	lhmslle_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhmslle_t*   entries;
+	hash_index_t index;
+	lhmslle_t*   phead;
+	lhmslle_t*   ptail;
 } lhmsll_t;
 
 // ----------------------------------------------------------------
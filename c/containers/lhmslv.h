@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-list-to-void-star linked hash map with
-// linear probing for collisions.
+// Insertion-ordered string-list-to-void-star hash map: a typed wrapper around lhm_t
+// (see lhm.h).
 //
 // John Kerl 2014-12-22
 //
@@ -16,29 +16,30 @@
 #ifndef LHMSLV_H
 #define LHMSLV_H
 
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
 #include "containers/slls.h"
 
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhmslve_t {
-	int     ideal_index;
+	unsigned hash;
+	struct _lhmslve_t *pprev;
+	struct _lhmslve_t *pnext;
 	slls_t* key;
 	void*   pvvalue;
 	char    free_flags;
-	struct _lhmslve_t *pprev;
-	struct _lhmslve_t *pnext;
 } lhmslve_t;
 
-typedef unsigned char lhmslve_state_t;
-
 // ----------------------------------------------------------------
+// Has the layout of lhm_t.
 typedef struct _lhmslv_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhmslve_t*       entries;
-	lhmslve_state_t* states;
-	lhmslve_t*       phead;
-	lhmslve_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhmslve_t*   entries;
+	hash_index_t index;
+	lhmslve_t*   phead;
+	lhmslve_t*   ptail;
 } lhmslv_t;
 
 lhmslv_t* lhmslv_alloc();
@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-to-mlrval linked hash map with linear
-// probing for collisions.
+// Insertion-ordered string-to-mlrval hash map: a typed wrapper around lhm_t
+// (see lhm.h).
 //
 // John Kerl 2012-08-13
 //
@@ -16,29 +16,30 @@
 #ifndef LHMSMV_H
 #define LHMSMV_H
 
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
 #include "containers/sllv.h"
 #include "containers/mlrval.h"
 
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhmsmve_t {
-	int   ideal_index;
+	unsigned hash;
+	struct _lhmsmve_t *pprev;
+	struct _lhmsmve_t *pnext;
 	char  free_flags;
 	char* key;
 	mv_t  value;
-	struct _lhmsmve_t *pprev;
-	struct _lhmsmve_t *pnext;
 } lhmsmve_t;
 
-typedef unsigned char lhmsmve_state_t;
-
+// Has the layout of lhm_t.
 typedef struct _lhmsmv_t {
-	int              num_occupied;
-	int              num_freed;
-	int              array_length;
-	lhmsmve_t*       entries;
-	lhmsmve_state_t* states;
-	lhmsmve_t*       phead;
-	lhmsmve_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhmsmve_t*   entries;
+	hash_index_t index;
+	lhmsmve_t*   phead;
+	lhmsmve_t*   ptail;
 } lhmsmv_t;
 
 // ----------------------------------------------------------------
@@ -1,6 +1,7 @@
 // ================================================================
-// Array-only (open addressing) string-to-string linked hash map with linear
-// probing for collisions.
+// Insertion-ordered string-to-string hash map: a typed wrapper around lhm_t
+// (see lhm.h). The entries are linked, for iteration from phead or ptail.
+// Entry pointers are invalidated when a put grows the map.
 //
 // John Kerl 2012-08-13
 //
@@ -17,27 +18,28 @@
 #define LHMSS_H
 
 #include "containers/sllv.h"
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
 
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhmsse_t {
-	int   ideal_index;
+	unsigned hash;
+	struct _lhmsse_t *pprev;
+	struct _lhmsse_t *pnext;
 	char  free_flags;
 	char* key;
 	char* value;
-	struct _lhmsse_t *pprev;
-	struct _lhmsse_t *pnext;
 } lhmsse_t;
 
-typedef unsigned char lhmsse_state_t;
-
+// Has the layout of lhm_t.
 typedef struct _lhmss_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmsse_t*       entries;
-	lhmsse_state_t* states;
-	lhmsse_t*       phead;
-	lhmsse_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhmsse_t*    entries;
+	hash_index_t index;
+	lhmsse_t*    phead;
+	lhmsse_t*    ptail;
 } lhmss_t;
 
 // ----------------------------------------------------------------
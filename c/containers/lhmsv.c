@@ -1,6 +1,5 @@
 // ================================================================
-// Array-only (open addressing) string-to-void linked hash map with linear
-// probing for collisions.
+// Insertion-ordered string-to-void hash map: a typed wrapper around lhm_t.
 //
 // Keys are not strduped; memory management of the void* values is left to the
 // caller.
@@ -22,54 +21,13 @@
 
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
+#include "containers/lhm.h"
 #include "containers/lhmsv.h"
 #include "containers/free_flags.h"
 
-// ----------------------------------------------------------------
-// Allow compile-time override, e.g using gcc -D.
-#ifndef INITIAL_ARRAY_LENGTH
-#define INITIAL_ARRAY_LENGTH 16
-#endif
-
-#ifndef LOAD_FACTOR
-#define LOAD_FACTOR          0.7
-#endif
-
-#ifndef ENLARGEMENT_FACTOR
-#define ENLARGEMENT_FACTOR   2
-#endif
-
-// ----------------------------------------------------------------
-#define OCCUPIED 0xa4
-#define DELETED  0xb8
-#define EMPTY    0xce
-
-// ----------------------------------------------------------------
-static void lhmsv_put_no_enlarge(lhmsv_t* pmap, char* key, void* pvvalue, char free_flags);
-static void lhmsv_enlarge(lhmsv_t* pmap);
-
-static void lhmsv_init(lhmsv_t *pmap, int length) {
-	pmap->num_occupied = 0;
-	pmap->num_freed    = 0;
-	pmap->array_length = length;
-
-	pmap->entries      = (lhmsve_t*)mlr_malloc_or_die(sizeof(lhmsve_t) * length);
-	// Don't do lhmsve_clear() of all entries at init time, since this has a
-	// drastic effect on the time needed to construct an empty map (and miller
-	// constructs an awful lot of those). The attributes there are don't-cares
-	// if the corresponding entry state is EMPTY. They are set on put, and
-	// mutated on remove.
-
-	pmap->states = (lhmsve_state_t*)mlr_malloc_or_die(sizeof(lhmsve_state_t) * length);
-	memset(pmap->states, EMPTY, length);
-
-	pmap->phead = NULL;
-	pmap->ptail = NULL;
-}
-
 lhmsv_t* lhmsv_alloc() {
 	lhmsv_t* pmap = mlr_malloc_or_die(sizeof(lhmsv_t));
-	lhmsv_init(pmap, INITIAL_ARRAY_LENGTH);
+	lhm_init((lhm_t*)pmap);
 	return pmap;
 }
 
@@ -81,12 +39,7 @@ void lhmsv_free(lhmsv_t* pmap) {
 		if (pe->free_flags & FREE_ENTRY_KEY)
 			free(pe->key);
 	}
-	free(pmap->entries);
-	free(pmap->states);
-	pmap->entries      = NULL;
-	pmap->num_occupied = 0;
-	pmap->num_freed    = 0;
-	pmap->array_length = 0;
+	lhm_uninit((lhm_t*)pmap);
 	free(pmap);
 }
 
@@ -97,197 +50,60 @@ void lhmsv_clear(lhmsv_t* pmap) {
 		if (pe->free_flags & FREE_ENTRY_KEY)
 			free(pe->key);
 	}
-	pmap->num_occupied = 0;
-	pmap->num_freed    = 0;
-	memset(pmap->states, EMPTY, pmap->array_length);
-	pmap->phead        = NULL;
-	pmap->ptail        = NULL;
+	lhm_clear((lhm_t*)pmap);
 }
 
 // ----------------------------------------------------------------
-// Used by get() and remove().
-// Returns >=0 for where the key is *or* should go (end of chain).
-static int lhmsv_find_index_for_key(lhmsv_t* pmap, char* key, int* pideal_index) {
-	int hash = mlr_string_hash_func(key);
-	int index = mlr_canonical_mod(hash, pmap->array_length);
-	*pideal_index = index;
-	int num_tries = 0;
-
-	while (TRUE) {
-		lhmsve_t* pe = &pmap->entries[index];
-		if (pmap->states[index] == OCCUPIED) {
-			char* ekey = pe->key;
-			// Existing key found in chain.
-			if (streq(key, ekey))
-				return index;
-		}
-		else if (pmap->states[index] == EMPTY) {
-			return index;
-		}
-
-		// If the current entry has been deleted, i.e. previously occupied,
-		// the sought index may be further down the chain.  So we must
-		// continue looking.
-		if (++num_tries >= pmap->array_length) {
-			fprintf(stderr,
-				"%s: internal coding error: table full even after enlargement.\n", MLR_GLOBALS.bargv0);
-			exit(1);
-		}
+static int lhmsv_key_matches(void* pentry, void* pkey) {
+	return streq(pkey, ((lhmsve_t*)pentry)->key);
+}
 
-		// Linear probing.
-		if (++index >= pmap->array_length)
-			index = 0;
-	}
-	MLR_INTERNAL_CODING_ERROR();
-	return -1; // not reached
+static lhmsve_t* lhmsv_find_entry(lhmsv_t* pmap, char* key, unsigned hash, hash_index_probe_t* pprobe) {
+	return lhm_find((lhm_t*)pmap, sizeof(lhmsve_t), key, hash, lhmsv_key_matches, pprobe);
 }
 
 // ----------------------------------------------------------------
 void lhmsv_put(lhmsv_t* pmap, char* key, void* pvvalue, char free_flags) {
-	if ((pmap->num_occupied + pmap->num_freed) >= (pmap->array_length*LOAD_FACTOR))
-		lhmsv_enlarge(pmap);
-	lhmsv_put_no_enlarge(pmap, key, pvvalue, free_flags);
-}
-
-static void lhmsv_put_no_enlarge(lhmsv_t* pmap, char* key, void* pvvalue, char free_flags) {
-	int ideal_index = 0;
-	int index = lhmsv_find_index_for_key(pmap, key, &ideal_index);
-	lhmsve_t* pe = &pmap->entries[index];
+	hash_index_probe_t probe;
+	unsigned hash = mlr_string_hash_func(key);
+	lhmsve_t* pe = lhmsv_find_entry(pmap, key, hash, &probe);
 
-	if (pmap->states[index] == OCCUPIED) {
-		// Existing key found in chain; put value.
+	if (pe != NULL) {
+		// Existing key found; put value.
 		pe->pvvalue = pvvalue;
-
-	} else if (pmap->states[index] == EMPTY) {
-		// End of chain.
-		pe->ideal_index = ideal_index;
-		pe->key = key;
-		pe->pvvalue = pvvalue;
-		pe->free_flags = free_flags;
-		pmap->states[index] = OCCUPIED;
-
-		if (pmap->phead == NULL) {
-			pe->pprev   = NULL;
-			pe->pnext   = NULL;
-			pmap->phead = pe;
-			pmap->ptail = pe;
-		} else {
-			pe->pprev   = pmap->ptail;
-			pe->pnext   = NULL;
-			pmap->ptail->pnext = pe;
-			pmap->ptail = pe;
-		}
-		pmap->num_occupied++;
-
-	} else {
-		fprintf(stderr, "%s: lhmsv_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
+		return;
 	}
+
+	pe = lhm_append((lhm_t*)pmap, sizeof(lhmsve_t), hash, &probe);
+	pe->key = key;
+	pe->pvvalue = pvvalue;
+	pe->free_flags = free_flags;
 }
 
 // ----------------------------------------------------------------
 void* lhmsv_get(lhmsv_t* pmap, char* key) {
-	int ideal_index = 0;
-	int index = lhmsv_find_index_for_key(pmap, key, &ideal_index);
-	lhmsve_t* pe = &pmap->entries[index];
-
-	if (pmap->states[index] == OCCUPIED)
-		return pe->pvvalue;
-	else if (pmap->states[index] == EMPTY)
-		return NULL;
-	else {
-		fprintf(stderr, "%s: lhmsv_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
+	hash_index_probe_t probe;
+	lhmsve_t* pe = lhmsv_find_entry(pmap, key, mlr_string_hash_func(key), &probe);
+	return (pe == NULL) ? NULL : pe->pvvalue;
 }
 
 // ----------------------------------------------------------------
 int  lhmsv_has_key(lhmsv_t* pmap, char* key) {
-	int ideal_index = 0;
-	int index = lhmsv_find_index_for_key(pmap, key, &ideal_index);
-
-	if (pmap->states[index] == OCCUPIED)
-		return TRUE;
-	else if (pmap->states[index] == EMPTY)
-		return FALSE;
-	else {
-		fprintf(stderr, "%s: lhmsv_find_index_for_key did not find end of chain.\n", MLR_GLOBALS.bargv0);
-		exit(1);
-	}
-}
-
-// ----------------------------------------------------------------
-static void lhmsv_enlarge(lhmsv_t* pmap) {
-	lhmsve_t*       old_entries = pmap->entries;
-	lhmsve_state_t* old_states  = pmap->states;
-	lhmsve_t*       old_head    = pmap->phead;
-
-	lhmsv_init(pmap, pmap->array_length*ENLARGEMENT_FACTOR);
-
-	for (lhmsve_t* pe = old_head; pe != NULL; pe = pe->pnext) {
-		lhmsv_put_no_enlarge(pmap, pe->key, pe->pvvalue, pe->free_flags);
-	}
-	free(old_entries);
-	free(old_states);
+	hash_index_probe_t probe;
+	return lhmsv_find_entry(pmap, key, mlr_string_hash_func(key), &probe) != NULL;
 }
 
 // ----------------------------------------------------------------
 int lhmsv_check_counts(lhmsv_t* pmap) {
-	int nocc = 0;
-	int ndel = 0;
-	for (int index = 0; index < pmap->array_length; index++) {
-		if (pmap->states[index] == OCCUPIED)
-			nocc++;
-		else if (pmap->states[index] == DELETED)
-			ndel++;
-	}
-	if (nocc != pmap->num_occupied) {
-		fprintf(stderr,
-			"occupancy-count mismatch:  actual %d != cached  %d.\n",
-				nocc, pmap->num_occupied);
-		return FALSE;
-	}
-	if (ndel != pmap->num_freed) {
-		fprintf(stderr,
-			"deleted-count mismatch:  actual %d != cached  %d.\n",
-				ndel, pmap->num_freed);
-		return FALSE;
-	}
-	return TRUE;
+	return lhm_check_counts((lhm_t*)pmap, sizeof(lhmsve_t));
 }
 
 // ----------------------------------------------------------------
-static char* get_state_name(int state) {
-	switch(state) {
-	case OCCUPIED: return "occupied"; break;
-	case DELETED:  return "deleted";  break;
-	case EMPTY:    return "empty";    break;
-	default:       return "?????";    break;
-	}
+static void lhmsv_print_entry(void* pentry) {
+	lhmsve_t* pe = pentry;
+	printf("key: %12s | pvvalue: %p |\n", pe->key == NULL ? "null" : pe->key, pe->pvvalue);
 }
 
 void lhmsv_print(lhmsv_t* pmap) {
-	for (int index = 0; index < pmap->array_length; index++) {
-		lhmsve_t* pe = &pmap->entries[index];
-
-		const char* key_string = (pe == NULL) ? "none" :
-			pe->key == NULL ? "null" :
-			pe->key;
-
-		printf(
-		"| stt: %-8s  | idx: %6d | nidx: %6d | key: %12s | pvvalue: %p |\n",
-			get_state_name(pmap->states[index]), index, pe->ideal_index, key_string, pe->pvvalue);
-	}
-	printf("+\n");
-	printf("| phead: %p | ptail %p\n", pmap->phead, pmap->ptail);
-	printf("+\n");
-	for (lhmsve_t* pe = pmap->phead; pe != NULL; pe = pe->pnext) {
-		const char* key_string = (pe == NULL) ? "none" :
-			pe->key == NULL ? "null" :
-			pe->key;
-		printf(
-		"| prev: %p curr: %p next: %p | nidx: %6d | key: %12s | pvvalue: %p |\n",
-			pe->pprev, pe, pe->pnext,
-			pe->ideal_index, key_string, pe->pvvalue);
-	}
+	lhm_print((lhm_t*)pmap, lhmsv_print_entry);
 }
@@ -1,6 +1,6 @@
 // ================================================================
-// Array-only (open addressing) string-to-void linked hash map with linear
-// probing for collisions.
+// Insertion-ordered string-to-void hash map: a typed wrapper around lhm_t
+// (see lhm.h).
 //
 // John Kerl 2012-08-13
 //
@@ -16,29 +16,30 @@
 #ifndef LHMSV_H
 #define LHMSV_H
 
+#include "containers/hash_index.h"
+#include "containers/lhm.h"
 #include "containers/sllv.h"
 #include "containers/free_flags.h"
 
 // ----------------------------------------------------------------
+// Begins as lhme_t does.
 typedef struct _lhmsve_t {
-	int   ideal_index;
+	unsigned hash;
+	struct _lhmsve_t *pprev;
+	struct _lhmsve_t *pnext;
 	char* key;
 	void* pvvalue;
 	char  free_flags;
-	struct _lhmsve_t *pprev;
-	struct _lhmsve_t *pnext;
 } lhmsve_t;
 
-typedef unsigned char lhmsve_state_t;
-
+// Has the layout of lhm_t.
 typedef struct _lhmsv_t {
-	int             num_occupied;
-	int             num_freed;
-	int             array_length;
-	lhmsve_t*       entries;
-	lhmsve_state_t* states;
-	lhmsve_t*       phead;
-	lhmsve_t*       ptail;
+	int          num_occupied;
+	int          num_allocated;
+	lhmsve_t*    entries;
+	hash_index_t index;
+	lhmsve_t*    phead;
+	lhmsve_t*    ptail;
 } lhmsv_t;
 
 // ----------------------------------------------------------------
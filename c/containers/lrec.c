@@ -16,6 +16,16 @@ static void lrec_unbacked_free(lrec_t* prec);
 static void lrec_free_single_line_backing(lrec_t* prec);
 static void lrec_free_csv_backing(lrec_t* prec);
 static void lrec_free_multiline_backing(lrec_t* prec);
+static void lrec_free_shared_backing(lrec_t* prec);
+
+// What a record owned before it was first copied, shared by it and its copies.
+typedef struct _lrec_shared_backing_t {
+	int     refcount;
+	char*   psingle_line;
+	slls_t* pxtab_lines;
+	char**  strings; // Keys and values which were to be freed with the record
+	int     num_strings;
+} lrec_shared_backing_t;
 
 // ----------------------------------------------------------------
 lrec_t* lrec_unbacked_alloc() {
@@ -97,15 +107,107 @@ void lrec_free(lrec_t* prec) {
 }
 
 // ----------------------------------------------------------------
+// Hands what the record owns to its shared backing, creating that on the first copy unless the record owns
+// nothing. Fields put since an earlier copy may own keys and values too; those are moved over on each copy.
+static void lrec_share_backing(lrec_t* prec) {
+	int num_owned = 0;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
+		if (pe->free_flags & FREE_ENTRY_KEY)
+			num_owned++;
+		if (pe->free_flags & FREE_ENTRY_VALUE)
+			num_owned++;
+	}
+
+	lrec_shared_backing_t* pshared = prec->pshared_backing;
+	if (pshared == NULL) {
+		if (prec->psingle_line == NULL && prec->pxtab_lines == NULL && num_owned == 0)
+			return;
+		pshared = mlr_malloc_or_die(sizeof(lrec_shared_backing_t));
+		pshared->refcount     = 1;
+		pshared->psingle_line = prec->psingle_line;
+		pshared->pxtab_lines  = prec->pxtab_lines;
+		pshared->strings      = NULL;
+		pshared->num_strings  = 0;
+
+		prec->psingle_line       = NULL;
+		prec->pxtab_lines        = NULL;
+		prec->pshared_backing    = pshared;
+		prec->pfree_backing_func = lrec_free_shared_backing;
+	}
+	if (num_owned == 0)
+		return;
+
+	pshared->strings = mlr_realloc_or_die(pshared->strings, (pshared->num_strings + num_owned) * sizeof(char*));
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
+		if (pe->free_flags & FREE_ENTRY_KEY)
+			pshared->strings[pshared->num_strings++] = pe->key;
+		if (pe->free_flags & FREE_ENTRY_VALUE)
+			pshared->strings[pshared->num_strings++] = pe->value;
+		pe->free_flags = NO_FREE;
+	}
+}
+
 lrec_t* lrec_copy(lrec_t* pinrec) {
+	lrec_share_backing(pinrec);
 	lrec_t* poutrec = lrec_unbacked_alloc();
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		lrec_put(poutrec, mlr_strdup_or_die(pe->key), mlr_strdup_or_die(pe->value),
-			FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+		lrece_t* pnew = mlr_malloc_or_die(sizeof(lrece_t));
+		pnew->key         = pe->key;
+		pnew->value       = pe->value;
+		pnew->free_flags  = NO_FREE;
+		pnew->quote_flags = 0;
+		lrec_link_at_tail(poutrec, pnew);
 	}
+	if (pinrec->pshared_backing != NULL) {
+		pinrec->pshared_backing->refcount++;
+		poutrec->pshared_backing    = pinrec->pshared_backing;
+		poutrec->pfree_backing_func = lrec_free_shared_backing;
+	}
+	poutrec->schema_id = pinrec->schema_id;
 	return poutrec;
 }
 
+// ----------------------------------------------------------------
+void lrec_compact(lrec_t* prec) {
+	if (prec->psingle_line == NULL && prec->pxtab_lines == NULL)
+		return;
+	// CSV keys are from the header, not the data line, so those not to be freed needn't be copied.
+	int keep_keys = prec->pfree_backing_func == lrec_free_csv_backing;
+
+	size_t length = 1; // Never zero, even for a record with no fields
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
+		if (!keep_keys || (pe->free_flags & FREE_ENTRY_KEY))
+			length += strlen(pe->key) + 1;
+		length += strlen(pe->value) + 1;
+	}
+
+	char* buffer = mlr_malloc_or_die(length);
+	char* p = buffer;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
+		if (!keep_keys || (pe->free_flags & FREE_ENTRY_KEY)) {
+			size_t n = strlen(pe->key) + 1;
+			memcpy(p, pe->key, n);
+			if (pe->free_flags & FREE_ENTRY_KEY)
+				free(pe->key);
+			pe->key = p;
+			p += n;
+		}
+		size_t n = strlen(pe->value) + 1;
+		memcpy(p, pe->value, n);
+		if (pe->free_flags & FREE_ENTRY_VALUE)
+			free(pe->value);
+		pe->value = p;
+		p += n;
+		pe->free_flags = NO_FREE;
+	}
+
+	prec->pfree_backing_func(prec);
+	prec->pxtab_lines = NULL;
+	prec->psingle_line = buffer;
+	if (!keep_keys)
+		prec->pfree_backing_func = lrec_free_single_line_backing;
+}
+
 // ----------------------------------------------------------------
 void lrec_put(lrec_t* prec, char* key, char* value, char free_flags) {
 	lrece_t* pe = lrec_find_entry(prec, key);
@@ -140,6 +242,7 @@ void lrec_put(lrec_t* prec, char* key, char* value, char free_flags) {
 			prec->ptail = pe;
 		}
 		prec->field_count++;
+		prec->schema_id = LREC_SCHEMA_UNKNOWN;
 	}
 }
 
@@ -176,6 +279,7 @@ void lrec_put_ext(lrec_t* prec, char* key, char* value, char free_flags, char qu
 			prec->ptail = pe;
 		}
 		prec->field_count++;
+		prec->schema_id = LREC_SCHEMA_UNKNOWN;
 	}
 }
 
@@ -209,6 +313,7 @@ void lrec_prepend(lrec_t* prec, char* key, char* value, char free_flags) {
 			prec->phead = pe;
 		}
 		prec->field_count++;
+		prec->schema_id = LREC_SCHEMA_UNKNOWN;
 	}
 }
 
@@ -245,6 +350,7 @@ lrece_t* lrec_put_after(lrec_t* prec, lrece_t* pd, char* key, char* value, char
 		}
 
 		prec->field_count++;
+		prec->schema_id = LREC_SCHEMA_UNKNOWN;
 	}
 	return pe;
 }
@@ -314,6 +420,7 @@ void lrec_rename(lrec_t* prec, char* old_key, char* new_key, int new_needs_freei
 
 	lrece_t* pold = lrec_find_entry(prec, old_key);
 	if (pold != NULL) {
+		prec->schema_id = LREC_SCHEMA_UNKNOWN;
 		lrece_t* pnew = lrec_find_entry(prec, new_key);
 
 		if (pnew == NULL) { // E.g. rename "x" to "y" when "y" is not present
@@ -385,6 +492,7 @@ void lrec_unlink(lrec_t* prec, lrece_t* pe) {
 		}
 	}
 	prec->field_count--;
+	prec->schema_id = LREC_SCHEMA_UNKNOWN;
 }
 
 void lrec_unlink_and_free(lrec_t* prec, lrece_t* pe) {
@@ -396,6 +504,16 @@ void lrec_unlink_and_free(lrec_t* prec, lrece_t* pe) {
 	free(pe);
 }
 
+// ----------------------------------------------------------------
+void lrec_stamp_header_schema(lrec_t* prec, header_keeper_t* pheader_keeper) {
+	slls_t* pkeys = pheader_keeper->pkeys;
+	if ((unsigned long long)prec->field_count != pkeys->length)
+		return;
+	if (prec->ptail != NULL && prec->ptail->key != pkeys->ptail->value)
+		return;
+	prec->schema_id = pheader_keeper->schema_id;
+}
+
 // ----------------------------------------------------------------
 static void lrec_link_at_head(lrec_t* prec, lrece_t* pe) {
 
@@ -412,6 +530,7 @@ static void lrec_link_at_head(lrec_t* prec, lrece_t* pe) {
 		prec->phead = pe;
 	}
 	prec->field_count++;
+	prec->schema_id = LREC_SCHEMA_UNKNOWN;
 }
 
 static void lrec_link_at_tail(lrec_t* prec, lrece_t* pe) {
@@ -428,6 +547,7 @@ static void lrec_link_at_tail(lrec_t* prec, lrece_t* pe) {
 		prec->ptail = pe;
 	}
 	prec->field_count++;
+	prec->schema_id = LREC_SCHEMA_UNKNOWN;
 }
 
 // ----------------------------------------------------------------
@@ -477,6 +597,18 @@ static void lrec_free_multiline_backing(lrec_t* prec) {
 	slls_free(prec->pxtab_lines);
 }
 
+static void lrec_free_shared_backing(lrec_t* prec) {
+	lrec_shared_backing_t* pshared = prec->pshared_backing;
+	if (--pshared->refcount > 0)
+		return;
+	free(pshared->psingle_line);
+	slls_free(pshared->pxtab_lines);
+	for (int i = 0; i < pshared->num_strings; i++)
+		free(pshared->strings[i]);
+	free(pshared->strings);
+	free(pshared);
+}
+
 // ----------------------------------------------------------------
 static char* static_nidx_keys[] = {
 	"0",   "1",  "2",  "3",  "4",  "5",  "6",  "7",  "8",  "9",
@@ -49,8 +49,11 @@
 
 #define FIELD_QUOTED_ON_INPUT 0x02
 
+#define LREC_SCHEMA_UNKNOWN 0LL
+
 struct _lrec_t; // forward reference
 typedef struct _lrec_t lrec_t;
+struct _lrec_shared_backing_t; // see lrec_copy
 
 typedef void lrec_free_func_t(lrec_t* prec);
 
@@ -87,6 +90,17 @@ struct _lrec_t {
 	// For XTAB format.
 	slls_t* pxtab_lines;
 
+	// For records sharing their keys and values with copies (see lrec_copy).
+	struct _lrec_shared_backing_t* pshared_backing;
+
+	//  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+	// Identifies the record's list of field names, for O(1) same-schema checks by
+	// writers and schema-grouping verbs. Two records with the same nonzero schema
+	// ID have the same field names in the same order. Readers set this when the
+	// field names come from a shared header (e.g. CSV); any lrec function which
+	// adds, removes, renames, or reorders fields resets it to LREC_SCHEMA_UNKNOWN.
+	unsigned long long schema_id;
+
 	//  - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	// Format-dependent virtual-function pointer:
 	lrec_free_func_t* pfree_backing_func;
@@ -102,8 +116,20 @@ lrec_t* lrec_xtab_alloc(slls_t* pxtab_lines);
 
 void lrec_clear(lrec_t* prec);
 void  lrec_free(lrec_t* prec);
+// The copy shares the original's keys and values rather than duplicating them: what the original owned (its
+// input line(s) and any separately allocated keys and values) is handed to a reference-counted backing shared
+// by both, and freed with the last of them. Either may then be modified without affecting the other, as lrec
+// functions replace keys and values rather than writing into them. Callers must not write into a key or value
+// in place, e.g. with strtok, without first copying it.
 lrec_t* lrec_copy(lrec_t* pinrec);
 
+// For verbs which retain records: copies the keys and values into one allocation, which becomes the record's
+// backing, and frees the input line(s) and any separately allocated keys and values. Then fields removed
+// upstream, e.g. by cut, no longer take up memory. CSV keys stay shared with the header. Records with no
+// backing, e.g. from mmapped input, are left as they are, as are records sharing a backing with copies. Any
+// pointers to the keys and values taken beforehand are invalidated.
+void lrec_compact(lrec_t* prec);
+
 // The only difference between lrec_put and lrec_prepend is that the latter
 // adds to the end of the record, while the former adds to the beginning.
 //
@@ -150,6 +176,10 @@ void lrec_unlink(lrec_t* prec, lrece_t* pe);
 // May be used for removing fields from a record while iterating over it:
 void lrec_unlink_and_free(lrec_t* prec, lrece_t* pe);
 
+// For readers: stamps the header's schema ID on a record pasted from that header, provided its field names
+// came out exactly as the header's (e.g. no duplicated header names, no ragged data lines).
+void lrec_stamp_header_schema(lrec_t* prec, header_keeper_t* pheader_keeper);
+
 void lrec_print(lrec_t* prec);
 void lrec_dump(lrec_t* prec);
 void lrec_dump_titled(char* msg, lrec_t* prec);
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/lrec_spill.h"
+
+// ----------------------------------------------------------------
+FILE* spill_file_open_or_die() {
+	char* dir = getenv("TMPDIR");
+	if (dir == NULL || *dir == 0)
+		dir = "/tmp";
+	char* path = mlr_paste_2_strings(dir, "/mlr-spill-XXXXXX");
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		perror("mkstemp");
+		fprintf(stderr, "%s: could not create temp file \"%s\".\n", MLR_GLOBALS.bargv0, path);
+		exit(1);
+	}
+	unlink(path);
+	FILE* fp = fdopen(fd, "w+b");
+	if (fp == NULL) {
+		perror("fdopen");
+		fprintf(stderr, "%s: could not open temp file \"%s\".\n", MLR_GLOBALS.bargv0, path);
+		exit(1);
+	}
+	free(path);
+	return fp;
+}
+
+// ----------------------------------------------------------------
+static int varint_length(unsigned long long u) {
+	int n = 1;
+	for ( ; u >= 0x80; u >>= 7)
+		n++;
+	return n;
+}
+
+static void varint_write(FILE* fp, unsigned long long u) {
+	for ( ; u >= 0x80; u >>= 7)
+		putc((int)(u & 0x7f) | 0x80, fp);
+	putc((int)u, fp);
+}
+
+void lrec_spill_write(FILE* fp, lrec_t* prec) {
+	unsigned long long payload_length = varint_length(prec->field_count);
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext)
+		payload_length += 1 + strlen(pe->key) + 1 + strlen(pe->value) + 1;
+
+	varint_write(fp, payload_length);
+	varint_write(fp, prec->field_count);
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
+		putc(pe->quote_flags, fp);
+		fputs(pe->key, fp);
+		putc(0, fp);
+		fputs(pe->value, fp);
+		putc(0, fp);
+	}
+	if (ferror(fp)) {
+		perror("fwrite");
+		fprintf(stderr, "%s: could not write temp file.\n", MLR_GLOBALS.bargv0);
+		exit(1);
+	}
+}
+
+// ----------------------------------------------------------------
+static void lrec_spill_read_error() {
+	fprintf(stderr, "%s: temp file read error or truncated temp file.\n", MLR_GLOBALS.bargv0);
+	exit(1);
+}
+
+// Returns FALSE at a clean end of file.
+static int varint_read(FILE* fp, unsigned long long* pu) {
+	unsigned long long u = 0LL;
+	for (int shift = 0; ; shift += 7) {
+		int c = getc(fp);
+		if (c == EOF) {
+			if (shift == 0 && !ferror(fp))
+				return FALSE;
+			lrec_spill_read_error();
+		}
+		u |= (unsigned long long)(c & 0x7f) << shift;
+		if ((c & 0x80) == 0)
+			break;
+	}
+	*pu = u;
+	return TRUE;
+}
+
+static lrec_t* lrec_spill_parse_payload(char* buffer, unsigned long long payload_length);
+
+lrec_t* lrec_spill_read(FILE* fp) {
+	unsigned long long payload_length = 0LL;
+	if (!varint_read(fp, &payload_length))
+		return NULL;
+
+	char* buffer = mlr_malloc_or_die(payload_length);
+	if (fread(buffer, 1, payload_length, fp) != payload_length)
+		lrec_spill_read_error();
+	return lrec_spill_parse_payload(buffer, payload_length);
+}
+
+// Returns FALSE if the varint runs to end.
+static int varint_decode(char** pp, char* end, unsigned long long* pu) {
+	unsigned long long u = 0LL;
+	char* p = *pp;
+	for (int shift = 0; ; shift += 7) {
+		if (p >= end || shift > 63)
+			return FALSE;
+		unsigned char c = *p++;
+		u |= (unsigned long long)(c & 0x7f) << shift;
+		if ((c & 0x80) == 0)
+			break;
+	}
+	*pp = p;
+	*pu = u;
+	return TRUE;
+}
+
+lrec_t* lrec_spill_decode(char* p, char* end, char** pnext) {
+	unsigned long long payload_length = 0LL;
+	if (!varint_decode(&p, end, &payload_length) || payload_length > (unsigned long long)(end - p))
+		lrec_spill_read_error();
+
+	char* buffer = mlr_malloc_or_die(payload_length);
+	memcpy(buffer, p, payload_length);
+	*pnext = p + payload_length;
+	return lrec_spill_parse_payload(buffer, payload_length);
+}
+
+// Mirrors lrec_spill_decode and lrec_spill_parse_payload.
+int lrec_spill_check(char* p, char* end, char** pnext) {
+	unsigned long long payload_length = 0LL;
+	if (!varint_decode(&p, end, &payload_length) || payload_length > (unsigned long long)(end - p))
+		return FALSE;
+	char* payload_end = p + payload_length;
+	if (payload_length == 0 || payload_end[-1] != 0)
+		return FALSE;
+	unsigned long long field_count = 0LL;
+	if (!varint_decode(&p, payload_end, &field_count))
+		return FALSE;
+	for (unsigned long long i = 0; i < field_count; i++) {
+		p++; // Quote flags
+		if (p >= payload_end)
+			return FALSE;
+		p += strlen(p) + 1;
+		if (p >= payload_end)
+			return FALSE;
+		p += strlen(p) + 1;
+	}
+	*pnext = payload_end;
+	return TRUE;
+}
+
+// Takes ownership of the buffer.
+static lrec_t* lrec_spill_parse_payload(char* buffer, unsigned long long payload_length) {
+	char* end = buffer + payload_length;
+	if (payload_length == 0 || end[-1] != 0) // Keeps the strlens below within the buffer
+		lrec_spill_read_error();
+
+	// The buffer is the record's single-line backing, freed with the record.
+	lrec_t* prec = lrec_dkvp_alloc(buffer);
+	char* p = buffer;
+	unsigned long long field_count = 0LL;
+	for (int shift = 0; ; shift += 7) {
+		if (p >= end)
+			lrec_spill_read_error();
+		unsigned char c = *p++;
+		field_count |= (unsigned long long)(c & 0x7f) << shift;
+		if ((c & 0x80) == 0)
+			break;
+	}
+	for (unsigned long long i = 0; i < field_count; i++) {
+		if (p >= end)
+			lrec_spill_read_error();
+		char quote_flags = *p++;
+		if (p >= end)
+			lrec_spill_read_error();
+		char* key = p;
+		p += strlen(key) + 1;
+		if (p >= end)
+			lrec_spill_read_error();
+		char* value = p;
+		p += strlen(value) + 1;
+		lrec_put_ext(prec, key, value, NO_FREE, quote_flags);
+	}
+	return prec;
+}
+
+// ----------------------------------------------------------------
+void spill_write_ull(FILE* fp, unsigned long long u) {
+	varint_write(fp, u);
+}
+
+int spill_read_ull(FILE* fp, unsigned long long* pu) {
+	return varint_read(fp, pu);
+}
+
+// ----------------------------------------------------------------
+long long lrec_memory_footprint(lrec_t* prec) {
+	long long size = sizeof(lrec_t);
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext)
+		size += sizeof(lrece_t) + strlen(pe->key) + 1 + strlen(pe->value) + 1;
+	return size;
+}
@@ -0,0 +1,42 @@
+// ================================================================
+// Spill files: records written to anonymous temp files in a compact binary
+// encoding, for verbs such as sort --max-memory which retain more records
+// than fit in memory. Each record is a varint payload length, then the
+// payload: a varint field count, then for each field a quote-flags byte, the
+// NUL-terminated key, and the NUL-terminated value. Reading back needs one
+// allocation per record, and keys and values point into it.
+//
+// Spill files are created in $TMPDIR (default /tmp) and unlinked at once, so
+// they are cleaned up by the OS however the process exits.
+// ================================================================
+
+#ifndef LREC_SPILL_H
+#define LREC_SPILL_H
+#include <stdio.h>
+#include "containers/lrec.h"
+
+// Opened for writing and reading. Succeeds or aborts the process.
+FILE* spill_file_open_or_die();
+
+// The record is not freed.
+void lrec_spill_write(FILE* fp, lrec_t* prec);
+
+// Returns NULL at end of file. Aborts the process on I/O error or truncated input.
+lrec_t* lrec_spill_read(FILE* fp);
+
+// As lrec_spill_read but from memory, e.g. an mmapped file, with the record's bytes running at most to
+// end. The record gets its own copy. Sets *pnext to just past the record.
+lrec_t* lrec_spill_decode(char* p, char* end, char** pnext);
+// Checks a record's encoding as lrec_spill_decode would decode it, e.g. before trusting a file written by
+// another process. Returns FALSE, rather than aborting, if it's malformed; else sets *pnext as decode does.
+int lrec_spill_check(char* p, char* end, char** pnext);
+
+// Varint tags, e.g. sequence numbers written ahead of records so that spilled outputs can be merged back
+// into input order. Reading returns FALSE at end of file.
+void spill_write_ull(FILE* fp, unsigned long long u);
+int  spill_read_ull(FILE* fp, unsigned long long* pu);
+
+// Rough count of heap bytes retained by the record, for memory-limit accounting.
+long long lrec_memory_footprint(lrec_t* prec);
+
+#endif // LREC_SPILL_H
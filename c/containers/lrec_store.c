@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
+#include "containers/lrec_spill.h"
+#include "containers/lrec_store.h"
+
+// ----------------------------------------------------------------
+lrec_store_t* lrec_store_alloc(long long max_memory) {
+	lrec_store_t* pstore = mlr_malloc_or_die(sizeof(lrec_store_t));
+	pstore->max_memory         = max_memory;
+	pstore->memory             = 0LL;
+	pstore->pgroups            = lhmslv_alloc();
+	pstore->pungrouped         = NULL;
+	pstore->fp                 = NULL;
+	pstore->pdirty_groups      = sllv_alloc();
+	pstore->reading            = FALSE;
+	pstore->reversed           = FALSE;
+	pstore->pnext_entry        = NULL;
+	pstore->ungrouped_done     = FALSE;
+	pstore->pgroup             = NULL;
+	pstore->extent_index       = 0;
+	pstore->num_left_in_extent = 0LL;
+	pstore->ploaded            = sllv_alloc();
+	return pstore;
+}
+
+static void lrec_store_group_free(lrec_store_group_t* pgroup) {
+	if (pgroup == NULL)
+		return;
+	for (sllve_t* pe = pgroup->precords->phead; pe != NULL; pe = pe->pnext)
+		lrec_free(pe->pvvalue);
+	sllv_free(pgroup->precords);
+	free(pgroup->extents);
+	free(pgroup);
+}
+
+void lrec_store_free(lrec_store_t* pstore) {
+	if (pstore == NULL)
+		return;
+	for (lhmslve_t* pe = pstore->pgroups->phead; pe != NULL; pe = pe->pnext)
+		lrec_store_group_free(pe->pvvalue);
+	lhmslv_free(pstore->pgroups);
+	lrec_store_group_free(pstore->pungrouped);
+	sllv_free(pstore->pdirty_groups);
+	for (sllve_t* pe = pstore->ploaded->phead; pe != NULL; pe = pe->pnext)
+		lrec_free(pe->pvvalue);
+	sllv_free(pstore->ploaded);
+	if (pstore->fp != NULL)
+		fclose(pstore->fp);
+	free(pstore);
+}
+
+// ----------------------------------------------------------------
+static lrec_store_group_t* lrec_store_group_alloc() {
+	lrec_store_group_t* pgroup = mlr_malloc_or_die(sizeof(lrec_store_group_t));
+	pgroup->precords      = sllv_alloc();
+	pgroup->extents       = NULL;
+	pgroup->num_extents   = 0;
+	pgroup->alloc_extents = 0;
+	return pgroup;
+}
+
+lrec_store_group_t* lrec_store_get_group(lrec_store_t* pstore, slls_t* pgroup_key) {
+	if (pgroup_key == NULL) {
+		if (pstore->pungrouped == NULL)
+			pstore->pungrouped = lrec_store_group_alloc();
+		return pstore->pungrouped;
+	}
+	lrec_store_group_t* pgroup = lhmslv_get(pstore->pgroups, pgroup_key);
+	if (pgroup == NULL) {
+		pgroup = lrec_store_group_alloc();
+		lhmslv_put(pstore->pgroups, slls_copy(pgroup_key), pgroup, FREE_ENTRY_KEY);
+	}
+	return pgroup;
+}
+
+// ----------------------------------------------------------------
+static void lrec_store_group_spill(FILE* fp, lrec_store_group_t* pgroup) {
+	if (pgroup->num_extents >= pgroup->alloc_extents) {
+		pgroup->alloc_extents = (pgroup->alloc_extents == 0) ? 4 : 2 * pgroup->alloc_extents;
+		pgroup->extents = mlr_realloc_or_die(pgroup->extents, pgroup->alloc_extents * sizeof(lrec_store_extent_t));
+	}
+	lrec_store_extent_t* pextent = &pgroup->extents[pgroup->num_extents++];
+	pextent->offset = ftell(fp);
+	pextent->count  = pgroup->precords->length;
+	lrec_t* prec;
+	while ((prec = sllv_pop(pgroup->precords)) != NULL) {
+		lrec_spill_write(fp, prec);
+		lrec_free(prec);
+	}
+}
+
+static void lrec_store_spill(lrec_store_t* pstore) {
+	if (pstore->fp == NULL)
+		pstore->fp = spill_file_open_or_die();
+	lrec_store_group_t* pgroup;
+	while ((pgroup = sllv_pop(pstore->pdirty_groups)) != NULL)
+		lrec_store_group_spill(pstore->fp, pgroup);
+	pstore->memory = 0LL;
+}
+
+void lrec_store_append(lrec_store_t* pstore, lrec_store_group_t* pgroup, lrec_t* prec) {
+	MLR_INTERNAL_CODING_ERROR_IF(pstore->reading);
+	lrec_compact(prec);
+	if (pstore->max_memory > 0LL && pgroup->precords->length == 0)
+		sllv_append(pstore->pdirty_groups, pgroup);
+	sllv_append(pgroup->precords, prec);
+	if (pstore->max_memory > 0LL) {
+		pstore->memory += lrec_memory_footprint(prec);
+		if (pstore->memory > pstore->max_memory)
+			lrec_store_spill(pstore);
+	}
+}
+
+// ----------------------------------------------------------------
+// Keyed groups then the ungrouped one; the reverse of that when reading last to first.
+static lrec_store_group_t* lrec_store_advance_group(lrec_store_t* pstore) {
+	if (pstore->reversed && !pstore->ungrouped_done) {
+		pstore->ungrouped_done = TRUE;
+		if (pstore->pungrouped != NULL)
+			return pstore->pungrouped;
+	}
+	if (pstore->pnext_entry != NULL) {
+		lhmslve_t* pe = pstore->pnext_entry;
+		pstore->pnext_entry = pstore->reversed ? pe->pprev : pe->pnext;
+		return pe->pvvalue;
+	}
+	if (!pstore->ungrouped_done) {
+		pstore->ungrouped_done = TRUE;
+		return pstore->pungrouped;
+	}
+	return NULL;
+}
+
+static void lrec_store_start_group(lrec_store_t* pstore) {
+	lrec_store_group_t* pgroup = pstore->pgroup;
+	pstore->num_left_in_extent = 0LL;
+	if (pgroup == NULL)
+		return;
+	if (pstore->reversed) {
+		// The in-memory records come last, so they are read first.
+		sllv_reverse(pgroup->precords);
+		sllv_transfer(pstore->ploaded, pgroup->precords);
+		pstore->extent_index = pgroup->num_extents;
+	} else {
+		pstore->extent_index = 0;
+	}
+}
+
+static void lrec_store_start_reading(lrec_store_t* pstore, int reversed) {
+	if (pstore->reading) {
+		MLR_INTERNAL_CODING_ERROR_IF(pstore->reversed != reversed);
+		return;
+	}
+	pstore->reading = TRUE;
+	pstore->reversed = reversed;
+	pstore->pnext_entry = reversed ? pstore->pgroups->ptail : pstore->pgroups->phead;
+	pstore->pgroup = lrec_store_advance_group(pstore);
+	lrec_store_start_group(pstore);
+}
+
+static void lrec_store_seek_extent(lrec_store_t* pstore, lrec_store_extent_t* pextent) {
+	if (fseek(pstore->fp, pextent->offset, SEEK_SET) != 0) {
+		perror("fseek");
+		fprintf(stderr, "%s: could not seek in temp file.\n", MLR_GLOBALS.bargv0);
+		exit(1);
+	}
+	pstore->num_left_in_extent = pextent->count;
+}
+
+static lrec_t* lrec_store_read_or_die(lrec_store_t* pstore) {
+	lrec_t* prec = lrec_spill_read(pstore->fp);
+	if (prec == NULL) {
+		fprintf(stderr, "%s: truncated temp file.\n", MLR_GLOBALS.bargv0);
+		exit(1);
+	}
+	pstore->num_left_in_extent--;
+	return prec;
+}
+
+lrec_t* lrec_store_next(lrec_store_t* pstore) {
+	lrec_store_start_reading(pstore, FALSE);
+	while (pstore->pgroup != NULL) {
+		lrec_store_group_t* pgroup = pstore->pgroup;
+		if (pstore->num_left_in_extent > 0LL)
+			return lrec_store_read_or_die(pstore);
+		if (pstore->extent_index < pgroup->num_extents) {
+			lrec_store_seek_extent(pstore, &pgroup->extents[pstore->extent_index++]);
+			continue;
+		}
+		lrec_t* prec = sllv_pop(pgroup->precords);
+		if (prec != NULL)
+			return prec;
+		pstore->pgroup = lrec_store_advance_group(pstore);
+		lrec_store_start_group(pstore);
+	}
+	return NULL;
+}
+
+lrec_t* lrec_store_prev(lrec_store_t* pstore) {
+	lrec_store_start_reading(pstore, TRUE);
+	while (pstore->pgroup != NULL) {
+		lrec_t* prec = sllv_pop(pstore->ploaded);
+		if (prec != NULL)
+			return prec;
+		if (pstore->extent_index > 0) {
+			lrec_store_seek_extent(pstore, &pstore->pgroup->extents[--pstore->extent_index]);
+			while (pstore->num_left_in_extent > 0LL)
+				sllv_push(pstore->ploaded, lrec_store_read_or_die(pstore));
+			continue;
+		}
+		pstore->pgroup = lrec_store_advance_group(pstore);
+		lrec_store_start_group(pstore);
+	}
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+sllv_t* lrec_store_next_batch(lrec_store_t* pstore, int reversed, context_t* pctx) {
+	sllv_t* poutrecs = sllv_alloc();
+	// Records all in memory go out at once, as they would without a store, so verbs after this one do all
+	// their end-of-stream processing before any of them is written.
+	while (pstore->fp == NULL || poutrecs->length < LREC_STORE_BATCH_SIZE) {
+		lrec_t* prec = reversed ? lrec_store_prev(pstore) : lrec_store_next(pstore);
+		if (prec == NULL) {
+			sllv_append(poutrecs, NULL); // Signal end of output-record stream.
+			return poutrecs;
+		}
+		sllv_append(poutrecs, prec);
+	}
+	pctx->more_output = TRUE;
+	return poutrecs;
+}
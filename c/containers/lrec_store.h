@@ -0,0 +1,75 @@
+// ================================================================
+// Record store for verbs which retain their input until end of stream, e.g.
+// tac and group-by. Records are appended to groups, then read back group by
+// group, in order of each group's first append, and within each group in
+// order of append; or else all of them last to first. Records appended with
+// no group key form a group of their own, read after all the others.
+//
+// With a memory limit, once the retained records exceed it they are written
+// out to a spill file (see lrec_spill.h) group by group, as one extent per
+// group, and memory is emptied. Reading a group then takes its spilled
+// extents in turn, then its records still in memory. Reading last to first
+// loads one extent at a time, so either way about the limit is in memory.
+// ================================================================
+
+#ifndef LREC_STORE_H
+#define LREC_STORE_H
+#include <stdio.h>
+#include "lib/context.h"
+#include "containers/lrec.h"
+#include "containers/slls.h"
+#include "containers/sllv.h"
+#include "containers/lhmslv.h"
+
+#define LREC_STORE_BATCH_SIZE 1000
+
+typedef struct _lrec_store_extent_t {
+	long               offset;
+	unsigned long long count;
+} lrec_store_extent_t;
+
+typedef struct _lrec_store_group_t {
+	sllv_t*              precords; // Not spilled
+	lrec_store_extent_t* extents;  // Spilled, in order of append
+	int                  num_extents;
+	int                  alloc_extents;
+} lrec_store_group_t;
+
+typedef struct _lrec_store_t {
+	long long           max_memory;  // Spill threshold in bytes; zero for none
+	long long           memory;      // Estimated bytes of records in memory
+	lhmslv_t*           pgroups;     // Keyed by group-by values
+	lrec_store_group_t* pungrouped;  // NULL until there are records with no group key
+	FILE*               fp;          // Spill file, or NULL if none
+	sllv_t*             pdirty_groups; // With a limit: groups having records in memory, to spill
+	// Read state
+	int                 reading;
+	int                 reversed;
+	lhmslve_t*          pnext_entry; // Next keyed group to read
+	int                 ungrouped_done;
+	lrec_store_group_t* pgroup;      // Group being read, or NULL when done
+	int                 extent_index;
+	unsigned long long  num_left_in_extent;
+	sllv_t*             ploaded;     // Reading last to first: the current extent's records
+} lrec_store_t;
+
+lrec_store_t* lrec_store_alloc(long long max_memory);
+// Records not yet read are freed.
+void lrec_store_free(lrec_store_t* pstore);
+
+// Returns the group for the key, making a new one if need be, with a copy of the key. A NULL key gets the
+// group for records with no group key. The group may be kept for further appends.
+lrec_store_group_t* lrec_store_get_group(lrec_store_t* pstore, slls_t* pgroup_key);
+// The store takes ownership of the record, and compacts it (see lrec.h). Not allowed once reading has started.
+void lrec_store_append(lrec_store_t* pstore, lrec_store_group_t* pgroup, lrec_t* prec);
+
+// Returns NULL after the last record. The caller owns each record.
+lrec_t* lrec_store_next(lrec_store_t* pstore);
+lrec_t* lrec_store_prev(lrec_store_t* pstore);
+
+// For a mapper's end-of-stream output: the next records, last to first if reversed, up to a batch of them if
+// any were spilled, else all of them. If there are more, sets more_output in the context (see context.h), else
+// ends the batch with NULL.
+sllv_t* lrec_store_next_batch(lrec_store_t* pstore, int reversed, context_t* pctx);
+
+#endif // LREC_STORE_H
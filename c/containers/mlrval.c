@@ -456,12 +456,11 @@ static mv_binary_func_t* dot_dispositions[MT_DIM][MT_DIM] = {
 mv_t s_xx_dot_func(mv_t* pval1, mv_t* pval2) { return (dot_dispositions[pval1->type][pval2->type])(pval1,pval2); }
 
 // ----------------------------------------------------------------
+// arg2 evaluates to string via compound expression; regexes are compiled via the regex cache.
 mv_t sub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3) {
-	regex_t regex;
 	string_builder_t *psb = sb_alloc(MV_SB_ALLOC_LENGTH);
-	mv_t rv = sub_precomp_func(pval1, regcomp_or_die(&regex, pval2->u.strv, 0), psb, pval3);
+	mv_t rv = sub_precomp_func(pval1, regcache_get_or_die(pval2->u.strv, 0), psb, pval3);
 	sb_free(psb);
-	regfree(&regex);
 	mv_free(pval2);
 	return rv;
 }
@@ -507,11 +506,9 @@ mv_t sub_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t*
 // *  len4 = 6 = 2+3+1
 
 mv_t gsub_no_precomp_func(mv_t* pval1, mv_t* pval2, mv_t* pval3) {
-	regex_t regex;
 	string_builder_t *psb = sb_alloc(MV_SB_ALLOC_LENGTH);
-	mv_t rv = gsub_precomp_func(pval1, regcomp_or_die(&regex, pval2->u.strv, 0), psb, pval3);
+	mv_t rv = gsub_precomp_func(pval1, regcache_get_or_die(pval2->u.strv, 0), psb, pval3);
 	sb_free(psb);
-	regfree(&regex);
 	mv_free(pval2);
 	return rv;
 }
@@ -2182,6 +2179,34 @@ mv_t ge_op_func(mv_t* pval1, mv_t* pval2) { return (ge_dispositions[pval1->type]
 mv_t lt_op_func(mv_t* pval1, mv_t* pval2) { return (lt_dispositions[pval1->type][pval2->type])(pval1, pval2); }
 mv_t le_op_func(mv_t* pval1, mv_t* pval2) { return (le_dispositions[pval1->type][pval2->type])(pval1, pval2); }
 
+// ----------------------------------------------------------------
+// For type-specialized DSL evaluators: given one of the disposition-matrix
+// entry points above, and argument types known ahead of time, returns the
+// matrix leaf which would be invoked for them. Returns NULL for functions
+// not dispatched via a disposition matrix.
+mv_binary_func_t* mv_get_binary_disposition(mv_binary_func_t* pfunc, int type1, int type2) {
+	if (type1 < 0 || type1 >= MT_DIM || type2 < 0 || type2 >= MT_DIM)
+		return NULL;
+	if      (pfunc == x_xx_plus_func)       return plus_dispositions[type1][type2];
+	else if (pfunc == x_xx_minus_func)      return minus_dispositions[type1][type2];
+	else if (pfunc == x_xx_times_func)      return times_dispositions[type1][type2];
+	else if (pfunc == x_xx_divide_func)     return divide_dispositions[type1][type2];
+	else if (pfunc == x_xx_int_divide_func) return idiv_dispositions[type1][type2];
+	else if (pfunc == x_xx_mod_func)        return mod_dispositions[type1][type2];
+	else if (pfunc == x_xx_band_func)       return band_dispositions[type1][type2];
+	else if (pfunc == x_xx_bor_func)        return bor_dispositions[type1][type2];
+	else if (pfunc == x_xx_bxor_func)       return bxor_dispositions[type1][type2];
+	else if (pfunc == x_xx_roundm_func)     return roundm_dispositions[type1][type2];
+	else if (pfunc == s_xx_dot_func)        return dot_dispositions[type1][type2];
+	else if (pfunc == eq_op_func)           return eq_dispositions[type1][type2];
+	else if (pfunc == ne_op_func)           return ne_dispositions[type1][type2];
+	else if (pfunc == gt_op_func)           return gt_dispositions[type1][type2];
+	else if (pfunc == ge_op_func)           return ge_dispositions[type1][type2];
+	else if (pfunc == lt_op_func)           return lt_dispositions[type1][type2];
+	else if (pfunc == le_op_func)           return le_dispositions[type1][type2];
+	else                                    return NULL;
+}
+
 // ----------------------------------------------------------------
 int mv_equals_si(mv_t* pa, mv_t* pb) {
 	if (pa->type == MT_INT) {
@@ -2319,35 +2344,14 @@ int mvnecopy(mv_t* pval1, mv_t* pval2) {
 }
 
 // ----------------------------------------------------------------
-// arg2 evaluates to string via compound expression; regexes compiled on each call.
-mv_t matches_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures) {
-	char* s1 = pval1->u.strv;
-	char* s2 = pval2->u.strv;
-
-	regex_t regex;
-	char* sstr   = s1;
-	char* sregex = s2;
-
-	regcomp_or_die(&regex, sregex, REG_NOSUB);
-
-	const size_t nmatchmax = 10; // Capture-groups \1 through \9 supported, along with entire-string match
-	regmatch_t matches[nmatchmax];
-	if (regmatch_or_die(&regex, sstr, nmatchmax, matches)) {
-		if (ppregex_captures != NULL && *ppregex_captures != NULL)
-			save_regex_captures(ppregex_captures, pval1->u.strv, matches, nmatchmax);
-		regfree(&regex);
-		mv_free(pval1);
-		mv_free(pval2);
-		return mv_from_true();
-	} else {
-		regfree(&regex);
-		mv_free(pval1);
-		mv_free(pval2);
-		return mv_from_false();
-	}
+// arg2 evaluates to string via compound expression; regexes are compiled via the regex cache.
+mv_t matches_no_precomp_func(mv_t* pval1, mv_t* pval2, regex_captures_t** ppregex_captures) {
+	regex_t* pregex = regcache_get_or_die(pval2->u.strv, 0);
+	mv_free(pval2);
+	return matches_precomp_func(pval1, pregex, NULL, ppregex_captures);
 }
 
-mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures) {
+mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, regex_captures_t** ppregex_captures) {
 	mv_t rv = matches_no_precomp_func(pval1, pval2, ppregex_captures);
 	rv.u.boolv = !rv.u.boolv;
 	return rv;
@@ -2355,8 +2359,8 @@ mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** p
 
 // ----------------------------------------------------------------
 // arg2 is a string, compiled to regex only once at alloc time
-mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures) {
-	const size_t nmatchmax = 10; // Capture-groups \1 through \9 supported, along with entire-string match
+mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, regex_captures_t** ppregex_captures) {
+	const size_t nmatchmax = REGEX_CAPTURES_MAX; // Capture-groups \1 through \9, along with entire-string match
 	regmatch_t matches[nmatchmax];
 	if (regmatch_or_die(pregex, pval1->u.strv, nmatchmax, matches)) {
 		if (ppregex_captures != NULL)
@@ -2367,18 +2371,14 @@ mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, s
 		// See comments in mapper_put.c. Setting this array to length 0 (i.e. zero matches) signals to the
 		// lrec-evaluator's from-literal function that we *are* in a regex-match context but there are *no* matches to
 		// be interpolated.
-		if (ppregex_captures != NULL) {
-			if (*ppregex_captures != NULL)
-				string_array_realloc(*ppregex_captures, 0);
-			else
-				*ppregex_captures = string_array_alloc(0);
-		}
+		if (ppregex_captures != NULL)
+			save_regex_captures_no_match(ppregex_captures);
 		mv_free(pval1);
 		return mv_from_false();
 	}
 }
 
-mv_t does_not_match_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures) {
+mv_t does_not_match_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, regex_captures_t** ppregex_captures) {
 	mv_t rv = matches_precomp_func(pval1, pregex, psb, ppregex_captures);
 	rv.u.boolv = !rv.u.boolv;
 	return rv;
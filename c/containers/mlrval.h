@@ -10,6 +10,7 @@
 #include "../lib/mtrand.h"
 #include "../lib/string_builder.h"
 #include "../lib/string_array.h"
+#include "../lib/mlrregex.h"
 #include "../containers/free_flags.h"
 
 // ================================================================
@@ -284,8 +285,8 @@ typedef mv_t mv_variadic_func_t(mv_t* pvals, int nvals);
 typedef mv_t mv_zary_func_t();
 typedef mv_t mv_unary_func_t(mv_t* pval1);
 typedef mv_t mv_binary_func_t(mv_t* pval1, mv_t* pval2);
-typedef mv_t mv_binary_arg3_capture_func_t(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures);
-typedef mv_t mv_binary_arg2_regex_func_t(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
+typedef mv_t mv_binary_arg3_capture_func_t(mv_t* pval1, mv_t* pval2, regex_captures_t** ppregex_captures);
+typedef mv_t mv_binary_arg2_regex_func_t(mv_t* pval1, regex_t* pregex, string_builder_t* psb, regex_captures_t** ppregex_captures);
 typedef mv_t mv_ternary_func_t(mv_t* pval1, mv_t* pval2, mv_t* pval3);
 typedef mv_t mv_ternary_arg2_regex_func_t(mv_t* pval1, regex_t* pregex, string_builder_t* psb, mv_t* pval3);
 
@@ -487,11 +488,11 @@ mv_t time_string_from_seconds(mv_t* psec, char* format);
 
 // ----------------------------------------------------------------
 // arg2 evaluates to string via compound expression; regexes compiled on each call
-mv_t matches_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures);
-mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, string_array_t** ppregex_captures);
+mv_t matches_no_precomp_func(mv_t* pval1, mv_t* pval2, regex_captures_t** ppregex_captures);
+mv_t does_not_match_no_precomp_func(mv_t* pval1, mv_t* pval2, regex_captures_t** ppregex_captures);
 // arg2 is a string, compiled to regex only once at alloc time
-mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
-mv_t does_not_match_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, string_array_t** ppregex_captures);
+mv_t matches_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, regex_captures_t** ppregex_captures);
+mv_t does_not_match_precomp_func(mv_t* pval1, regex_t* pregex, string_builder_t* psb, regex_captures_t** ppregex_captures);
 
 // For filter/put DSL:
 mv_t eq_op_func(mv_t* pval1, mv_t* pval2);
@@ -501,6 +502,11 @@ mv_t ge_op_func(mv_t* pval1, mv_t* pval2);
 mv_t lt_op_func(mv_t* pval1, mv_t* pval2);
 mv_t le_op_func(mv_t* pval1, mv_t* pval2);
 
+// Returns the disposition-matrix leaf which the given binary function (e.g.
+// x_xx_plus_func or eq_op_func) dispatches to for the given argument types, or
+// NULL if the function isn't matrix-dispatched.
+mv_binary_func_t* mv_get_binary_disposition(mv_binary_func_t* pfunc, int type1, int type2);
+
 // Assumes inputs are MT_STRING or MT_INT. Nominally intended for mlhmmv which uses only string/int mlrvals.
 int mv_equals_si(mv_t* pa, mv_t* pb);
 
@@ -5,15 +5,19 @@
 
 #define INITIAL_CAPACITY 10000
 #define GROWTH_FACTOR    2.0
+#define INITIAL_SELECTED_CAPACITY 16
+#define INSERTION_SORT_THRESHOLD  16
 
 // ----------------------------------------------------------------
 percentile_keeper_t* percentile_keeper_alloc() {
-	int capacity = INITIAL_CAPACITY;
 	percentile_keeper_t* ppercentile_keeper = mlr_malloc_or_die(sizeof(percentile_keeper_t));
-	ppercentile_keeper->data     = mlr_malloc_or_die(capacity*sizeof(mv_t));
-	ppercentile_keeper->size     = 0;
-	ppercentile_keeper->capacity = capacity;
-	ppercentile_keeper->sorted   = FALSE;
+	ppercentile_keeper->storage            = PK_STORE_INTS;
+	ppercentile_keeper->data.intvs         = NULL;
+	ppercentile_keeper->size               = 0;
+	ppercentile_keeper->capacity           = 0;
+	ppercentile_keeper->selected           = mlr_malloc_or_die(INITIAL_SELECTED_CAPACITY * sizeof(int));
+	ppercentile_keeper->num_selected       = 0;
+	ppercentile_keeper->selected_capacity  = INITIAL_SELECTED_CAPACITY;
 	return ppercentile_keeper;
 }
 
@@ -21,22 +25,60 @@ percentile_keeper_t* percentile_keeper_alloc() {
 void percentile_keeper_free(percentile_keeper_t* ppercentile_keeper) {
 	if (ppercentile_keeper == NULL)
 		return;
-	free(ppercentile_keeper->data);
-	ppercentile_keeper->data = NULL;
+	free(ppercentile_keeper->data.intvs);
+	ppercentile_keeper->data.intvs = NULL;
 	ppercentile_keeper->size = 0;
 	ppercentile_keeper->capacity = 0;
+	free(ppercentile_keeper->selected);
 	free(ppercentile_keeper);
 }
 
 // ----------------------------------------------------------------
+// Capacities are in elements, so carry over.
+static void percentile_keeper_convert_to_mixed(percentile_keeper_t* ppercentile_keeper) {
+	mv_t* mvs = mlr_malloc_or_die(ppercentile_keeper->capacity * sizeof(mv_t));
+	for (int i = 0; i < ppercentile_keeper->size; i++) {
+		mvs[i] = (ppercentile_keeper->storage == PK_STORE_INTS)
+			? mv_from_int(ppercentile_keeper->data.intvs[i])
+			: mv_from_float(ppercentile_keeper->data.fltvs[i]);
+	}
+	free(ppercentile_keeper->data.intvs);
+	ppercentile_keeper->data.mvs = mvs;
+	ppercentile_keeper->storage = PK_STORE_MIXED;
+}
+
 void percentile_keeper_ingest(percentile_keeper_t* ppercentile_keeper, mv_t value) {
+	if (ppercentile_keeper->size == 0 && ppercentile_keeper->storage != PK_STORE_MIXED) {
+		ppercentile_keeper->storage = (value.type == MT_FLOAT) ? PK_STORE_FLOATS
+			: (value.type == MT_INT) ? PK_STORE_INTS
+			: PK_STORE_MIXED;
+	} else if ((ppercentile_keeper->storage == PK_STORE_INTS && value.type != MT_INT)
+		|| (ppercentile_keeper->storage == PK_STORE_FLOATS && value.type != MT_FLOAT))
+	{
+		percentile_keeper_convert_to_mixed(ppercentile_keeper);
+	}
+
 	if (ppercentile_keeper->size >= ppercentile_keeper->capacity) {
-		ppercentile_keeper->capacity = (int)(ppercentile_keeper->capacity * GROWTH_FACTOR);
-		ppercentile_keeper->data = (mv_t*)mlr_realloc_or_die(ppercentile_keeper->data,
-			ppercentile_keeper->capacity*sizeof(mv_t));
+		ppercentile_keeper->capacity = (ppercentile_keeper->capacity == 0)
+			? INITIAL_CAPACITY
+			: (int)(ppercentile_keeper->capacity * GROWTH_FACTOR);
+		size_t element_size = (ppercentile_keeper->storage == PK_STORE_MIXED) ? sizeof(mv_t) : sizeof(double);
+		ppercentile_keeper->data.intvs = mlr_realloc_or_die(ppercentile_keeper->data.intvs,
+			ppercentile_keeper->capacity * element_size);
+	}
+
+	switch (ppercentile_keeper->storage) {
+	case PK_STORE_INTS:
+		ppercentile_keeper->data.intvs[ppercentile_keeper->size++] = value.u.intv;
+		break;
+	case PK_STORE_FLOATS:
+		ppercentile_keeper->data.fltvs[ppercentile_keeper->size++] = value.u.fltv;
+		break;
+	default:
+		ppercentile_keeper->data.mvs[ppercentile_keeper->size++] = value;
+		break;
 	}
-	ppercentile_keeper->data[ppercentile_keeper->size++] = value;
-	ppercentile_keeper->sorted = FALSE;
+	ppercentile_keeper->num_selected = 0;
 }
 
 // ================================================================
@@ -221,22 +263,112 @@ static int compute_index_non_interpolated(int n, double p) {
 	return index;
 }
 
-static mv_t get_percentile_linearly_interpolated(mv_t* array, int n, double p) {
-	double findex = (p/100.0)*(n-1);
-	if (findex < 0)
-		findex = 0;
-	int iindex = (int)floor(findex);
-	if (iindex >= n-1) {
-		return array[iindex];
-	} else {
-		// array[iindex] + frac * (array[iindex+1] - array[iindex]);
-		mv_t frac = mv_from_float(findex - iindex);
-		mv_t* pa = &array[iindex];
-		mv_t* pb = &array[iindex+1];
-		mv_t diff = x_xx_minus_func(pb, pa);
-		mv_t prod = x_xx_times_func(&frac, &diff);
-		mv_t rv = x_xx_plus_func(pa, &prod);
-		return rv;
+// ----------------------------------------------------------------
+// Introselect: quickselect with median-of-three pivots, falling back to sorting the remaining range if the
+// partitions are persistently lopsided. Afterward a[k] holds the k-th smallest of a[lo..hi], with nothing
+// greater before it and nothing less after it.
+#define PERCENTILE_KEEPER_DEFINE_SELECT(SUFFIX, TYPE, LESS) \
+static int compare_##SUFFIX(const void* pva, const void* pvb) { \
+	const TYPE* pa = pva; \
+	const TYPE* pb = pvb; \
+	return LESS(*pa, *pb) ? -1 : LESS(*pb, *pa) ? 1 : 0; \
+} \
+static void select_##SUFFIX(TYPE* a, int lo, int hi, int k) { \
+	int depth_limit = 2; \
+	for (int n = hi - lo + 1; n > 1; n >>= 1) \
+		depth_limit += 2; \
+	while (hi - lo >= INSERTION_SORT_THRESHOLD) { \
+		if (depth_limit-- == 0) { \
+			qsort(&a[lo], hi - lo + 1, sizeof(TYPE), compare_##SUFFIX); \
+			return; \
+		} \
+		int mid = lo + (hi - lo) / 2; \
+		TYPE t; \
+		if (LESS(a[mid], a[lo])) { t = a[mid]; a[mid] = a[lo]; a[lo] = t; } \
+		if (LESS(a[hi], a[lo]))  { t = a[hi];  a[hi]  = a[lo]; a[lo] = t; } \
+		if (LESS(a[hi], a[mid])) { t = a[hi];  a[hi]  = a[mid]; a[mid] = t; } \
+		TYPE pivot = a[mid]; \
+		int i = lo; \
+		int j = hi; \
+		while (i <= j) { \
+			while (LESS(a[i], pivot)) \
+				i++; \
+			while (LESS(pivot, a[j])) \
+				j--; \
+			if (i <= j) { \
+				t = a[i]; a[i] = a[j]; a[j] = t; \
+				i++; \
+				j--; \
+			} \
+		} \
+		/* Now a[lo..j] <= pivot, a[i..hi] >= pivot, and anything between equals it. */ \
+		if (k <= j) \
+			hi = j; \
+		else if (k >= i) \
+			lo = i; \
+		else \
+			return; \
+	} \
+	for (int i = lo + 1; i <= hi; i++) { \
+		TYPE v = a[i]; \
+		int j = i - 1; \
+		for ( ; j >= lo && LESS(v, a[j]); j--) \
+			a[j+1] = a[j]; \
+		a[j+1] = v; \
+	} \
+}
+
+#define PK_SCALAR_LESS(a, b) ((a) < (b))
+#define PK_MV_LESS(a, b) (mv_nn_comparator(&(a), &(b)) < 0)
+PERCENTILE_KEEPER_DEFINE_SELECT(ints, long long, PK_SCALAR_LESS)
+PERCENTILE_KEEPER_DEFINE_SELECT(floats, double, PK_SCALAR_LESS)
+PERCENTILE_KEEPER_DEFINE_SELECT(mixed, mv_t, PK_MV_LESS)
+
+// ----------------------------------------------------------------
+// Returns the k-th smallest value. Indices already selected since the last ingest are kept, sorted, in
+// ppercentile_keeper->selected; the array is partitioned around each, so a new selection need only
+// search between its nearest selected neighbors. Asking for several percentiles thus partitions
+// recursively, without sorting everything.
+static mv_t percentile_keeper_select(percentile_keeper_t* ppercentile_keeper, int k) {
+	int* selected = ppercentile_keeper->selected;
+	int num_selected = ppercentile_keeper->num_selected;
+	int pos = 0;
+	while (pos < num_selected && selected[pos] < k)
+		pos++;
+
+	if (pos >= num_selected || selected[pos] != k) {
+		int lo = (pos > 0) ? selected[pos-1] + 1 : 0;
+		int hi = (pos < num_selected) ? selected[pos] - 1 : ppercentile_keeper->size - 1;
+		switch (ppercentile_keeper->storage) {
+		case PK_STORE_INTS:
+			select_ints(ppercentile_keeper->data.intvs, lo, hi, k);
+			break;
+		case PK_STORE_FLOATS:
+			select_floats(ppercentile_keeper->data.fltvs, lo, hi, k);
+			break;
+		default:
+			select_mixed(ppercentile_keeper->data.mvs, lo, hi, k);
+			break;
+		}
+
+		if (num_selected >= ppercentile_keeper->selected_capacity) {
+			ppercentile_keeper->selected_capacity *= 2;
+			ppercentile_keeper->selected = mlr_realloc_or_die(ppercentile_keeper->selected,
+				ppercentile_keeper->selected_capacity * sizeof(int));
+			selected = ppercentile_keeper->selected;
+		}
+		memmove(&selected[pos+1], &selected[pos], (num_selected - pos) * sizeof(int));
+		selected[pos] = k;
+		ppercentile_keeper->num_selected++;
+	}
+
+	switch (ppercentile_keeper->storage) {
+	case PK_STORE_INTS:
+		return mv_from_int(ppercentile_keeper->data.intvs[k]);
+	case PK_STORE_FLOATS:
+		return mv_from_float(ppercentile_keeper->data.fltvs[k]);
+	default:
+		return ppercentile_keeper->data.mvs[k];
 	}
 }
 
@@ -245,32 +377,52 @@ mv_t percentile_keeper_emit_non_interpolated(percentile_keeper_t* ppercentile_ke
 	if (ppercentile_keeper->size == 0) {
 		return mv_absent();
 	}
-	if (!ppercentile_keeper->sorted) {
-		qsort(ppercentile_keeper->data, ppercentile_keeper->size, sizeof(mv_t), mv_nn_comparator);
-		ppercentile_keeper->sorted = TRUE;
-	}
-	return ppercentile_keeper->data[compute_index_non_interpolated(ppercentile_keeper->size, percentile)];
+	return percentile_keeper_select(ppercentile_keeper,
+		compute_index_non_interpolated(ppercentile_keeper->size, percentile));
 }
 
 mv_t percentile_keeper_emit_linearly_interpolated(percentile_keeper_t* ppercentile_keeper, double percentile) {
-	if (ppercentile_keeper->size == 0) {
+	int n = ppercentile_keeper->size;
+	if (n == 0) {
 		return mv_absent();
 	}
-	if (!ppercentile_keeper->sorted) {
-		qsort(ppercentile_keeper->data, ppercentile_keeper->size, sizeof(mv_t), mv_nn_comparator);
-		ppercentile_keeper->sorted = TRUE;
+	double findex = (percentile/100.0)*(n-1);
+	if (findex < 0)
+		findex = 0;
+	int iindex = (int)floor(findex);
+	if (iindex >= n-1) {
+		return percentile_keeper_select(ppercentile_keeper, n-1);
+	} else {
+		// array[iindex] + frac * (array[iindex+1] - array[iindex]);
+		mv_t frac = mv_from_float(findex - iindex);
+		mv_t a = percentile_keeper_select(ppercentile_keeper, iindex);
+		mv_t b = percentile_keeper_select(ppercentile_keeper, iindex+1);
+		mv_t diff = x_xx_minus_func(&b, &a);
+		mv_t prod = x_xx_times_func(&frac, &diff);
+		mv_t rv = x_xx_plus_func(&a, &prod);
+		return rv;
 	}
-	return get_percentile_linearly_interpolated(ppercentile_keeper->data, ppercentile_keeper->size, percentile);
 }
 
 // ----------------------------------------------------------------
 void percentile_keeper_print(percentile_keeper_t* ppercentile_keeper) {
 	printf("percentile_keeper dump:\n");
 	for (int i = 0; i < ppercentile_keeper->size; i++) {
-		mv_t* pa = &ppercentile_keeper->data[i];
-		if (pa->type == MT_FLOAT)
-			printf("[%02d] %.8lf\n", i, ppercentile_keeper->data[i].u.fltv);
-		else
-			printf("[%02d] %8lld\n", i, ppercentile_keeper->data[i].u.intv);
+		switch (ppercentile_keeper->storage) {
+		case PK_STORE_INTS:
+			printf("[%02d] %8lld\n", i, ppercentile_keeper->data.intvs[i]);
+			break;
+		case PK_STORE_FLOATS:
+			printf("[%02d] %.8lf\n", i, ppercentile_keeper->data.fltvs[i]);
+			break;
+		default: {
+			mv_t* pa = &ppercentile_keeper->data.mvs[i];
+			if (pa->type == MT_FLOAT)
+				printf("[%02d] %.8lf\n", i, pa->u.fltv);
+			else
+				printf("[%02d] %8lld\n", i, pa->u.intv);
+			break;
+		}
+		}
 	}
 }
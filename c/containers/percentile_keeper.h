@@ -1,16 +1,31 @@
 // ================================================================
-// For mlr stats1 percentiles
+// For mlr stats1 percentiles. All values are kept; they're packed as long
+// longs or doubles while all are ints or all are floats, else as mv_t's.
+// Percentiles are found by selection rather than by sorting everything.
 // ================================================================
 
 #ifndef PERCENTILE_KEEPER_H
 #define PERCENTILE_KEEPER_H
 #include "containers/mlrval.h"
 
+typedef enum _percentile_keeper_storage_t {
+	PK_STORE_INTS,
+	PK_STORE_FLOATS,
+	PK_STORE_MIXED,
+} percentile_keeper_storage_t;
+
 typedef struct _percentile_keeper_t {
-	mv_t* data;
-	int   size;
-	int   capacity;
-	int   sorted;
+	percentile_keeper_storage_t storage;
+	union {
+		long long* intvs;
+		double*    fltvs;
+		mv_t*      mvs;
+	} data;
+	int  size;
+	int  capacity;
+	int* selected; // Sorted indices already holding their sorted values; reset on ingest
+	int  num_selected;
+	int  selected_capacity;
 } percentile_keeper_t;
 
 percentile_keeper_t* percentile_keeper_alloc();
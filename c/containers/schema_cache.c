@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+#include "lib/mlrutil.h"
+#include "containers/schema_cache.h"
+
+// ----------------------------------------------------------------
+schema_cache_t* schema_cache_alloc(schema_plan_free_func_t* pplan_free_func) {
+	schema_cache_t* pcache = mlr_malloc_or_die(sizeof(schema_cache_t));
+	pcache->num_entries         = 0;
+	pcache->mru_index           = -1;
+	pcache->mru_schema_id       = LREC_SCHEMA_UNKNOWN;
+	pcache->next_eviction_index = 0;
+	pcache->pplan_free_func     = pplan_free_func;
+	return pcache;
+}
+
+static void schema_cache_entry_clear(schema_cache_t* pcache, schema_cache_entry_t* pentry) {
+	for (int i = 0; i < pentry->field_count; i++)
+		free(pentry->keys[i]);
+	free(pentry->keys);
+	pcache->pplan_free_func(pentry->pvplan);
+}
+
+void schema_cache_free(schema_cache_t* pcache) {
+	if (pcache == NULL)
+		return;
+	for (int i = 0; i < pcache->num_entries; i++)
+		schema_cache_entry_clear(pcache, &pcache->entries[i]);
+	free(pcache);
+}
+
+// ----------------------------------------------------------------
+unsigned lrec_schema_hash(lrec_t* prec) {
+	unsigned hash = prec->field_count;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext)
+		hash = hash * 31 + (unsigned)mlr_string_hash_func(pe->key);
+	return hash;
+}
+
+static int schema_cache_entry_matches(schema_cache_entry_t* pentry, lrec_t* prec) {
+	if (pentry->field_count != prec->field_count)
+		return FALSE;
+	int i = 0;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext, i++)
+		if (!streq(pentry->keys[i], pe->key))
+			return FALSE;
+	return TRUE;
+}
+
+// ----------------------------------------------------------------
+// The most-recently-used entry is checked first, without hashing: consecutive records usually have the
+// same schema. If the record carries the schema ID last seen matching that entry, the key comparison is
+// skipped too.
+void* schema_cache_get(schema_cache_t* pcache, lrec_t* prec) {
+	if (pcache->mru_index >= 0) {
+		schema_cache_entry_t* pentry = &pcache->entries[pcache->mru_index];
+		if (prec->schema_id != LREC_SCHEMA_UNKNOWN && prec->schema_id == pcache->mru_schema_id)
+			return pentry->pvplan;
+		if (schema_cache_entry_matches(pentry, prec)) {
+			pcache->mru_schema_id = prec->schema_id;
+			return pentry->pvplan;
+		}
+	}
+	if (pcache->num_entries <= 1)
+		return NULL;
+
+	unsigned hash = lrec_schema_hash(prec);
+	for (int i = 0; i < pcache->num_entries; i++) {
+		schema_cache_entry_t* pentry = &pcache->entries[i];
+		if (i != pcache->mru_index && pentry->hash == hash && schema_cache_entry_matches(pentry, prec)) {
+			pcache->mru_index = i;
+			pcache->mru_schema_id = prec->schema_id;
+			return pentry->pvplan;
+		}
+	}
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+void schema_cache_put(schema_cache_t* pcache, lrec_t* prec, void* pvplan) {
+	schema_cache_entry_t* pentry = NULL;
+	if (pcache->num_entries < SCHEMA_CACHE_CAPACITY) {
+		pcache->mru_index = pcache->num_entries++;
+	} else {
+		pcache->mru_index = pcache->next_eviction_index;
+		pcache->next_eviction_index = (pcache->next_eviction_index + 1) % SCHEMA_CACHE_CAPACITY;
+		schema_cache_entry_clear(pcache, &pcache->entries[pcache->mru_index]);
+	}
+	pentry = &pcache->entries[pcache->mru_index];
+
+	pentry->hash        = lrec_schema_hash(prec);
+	pentry->field_count = prec->field_count;
+	pentry->keys        = mlr_malloc_or_die(prec->field_count * sizeof(char*));
+	int i = 0;
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext, i++)
+		pentry->keys[i] = mlr_strdup_or_die(pe->key);
+	pentry->pvplan      = pvplan;
+	pcache->mru_schema_id = prec->schema_id;
+}
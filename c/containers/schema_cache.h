@@ -0,0 +1,49 @@
+// ================================================================
+// Per-schema plan cache for verbs which do the same field-name work on every record: regex matching in
+// cut -r, having-fields, rename -r, reshape -r, and merge-fields -r/-c; sort-and-lookup in regularize.
+// A record's schema is its list of field names, in order. Data streams typically have only a handful of
+// distinct schemas across many records, so the verb computes its plan (which fields to keep, rename,
+// accumulate, etc.) once per schema and then only executes the cached plan on subsequent records.
+//
+// Plans depend only on the field names, never on the field values. They are opaque to the cache, and are
+// freed by the caller-supplied free function when evicted or when the cache is freed.
+// ================================================================
+
+#ifndef SCHEMA_CACHE_H
+#define SCHEMA_CACHE_H
+#include "containers/lrec.h"
+
+#define SCHEMA_CACHE_CAPACITY 64
+
+typedef void schema_plan_free_func_t(void* pvplan);
+
+typedef struct _schema_cache_entry_t {
+	unsigned hash;
+	int      field_count;
+	char**   keys;
+	void*    pvplan;
+} schema_cache_entry_t;
+
+typedef struct _schema_cache_t {
+	schema_cache_entry_t     entries[SCHEMA_CACHE_CAPACITY];
+	int                      num_entries;
+	int                      mru_index;
+	unsigned long long       mru_schema_id; // lrec schema ID last seen matching the MRU entry, if any
+	int                      next_eviction_index;
+	schema_plan_free_func_t* pplan_free_func;
+} schema_cache_t;
+
+schema_cache_t* schema_cache_alloc(schema_plan_free_func_t* pplan_free_func);
+void schema_cache_free(schema_cache_t* pcache);
+
+// Returns the plan cached for the record's field names, or NULL if there is none.
+void* schema_cache_get(schema_cache_t* pcache, lrec_t* prec);
+
+// Caches the plan for the record's field names. The cache takes ownership of the plan. If the cache is
+// full, an older plan is evicted.
+void schema_cache_put(schema_cache_t* pcache, lrec_t* prec, void* pvplan);
+
+// Order-sensitive hash of the record's field names.
+unsigned lrec_schema_hash(lrec_t* prec);
+
+#endif // SCHEMA_CACHE_H
@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lib/mlrutil.h"
+#include "containers/sort_key.h"
+
+#define SORT_KEY_INIT_ALLOC_LENGTH 32
+#define SORT_ITEMS_INSERTION_LENGTH 16
+
+// ----------------------------------------------------------------
+sort_key_t* sort_key_alloc() {
+	sort_key_t* pkey = mlr_malloc_or_die(sizeof(sort_key_t));
+	pkey->bytes        = mlr_malloc_or_die(SORT_KEY_INIT_ALLOC_LENGTH);
+	pkey->length       = 0;
+	pkey->alloc_length = SORT_KEY_INIT_ALLOC_LENGTH;
+	return pkey;
+}
+
+void sort_key_free(sort_key_t* pkey) {
+	if (pkey == NULL)
+		return;
+	free(pkey->bytes);
+	free(pkey);
+}
+
+void sort_key_clear(sort_key_t* pkey) {
+	pkey->length = 0;
+}
+
+static void sort_key_ensure(sort_key_t* pkey, int more) {
+	if (pkey->length + more > pkey->alloc_length) {
+		int new_alloc_length = pkey->alloc_length * 2;
+		while (new_alloc_length < pkey->length + more)
+			new_alloc_length *= 2;
+		pkey->bytes = mlr_realloc_or_die(pkey->bytes, new_alloc_length);
+		pkey->alloc_length = new_alloc_length;
+	}
+}
+
+static void sort_key_complement_from(sort_key_t* pkey, int start) {
+	for (int i = start; i < pkey->length; i++)
+		pkey->bytes[i] = ~pkey->bytes[i];
+}
+
+// ----------------------------------------------------------------
+void sort_key_append_string(sort_key_t* pkey, char* s, int descending) {
+	int n = strlen(s) + 1;
+	sort_key_ensure(pkey, n);
+	int start = pkey->length;
+	memcpy(&pkey->bytes[start], s, n);
+	pkey->length += n;
+	if (descending)
+		sort_key_complement_from(pkey, start);
+}
+
+void sort_key_append_double(sort_key_t* pkey, double d, int descending) {
+	sort_key_ensure(pkey, 9);
+	int start = pkey->length;
+	unsigned long long u = 0LL;
+	if (isnan(d)) {
+		pkey->bytes[start] = 1;
+	} else {
+		if (d == 0.0)
+			d = 0.0;
+		memcpy(&u, &d, sizeof(u));
+		u = (u & 0x8000000000000000ULL) ? ~u : (u | 0x8000000000000000ULL);
+		pkey->bytes[start] = 0;
+	}
+	for (int i = 8; i >= 1; i--) {
+		pkey->bytes[start + i] = u & 0xff;
+		u >>= 8;
+	}
+	pkey->length += 9;
+	if (descending)
+		sort_key_complement_from(pkey, start);
+}
+
+void sort_key_append_ull(sort_key_t* pkey, unsigned long long u) {
+	sort_key_ensure(pkey, 8);
+	for (int i = 7; i >= 0; i--) {
+		pkey->bytes[pkey->length + i] = u & 0xff;
+		u >>= 8;
+	}
+	pkey->length += 8;
+}
+
+void sort_key_copy(sort_key_t* pdst, sort_key_t* psrc) {
+	pdst->length = 0;
+	sort_key_ensure(pdst, psrc->length);
+	memcpy(pdst->bytes, psrc->bytes, psrc->length);
+	pdst->length = psrc->length;
+}
+
+// ----------------------------------------------------------------
+int sort_key_compare(sort_key_t* pa, sort_key_t* pb) {
+	int n = (pa->length < pb->length) ? pa->length : pb->length;
+	int s = memcmp(pa->bytes, pb->bytes, n);
+	if (s != 0)
+		return s;
+	return pa->length - pb->length;
+}
+
+static unsigned long long sort_key_prefix(sort_key_t* pkey) {
+	unsigned long long prefix = 0LL;
+	for (int i = 0; i < 8; i++)
+		prefix = (prefix << 8) | ((i < pkey->length) ? pkey->bytes[i] : 0);
+	return prefix;
+}
+
+static inline int sort_item_compare(sort_item_t* pa, sort_item_t* pb) {
+	if (pa->prefix != pb->prefix)
+		return (pa->prefix < pb->prefix) ? -1 : 1;
+	return sort_key_compare(pa->pkey, pb->pkey);
+}
+
+// ----------------------------------------------------------------
+// Bottom-up merge sort: insertion-sorted blocks, then merge passes back and forth between the items and a
+// scratch array. Merges take from the left on ties, for stability.
+void sort_items(sort_item_t* items, int num_items) {
+	for (int i = 0; i < num_items; i++)
+		items[i].prefix = sort_key_prefix(items[i].pkey);
+
+	for (int lo = 0; lo < num_items; lo += SORT_ITEMS_INSERTION_LENGTH) {
+		int hi = lo + SORT_ITEMS_INSERTION_LENGTH;
+		if (hi > num_items)
+			hi = num_items;
+		for (int i = lo + 1; i < hi; i++) {
+			sort_item_t item = items[i];
+			int j = i;
+			for ( ; j > lo && sort_item_compare(&items[j-1], &item) > 0; j--)
+				items[j] = items[j-1];
+			items[j] = item;
+		}
+	}
+	if (num_items <= SORT_ITEMS_INSERTION_LENGTH)
+		return;
+
+	sort_item_t* scratch = mlr_malloc_or_die(num_items * sizeof(sort_item_t));
+	sort_item_t* src = items;
+	sort_item_t* dst = scratch;
+	for (int width = SORT_ITEMS_INSERTION_LENGTH; width < num_items; width *= 2) {
+		for (int lo = 0; lo < num_items; lo += 2*width) {
+			int mid = (lo + width < num_items) ? lo + width : num_items;
+			int hi  = (lo + 2*width < num_items) ? lo + 2*width : num_items;
+			int i = lo, j = mid, k = lo;
+			while (i < mid && j < hi)
+				dst[k++] = (sort_item_compare(&src[j], &src[i]) < 0) ? src[j++] : src[i++];
+			while (i < mid)
+				dst[k++] = src[i++];
+			while (j < hi)
+				dst[k++] = src[j++];
+		}
+		sort_item_t* temp = src;
+		src = dst;
+		dst = temp;
+	}
+	if (src != items)
+		memcpy(items, src, num_items * sizeof(sort_item_t));
+	free(scratch);
+}
@@ -0,0 +1,56 @@
+// ================================================================
+// Normalized sort keys: a multi-field sort tuple encoded as a byte string
+// such that comparing two keys with memcmp gives the tuple order. This
+// replaces per-field typed comparisons (and the comparator parameters they
+// need) with a single byte comparison, and makes for a reentrant sort.
+//
+// Field encodings, in order of appending:
+// * Lexical: the string's bytes and a NUL terminator. Since the terminator
+//   is less than any string byte, a string sorts before its extensions, as
+//   with strcmp.
+// * Numeric: a tag byte (0 for numbers, 1 for null/NaN, so that nulls sort
+//   last) then the double's IEEE bits, big-endian, with the sign bit flipped
+//   for non-negatives and all bits flipped for negatives. -0.0 is encoded
+//   as 0.0.
+// * Descending: all of the field's bytes are complemented. For numbers this
+//   puts nulls first.
+// ================================================================
+
+#ifndef SORT_KEY_H
+#define SORT_KEY_H
+
+typedef struct _sort_key_t {
+	unsigned char* bytes;
+	int            length;
+	int            alloc_length;
+} sort_key_t;
+
+sort_key_t* sort_key_alloc();
+void sort_key_free(sort_key_t* pkey);
+// Empties the key for reuse, keeping its buffer.
+void sort_key_clear(sort_key_t* pkey);
+
+void sort_key_append_string(sort_key_t* pkey, char* s, int descending);
+// NaN is taken as null.
+void sort_key_append_double(sort_key_t* pkey, double d, int descending);
+// Eight bytes, big-endian: e.g. a record's arrival sequence number, as a final tie-breaker.
+void sort_key_append_ull(sort_key_t* pkey, unsigned long long u);
+
+void sort_key_copy(sort_key_t* pdst, sort_key_t* psrc);
+
+int sort_key_compare(sort_key_t* pa, sort_key_t* pb);
+
+// ----------------------------------------------------------------
+// For sorting an array of keys with their payloads. The first eight key
+// bytes are cached in the array as an integer, so most comparisons are
+// resolved without following the key pointer.
+typedef struct _sort_item_t {
+	unsigned long long prefix;
+	sort_key_t*        pkey;
+	void*              pvvalue;
+} sort_item_t;
+
+// Stable: items with equal keys keep their order. Fills in the prefixes.
+void sort_items(sort_item_t* items, int num_items);
+
+#endif // SORT_KEY_H
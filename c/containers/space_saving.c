@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lib/mlrutil.h"
+#include "containers/bloom_filter.h"
+#include "containers/space_saving.h"
+
+// ----------------------------------------------------------------
+space_saving_t* space_saving_alloc(int capacity) {
+	MLR_INTERNAL_CODING_ERROR_IF(capacity < 1);
+	space_saving_t* psummary = mlr_malloc_or_die(sizeof(space_saving_t));
+	psummary->capacity     = capacity;
+	psummary->num_counters = 0;
+	psummary->counters     = mlr_malloc_or_die(capacity * sizeof(space_saving_counter_t));
+	psummary->heap         = mlr_malloc_or_die(capacity * sizeof(int));
+
+	unsigned long long table_size = 16;
+	while (table_size < 2ULL * capacity)
+		table_size *= 2;
+	psummary->table = mlr_malloc_or_die(table_size * sizeof(int));
+	memset(psummary->table, 0, table_size * sizeof(int));
+	psummary->table_mask = table_size - 1;
+	return psummary;
+}
+
+void space_saving_free(space_saving_t* psummary) {
+	if (psummary == NULL)
+		return;
+	for (int i = 0; i < psummary->num_counters; i++)
+		slls_free(psummary->counters[i].pvalues);
+	free(psummary->counters);
+	free(psummary->heap);
+	free(psummary->table);
+	free(psummary);
+}
+
+// ----------------------------------------------------------------
+// Returns the slot holding the values, or else the empty slot where they'd go.
+static unsigned long long space_saving_find_slot(space_saving_t* psummary, slls_t* pvalues,
+	unsigned long long hash)
+{
+	unsigned long long slot = bloom_hash_mix(hash) & psummary->table_mask;
+	while (psummary->table[slot] != 0) {
+		space_saving_counter_t* pcounter = &psummary->counters[psummary->table[slot] - 1];
+		if (pcounter->hash == hash && slls_equals(pcounter->pvalues, pvalues))
+			break;
+		slot = (slot + 1) & psummary->table_mask;
+	}
+	return slot;
+}
+
+// Backward-shift deletion, so that there are no tombstones: later entries of the probe run are moved up
+// unless that would put them before their home slots.
+static void space_saving_remove_from_table(space_saving_t* psummary, int counter_index) {
+	unsigned long long mask = psummary->table_mask;
+	unsigned long long hole = bloom_hash_mix(psummary->counters[counter_index].hash) & mask;
+	while (psummary->table[hole] != counter_index + 1)
+		hole = (hole + 1) & mask;
+
+	unsigned long long slot = hole;
+	while (TRUE) {
+		psummary->table[hole] = 0;
+		while (TRUE) {
+			slot = (slot + 1) & mask;
+			if (psummary->table[slot] == 0)
+				return;
+			unsigned long long home = bloom_hash_mix(psummary->counters[psummary->table[slot] - 1].hash) & mask;
+			int home_is_after_hole = (hole <= slot)
+				? (home > hole && home <= slot)
+				: (home > hole || home <= slot);
+			if (!home_is_after_hole)
+				break;
+		}
+		psummary->table[hole] = psummary->table[slot];
+		hole = slot;
+	}
+}
+
+// ----------------------------------------------------------------
+static void space_saving_heap_swap(space_saving_t* psummary, int i, int j) {
+	int t = psummary->heap[i];
+	psummary->heap[i] = psummary->heap[j];
+	psummary->heap[j] = t;
+	psummary->counters[psummary->heap[i]].heap_index = i;
+	psummary->counters[psummary->heap[j]].heap_index = j;
+}
+
+static unsigned long long space_saving_heap_count(space_saving_t* psummary, int i) {
+	return psummary->counters[psummary->heap[i]].count;
+}
+
+static void space_saving_sift_up(space_saving_t* psummary, int i) {
+	while (i > 0) {
+		int parent = (i - 1) / 2;
+		if (space_saving_heap_count(psummary, parent) <= space_saving_heap_count(psummary, i))
+			break;
+		space_saving_heap_swap(psummary, i, parent);
+		i = parent;
+	}
+}
+
+static void space_saving_sift_down(space_saving_t* psummary, int i) {
+	int n = psummary->num_counters;
+	while (TRUE) {
+		int least = i;
+		int left = 2 * i + 1;
+		int right = left + 1;
+		if (left < n && space_saving_heap_count(psummary, left) < space_saving_heap_count(psummary, least))
+			least = left;
+		if (right < n && space_saving_heap_count(psummary, right) < space_saving_heap_count(psummary, least))
+			least = right;
+		if (least == i)
+			break;
+		space_saving_heap_swap(psummary, i, least);
+		i = least;
+	}
+}
+
+// ----------------------------------------------------------------
+void space_saving_add(space_saving_t* psummary, slls_t* pvalues) {
+	unsigned long long hash = bloom_hash_values(pvalues);
+	unsigned long long slot = space_saving_find_slot(psummary, pvalues, hash);
+
+	if (psummary->table[slot] != 0) {
+		space_saving_counter_t* pcounter = &psummary->counters[psummary->table[slot] - 1];
+		pcounter->count++;
+		space_saving_sift_down(psummary, pcounter->heap_index);
+
+	} else if (psummary->num_counters < psummary->capacity) {
+		int counter_index = psummary->num_counters++;
+		space_saving_counter_t* pcounter = &psummary->counters[counter_index];
+		pcounter->pvalues    = slls_copy(pvalues);
+		pcounter->hash       = hash;
+		pcounter->count      = 1;
+		pcounter->error      = 0;
+		pcounter->heap_index = counter_index;
+		psummary->heap[counter_index] = counter_index;
+		space_saving_sift_up(psummary, counter_index);
+		psummary->table[slot] = counter_index + 1;
+
+	} else {
+		// Replace the least-count tuple. Removing it from the table may shift the probe run, so the
+		// new tuple's slot is found afresh.
+		int counter_index = psummary->heap[0];
+		space_saving_counter_t* pcounter = &psummary->counters[counter_index];
+		space_saving_remove_from_table(psummary, counter_index);
+		slls_free(pcounter->pvalues);
+		pcounter->pvalues = slls_copy(pvalues);
+		pcounter->hash    = hash;
+		pcounter->error   = pcounter->count;
+		pcounter->count++;
+		space_saving_sift_down(psummary, 0);
+		psummary->table[space_saving_find_slot(psummary, pvalues, hash)] = counter_index + 1;
+	}
+}
+
+// ----------------------------------------------------------------
+static int space_saving_counter_cmp(const void* pva, const void* pvb) {
+	const space_saving_counter_t* pa = *(space_saving_counter_t* const*)pva;
+	const space_saving_counter_t* pb = *(space_saving_counter_t* const*)pvb;
+	if (pa->count != pb->count)
+		return (pa->count > pb->count) ? -1 : 1;
+	if (pa->error != pb->error)
+		return (pa->error < pb->error) ? -1 : 1;
+	return 0;
+}
+
+space_saving_counter_t** space_saving_sorted_counters(space_saving_t* psummary) {
+	int n = psummary->num_counters;
+	space_saving_counter_t** pcounters = mlr_malloc_or_die((n + 1) * sizeof(space_saving_counter_t*));
+	for (int i = 0; i < n; i++)
+		pcounters[i] = &psummary->counters[i];
+	qsort(pcounters, n, sizeof(space_saving_counter_t*), space_saving_counter_cmp);
+	return pcounters;
+}
@@ -0,0 +1,47 @@
+// ================================================================
+// Space-Saving heavy-hitters summary (Metwally, Agrawal, El Abbadi 2005) for
+// mlr most-frequent --approx: approximate counts of the most frequent string
+// tuples in a stream, in memory for a fixed number of counters.
+//
+// Each counter holds a tuple, its count, and an error bound. A tuple already
+// monitored has its count incremented. Otherwise, while there are free
+// counters, it takes one with count 1 and error 0; after that it replaces the
+// tuple with the least count, inheriting that count plus one, with the
+// inherited part as its error. So each reported count is an overestimate by
+// at most its error, and any tuple occurring more than n/capacity times in n
+// inputs is monitored.
+//
+// Counters are in a min-heap on count, for finding the least, and in an
+// open-addressing hash table on the tuple, for finding monitored tuples.
+// ================================================================
+
+#ifndef SPACE_SAVING_H
+#define SPACE_SAVING_H
+#include "containers/slls.h"
+
+typedef struct _space_saving_counter_t {
+	slls_t*            pvalues;
+	unsigned long long hash;
+	unsigned long long count;
+	unsigned long long error;
+	int                heap_index;
+} space_saving_counter_t;
+
+typedef struct _space_saving_t {
+	int                     capacity;
+	int                     num_counters;
+	space_saving_counter_t* counters;
+	int*                    heap;       // Counter indices, least count at the root
+	int*                    table;      // 0 for empty, else one plus a counter index
+	unsigned long long      table_mask; // Number of slots, a power of two, minus one
+} space_saving_t;
+
+space_saving_t* space_saving_alloc(int capacity);
+void space_saving_free(space_saving_t* psummary);
+// The values are copied if the summary keeps them.
+void space_saving_add(space_saving_t* psummary, slls_t* pvalues);
+// Returns the counters, sorted by descending count then ascending error, in an array which the caller must
+// free. The counters themselves remain owned by the summary.
+space_saving_counter_t** space_saving_sorted_counters(space_saving_t* psummary);
+
+#endif // SPACE_SAVING_H
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "lib/mlrutil.h"
+#include "containers/tdigest.h"
+
+#define TDIGEST_INITIAL_ALLOC_SIZE 16
+#define TDIGEST_BUFFER_FACTOR      2
+
+// ----------------------------------------------------------------
+tdigest_t* tdigest_alloc(double compression) {
+	tdigest_t* pdigest = mlr_malloc_or_die(sizeof(tdigest_t));
+	pdigest->compression  = compression;
+	// Merged centroids number at most about the compression; see tdigest_merge.
+	pdigest->max_size     = (int)ceil(compression) + 2 + TDIGEST_BUFFER_FACTOR * (int)ceil(compression);
+	pdigest->alloc_size   = TDIGEST_INITIAL_ALLOC_SIZE;
+	pdigest->centroids    = mlr_malloc_or_die(pdigest->alloc_size * sizeof(tdigest_centroid_t));
+	pdigest->num_merged   = 0;
+	pdigest->num_buffered = 0;
+	pdigest->count        = 0.0;
+	pdigest->min          = 0.0;
+	pdigest->max          = 0.0;
+	return pdigest;
+}
+
+void tdigest_free(tdigest_t* pdigest) {
+	if (pdigest == NULL)
+		return;
+	free(pdigest->centroids);
+	free(pdigest);
+}
+
+// ----------------------------------------------------------------
+// The k1 scale function maps quantiles q in [0,1] to k in [-compression/4, compression/4]; a merged centroid
+// may span at most one unit of k. Its slope is steepest at the ends, so centroids there stay small.
+static double tdigest_k_of_q(double compression, double q) {
+	return compression / (2.0 * M_PI) * asin(2.0 * q - 1.0);
+}
+
+static double tdigest_q_of_k(double compression, double k) {
+	if (k >= compression / 4.0)
+		return 1.0;
+	return (sin(2.0 * M_PI * k / compression) + 1.0) / 2.0;
+}
+
+static int tdigest_centroid_cmp(const void* pva, const void* pvb) {
+	const tdigest_centroid_t* pa = pva;
+	const tdigest_centroid_t* pb = pvb;
+	return (pa->mean < pb->mean) ? -1 : (pa->mean > pb->mean) ? 1 : 0;
+}
+
+// Sorts merged centroids and buffered values together, then greedily combines neighbors while they stay
+// within one unit of k. Any two adjacent output centroids span more than one unit, so there are at most
+// about compression/2 * 2 + 2 of them. In place since the write index never passes the read index.
+static void tdigest_merge(tdigest_t* pdigest) {
+	int n = pdigest->num_merged + pdigest->num_buffered;
+	if (pdigest->num_buffered == 0)
+		return;
+	tdigest_centroid_t* pc = pdigest->centroids;
+	qsort(pc, n, sizeof(tdigest_centroid_t), tdigest_centroid_cmp);
+
+	double compression = pdigest->compression;
+	double total = pdigest->count;
+	double weight_so_far = 0.0;
+	double q_limit = tdigest_q_of_k(compression, tdigest_k_of_q(compression, 0.0) + 1.0);
+	int outi = 0;
+	for (int ini = 1; ini < n; ini++) {
+		double q = (weight_so_far + pc[outi].weight + pc[ini].weight) / total;
+		if (q <= q_limit) {
+			double weight = pc[outi].weight + pc[ini].weight;
+			pc[outi].mean += (pc[ini].mean - pc[outi].mean) * pc[ini].weight / weight;
+			pc[outi].weight = weight;
+		} else {
+			weight_so_far += pc[outi].weight;
+			q_limit = tdigest_q_of_k(compression, tdigest_k_of_q(compression, weight_so_far / total) + 1.0);
+			pc[++outi] = pc[ini];
+		}
+	}
+	pdigest->num_merged = outi + 1;
+	pdigest->num_buffered = 0;
+}
+
+// ----------------------------------------------------------------
+void tdigest_ingest(tdigest_t* pdigest, double value) {
+	int n = pdigest->num_merged + pdigest->num_buffered;
+	if (n >= pdigest->alloc_size) {
+		if (pdigest->alloc_size < pdigest->max_size) {
+			pdigest->alloc_size *= 2;
+			if (pdigest->alloc_size > pdigest->max_size)
+				pdigest->alloc_size = pdigest->max_size;
+			pdigest->centroids = mlr_realloc_or_die(pdigest->centroids,
+				pdigest->alloc_size * sizeof(tdigest_centroid_t));
+		} else {
+			tdigest_merge(pdigest);
+			n = pdigest->num_merged;
+		}
+	}
+
+	pdigest->centroids[n].mean = value;
+	pdigest->centroids[n].weight = 1.0;
+	pdigest->num_buffered++;
+	if (pdigest->count == 0.0 || value < pdigest->min)
+		pdigest->min = value;
+	if (pdigest->count == 0.0 || value > pdigest->max)
+		pdigest->max = value;
+	pdigest->count += 1.0;
+}
+
+// ----------------------------------------------------------------
+// Each centroid's mean is taken to sit at the middle of its weight in rank order, and percentiles are
+// interpolated linearly between those points, or between the outermost ones and the min and max.
+double tdigest_percentile(tdigest_t* pdigest, double percentile) {
+	tdigest_merge(pdigest);
+	tdigest_centroid_t* pc = pdigest->centroids;
+	int n = pdigest->num_merged;
+
+	double index = percentile / 100.0 * pdigest->count;
+	if (index <= 0.0)
+		return pdigest->min;
+	if (index >= pdigest->count)
+		return pdigest->max;
+
+	double center = pc[0].weight / 2.0;
+	if (index < center)
+		return pdigest->min + (pc[0].mean - pdigest->min) * index / center;
+	for (int i = 0; i < n - 1; i++) {
+		double gap = (pc[i].weight + pc[i+1].weight) / 2.0;
+		if (index < center + gap)
+			return pc[i].mean + (pc[i+1].mean - pc[i].mean) * (index - center) / gap;
+		center += gap;
+	}
+	double half = pc[n-1].weight / 2.0;
+	return pc[n-1].mean + (pdigest->max - pc[n-1].mean) * (index - center) / half;
+}
+
+// ----------------------------------------------------------------
+void tdigest_print(tdigest_t* pdigest) {
+	tdigest_merge(pdigest);
+	printf("tdigest dump: count %.0lf min %lf max %lf\n", pdigest->count, pdigest->min, pdigest->max);
+	for (int i = 0; i < pdigest->num_merged; i++)
+		printf("[%03d] mean %lf weight %.0lf\n", i, pdigest->centroids[i].mean, pdigest->centroids[i].weight);
+}
@@ -0,0 +1,50 @@
+// ================================================================
+// Merging t-digest (Dunning & Ertl) for approximate percentiles in bounded
+// memory, e.g. mlr stats1 -a p99~. Values are summarized as centroids (mean,
+// weight) sorted by mean. Centroids near p0 and p100 are kept small and those
+// near p50 may be large, so the tails are the most accurate.
+//
+// Ingested values are buffered and merged into the centroids when the buffer
+// fills or a percentile is asked for. The merge bounds the number of centroids
+// by about the compression, independent of the number of values; with the
+// default compression of 200 a digest is at most about 10KB.
+//
+// Accuracy: p0 and p100 are exact (the min and max are kept). Elsewhere the
+// rank error is typically under 0.1% of the count, and smaller toward the
+// tails: for a million values, p50 and p99 are usually within a hundred ranks
+// of exact. Percentiles are interpolated between centroids, so results are
+// floats even for integer input.
+// ================================================================
+
+#ifndef TDIGEST_H
+#define TDIGEST_H
+
+#define TDIGEST_DEFAULT_COMPRESSION 200.0
+
+typedef struct _tdigest_centroid_t {
+	double mean;
+	double weight;
+} tdigest_centroid_t;
+
+typedef struct _tdigest_t {
+	double              compression;
+	tdigest_centroid_t* centroids;     // Merged centroids, then buffered values of weight 1
+	int                 num_merged;
+	int                 num_buffered;
+	int                 alloc_size;    // Grows by doubling up to max_size
+	int                 max_size;
+	double              count;
+	double              min;
+	double              max;
+} tdigest_t;
+
+tdigest_t* tdigest_alloc(double compression);
+void tdigest_free(tdigest_t* pdigest);
+void tdigest_ingest(tdigest_t* pdigest, double value);
+// The percentile is in [0,100]. The digest must be non-empty.
+double tdigest_percentile(tdigest_t* pdigest, double percentile);
+
+// For debug/test
+void tdigest_print(tdigest_t* pdigest);
+
+#endif // TDIGEST_H
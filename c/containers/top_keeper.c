@@ -3,13 +3,21 @@
 #include "lib/mlrutil.h"
 #include "containers/top_keeper.h"
 
+#define TOP_KEEPER_INIT_ALLOC_SIZE 16
+
 // ----------------------------------------------------------------
 top_keeper_t* top_keeper_alloc(int capacity) {
-	top_keeper_t* ptop_keeper = mlr_malloc_or_die(sizeof(top_keeper_t));
-	ptop_keeper->top_values   = mlr_malloc_or_die(capacity*sizeof(mv_t));
-	ptop_keeper->top_precords = mlr_malloc_or_die(capacity*sizeof(lrec_t*));
-	ptop_keeper->size         = 0;
-	ptop_keeper->capacity     = capacity;
+	top_keeper_t* ptop_keeper  = mlr_malloc_or_die(sizeof(top_keeper_t));
+	ptop_keeper->alloc_size    = (capacity < TOP_KEEPER_INIT_ALLOC_SIZE) ? capacity : TOP_KEEPER_INIT_ALLOC_SIZE;
+	if (ptop_keeper->alloc_size < 1)
+		ptop_keeper->alloc_size = 1;
+	ptop_keeper->top_values    = mlr_malloc_or_die(ptop_keeper->alloc_size*sizeof(mv_t));
+	ptop_keeper->top_precords  = NULL;
+	ptop_keeper->top_sequences = mlr_malloc_or_die(ptop_keeper->alloc_size*sizeof(unsigned long long));
+	ptop_keeper->size          = 0;
+	ptop_keeper->capacity      = capacity;
+	ptop_keeper->num_added     = 0LL;
+	ptop_keeper->is_sorted     = TRUE;
 	return ptop_keeper;
 }
 
@@ -19,66 +27,142 @@ void top_keeper_free(top_keeper_t* ptop_keeper) {
 		return;
 	free(ptop_keeper->top_values);
 	free(ptop_keeper->top_precords);
+	free(ptop_keeper->top_sequences);
 	ptop_keeper->top_values = NULL;
 	ptop_keeper->top_precords = NULL;
+	ptop_keeper->top_sequences = NULL;
 	ptop_keeper->size = 0;
 	ptop_keeper->capacity = 0;
 	free(ptop_keeper);
 }
 
 // ----------------------------------------------------------------
-// Cases:
-// 1. array size <  capacity
-//    * find destidx
-//    * if destidx == size
-//        put it there
-//      else
-//        shift down & insert
-//      increment size
-//
-// 2. array size == capacity
-//    * find destidx
-//    * if destidx == size
-//        discard
-//      else
-//        shift down & insert
+// The heap is ordered so that each parent ranks no higher than its children: the root is the entry to
+// evict next. Lower values rank lower, and among equal values later-added ones do.
+static int top_keeper_ranks_lower(top_keeper_t* ptop_keeper, int i, int j) {
+	mv_t* pa = &ptop_keeper->top_values[i];
+	mv_t* pb = &ptop_keeper->top_values[j];
+	if (mv_i_nn_lt(pa, pb))
+		return TRUE;
+	if (mv_i_nn_gt(pa, pb))
+		return FALSE;
+	return ptop_keeper->top_sequences[i] > ptop_keeper->top_sequences[j];
+}
+
+static void top_keeper_swap(top_keeper_t* ptop_keeper, int i, int j) {
+	mv_t value = ptop_keeper->top_values[i];
+	ptop_keeper->top_values[i] = ptop_keeper->top_values[j];
+	ptop_keeper->top_values[j] = value;
+
+	unsigned long long sequence = ptop_keeper->top_sequences[i];
+	ptop_keeper->top_sequences[i] = ptop_keeper->top_sequences[j];
+	ptop_keeper->top_sequences[j] = sequence;
 
-// capacity = 10, size = 6, destidx = 3     capacity = 10, size = 10, destidx = 3
-// [0 #]   [0 #]                            [0 #]   [0 #]
-// [1 #]   [1 #]                            [1 #]   [1 #]
-// [2 #]   [2 #]                            [2 #]   [2 #]
-// [3 #]*  [3 X]                            [3 #]*  [3 X]
-// [4 #]   [4 #]                            [4 #]   [4 #]
-// [5 #]   [5 #]                            [5 #]   [5 #]
-// [6  ]   [6 #]                            [6 #]   [6 #]
-// [7  ]   [7  ]                            [7 #]   [7 #]
-// [8  ]   [8  ]                            [8 #]   [8 #]
-// [9  ]   [9  ]                            [9 #]   [9 #]
+	if (ptop_keeper->top_precords != NULL) {
+		lrec_t* prec = ptop_keeper->top_precords[i];
+		ptop_keeper->top_precords[i] = ptop_keeper->top_precords[j];
+		ptop_keeper->top_precords[j] = prec;
+	}
+}
 
+static void top_keeper_sift_up(top_keeper_t* ptop_keeper, int i) {
+	while (i > 0) {
+		int parent = (i - 1) / 2;
+		if (!top_keeper_ranks_lower(ptop_keeper, i, parent))
+			break;
+		top_keeper_swap(ptop_keeper, i, parent);
+		i = parent;
+	}
+}
+
+static void top_keeper_sift_down(top_keeper_t* ptop_keeper, int i, int size) {
+	while (TRUE) {
+		int l = 2*i + 1;
+		int r = l + 1;
+		int m = i;
+		if (l < size && top_keeper_ranks_lower(ptop_keeper, l, m))
+			m = l;
+		if (r < size && top_keeper_ranks_lower(ptop_keeper, r, m))
+			m = r;
+		if (m == i)
+			break;
+		top_keeper_swap(ptop_keeper, i, m);
+		i = m;
+	}
+}
+
+// A descending array reversed is ascending, which is a valid heap.
+static void top_keeper_unsort(top_keeper_t* ptop_keeper) {
+	for (int i = 0, j = ptop_keeper->size - 1; i < j; i++, j--)
+		top_keeper_swap(ptop_keeper, i, j);
+	ptop_keeper->is_sorted = FALSE;
+}
+
+static void top_keeper_grow(top_keeper_t* ptop_keeper) {
+	int new_alloc_size = 2 * ptop_keeper->alloc_size;
+	if (new_alloc_size > ptop_keeper->capacity)
+		new_alloc_size = ptop_keeper->capacity;
+	ptop_keeper->top_values = mlr_realloc_or_die(ptop_keeper->top_values, new_alloc_size*sizeof(mv_t));
+	ptop_keeper->top_sequences = mlr_realloc_or_die(ptop_keeper->top_sequences,
+		new_alloc_size*sizeof(unsigned long long));
+	if (ptop_keeper->top_precords != NULL)
+		ptop_keeper->top_precords = mlr_realloc_or_die(ptop_keeper->top_precords, new_alloc_size*sizeof(lrec_t*));
+	ptop_keeper->alloc_size = new_alloc_size;
+}
+
+// ----------------------------------------------------------------
 // Our caller, mapper_top, feeds us records. We keep them or free them.
 void top_keeper_add(top_keeper_t* ptop_keeper, mv_t value, lrec_t* prec) {
-	int destidx = mlr_bsearch_mv_n_for_insert(ptop_keeper->top_values, ptop_keeper->size, &value);
+	if (ptop_keeper->capacity <= 0) {
+		if (prec != NULL)
+			lrec_free(prec);
+		return;
+	}
+	if (prec != NULL && ptop_keeper->top_precords == NULL) {
+		ptop_keeper->top_precords = mlr_malloc_or_die(ptop_keeper->alloc_size*sizeof(lrec_t*));
+		memset(ptop_keeper->top_precords, 0, ptop_keeper->alloc_size*sizeof(lrec_t*));
+	}
+	if (ptop_keeper->is_sorted)
+		top_keeper_unsort(ptop_keeper);
+	unsigned long long sequence = ptop_keeper->num_added++;
+
 	if (ptop_keeper->size < ptop_keeper->capacity) {
-		for (int i = ptop_keeper->size-1; i >= destidx; i--) {
-			ptop_keeper->top_values[i+1]   = ptop_keeper->top_values[i];
-			ptop_keeper->top_precords[i+1] = ptop_keeper->top_precords[i];
-		}
-		ptop_keeper->top_values[destidx]   = value;
-		ptop_keeper->top_precords[destidx] = prec;
-		ptop_keeper->size++;
+		if (ptop_keeper->size >= ptop_keeper->alloc_size)
+			top_keeper_grow(ptop_keeper);
+		int i = ptop_keeper->size++;
+		ptop_keeper->top_values[i]    = value;
+		ptop_keeper->top_sequences[i] = sequence;
+		if (ptop_keeper->top_precords != NULL)
+			ptop_keeper->top_precords[i] = prec;
+		top_keeper_sift_up(ptop_keeper, i);
 	} else {
-		if (destidx >= ptop_keeper->capacity) {
-			lrec_free(prec);
+		// Being added last, the new value must exceed the least kept value to displace it.
+		if (!mv_i_nn_gt(&value, &ptop_keeper->top_values[0])) {
+			if (prec != NULL)
+				lrec_free(prec);
 			return;
 		}
-		lrec_free(ptop_keeper->top_precords[ptop_keeper->size-1]);
-		for (int i = ptop_keeper->size-2; i >= destidx; i--) {
-			ptop_keeper->top_values[i+1]   = ptop_keeper->top_values[i];
-			ptop_keeper->top_precords[i+1] = ptop_keeper->top_precords[i];
+		if (ptop_keeper->top_precords != NULL) {
+			if (ptop_keeper->top_precords[0] != NULL)
+				lrec_free(ptop_keeper->top_precords[0]);
+			ptop_keeper->top_precords[0] = prec;
 		}
-		ptop_keeper->top_values[destidx]   = value;
-		ptop_keeper->top_precords[destidx] = prec;
+		ptop_keeper->top_values[0]    = value;
+		ptop_keeper->top_sequences[0] = sequence;
+		top_keeper_sift_down(ptop_keeper, 0, ptop_keeper->size);
+	}
+}
+
+// ----------------------------------------------------------------
+// Heapsort: each lowest-ranked entry is moved from the root to the end of the shrinking heap.
+void top_keeper_sort(top_keeper_t* ptop_keeper) {
+	if (ptop_keeper->is_sorted)
+		return;
+	for (int n = ptop_keeper->size; n > 1; n--) {
+		top_keeper_swap(ptop_keeper, 0, n-1);
+		top_keeper_sift_down(ptop_keeper, 0, n-1);
 	}
+	ptop_keeper->is_sorted = TRUE;
 }
 
 // ----------------------------------------------------------------
@@ -1,5 +1,13 @@
 // ================================================================
-// Data structure for mlr top: just a decorated array.
+// Data structure for mlr top: a bounded binary heap whose root is the least
+// of the top values, so each candidate is compared against it and, if it
+// displaces it, costs O(log n) rather than an O(n) shift of a sorted array.
+// Among equal values, earlier-added ones rank higher.
+//
+// The arrays grow by doubling up to the capacity, so many small groups with a
+// large capacity stay small. Call top_keeper_sort before reading the arrays:
+// it leaves them in descending order, largest value first. Adds after a sort
+// are allowed.
 // ================================================================
 
 #ifndef TOP_KEEPER_H
@@ -8,15 +16,21 @@
 #include "containers/lrec.h"
 
 typedef struct _top_keeper_t {
-	mv_t*    top_values;
-	lrec_t** top_precords;
-	int      size;
-	int      capacity;
+	mv_t*               top_values;
+	lrec_t**            top_precords; // NULL until a record is added: mapper_top without -a keeps none
+	unsigned long long* top_sequences;
+	int                 size;
+	int                 capacity;
+	int                 alloc_size;
+	unsigned long long  num_added;
+	int                 is_sorted;
 } top_keeper_t;
 
 top_keeper_t* top_keeper_alloc(int capacity);
 void top_keeper_free(top_keeper_t* ptop_keeper);
+// The record may be NULL. It is freed if not kept.
 void top_keeper_add(top_keeper_t* ptop_keeper, mv_t value, lrec_t* prec);
+void top_keeper_sort(top_keeper_t* ptop_keeper);
 
 // For debug/test
 void top_keeper_print(top_keeper_t* ptop_keeper);
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <regex.h>
+#include "mlr_dsl_parse.h"
+#include "../mapping/mlr_dsl_ast.h"
+#include "mlr_dsl_lexer.h"
+typedef struct { const char* ere; int type; int tok; regex_t re; } rule_t;
+static rule_t rules[] = {
+	{ "^([;])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_SEMICOLON },
+	{ "^([{])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_LBRACE },
+	{ "^([}])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_RBRACE },
+	{ "^([=])", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, MD_TOKEN_ASSIGN },
+	{ "^([f][i][l][t][e][r])", MD_AST_NODE_TYPE_FILTER, MD_TOKEN_FILTER },
+	{ "^([u][n][s][e][t])", MD_AST_NODE_TYPE_UNSET, MD_TOKEN_UNSET },
+	{ "^([t][e][e])", MD_AST_NODE_TYPE_TEE, MD_TOKEN_TEE },
+	{ "^([e][m][i][t][f])", MD_AST_NODE_TYPE_EMITF, MD_TOKEN_EMITF },
+	{ "^([e][m][i][t][p])", MD_AST_NODE_TYPE_EMITP, MD_TOKEN_EMITP },
+	{ "^([e][m][i][t])", MD_AST_NODE_TYPE_EMIT, MD_TOKEN_EMIT },
+	{ "^([d][u][m][p])", MD_AST_NODE_TYPE_DUMP, MD_TOKEN_DUMP },
+	{ "^([e][d][u][m][p])", MD_AST_NODE_TYPE_EDUMP, MD_TOKEN_EDUMP },
+	{ "^([p][r][i][n][t])", MD_AST_NODE_TYPE_PRINT, MD_TOKEN_PRINT },
+	{ "^([p][r][i][n][t][n])", MD_AST_NODE_TYPE_PRINTN, MD_TOKEN_PRINTN },
+	{ "^([e][p][r][i][n][t])", MD_AST_NODE_TYPE_EPRINT, MD_TOKEN_EPRINT },
+	{ "^([e][p][r][i][n][t][n])", MD_AST_NODE_TYPE_EPRINTN, MD_TOKEN_EPRINTN },
+	{ "^([s][t][d][o][u][t])", MD_AST_NODE_TYPE_STDOUT, MD_TOKEN_STDOUT },
+	{ "^([s][t][d][e][r][r])", MD_AST_NODE_TYPE_STDERR, MD_TOKEN_STDERR },
+	{ "^([f][u][n][c])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_FUNC_DEF },
+	{ "^([s][u][b][r])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_SUBR_DEF },
+	{ "^([c][a][l][l])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_SUBR_CALL },
+	{ "^([r][e][t][u][r][n])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_RETURN },
+	{ "^([b][e][g][i][n])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_BEGIN },
+	{ "^([e][n][d])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_END },
+	{ "^([a][l][l])", MD_AST_NODE_TYPE_ALL, MD_TOKEN_ALL },
+	{ "^([d][o])", MD_AST_NODE_TYPE_DO_WHILE, MD_TOKEN_DO },
+	{ "^([w][h][i][l][e])", MD_AST_NODE_TYPE_WHILE, MD_TOKEN_WHILE },
+	{ "^([f][o][r])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_FOR },
+	{ "^([i][n])", MD_AST_NODE_TYPE_IN, MD_TOKEN_IN },
+	{ "^([b][r][e][a][k])", MD_AST_NODE_TYPE_BREAK, MD_TOKEN_BREAK },
+	{ "^([c][o][n][t][i][n][u][e])", MD_AST_NODE_TYPE_CONTINUE, MD_TOKEN_CONTINUE },
+	{ "^([i][f])", MD_AST_NODE_TYPE_IF_ITEM, MD_TOKEN_IF },
+	{ "^([e][l][i][f])", MD_AST_NODE_TYPE_IF_ITEM, MD_TOKEN_ELIF },
+	{ "^([e][l][s][e])", MD_AST_NODE_TYPE_IF_ITEM, MD_TOKEN_ELSE },
+	{ "^([?])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_QUESTION_MARK },
+	{ "^([:])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_COLON },
+	{ "^([|][|])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_OR },
+	{ "^([|][|][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_OR_EQUALS },
+	{ "^(\\^\\^)", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_XOR },
+	{ "^(\\^\\^[=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_XOR_EQUALS },
+	{ "^([&][&])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_AND },
+	{ "^([&][&][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_AND_EQUALS },
+	{ "^([=][~])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_MATCHES },
+	{ "^([!][=][~])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_DOES_NOT_MATCH },
+	{ "^([=][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_EQ },
+	{ "^([!][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_NE },
+	{ "^([>])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_GT },
+	{ "^([>][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_GE },
+	{ "^([<])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LT },
+	{ "^([<][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LE },
+	{ "^([|])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_OR },
+	{ "^([|][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_OR_EQUALS },
+	{ "^(\\^)", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_XOR },
+	{ "^(\\^[=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_XOR_EQUALS },
+	{ "^([&])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_AND },
+	{ "^([&][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_AND_EQUALS },
+	{ "^([<][<])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_LSH },
+	{ "^([<][<][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_LSH_EQUALS },
+	{ "^([>][>])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_RSH },
+	{ "^([>][>][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_RSH_EQUALS },
+	{ "^([+])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_PLUS },
+	{ "^([+][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_PLUS_EQUALS },
+	{ "^([-])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_MINUS },
+	{ "^([-][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_MINUS_EQUALS },
+	{ "^([.])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_DOT },
+	{ "^([.][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_DOT_EQUALS },
+	{ "^([*])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_TIMES },
+	{ "^([*][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_TIMES_EQUALS },
+	{ "^([/])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_DIVIDE },
+	{ "^([/][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_DIVIDE_EQUALS },
+	{ "^([/][/])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_INT_DIVIDE },
+	{ "^([/][/][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_INT_DIVIDE_EQUALS },
+	{ "^([%])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_MOD },
+	{ "^([%][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_MOD_EQUALS },
+	{ "^([!])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_LOGICAL_NOT },
+	{ "^([~])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_BITWISE_NOT },
+	{ "^([*][*])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_POW },
+	{ "^([*][*][=])", MD_AST_NODE_TYPE_OPERATOR, MD_TOKEN_POW_EQUALS },
+	{ "^([$][*])", MD_AST_NODE_TYPE_FULL_SREC, MD_TOKEN_FULL_SREC },
+	{ "^([$])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_DOLLAR_SIGN },
+	{ "^([$][a-zA-Z_0-9]+)", MD_AST_NODE_TYPE_FIELD_NAME, MD_TOKEN_FIELD_NAME },
+	{ "^([$][{]([^}\\\\]|\\\\.)*[}])", MD_AST_NODE_TYPE_FIELD_NAME, MD_TOKEN_BRACED_FIELD_NAME },
+	{ "^(@[a-zA-Z_0-9]+)", MD_AST_NODE_TYPE_STRING_LITERAL, MD_TOKEN_UNBRACED_OOSVAR_NAME },
+	{ "^(@[{]([^}\\\\]|\\\\.)*[}])", MD_AST_NODE_TYPE_STRING_LITERAL, MD_TOKEN_BRACED_OOSVAR_NAME },
+	{ "^(@)", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_AT_SIGN },
+	{ "^(@[*])", MD_AST_NODE_TYPE_FULL_OOSVAR, MD_TOKEN_FULL_OOSVAR },
+	{ "^([[])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_LEFT_BRACKET },
+	{ "^([]])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_RIGHT_BRACKET },
+	{ "^([0-9]+|[0-9]+[.][0-9]*|[0-9]*[.][0-9]+|[0-9]+[eE][0-9]+|[0-9]+[eE]-[0-9]+|[0-9]+[.][0-9]*[eE][0-9]+|[0-9]+[.][0-9]*[eE]-[0-9]+|[0-9]*[.][0-9]+[eE][0-9]+|[0-9]*[.][0-9]+[eE]-[0-9]+)", MD_AST_NODE_TYPE_NUMERIC_LITERAL, MD_TOKEN_NUMBER },
+	{ "^(0x[0-9a-fA-F]+)", MD_AST_NODE_TYPE_NUMERIC_LITERAL, MD_TOKEN_NUMBER },
+	{ "^(\"([^\\\\\"]|\\\\.)*\")", MD_AST_NODE_TYPE_STRING_LITERAL, MD_TOKEN_STRING },
+	{ "^(\"([^\\\\\"]|\\\\.)*\"i)", MD_AST_NODE_TYPE_REGEXI, MD_TOKEN_REGEXI },
+	{ "^([m][a][p])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_MAP },
+	{ "^([v][a][r])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_VAR },
+	{ "^([n][u][m])", MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION, MD_TOKEN_NUMERIC },
+	{ "^([i][n][t])", MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION, MD_TOKEN_INT },
+	{ "^([f][l][o][a][t])", MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION, MD_TOKEN_FLOAT },
+	{ "^([b][o][o][l])", MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION, MD_TOKEN_BOOLEAN },
+	{ "^([s][t][r])", MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION, MD_TOKEN_STRING },
+	{ "^([t][r][u][e])", MD_AST_NODE_TYPE_BOOLEAN_LITERAL, MD_TOKEN_TRUE },
+	{ "^([f][a][l][s][e])", MD_AST_NODE_TYPE_BOOLEAN_LITERAL, MD_TOKEN_FALSE },
+	{ "^([N][F])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([N][R])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([F][N][R])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([F][I][L][E][N][A][M][E])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([F][I][L][E][N][U][M])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([P][I])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([E])", MD_AST_NODE_TYPE_CONTEXT_VARIABLE, MD_TOKEN_CONTEXT_VARIABLE },
+	{ "^([E][N][V])", MD_AST_NODE_TYPE_ENV, MD_TOKEN_ENV },
+	{ "^([a-zA-Z_][a-zA-Z_0-9]*)", MD_AST_NODE_TYPE_NON_SIGIL_NAME, MD_TOKEN_NON_SIGIL_NAME },
+	{ "^([(])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_LPAREN },
+	{ "^([)])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_RPAREN },
+	{ "^([,])", MD_AST_NODE_TYPE_STRIPPED_AWAY, MD_TOKEN_COMMA },
+};
+#define NRULES (int)(sizeof(rules)/sizeof(rules[0]))
+static int compiled = 0;
+typedef struct { struct _mlr_dsl_ast_node_t** pp; char* text; char* p; } scanner_t;
+int mlr_dsl_lexer_lex_init_extra(struct _mlr_dsl_ast_node_t** pp, yyscan_t* ps) {
+	if (!compiled) {
+		for (int i = 0; i < NRULES; i++)
+			if (regcomp(&rules[i].re, rules[i].ere, REG_EXTENDED)) { fprintf(stderr, "bad re %s\n", rules[i].ere); exit(1); }
+		compiled = 1;
+	}
+	scanner_t* s = calloc(1, sizeof(scanner_t)); s->pp = pp; *ps = s; return 0;
+}
+void mlr_dsl_lexer_set_in(FILE* f, yyscan_t vs) {
+	scanner_t* s = vs; size_t n = 0, cap = 4096; char* buf = malloc(cap); int ch;
+	while ((ch = fgetc(f)) != EOF) { if (n + 1 >= cap) buf = realloc(buf, cap *= 2); buf[n++] = ch; }
+	buf[n] = 0; s->text = s->p = buf;
+}
+YY_BUFFER_STATE mlr_dsl_lexer__scan_string(const char* str, yyscan_t vs) {
+	scanner_t* s = vs; s->text = s->p = strdup(str); return s->text;
+}
+void mlr_dsl_lexer__switch_to_buffer(YY_BUFFER_STATE b, yyscan_t s) { }
+void mlr_dsl_lexer__delete_buffer(YY_BUFFER_STATE b, yyscan_t s) { }
+int mlr_dsl_lexer_lex_destroy(yyscan_t vs) { scanner_t* s = vs; free(s->text); free(s); return 0; }
+int mlr_dsl_lexer_lex(yyscan_t vs) {
+	scanner_t* s = vs;
+	for (;;) {
+		if (*s->p == 0) return 0;
+		if (*s->p == ' ' || *s->p == '\t' || *s->p == '\r' || *s->p == '\n') { s->p++; continue; }
+		if (*s->p == '#') {
+			char* nl = strchr(s->p, '\n');
+			if (nl == NULL) return -1; // flex rule needs the newline
+			s->p = nl + 1; continue;
+		}
+		break;
+	}
+	int best = -1, bestlen = 0;
+	for (int i = 0; i < NRULES; i++) {
+		regmatch_t m;
+		if (regexec(&rules[i].re, s->p, 1, &m, 0) == 0 && m.rm_eo > bestlen) { best = i; bestlen = m.rm_eo; }
+	}
+	if (best < 0) return -1;
+	char save = s->p[bestlen]; s->p[bestlen] = 0;
+	*s->pp = mlr_dsl_ast_node_alloc(s->p, rules[best].type);
+	s->p[bestlen] = save; s->p += bestlen;
+	return rules[best].tok;
+}
@@ -0,0 +1,14 @@
+#ifndef MLR_DSL_LEXER_H
+#define MLR_DSL_LEXER_H
+#include <stdio.h>
+typedef void* yyscan_t;
+typedef void* YY_BUFFER_STATE;
+struct _mlr_dsl_ast_node_t;
+int mlr_dsl_lexer_lex(yyscan_t s);
+int mlr_dsl_lexer_lex_init_extra(struct _mlr_dsl_ast_node_t** pp, yyscan_t* ps);
+void mlr_dsl_lexer_set_in(FILE* f, yyscan_t s);
+YY_BUFFER_STATE mlr_dsl_lexer__scan_string(const char* str, yyscan_t s);
+void mlr_dsl_lexer__switch_to_buffer(YY_BUFFER_STATE b, yyscan_t s);
+void mlr_dsl_lexer__delete_buffer(YY_BUFFER_STATE b, yyscan_t s);
+int mlr_dsl_lexer_lex_destroy(yyscan_t s);
+#endif
@@ -0,0 +1,7817 @@
+/* Driver template for the LEMON parser generator.
+** The author disclaims copyright to this source code.
+*/
+/* First off, code is include which follows the "include" declaration
+** in the input file. */
+#include <stdio.h>
+#line 4 "mlr_dsl_parse.y"
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "../lib/mlrutil.h"
+#include "../mapping/mlr_dsl_ast.h"
+#include "../containers/sllv.h"
+
+// ================================================================
+// AST:
+// * parens, commas, semis, line endings, whitespace are all stripped away
+// * variable names and literal values remain as leaf nodes of the AST
+// * = + - * / ** {function names} remain as non-leaf nodes of the AST
+// CST: See mlr_dsl_cst.c
+//
+// Note: This parser accepts many things that are invalid, e.g.
+//
+// * begin{end{}} -- begin/end not at top level
+// * begin{$x=1} -- references to stream records at begin/end
+// * break/continue outside of for/while/do-while
+// * return outside of a function definition
+// * $x=x -- boundvars outside of for-loop variable bindings
+//
+// All of the above are enforced by the CST builder's semantic-analysis logic,
+// which takes this parser's output AST as input.  This is done (a) to keep this
+// grammar from being overly complex, and (b) so we can get much more
+// informative error messages in C than in Lemon ('syntax error').
+//
+// The parser hooks all build up an abstract syntax tree specifically for the CST builder.
+// For clearer visuals on what the ASTs look like:
+// * See mlr_dsl_cst.c
+// * See reg_test/run's filter -v and put -v outputs, e.g. in reg_test/expected/out
+// * Do "mlr -n put -v 'your expression goes here'"
+// ================================================================
+
+
+#line 45 "mlr_dsl_parse.c"
+/* Next is all token values, in a form suitable for use by makeheaders.
+** This section will be null unless lemon is run with the -m switch.
+*/
+/*
+** These constants (all generated automatically by the parser generator)
+** specify the various kinds of tokens (terminals) that the parser
+** understands.
+**
+** Each symbol here is a terminal symbol in the grammar.
+*/
+/* Make sure the INTERFACE macro is defined.
+*/
+#ifndef INTERFACE
+# define INTERFACE 1
+#endif
+/* The next thing included is series of defines which control
+** various aspects of the generated parser.
+**    YYCODETYPE         is the data type used for storing terminal
+**                       and nonterminal numbers.  "unsigned char" is
+**                       used if there are fewer than 250 terminals
+**                       and nonterminals.  "int" is used otherwise.
+**    YYNOCODE           is a number of type YYCODETYPE which corresponds
+**                       to no legal terminal or nonterminal number.  This
+**                       number is used to fill in empty slots of the hash
+**                       table.
+**    YYFALLBACK         If defined, this indicates that one or more tokens
+**                       have fall-back values which should be used if the
+**                       original value of the token will not parse.
+**    YYACTIONTYPE       is the data type used for storing terminal
+**                       and nonterminal numbers.  "unsigned char" is
+**                       used if there are fewer than 250 rules and
+**                       states combined.  "int" is used otherwise.
+**    ParseTOKENTYPE     is the data type used for minor tokens given
+**                       directly to the parser from the tokenizer.
+**    YYMINORTYPE        is the data type used for all minor tokens.
+**                       This is typically a union of many types, one of
+**                       which is ParseTOKENTYPE.  The entry in the union
+**                       for base tokens is called "yy0".
+**    YYSTACKDEPTH       is the maximum depth of the parser's stack.
+**    ParseARG_SDECL     A static variable declaration for the %extra_argument
+**    ParseARG_PDECL     A parameter declaration for the %extra_argument
+**    ParseARG_STORE     Code to store %extra_argument into pparser
+**    ParseARG_FETCH     Code to extract %extra_argument from pparser
+**    YYNSTATE           the combined number of states.
+**    YYNRULE            the number of rules in the grammar
+**    YYERRORSYMBOL      is the code number of the error symbol.  If not
+**                       defined, then do no error processing.
+*/
+#define YYCODETYPE unsigned char
+#define YYNOCODE 238
+#define YYACTIONTYPE unsigned short int
+#define ParseTOKENTYPE mlr_dsl_ast_node_t*
+typedef union {
+  ParseTOKENTYPE yy0;
+  mlr_dsl_ast_node_t* yy433;
+  int yy475;
+} YYMINORTYPE;
+#define YYSTACKDEPTH 800
+#define ParseARG_SDECL mlr_dsl_ast_t* past;
+#define ParseARG_PDECL ,mlr_dsl_ast_t* past
+#define ParseARG_FETCH mlr_dsl_ast_t* past = pparser->past
+#define ParseARG_STORE pparser->past = past
+#define YYNSTATE 904
+#define YYNRULE 468
+#define YYERRORSYMBOL 106
+#define YYERRSYMDT yy475
+#define YY_NO_ACTION      (YYNSTATE+YYNRULE+2)
+#define YY_ACCEPT_ACTION  (YYNSTATE+YYNRULE+1)
+#define YY_ERROR_ACTION   (YYNSTATE+YYNRULE)
+
+/* Next are that tables used to determine what action to take based on the
+** current state and lookahead token.  These tables are used to implement
+** functions that take a state number and lookahead value and return an
+** action integer.
+**
+** Suppose the action integer is N.  Then the action is determined as
+** follows
+**
+**   0 <= N < YYNSTATE                  Shift N.  That is, push the lookahead
+**                                      token onto the stack and goto state N.
+**
+**   YYNSTATE <= N < YYNSTATE+YYNRULE   Reduce by rule N-YYNSTATE.
+**
+**   N == YYNSTATE+YYNRULE              A syntax error has occurred.
+**
+**   N == YYNSTATE+YYNRULE+1            The parser accepts its input.
+**
+**   N == YYNSTATE+YYNRULE+2            No such action.  Denotes unused
+**                                      slots in the yy_action[] table.
+**
+** The action table is constructed as a single large table named yy_action[].
+** Given state S and lookahead X, the action is computed as
+**
+**      yy_action[ yy_shift_ofst[S] + X ]
+**
+** If the index value yy_shift_ofst[S]+X is out of range or if the value
+** yy_lookahead[yy_shift_ofst[S]+X] is not equal to X or if yy_shift_ofst[S]
+** is equal to YY_SHIFT_USE_DFLT, it means that the action is not in the table
+** and that yy_default[S] should be used instead.
+**
+** The formula above is for computing the action when the lookahead is
+** a terminal symbol.  If the lookahead is a non-terminal (as occurs after
+** a reduce action) then the yy_reduce_ofst[] array is used in place of
+** the yy_shift_ofst[] array and YY_REDUCE_USE_DFLT is used in place of
+** YY_SHIFT_USE_DFLT.
+**
+** The following are the tables generated in this section:
+**
+**  yy_action[]        A single table containing all actions.
+**  yy_lookahead[]     A table containing the lookahead for each entry in
+**                     yy_action.  Used to detect hash collisions.
+**  yy_shift_ofst[]    For each state, the offset into yy_action for
+**                     shifting terminals.
+**  yy_reduce_ofst[]   For each state, the offset into yy_action for
+**                     shifting non-terminals after a reduce.
+**  yy_default[]       Default action for each state.
+*/
+static YYACTIONTYPE yy_action[] = {
+ /*     0 */  1373,    1,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*    10 */    12,   13,   14,  257,  310,  165,  166,  167,  168,  169,
+ /*    20 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*    30 */   120,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*    40 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*    50 */   202,  203,  204,  205,  206,  207,  208,  209,  210,  211,
+ /*    60 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*    70 */   222,  223,  224,  225,  226,  227,  228,  229,  230,   58,
+ /*    80 */    59,   89,   90,   91,  452,   29,   65,  144,  146,  287,
+ /*    90 */   904,  295,  888,  335,  373,  411,  491,    3,   60,  889,
+ /*   100 */   891,  893,  895,  897,   89,   90,   91,   18,   19,   24,
+ /*   110 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*   120 */    45,   54,   88,  100,  101,  903,    2,    4,    6,    7,
+ /*   130 */     8,    9,   10,   11,   12,   13,   14,  257,   22,  165,
+ /*   140 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*   150 */   176,  177,  178,  179,  120,  183,  184,  185,  186,  187,
+ /*   160 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*   170 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*   180 */   208,  209,  210,  211,  212,  213,  214,  215,  216,  217,
+ /*   190 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*   200 */   228,  229,  230,  868,   20,   31,  150,   27,  452,   43,
+ /*   210 */    76,   86,   95,  287,  883,  295,  802,  335,  373,  411,
+ /*   220 */   491,   25,   60,  803,  805,  807,  809,  811,   67,   81,
+ /*   230 */   140,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*   240 */    71,   83,   94,  104,   45,   54,   88,  100,  101,    5,
+ /*   250 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*   260 */    14,  257,   33,  165,  166,  167,  168,  169,  170,  171,
+ /*   270 */   172,  173,  174,  175,  176,  177,  178,  179,  120,  183,
+ /*   280 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*   290 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*   300 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+ /*   310 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*   320 */   224,  225,  226,  227,  228,  229,  230,   72,  124,  108,
+ /*   330 */  1013,  125,  452, 1013,   41,   74,   84,  287,   35,  295,
+ /*   340 */   182,  335,  373,  411,  491, 1013,   60,   37,  121,  126,
+ /*   350 */    89,   90,   91,   55,   39,   18,   19,   24,   63,   64,
+ /*   360 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*   370 */    88,  100,  101,  239,    2,    4,    6,    7,    8,    9,
+ /*   380 */    10,   11,   12,   13,   14,  257,   62,  165,  166,  167,
+ /*   390 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*   400 */   178,  179,  120,  183,  184,  185,  186,  187,  188,  189,
+ /*   410 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*   420 */   200,  201,  202,  203,  204,  205,  206,  207,  208,  209,
+ /*   430 */   210,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*   440 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*   450 */   230,  540,  547,  551,  129,  133,  452,  125,  125,  155,
+ /*   460 */   156,  287,   79,  295,   92,  335,  373,  411,  491,  103,
+ /*   470 */    60,  236,  902,  237,  899,  244,  900,  290,  779,   18,
+ /*   480 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*   490 */    94,  104,   45,   54,   88,  100,  101,  247,    2,    4,
+ /*   500 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  257,
+ /*   510 */   106,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*   520 */   174,  175,  176,  177,  178,  179,  120,  183,  184,  185,
+ /*   530 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*   540 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*   550 */   206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
+ /*   560 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*   570 */   226,  227,  228,  229,  230,  245,  279,  288,  886,  289,
+ /*   580 */   452,  310,  122,  310,  127,  287,  108,  295,  813,  335,
+ /*   590 */   373,  411,  491,  114,   60,  599,  490,  622,  605,  639,
+ /*   600 */   605,  116,  605,   18,   19,   24,   63,   64,   80,   93,
+ /*   610 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*   620 */   101,  251,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*   630 */    12,   13,   14,  257,   88,  165,  166,  167,  168,  169,
+ /*   640 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*   650 */   120,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*   660 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*   670 */   202,  203,  204,  205,  206,  207,  208,  209,  210,  211,
+ /*   680 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*   690 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  583,
+ /*   700 */   595,  618,  635,  644,  452,  674,  605,  697,  680,  287,
+ /*   710 */   680,  295,  119,  335,  373,  411,  491,  122,   60,  127,
+ /*   720 */   558,  135,   79,   79,   79,   79,  159,   18,   19,   24,
+ /*   730 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*   740 */    45,   54,   88,  100,  101,  255,    2,    4,    6,    7,
+ /*   750 */     8,    9,   10,   11,   12,   13,   14,  257,   88,  165,
+ /*   760 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*   770 */   176,  177,  178,  179,  120,  183,  184,  185,  186,  187,
+ /*   780 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*   790 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*   800 */   208,  209,  210,  211,  212,  213,  214,  215,  216,  217,
+ /*   810 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*   820 */   228,  229,  230,  658,  670,  693,  710,  714,  452,  719,
+ /*   830 */   680,  831,  680,  287,  850,  295,  137,  335,  373,  411,
+ /*   840 */   491,  139,   60,  143,  582,  149,   79,   79,   79,   79,
+ /*   850 */  1369,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*   860 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  259,
+ /*   870 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*   880 */    14,  257,   88,  165,  166,  167,  168,  169,  170,  171,
+ /*   890 */   172,  173,  174,  175,  176,  177,  178,  179,  120,  183,
+ /*   900 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*   910 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*   920 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+ /*   930 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*   940 */   224,  225,  226,  227,  228,  229,  230,  789,  794,  806,
+ /*   950 */   122,  234,  452,  808,  127,  860,  122,  287,  181,  295,
+ /*   960 */   235,  335,  373,  411,  491,  238,   60,  240,  594,  862,
+ /*   970 */   127,  242,  248,   79,  798,   18,   19,   24,   63,   64,
+ /*   980 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*   990 */    88,  100,  101,  266,    2,    4,    6,    7,    8,    9,
+ /*  1000 */    10,   11,   12,   13,   14,  257,   88,  165,  166,  167,
+ /*  1010 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  1020 */   178,  179,  120,  183,  184,  185,  186,  187,  188,  189,
+ /*  1030 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  1040 */   200,  201,  202,  203,  204,  205,  206,  207,  208,  209,
+ /*  1050 */   210,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  1060 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  1070 */   230,  820,  825,  870,  872,  243,  452,  876,  246,  250,
+ /*  1080 */   254,  287,  252,  295,  880,  335,  373,  411,  491,  256,
+ /*  1090 */    60,  258,  606,  260,  262,  265,  264,   79,  798,   18,
+ /*  1100 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  1110 */    94,  104,   45,   54,   88,  100,  101,  270,    2,    4,
+ /*  1120 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  257,
+ /*  1130 */    88,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*  1140 */   174,  175,  176,  177,  178,  179,  120,  183,  184,  185,
+ /*  1150 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  1160 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*  1170 */   206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
+ /*  1180 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  1190 */   226,  227,  228,  229,  230,  841,  846,  272,  273,  267,
+ /*  1200 */   452,  269,  275,  271,  277,  287,  280,  295,  281,  335,
+ /*  1210 */   373,  411,  491,  283,   60,  284,  617,  286,  291,  294,
+ /*  1220 */   293,   79,  798,   18,   19,   24,   63,   64,   80,   93,
+ /*  1230 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  1240 */   101,  285,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*  1250 */    12,   13,   14,  257,   88,  165,  166,  167,  168,  169,
+ /*  1260 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  1270 */   120,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*  1280 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  1290 */   202,  203,  204,  205,  206,  207,  208,  209,  210,  211,
+ /*  1300 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  1310 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  297,
+ /*  1320 */   300,  299,  310,  306,  452,  302,  307,  312,  313,  287,
+ /*  1330 */   316,  295,  317,  335,  373,  411,  491,  320,   60,  321,
+ /*  1340 */   634,  324,  328,  332,  152,  325,  334,   18,   19,   24,
+ /*  1350 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  1360 */    45,   54,   88,  100,  101,  777,    2,    4,    6,    7,
+ /*  1370 */     8,    9,   10,   11,   12,   13,   14,  257,   88,  165,
+ /*  1380 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  1390 */   176,  177,  178,  179,  120,  183,  184,  185,  186,  187,
+ /*  1400 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  1410 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*  1420 */   208,  209,  210,  211,  212,  213,  214,  215,  216,  217,
+ /*  1430 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  1440 */   228,  229,  230,  329,  333,  447,  450,  489,  452,  449,
+ /*  1450 */   530,  542,  543,  287,  549,  295,  550,  335,  373,  411,
+ /*  1460 */   491,  553,   60,  557,  657,  554,  562,  566,  570,  574,
+ /*  1470 */   576,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  1480 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  301,
+ /*  1490 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*  1500 */    14,  257,   88,  165,  166,  167,  168,  169,  170,  171,
+ /*  1510 */   172,  173,  174,  175,  176,  177,  178,  179,  120,  183,
+ /*  1520 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*  1530 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  1540 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+ /*  1550 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  1560 */   224,  225,  226,  227,  228,  229,  230,  580,  587,  589,
+ /*  1570 */   592,  600,  452,  602,  610,  612,  615,  287,  623,  295,
+ /*  1580 */   627,  335,  373,  411,  491,  629,   60,  632,  669,  640,
+ /*  1590 */   645,  649,  651,  655,  662,   18,   19,   24,   63,   64,
+ /*  1600 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  1610 */    88,  100,  101,  781,    2,    4,    6,    7,    8,    9,
+ /*  1620 */    10,   11,   12,   13,   14,  257,   88,  165,  166,  167,
+ /*  1630 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  1640 */   178,  179,  120,  183,  184,  185,  186,  187,  188,  189,
+ /*  1650 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  1660 */   200,  201,  202,  203,  204,  205,  206,  207,  208,  209,
+ /*  1670 */   210,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  1680 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  1690 */   230,  664,  667,  675,  677,  685,  452,  687,  690,  698,
+ /*  1700 */   702,  287,  704,  295,  707,  335,  373,  411,  491,  715,
+ /*  1710 */    60,  720,  681,  749,  753,  757,  765,  769,  773,   18,
+ /*  1720 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  1730 */    94,  104,   45,   54,   88,  100,  101,  786,    2,    4,
+ /*  1740 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  257,
+ /*  1750 */    88,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*  1760 */   174,  175,  176,  177,  178,  179,  120,  183,  184,  185,
+ /*  1770 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  1780 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*  1790 */   206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
+ /*  1800 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  1810 */   226,  227,  228,  229,  230,  778,  780,  784,  782,  785,
+ /*  1820 */   452,  787,  790,  800,  792,  287,  795,  295,  797,  335,
+ /*  1830 */   373,  411,  491,  804,   60,  806,  692,  808,  810,  812,
+ /*  1840 */   818,  833,  815,   18,   19,   24,   63,   64,   80,   93,
+ /*  1850 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  1860 */   101,  791,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*  1870 */    12,   13,   14,  257,   88,  165,  166,  167,  168,  169,
+ /*  1880 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  1890 */   120,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*  1900 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  1910 */   202,  203,  204,  205,  206,  207,  208,  209,  210,  211,
+ /*  1920 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  1930 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  816,
+ /*  1940 */   821,  834,  823,  826,  452,  828,  836,  832,  837,  287,
+ /*  1950 */   839,  295,  842,  335,  373,  411,  491,  844,   60,  847,
+ /*  1960 */   709,  849,  851,  858, 1348,  864,  866,   18,   19,   24,
+ /*  1970 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  1980 */    45,   54,   88,  100,  101,  796,    2,    4,    6,    7,
+ /*  1990 */     8,    9,   10,   11,   12,   13,   14,  257,   88,  165,
+ /*  2000 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  2010 */   176,  177,  178,  179,  120,  183,  184,  185,  186,  187,
+ /*  2020 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  2030 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*  2040 */   208,  209,  210,  211,  212,  213,  214,  215,  216,  217,
+ /*  2050 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  2060 */   228,  229,  230,  873,  890,  875,  887,  892,  452,  894,
+ /*  2070 */   896,  898,  901,  287,  707,  295,  707,  335,  373,  411,
+ /*  2080 */   491,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /*  2090 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  2100 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  817,
+ /*  2110 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*  2120 */    14,  257,  707,  165,  166,  167,  168,  169,  170,  171,
+ /*  2130 */   172,  173,  174,  175,  176,  177,  178,  179,  120,  183,
+ /*  2140 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*  2150 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  2160 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+ /*  2170 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  2180 */   224,  225,  226,  227,  228,  229,  230,  707,  707,  707,
+ /*  2190 */   707,  707,  452,  707,  707,  707,  707,  287,  707,  295,
+ /*  2200 */   707,  335,  373,  411,  491,  707,   60,  707,  707,  707,
+ /*  2210 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  2220 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  2230 */    88,  100,  101,  822,    2,    4,    6,    7,    8,    9,
+ /*  2240 */    10,   11,   12,   13,   14,  257,  707,  165,  166,  167,
+ /*  2250 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  2260 */   178,  179,  120,  183,  184,  185,  186,  187,  188,  189,
+ /*  2270 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  2280 */   200,  201,  202,  203,  204,  205,  206,  207,  208,  209,
+ /*  2290 */   210,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  2300 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  2310 */   230,  707,  707,  707,  707,  707,  452,  707,  707,  707,
+ /*  2320 */   707,  287,  707,  295,  707,  335,  373,  411,  491,  707,
+ /*  2330 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /*  2340 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  2350 */    94,  104,   45,   54,   88,  100,  101,  827,    2,    4,
+ /*  2360 */     6,    7,    8,    9,   10,   11,   12,   13,   14,  257,
+ /*  2370 */   707,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*  2380 */   174,  175,  176,  177,  178,  179,  120,  183,  184,  185,
+ /*  2390 */   186,  187,  188,  189,  190,  191,  192,  193,  194,  195,
+ /*  2400 */   196,  197,  198,  199,  200,  201,  202,  203,  204,  205,
+ /*  2410 */   206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
+ /*  2420 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  2430 */   226,  227,  228,  229,  230,  707,  707,  707,  707,  707,
+ /*  2440 */   452,  707,  707,  707,  707,  287,  707,  295,  707,  335,
+ /*  2450 */   373,  411,  491,  707,   60,  707,  707,  707,  707,  707,
+ /*  2460 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  2470 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  2480 */   101,  838,    2,    4,    6,    7,    8,    9,   10,   11,
+ /*  2490 */    12,   13,   14,  257,  707,  165,  166,  167,  168,  169,
+ /*  2500 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  2510 */   120,  183,  184,  185,  186,  187,  188,  189,  190,  191,
+ /*  2520 */   192,  193,  194,  195,  196,  197,  198,  199,  200,  201,
+ /*  2530 */   202,  203,  204,  205,  206,  207,  208,  209,  210,  211,
+ /*  2540 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  2550 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  707,
+ /*  2560 */   707,  707,  707,  707,  452,  707,  707,  707,  707,  287,
+ /*  2570 */   707,  295,  707,  335,  373,  411,  491,  707,   60,  707,
+ /*  2580 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /*  2590 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  2600 */    45,   54,   88,  100,  101,  843,    2,    4,    6,    7,
+ /*  2610 */     8,    9,   10,   11,   12,   13,   14,  257,  707,  165,
+ /*  2620 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  2630 */   176,  177,  178,  179,  120,  183,  184,  185,  186,  187,
+ /*  2640 */   188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+ /*  2650 */   198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+ /*  2660 */   208,  209,  210,  211,  212,  213,  214,  215,  216,  217,
+ /*  2670 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  2680 */   228,  229,  230,  707,  707,  707,  707,  707,  452,  707,
+ /*  2690 */   707,  707,  707,  287,  707,  295,  707,  335,  373,  411,
+ /*  2700 */   491,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /*  2710 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  2720 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  848,
+ /*  2730 */     2,    4,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*  2740 */    14,  257,  707,  165,  166,  167,  168,  169,  170,  171,
+ /*  2750 */   172,  173,  174,  175,  176,  177,  178,  179,  120,  183,
+ /*  2760 */   184,  185,  186,  187,  188,  189,  190,  191,  192,  193,
+ /*  2770 */   194,  195,  196,  197,  198,  199,  200,  201,  202,  203,
+ /*  2780 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+ /*  2790 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  2800 */   224,  225,  226,  227,  228,  229,  230,  707,  707,  707,
+ /*  2810 */   707,  707,  452,  707,  707,  707,  707,  287,  707,  295,
+ /*  2820 */   707,  335,  373,  411,  491,  707,   60,  707,  707,  707,
+ /*  2830 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  2840 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  2850 */    88,  100,  101,  874,    2,    4,    6,    7,    8,    9,
+ /*  2860 */    10,   11,   12,   13,   14,  257,  707,  165,  166,  167,
+ /*  2870 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  2880 */   178,  179,  120,  183,  184,  185,  186,  187,  188,  189,
+ /*  2890 */   190,  191,  192,  193,  194,  195,  196,  197,  198,  199,
+ /*  2900 */   200,  201,  202,  203,  204,  205,  206,  207,  208,  209,
+ /*  2910 */   210,  211,  212,  213,  214,  215,  216,  217,  218,  219,
+ /*  2920 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  2930 */   230,  707,  707,  707,  707,  707,  452,  707,  707,  707,
+ /*  2940 */   559,  287,  707,  295,  707,  335,  373,  411,  491,  707,
+ /*  2950 */    60,  560,  564,  568,  707,  707,  556,  707,  707,   18,
+ /*  2960 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  2970 */    94,  104,   45,   54,   88,  100,  101,  885,   88,    6,
+ /*  2980 */     7,    8,    9,   10,   11,   12,   13,   14,  878,  707,
+ /*  2990 */   707,  707,   89,   90,   91,  707,  707,  707,  707,  707,
+ /*  3000 */   707,  707,  707,  707,  707,  120,  183,  184,  185,  186,
+ /*  3010 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  3020 */   197,  198,  199,  200,  201,  202,  203,  204,  205,  206,
+ /*  3030 */   207,  208,  209,  210,  211,  212,  213,  214,  215,  216,
+ /*  3040 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  3050 */   227,  228,  229,  230,  707,  707,  707,  278,  707,  452,
+ /*  3060 */   707,  867,  707,  788,  793,  536,  707,  707,  335,  373,
+ /*  3070 */   411,  491,  801,   60,  537,  538,  533,  707,  529,  534,
+ /*  3080 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  3090 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  3100 */   740,   88,  707,   88,  727,  707,  707,  707,  707,  738,
+ /*  3110 */   739,  310,  707,  725,  726,  882,  707,    6,    7,    8,
+ /*  3120 */     9,   10,   11,   12,   13,   14,  878,  707,  707,  282,
+ /*  3130 */   783,  707,  707,  707,  707,  707,  707,  707,   88,  707,
+ /*  3140 */   707,  707,   88,  120,  183,  184,  185,  186,  187,  188,
+ /*  3150 */   189,  190,  191,  192,  193,  194,  195,  196,  197,  198,
+ /*  3160 */   199,  200,  201,  202,  203,  204,  205,  206,  207,  208,
+ /*  3170 */   209,  210,  211,  212,  213,  214,  215,  216,  217,  218,
+ /*  3180 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  3190 */   229,  230,  707,  707,  707,  707,  707,  452,  707,  707,
+ /*  3200 */   869,   89,   90,   91,  732,  532,  335,  373,  411,  491,
+ /*  3210 */   707,   60,  707,  730,  731,  707,  531,  707,  707,  707,
+ /*  3220 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  3230 */    83,   94,  104,   45,   54,   88,  100,  101,  737,  707,
+ /*  3240 */   744,  707,   88,   88,  707,  707,  707,  735,  736,  742,
+ /*  3250 */   743,  707,  707,  879,  707,    6,    7,    8,    9,   10,
+ /*  3260 */    11,   12,   13,   14,  878,  707,  707,  707,  707,  707,
+ /*  3270 */   707,  707,  707,  707,  707,  707,   88,  707,   88,  707,
+ /*  3280 */   707,  120,  183,  184,  185,  186,  187,  188,  189,  190,
+ /*  3290 */   191,  192,  193,  194,  195,  196,  197,  198,  199,  200,
+ /*  3300 */   201,  202,  203,  204,  205,  206,  207,  208,  209,  210,
+ /*  3310 */   211,  212,  213,  214,  215,  216,  217,  218,  219,  220,
+ /*  3320 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  3330 */   707,  707,  707,  707,  707,  452,  707,  707,  707,  871,
+ /*  3340 */   559,  819,  824,  707,  335,  373,  411,  491,  707,   60,
+ /*  3350 */   801,  707,  707,  707,  707,  707,  563,  707,   18,   19,
+ /*  3360 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  3370 */   104,   45,   54,   88,  100,  101,  840,  845,   88,   88,
+ /*  3380 */   707,  707,  707,  707,  707,  801,  707,  707,  707,  707,
+ /*  3390 */   707,  877,  707,    6,    7,    8,    9,   10,   11,   12,
+ /*  3400 */    13,   14,  878,  707,  707,  707,  707,  707,  707,  707,
+ /*  3410 */   707,  707,  707,  707,   88,  707,  707,  707,  707,  120,
+ /*  3420 */   183,  184,  185,  186,  187,  188,  189,  190,  191,  192,
+ /*  3430 */   193,  194,  195,  196,  197,  198,  199,  200,  201,  202,
+ /*  3440 */   203,  204,  205,  206,  207,  208,  209,  210,  211,  212,
+ /*  3450 */   213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  3460 */   223,  224,  225,  226,  227,  228,  229,  230,  707,  707,
+ /*  3470 */   707,  707,  707,  452,  707,  707,  559,  559,  707,  707,
+ /*  3480 */   707,  707,  335,  373,  411,  491,  707,   60,  707,  707,
+ /*  3490 */   707,  707,  567,  571,  707,  707,   18,   19,   24,   63,
+ /*  3500 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  3510 */    54,   88,  100,  101,   88,   88,  707,  707,  707,  707,
+ /*  3520 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  881,
+ /*  3530 */   707,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*  3540 */   878,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  3550 */   707,  707,  707,  707,  707,  707,  707,  120,  183,  184,
+ /*  3560 */   185,  186,  187,  188,  189,  190,  191,  192,  193,  194,
+ /*  3570 */   195,  196,  197,  198,  199,  200,  201,  202,  203,  204,
+ /*  3580 */   205,  206,  207,  208,  209,  210,  211,  212,  213,  214,
+ /*  3590 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  3600 */   225,  226,  227,  228,  229,  230,  707,  707,  707,  707,
+ /*  3610 */   707,  452,  707,  707,  607,  707,  707,  707,  707,  707,
+ /*  3620 */   335,  373,  411,  491,  707,   60,  707,  707,  707,  707,
+ /*  3630 */   707,  707,  707,  598,   18,   19,   24,   63,   64,   80,
+ /*  3640 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  3650 */   100,  101,   88,  707,  707,  707,  707,  707,  707,  707,
+ /*  3660 */   707,  707,  707,  707,  707,  707,  707,  884,  707,    6,
+ /*  3670 */     7,    8,    9,   10,   11,   12,   13,   14,  878,  707,
+ /*  3680 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  3690 */   707,  707,  707,  707,  707,  120,  183,  184,  185,  186,
+ /*  3700 */   187,  188,  189,  190,  191,  192,  193,  194,  195,  196,
+ /*  3710 */   197,  198,  199,  200,  201,  202,  203,  204,  205,  206,
+ /*  3720 */   207,  208,  209,  210,  211,  212,  213,  214,  215,  216,
+ /*  3730 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  3740 */   227,  228,  229,  230,  707,  310,  707,  707,  310,  452,
+ /*  3750 */   707,  707,  707,  707,  707,  707,  707,  707,  335,  373,
+ /*  3760 */   411,  491,  707,   60,  814,  707,  707,  835,  707,  707,
+ /*  3770 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  3780 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  3790 */   909,   15,  180,  231,  232,  233,  107,  117,  707,  707,
+ /*  3800 */   707,  707,  241,  311,  315,  319,  327,  323,  249,  253,
+ /*  3810 */   261,  268,  276,  642,  488,  707,  296,  707,  707,  303,
+ /*  3820 */   305,  707,  331,  446,  707,  707,  607,  607,  607,  707,
+ /*  3830 */   707,  579,  707,  707,  707,   89,   90,   91,   89,   90,
+ /*  3840 */    91,  707,  526,  707,  539,  621,  638,  643,  555,  572,
+ /*  3850 */   647,  722,  741,  745,  759,  761,  775,  707,  707,  573,
+ /*  3860 */   707,  585,  608,  625,   88,   88,   88,  707,  707,  707,
+ /*  3870 */   707,  707,  707,  707,   46,   48,  707,  707,  707,  120,
+ /*  3880 */   707,   50,   52,  707,   58,   59,   89,   90,   91,   97,
+ /*  3890 */    98,   99,  110,  111,  113,   15,  180,  231,  232,  233,
+ /*  3900 */   107,  117,   89,   90,   91,  707,  241,  311,  315,  319,
+ /*  3910 */   327,  323,  249,  253,  261,  268,  276,  707,  488,  707,
+ /*  3920 */   296,  707,  707,  303,  305,  707,  331,  446,  707,  707,
+ /*  3930 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /*  3940 */   707,  707,  102,  105,   57,  112,  526,   60,  539,  707,
+ /*  3950 */   707,  707,  555,  572,  647,  722,  741,  745,  759,  761,
+ /*  3960 */   775,   30,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  3970 */    54,   88,  100,  101,  707,  707,  707,  707,   46,   48,
+ /*  3980 */   120,  707,  682,  707,  707,   50,   52,  310,   58,   59,
+ /*  3990 */    89,   90,   91,   97,   98,   99,  110,  111,  113,   15,
+ /*  4000 */   180,  231,  232,  673,  852,  829,  707,  707,  707,  707,
+ /*  4010 */   707,  857,  859,  861,  863,  865,  707,  707,  707,  268,
+ /*  4020 */    88,  707,  488,  707,  707,  707,  707,  303,  305,  707,
+ /*  4030 */   331,  446,  707,  707,   78,  707,  723,  728,  733,  707,
+ /*  4040 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  4050 */   526,  707,  539,  707,  707,  707,  555,  572,  647,  722,
+ /*  4060 */   741,  745,  759,  761,  775,   36,   71,   83,   94,  104,
+ /*  4070 */    45,   54,   88,  100,  101,  707,  707,   89,   90,   91,
+ /*  4080 */   707,  707,   46,   48,  120,  707,  682,  707,  707,   50,
+ /*  4090 */    52,  682,   58,   59,   89,   90,   91,   97,   98,   99,
+ /*  4100 */   110,  111,  113,   15,  180,  231,  232,  696,  107,  117,
+ /*  4110 */   707,  707,  713,  707,  707,  311,  315,  319,  327,  323,
+ /*  4120 */   707,  707,  707,  268,   88,  707,  488,  707,  707,   88,
+ /*  4130 */   707,  303,  305,  707,  331,  446,  163,  707,   78,  707,
+ /*  4140 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  4150 */   112,  707,   60,  120,  526,  707,  539,  707,  707,  707,
+ /*  4160 */   555,  572,  647,  722,  741,  745,  759,  761,  775,  707,
+ /*  4170 */    38,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /*  4180 */   707,  707,  707,  707,  707,  707,   46,   48,  707,  707,
+ /*  4190 */   682,  707,  707,   50,   52,  707,   58,   59,   89,   90,
+ /*  4200 */    91,   97,   98,   99,  110,  111,  113,   78,  707,  120,
+ /*  4210 */   163,  718,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  4220 */   707,   60,  707,  707,  707,  707,  707,  120,   88,  707,
+ /*  4230 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  4240 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  154,
+ /*  4250 */   164,  158,  161,  162,  707,  707,  707,  707,  707,  707,
+ /*  4260 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  120,
+ /*  4270 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  4280 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  4290 */   102,  105,   57,  112,  707,   60,   40,   94,  104,   45,
+ /*  4300 */    54,   88,  100,  101,   18,   19,   24,   63,   64,   80,
+ /*  4310 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  4320 */   100,  101,  118,   78,  157,  158,  707,  707,  707,  707,
+ /*  4330 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  120,
+ /*  4340 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  4350 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  4360 */    54,   88,  100,  101,   16,   17,  707,  707,  160,  707,
+ /*  4370 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  4380 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  120,
+ /*  4390 */   707,  856,  830,   78,  707,  707,  707,  707,  707,  707,
+ /*  4400 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  4410 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  4420 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  4430 */    54,   88,  100,  101,  130,   78,  707,  707,  707,  707,
+ /*  4440 */   707,  707,  707,   78,  102,  105,   57,  112,  707,   60,
+ /*  4450 */   707,  120,  102,  105,   57,  112,  707,   60,   18,   19,
+ /*  4460 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  4470 */   104,   45,   54,   88,  100,  101,  130,   42,  104,   45,
+ /*  4480 */    54,   88,  100,  101,  707,  707,  707,  707,  707,  707,
+ /*  4490 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /*  4500 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /*  4510 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  4520 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /*  4530 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  4540 */   104,   45,   54,   88,  100,  101,  132,   78,  130,  717,
+ /*  4550 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  4560 */   707,   60,  707,  707,  707,  120,  707,  654,  707,  707,
+ /*  4570 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  4580 */    83,   94,  104,   45,   54,   88,  100,  101,  123,  707,
+ /*  4590 */   308,  309,  707,  707,  707,  648,  707,  660,  683,  700,
+ /*  4600 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /*  4610 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /*  4620 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  4630 */    57,  112,  707,   60,  707,  707,  707,  707,   89,   90,
+ /*  4640 */    91,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  4650 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  4660 */   128,   78,  337,  338,  597,  707,  707,  707,  707,  707,
+ /*  4670 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /*  4680 */   707,  707,  591,  707,   18,   19,   24,   63,   64,   80,
+ /*  4690 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  4700 */   100,  101,  707,  375,  376,  620,  707,  707,  707,  707,
+ /*  4710 */   588,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  4720 */   120,  707,  707,  614,  707,  707,  707,  707,  707,  707,
+ /*  4730 */   707,  707,  637,   78,  707,  707,  707,  707,  707,  707,
+ /*  4740 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  4750 */   631,  611,  707,   89,   90,   91,   18,   19,   24,   63,
+ /*  4760 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  4770 */    54,   88,  100,  101,   78,  544,  707,  707,  628,  707,
+ /*  4780 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  4790 */   707,  707,  120,  707,   89,   90,   91,   18,   19,   24,
+ /*  4800 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  4810 */    45,   54,   88,  100,  101,  707,  544,  707,  672,  707,
+ /*  4820 */   707,   89,   90,   91,  707,  707,  707,  707,  707,  707,
+ /*  4830 */   707,  707,  707,  120,  707,  707,  666,  707,  707,  707,
+ /*  4840 */   707,  707,  707,  707,  707,  695,   78,  707,  707,  707,
+ /*  4850 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  4860 */    60,  541,  707,  689,  663,  707,  707,  707,  707,   18,
+ /*  4870 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  4880 */    94,  104,   45,   54,   88,  100,  101,   78,  544,  707,
+ /*  4890 */   707,  686,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  4900 */   707,   60,  548,  707,  707,  120,  707,   89,   90,   91,
+ /*  4910 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  4920 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  544,
+ /*  4930 */   707,  712,  707,  707,   89,   90,   91,  707,  707,  707,
+ /*  4940 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  706,
+ /*  4950 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /*  4960 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  4970 */    57,  112,  707,   60,  561,  707,  707,  703,  707,  707,
+ /*  4980 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  4990 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  5000 */    78,  578,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  5010 */   105,   57,  112,  707,   60,  565,  707,  707,  120,  707,
+ /*  5020 */    89,   90,   91,   18,   19,   24,   63,   64,   80,   93,
+ /*  5030 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  5040 */   101,  707,  578,  707,  707,  707,  707,  707,  707,  707,
+ /*  5050 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /*  5060 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5070 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /*  5080 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  575,
+ /*  5090 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  5100 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  5110 */    88,  100,  101,   78,  578,  707,  707,  707,  707,  707,
+ /*  5120 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  5130 */   581,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  5140 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  5150 */    54,   88,  100,  101,  707,  544,  707,  707,  707,  707,
+ /*  5160 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5170 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /*  5180 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /*  5190 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  5200 */   707,  707,  584,  707,  707,  707,  707,  707,   18,   19,
+ /*  5210 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  5220 */   104,   45,   54,   88,  100,  101,   78,  578,  707,  707,
+ /*  5230 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  5240 */    60,  586,  707,  707,  120,  707,  707,  707,  707,   18,
+ /*  5250 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  5260 */    94,  104,   45,   54,   88,  100,  101,  707,  578,  707,
+ /*  5270 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5280 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /*  5290 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /*  5300 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  5310 */   112,  707,   60,  707,  707,  590,  707,  707,  707,  707,
+ /*  5320 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  5330 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /*  5340 */   578,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  5350 */    57,  112,  707,   60,  707,  707,  593,  120,  707,  707,
+ /*  5360 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  5370 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  5380 */   707,  604,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5390 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /*  5400 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5410 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5420 */   102,  105,   57,  112,  707,   60,  707,  707,  596,  707,
+ /*  5430 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  5440 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  5450 */   100,  101,   78,  544,  707,  707,  707,  707,  707,  707,
+ /*  5460 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  5470 */   120,  707,  601,  707,  707,   18,   19,   24,   63,   64,
+ /*  5480 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  5490 */    88,  100,  101,  707,  578,  707,  707,  707,  707,  707,
+ /*  5500 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5510 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5520 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /*  5530 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  609,
+ /*  5540 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /*  5550 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  5560 */    45,   54,   88,  100,  101,   78,  578,  707,  707,  707,
+ /*  5570 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  5580 */   707,  707,  613,  120,  707,  707,  707,  707,   18,   19,
+ /*  5590 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  5600 */   104,   45,   54,   88,  100,  101,  707,  578,  707,  707,
+ /*  5610 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5620 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /*  5630 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /*  5640 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  5650 */   707,   60,  707,  707,  616,  707,  707,  707,  707,  707,
+ /*  5660 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  5670 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  604,
+ /*  5680 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  5690 */   112,  707,   60,  707,  707,  619,  120,  707,  707,  707,
+ /*  5700 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  5710 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /*  5720 */   578,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5730 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /*  5740 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5750 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  5760 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /*  5770 */   624,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  5780 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  5790 */   101,   78,  578,  707,  707,  707,  707,  707,  707,  707,
+ /*  5800 */   102,  105,   57,  112,  707,   60,  707,  707,  630,  120,
+ /*  5810 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  5820 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  5830 */   100,  101,  707,  578,  707,  707,  707,  707,  707,  707,
+ /*  5840 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5850 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5860 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /*  5870 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  5880 */   633,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  5890 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  5900 */    54,   88,  100,  101,   78,  604,  707,  707,  707,  707,
+ /*  5910 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  5920 */   707,  636,  120,  707,  707,  707,  707,   18,   19,   24,
+ /*  5930 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  5940 */    45,   54,   88,  100,  101,  707,  604,  707,  707,  707,
+ /*  5950 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  5960 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /*  5970 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /*  5980 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  5990 */    60,  707,  707,  707,  707,  707,  641,  707,  707,   18,
+ /*  6000 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  6010 */    94,  104,   45,   54,   88,  100,  101,   78,  653,  707,
+ /*  6020 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  6030 */   707,   60,  707,  707,  707,  120,  707,  646,  707,  707,
+ /*  6040 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  6050 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  653,
+ /*  6060 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6070 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /*  6080 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /*  6090 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  6100 */    57,  112,  707,   60,  707,  707,  707,  650,  707,  707,
+ /*  6110 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  6120 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  6130 */    78,  707,  653,  707,  707,  707,  707,  707,  707,  102,
+ /*  6140 */   105,   57,  112,  707,   60,  707,  707,  707,  656,  120,
+ /*  6150 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  6160 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  6170 */   101,  707,  707,  544,  707,  707,  707,  707,  707,  707,
+ /*  6180 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6190 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6200 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /*  6210 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  6220 */   707,  659,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  6230 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  6240 */    54,   88,  100,  101,   78,  653,  707,  707,  707,  707,
+ /*  6250 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  661,
+ /*  6260 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /*  6270 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  6280 */    45,   54,   88,  100,  101,  707,  653,  707,  707,  707,
+ /*  6290 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6300 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /*  6310 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /*  6320 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  6330 */    60,  707,  707,  707,  665,  707,  707,  707,  707,   18,
+ /*  6340 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  6350 */    94,  104,   45,   54,   88,  100,  101,   78,  707,  653,
+ /*  6360 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  6370 */   707,   60,  707,  707,  707,  668,  120,  707,  707,  707,
+ /*  6380 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  6390 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  707,
+ /*  6400 */   679,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6410 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /*  6420 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6430 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  6440 */   105,   57,  112,  707,   60,  707,  707,  707,  671,  707,
+ /*  6450 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  6460 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  6470 */   101,   78,  544,  707,  707,  707,  707,  707,  707,  707,
+ /*  6480 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /*  6490 */   707,  707,  707,  676,   18,   19,   24,   63,   64,   80,
+ /*  6500 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  6510 */   100,  101,  707,  653,  707,  707,  707,  707,  707,  707,
+ /*  6520 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6530 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6540 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /*  6550 */   707,  707,  102,  105,   57,  112,  707,   60,  684,  707,
+ /*  6560 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  6570 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  6580 */    54,   88,  100,  101,   78,  707,  653,  707,  707,  707,
+ /*  6590 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  6600 */   707,  707,  688,  120,  707,  707,  707,   18,   19,   24,
+ /*  6610 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  6620 */    45,   54,   88,  100,  101,  707,  707,  653,  707,  707,
+ /*  6630 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6640 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /*  6650 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /*  6660 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  6670 */   707,   60,  707,  707,  707,  691,  707,  707,  707,  707,
+ /*  6680 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  6690 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  707,
+ /*  6700 */   679,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  6710 */   112,  707,   60,  707,  707,  707,  694,  120,  707,  707,
+ /*  6720 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  6730 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /*  6740 */   707,  653,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6750 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /*  6760 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6770 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6780 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /*  6790 */   707,  707,  707,  699,   18,   19,   24,   63,   64,   80,
+ /*  6800 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  6810 */   100,  101,   78,  707,  653,  707,  707,  707,  707,  707,
+ /*  6820 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  6830 */   705,  120,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  6840 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  6850 */    88,  100,  101,  707,  707,  653,  707,  707,  707,  707,
+ /*  6860 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6870 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /*  6880 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /*  6890 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  6900 */   707,  707,  707,  708,  707,  707,  707,  707,   18,   19,
+ /*  6910 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  6920 */   104,   45,   54,   88,  100,  101,   78,  707,  679,  707,
+ /*  6930 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  6940 */    60,  707,  707,  707,  711,  120,  707,  707,  707,   18,
+ /*  6950 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  6960 */    94,  104,   45,   54,   88,  100,  101,  707,  707,  679,
+ /*  6970 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  6980 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /*  6990 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /*  7000 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  7010 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /*  7020 */   707,  716,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  7030 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  7040 */    78,  544,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  7050 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /*  7060 */   707,  707,  721,   18,   19,   24,   63,   64,   80,   93,
+ /*  7070 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  7080 */   101,  707,  544,  707,  707,  707,  707,  707,  707,  707,
+ /*  7090 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /*  7100 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7110 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /*  7120 */   707,  102,  105,   57,  112,  707,   60,  724,  707,  707,
+ /*  7130 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  7140 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  7150 */    88,  100,  101,   78,  544,  707,  707,  707,  707,  707,
+ /*  7160 */   707,  707,  102,  105,   57,  112,  707,   60,  729,  707,
+ /*  7170 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  7180 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  7190 */    54,   88,  100,  101,  707,  544,  707,  707,  707,  707,
+ /*  7200 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7210 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /*  7220 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /*  7230 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  7240 */   748,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /*  7250 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  7260 */   104,   45,   54,   88,  100,  101,   78,  544,  707,  707,
+ /*  7270 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  7280 */    60,  752,  707,  707,  120,  707,  707,  707,  707,   18,
+ /*  7290 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  7300 */    94,  104,   45,   54,   88,  100,  101,  707,  544,  707,
+ /*  7310 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7320 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /*  7330 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /*  7340 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  7350 */   112,  707,   60,  764,  707,  707,  707,  707,  707,  707,
+ /*  7360 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  7370 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /*  7380 */   148,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  7390 */    57,  112,  707,   60,  768,  707,  707,  120,  707,  707,
+ /*  7400 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  7410 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  7420 */   707,  142,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7430 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /*  7440 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7450 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7460 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /*  7470 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  7480 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  7490 */   100,  101,   78,  138,  707,  707,  707,  707,  707,  707,
+ /*  7500 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  7510 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  7520 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  7530 */    88,  100,  101,  707,  136,  707,  707,  707,  707,  707,
+ /*  7540 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7550 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7560 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /*  7570 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  7580 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /*  7590 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  7600 */    45,   54,   88,  100,  101,   78,  134,  707,  707,  707,
+ /*  7610 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  7620 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /*  7630 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  7640 */   104,   45,   54,   88,  100,  101,  707,  115,  707,  707,
+ /*  7650 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7660 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /*  7670 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /*  7680 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  7690 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7700 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  7710 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  118,
+ /*  7720 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  7730 */   112,  707,   60,  707,  707,  707,  120,  707,  707,  707,
+ /*  7740 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  7750 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /*  7760 */   131,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7770 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /*  7780 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7790 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  7800 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /*  7810 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  7820 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  7830 */   101,   78,  263,  707,  707,  707,  707,  707,  707,  707,
+ /*  7840 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /*  7850 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  7860 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  7870 */   100,  101,  707,  274,  707,  707,  707,  707,  707,  707,
+ /*  7880 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7890 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  7900 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /*  7910 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  7920 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  7930 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  7940 */    54,   88,  100,  101,   78,  292,  707,  707,  707,  707,
+ /*  7950 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  7960 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /*  7970 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  7980 */    45,   54,   88,  100,  101,  707,  298,  707,  707,  707,
+ /*  7990 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8000 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /*  8010 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /*  8020 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  8030 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /*  8040 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  8050 */    94,  104,   45,   54,   88,  100,  101,   78,  304,  707,
+ /*  8060 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  8070 */   707,   60,  707,  707,  707,  120,  707,  707,  707,  707,
+ /*  8080 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  8090 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  314,
+ /*  8100 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8110 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /*  8120 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /*  8130 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  8140 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /*  8150 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  8160 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  8170 */    78,  318,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  8180 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /*  8190 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  8200 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  8210 */   101,  707,  322,  707,  707,  707,  707,  707,  707,  707,
+ /*  8220 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /*  8230 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8240 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /*  8250 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  8260 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  8270 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  8280 */    88,  100,  101,   78,  326,  707,  707,  707,  707,  707,
+ /*  8290 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  8300 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  8310 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  8320 */    54,   88,  100,  101,  707,  330,  707,  707,  707,  707,
+ /*  8330 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8340 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /*  8350 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /*  8360 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  8370 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /*  8380 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  8390 */   104,   45,   54,   88,  100,  101,   78,  342,  707,  707,
+ /*  8400 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  8410 */    60,  707,  707,  707,  120,  707,  707,  707,  707,   18,
+ /*  8420 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  8430 */    94,  104,   45,   54,   88,  100,  101,  707,  344,  707,
+ /*  8440 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8450 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /*  8460 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /*  8470 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  8480 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /*  8490 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  8500 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /*  8510 */   346,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  8520 */    57,  112,  707,   60,  707,  707,  707,  120,  707,  707,
+ /*  8530 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  8540 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  8550 */   707,  348,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8560 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /*  8570 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8580 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8590 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /*  8600 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  8610 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  8620 */   100,  101,   78,  350,  707,  707,  707,  707,  707,  707,
+ /*  8630 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  8640 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  8650 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  8660 */    88,  100,  101,  707,  352,  707,  707,  707,  707,  707,
+ /*  8670 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8680 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8690 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /*  8700 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  8710 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /*  8720 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  8730 */    45,   54,   88,  100,  101,   78,  354,  707,  707,  707,
+ /*  8740 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  8750 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /*  8760 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  8770 */   104,   45,   54,   88,  100,  101,  707,  356,  707,  707,
+ /*  8780 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8790 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /*  8800 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /*  8810 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  8820 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8830 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  8840 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  358,
+ /*  8850 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  8860 */   112,  707,   60,  707,  707,  707,  120,  707,  707,  707,
+ /*  8870 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  8880 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /*  8890 */   360,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8900 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /*  8910 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  8920 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  8930 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /*  8940 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  8950 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  8960 */   101,   78,  362,  707,  707,  707,  707,  707,  707,  707,
+ /*  8970 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /*  8980 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  8990 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  9000 */   100,  101,  707,  364,  707,  707,  707,  707,  707,  707,
+ /*  9010 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9020 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9030 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /*  9040 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  9050 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  9060 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  9070 */    54,   88,  100,  101,   78,  366,  707,  707,  707,  707,
+ /*  9080 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  9090 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /*  9100 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  9110 */    45,   54,   88,  100,  101,  707,  368,  707,  707,  707,
+ /*  9120 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9130 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /*  9140 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /*  9150 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  9160 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /*  9170 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  9180 */    94,  104,   45,   54,   88,  100,  101,   78,  370,  707,
+ /*  9190 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  9200 */   707,   60,  707,  707,  707,  120,  707,  707,  707,  707,
+ /*  9210 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  9220 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  372,
+ /*  9230 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9240 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /*  9250 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /*  9260 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  9270 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /*  9280 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  9290 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  9300 */    78,  380,  707,  707,  707,  707,  707,  707,  707,  102,
+ /*  9310 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /*  9320 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /*  9330 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /*  9340 */   101,  707,  382,  707,  707,  707,  707,  707,  707,  707,
+ /*  9350 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /*  9360 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9370 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /*  9380 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  9390 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  9400 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  9410 */    88,  100,  101,   78,  384,  707,  707,  707,  707,  707,
+ /*  9420 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /*  9430 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /*  9440 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /*  9450 */    54,   88,  100,  101,  707,  386,  707,  707,  707,  707,
+ /*  9460 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9470 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /*  9480 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /*  9490 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  9500 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /*  9510 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  9520 */   104,   45,   54,   88,  100,  101,   78,  388,  707,  707,
+ /*  9530 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /*  9540 */    60,  707,  707,  707,  120,  707,  707,  707,  707,   18,
+ /*  9550 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /*  9560 */    94,  104,   45,   54,   88,  100,  101,  707,  390,  707,
+ /*  9570 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9580 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /*  9590 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /*  9600 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  9610 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /*  9620 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /*  9630 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /*  9640 */   392,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /*  9650 */    57,  112,  707,   60,  707,  707,  707,  120,  707,  707,
+ /*  9660 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /*  9670 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /*  9680 */   707,  394,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9690 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /*  9700 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9710 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9720 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /*  9730 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /*  9740 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /*  9750 */   100,  101,   78,  396,  707,  707,  707,  707,  707,  707,
+ /*  9760 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /*  9770 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /*  9780 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /*  9790 */    88,  100,  101,  707,  398,  707,  707,  707,  707,  707,
+ /*  9800 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9810 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9820 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /*  9830 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /*  9840 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /*  9850 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /*  9860 */    45,   54,   88,  100,  101,   78,  400,  707,  707,  707,
+ /*  9870 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /*  9880 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /*  9890 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /*  9900 */   104,   45,   54,   88,  100,  101,  707,  402,  707,  707,
+ /*  9910 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9920 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /*  9930 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /*  9940 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /*  9950 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /*  9960 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /*  9970 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  404,
+ /*  9980 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /*  9990 */   112,  707,   60,  707,  707,  707,  120,  707,  707,  707,
+ /* 10000 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 10010 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /* 10020 */   406,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10030 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /* 10040 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10050 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 10060 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /* 10070 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 10080 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 10090 */   101,   78,  408,  707,  707,  707,  707,  707,  707,  707,
+ /* 10100 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /* 10110 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 10120 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 10130 */   100,  101,  707,  410,  707,  707,  707,  707,  707,  707,
+ /* 10140 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10150 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10160 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /* 10170 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 10180 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 10190 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 10200 */    54,   88,  100,  101,   78,  413,  707,  707,  707,  707,
+ /* 10210 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 10220 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /* 10230 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 10240 */    45,   54,   88,  100,  101,  707,  415,  707,  707,  707,
+ /* 10250 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10260 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /* 10270 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /* 10280 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 10290 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /* 10300 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 10310 */    94,  104,   45,   54,   88,  100,  101,   78,  417,  707,
+ /* 10320 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 10330 */   707,   60,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 10340 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 10350 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  419,
+ /* 10360 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10370 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /* 10380 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /* 10390 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 10400 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /* 10410 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 10420 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 10430 */    78,  421,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 10440 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /* 10450 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 10460 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 10470 */   101,  707,  423,  707,  707,  707,  707,  707,  707,  707,
+ /* 10480 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /* 10490 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10500 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /* 10510 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 10520 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 10530 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 10540 */    88,  100,  101,   78,  425,  707,  707,  707,  707,  707,
+ /* 10550 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 10560 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 10570 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 10580 */    54,   88,  100,  101,  707,  427,  707,  707,  707,  707,
+ /* 10590 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10600 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /* 10610 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /* 10620 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 10630 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /* 10640 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 10650 */   104,   45,   54,   88,  100,  101,   78,  429,  707,  707,
+ /* 10660 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 10670 */    60,  707,  707,  707,  120,  707,  707,  707,  707,   18,
+ /* 10680 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 10690 */    94,  104,   45,   54,   88,  100,  101,  707,  431,  707,
+ /* 10700 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10710 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 10720 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /* 10730 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 10740 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /* 10750 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 10760 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /* 10770 */   433,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 10780 */    57,  112,  707,   60,  707,  707,  707,  120,  707,  707,
+ /* 10790 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 10800 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 10810 */   707,  435,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10820 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /* 10830 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10840 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10850 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /* 10860 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 10870 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 10880 */   100,  101,   78,  437,  707,  707,  707,  707,  707,  707,
+ /* 10890 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 10900 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 10910 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 10920 */    88,  100,  101,  707,  439,  707,  707,  707,  707,  707,
+ /* 10930 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10940 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 10950 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /* 10960 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 10970 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /* 10980 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 10990 */    45,   54,   88,  100,  101,   78,  441,  707,  707,  707,
+ /* 11000 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 11010 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /* 11020 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 11030 */   104,   45,   54,   88,  100,  101,  707,  443,  707,  707,
+ /* 11040 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11050 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /* 11060 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /* 11070 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 11080 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11090 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 11100 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  445,
+ /* 11110 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 11120 */   112,  707,   60,  707,  707,  707,  120,  707,  707,  707,
+ /* 11130 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 11140 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /* 11150 */   448,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11160 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /* 11170 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11180 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 11190 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /* 11200 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 11210 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 11220 */   101,   78,  451,  707,  707,  707,  707,  707,  707,  707,
+ /* 11230 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /* 11240 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 11250 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 11260 */   100,  101,  707,  454,  707,  707,  707,  707,  707,  707,
+ /* 11270 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11280 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11290 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /* 11300 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 11310 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 11320 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 11330 */    54,   88,  100,  101,   78,  457,  707,  707,  707,  707,
+ /* 11340 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 11350 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /* 11360 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 11370 */    45,   54,   88,  100,  101,  707,  459,  707,  707,  707,
+ /* 11380 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11390 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /* 11400 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /* 11410 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 11420 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /* 11430 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 11440 */    94,  104,   45,   54,   88,  100,  101,   78,  461,  707,
+ /* 11450 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 11460 */   707,   60,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 11470 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 11480 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  463,
+ /* 11490 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11500 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /* 11510 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /* 11520 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 11530 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /* 11540 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 11550 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 11560 */    78,  465,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 11570 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /* 11580 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 11590 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 11600 */   101,  707,  467,  707,  707,  707,  707,  707,  707,  707,
+ /* 11610 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /* 11620 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11630 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /* 11640 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 11650 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 11660 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 11670 */    88,  100,  101,   78,  469,  707,  707,  707,  707,  707,
+ /* 11680 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 11690 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 11700 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 11710 */    54,   88,  100,  101,  707,  471,  707,  707,  707,  707,
+ /* 11720 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11730 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /* 11740 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /* 11750 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 11760 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /* 11770 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 11780 */   104,   45,   54,   88,  100,  101,   78,  473,  707,  707,
+ /* 11790 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 11800 */    60,  707,  707,  707,  120,  707,  707,  707,  707,   18,
+ /* 11810 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 11820 */    94,  104,   45,   54,   88,  100,  101,  707,  475,  707,
+ /* 11830 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11840 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 11850 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /* 11860 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 11870 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /* 11880 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 11890 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /* 11900 */   477,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 11910 */    57,  112,  707,   60,  707,  707,  707,  120,  707,  707,
+ /* 11920 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 11930 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 11940 */   707,  479,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11950 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /* 11960 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11970 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 11980 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /* 11990 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 12000 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 12010 */   100,  101,   78,  481,  707,  707,  707,  707,  707,  707,
+ /* 12020 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 12030 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 12040 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 12050 */    88,  100,  101,  707,  483,  707,  707,  707,  707,  707,
+ /* 12060 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12070 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12080 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /* 12090 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 12100 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /* 12110 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 12120 */    45,   54,   88,  100,  101,   78,  485,  707,  707,  707,
+ /* 12130 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 12140 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /* 12150 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 12160 */   104,   45,   54,   88,  100,  101,  707,  487,  707,  707,
+ /* 12170 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12180 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /* 12190 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /* 12200 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 12210 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12220 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 12230 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  493,
+ /* 12240 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 12250 */   112,  707,   60,  707,  707,  707,  120,  707,  707,  707,
+ /* 12260 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 12270 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /* 12280 */   495,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12290 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /* 12300 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12310 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 12320 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /* 12330 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 12340 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 12350 */   101,   78,  497,  707,  707,  707,  707,  707,  707,  707,
+ /* 12360 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /* 12370 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 12380 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 12390 */   100,  101,  707,  499,  707,  707,  707,  707,  707,  707,
+ /* 12400 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12410 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12420 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /* 12430 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 12440 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 12450 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 12460 */    54,   88,  100,  101,   78,  501,  707,  707,  707,  707,
+ /* 12470 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 12480 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /* 12490 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 12500 */    45,   54,   88,  100,  101,  707,  503,  707,  707,  707,
+ /* 12510 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12520 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /* 12530 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /* 12540 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 12550 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /* 12560 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 12570 */    94,  104,   45,   54,   88,  100,  101,   78,  505,  707,
+ /* 12580 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 12590 */   707,   60,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 12600 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 12610 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  507,
+ /* 12620 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12630 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /* 12640 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /* 12650 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 12660 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /* 12670 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 12680 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 12690 */    78,  509,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 12700 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /* 12710 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 12720 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 12730 */   101,  707,  511,  707,  707,  707,  707,  707,  707,  707,
+ /* 12740 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /* 12750 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12760 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /* 12770 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 12780 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 12790 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 12800 */    88,  100,  101,   78,  513,  707,  707,  707,  707,  707,
+ /* 12810 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 12820 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 12830 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 12840 */    54,   88,  100,  101,  707,  515,  707,  707,  707,  707,
+ /* 12850 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12860 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /* 12870 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /* 12880 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 12890 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /* 12900 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 12910 */   104,   45,   54,   88,  100,  101,   78,  517,  707,  707,
+ /* 12920 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 12930 */    60,  707,  707,  707,  120,  707,  707,  707,  707,   18,
+ /* 12940 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 12950 */    94,  104,   45,   54,   88,  100,  101,  707,  519,  707,
+ /* 12960 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 12970 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 12980 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /* 12990 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 13000 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /* 13010 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 13020 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /* 13030 */   521,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 13040 */    57,  112,  707,   60,  707,  707,  707,  120,  707,  707,
+ /* 13050 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 13060 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 13070 */   707,  523,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13080 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /* 13090 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13100 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13110 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /* 13120 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 13130 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 13140 */   100,  101,   78,  525,  707,  707,  707,  707,  707,  707,
+ /* 13150 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 13160 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 13170 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 13180 */    88,  100,  101,  707,  552,  707,  707,  707,  707,  707,
+ /* 13190 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13200 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13210 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /* 13220 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 13230 */   707,  707,  707,  707,  707,  707,  707,   18,   19,   24,
+ /* 13240 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 13250 */    45,   54,   88,  100,  101,   78,  569,  707,  707,  707,
+ /* 13260 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 13270 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /* 13280 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 13290 */   104,   45,   54,   88,  100,  101,  707,  577,  707,  707,
+ /* 13300 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13310 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /* 13320 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /* 13330 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 13340 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13350 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 13360 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  603,
+ /* 13370 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 13380 */   112,  707,   60,  707,  707,  707,  120,  707,  707,  707,
+ /* 13390 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 13400 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /* 13410 */   626,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13420 */   707,  707,  707,  707,  707,  707,  707,  120,  707,  707,
+ /* 13430 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13440 */    78,  707,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 13450 */   105,   57,  112,  707,   60,  707,  707,  707,  707,  707,
+ /* 13460 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 13470 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 13480 */   101,   78,  652,  707,  707,  707,  707,  707,  707,  707,
+ /* 13490 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  120,
+ /* 13500 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 13510 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 13520 */   100,  101,  707,  678,  707,  707,  707,  707,  707,  707,
+ /* 13530 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13540 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13550 */   707,  707,  707,   78,  707,  707,  707,  707,  707,  707,
+ /* 13560 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 13570 */   707,  707,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 13580 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 13590 */    54,   88,  100,  101,   78,  701,  707,  707,  707,  707,
+ /* 13600 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 13610 */   707,  707,  120,  707,  707,  707,  707,   18,   19,   24,
+ /* 13620 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 13630 */    45,   54,   88,  100,  101,  707,  734,  707,  707,  707,
+ /* 13640 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13650 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /* 13660 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /* 13670 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 13680 */    60,  707,  707,  707,  707,  707,  707,  707,  707,   18,
+ /* 13690 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 13700 */    94,  104,   45,   54,   88,  100,  101,   78,  746,  707,
+ /* 13710 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 13720 */   707,   60,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 13730 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 13740 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  750,
+ /* 13750 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13760 */   707,  707,  707,  707,  707,  707,  120,  707,  707,  707,
+ /* 13770 */   707,  707,  707,  707,  707,  707,  707,  707,  707,   78,
+ /* 13780 */   707,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 13790 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /* 13800 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 13810 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 13820 */    78,  754,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 13830 */   105,   57,  112,  707,   60,  707,  707,  707,  120,  707,
+ /* 13840 */   707,  707,  707,   18,   19,   24,   63,   64,   80,   93,
+ /* 13850 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 13860 */   101,  707,  756,  707,  707,  707,  707,  707,  707,  707,
+ /* 13870 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  120,
+ /* 13880 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13890 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /* 13900 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 13910 */   707,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 13920 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 13930 */    88,  100,  101,   78,  758,  707,  707,  707,  707,  707,
+ /* 13940 */   707,  707,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 13950 */   707,  120,  707,  707,  707,  707,   18,   19,   24,   63,
+ /* 13960 */    64,   80,   93,   69,   70,   71,   83,   94,  104,   45,
+ /* 13970 */    54,   88,  100,  101,  707,  760,  707,  707,  707,  707,
+ /* 13980 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 13990 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /* 14000 */   707,  707,  707,  707,  707,   78,  707,  707,  707,  707,
+ /* 14010 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 14020 */   707,  707,  707,  707,  707,  707,  707,  707,   18,   19,
+ /* 14030 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 14040 */   104,   45,   54,   88,  100,  101,   78,  762,  707,  707,
+ /* 14050 */   707,  707,  707,  707,  707,  102,  105,   57,  112,  707,
+ /* 14060 */    60,  707,  707,  707,  120,  707,  707,  707,  707,   18,
+ /* 14070 */    19,   24,   63,   64,   80,   93,   69,   70,   71,   83,
+ /* 14080 */    94,  104,   45,   54,   88,  100,  101,  707,  766,  707,
+ /* 14090 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14100 */   707,  707,  707,  707,  707,  120,  707,  707,  707,  707,
+ /* 14110 */   707,  707,  707,  707,  707,  707,  707,  707,   78,  707,
+ /* 14120 */   707,  707,  707,  707,  707,  707,  707,  102,  105,   57,
+ /* 14130 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /* 14140 */   707,   18,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 14150 */    71,   83,   94,  104,   45,   54,   88,  100,  101,   78,
+ /* 14160 */   770,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 14170 */    57,  112,  707,   60,  707,  707,  707,  120,  707,  707,
+ /* 14180 */   707,  707,   18,   19,   24,   63,   64,   80,   93,   69,
+ /* 14190 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 14200 */   707,  772,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14210 */   707,  707,  707,  707,  707,  707,  707,  707,  120,  707,
+ /* 14220 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14230 */   707,   78,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14240 */   102,  105,   57,  112,  707,   60,  707,  707,  707,  707,
+ /* 14250 */   707,  707,  707,  707,   18,   19,   24,   63,   64,   80,
+ /* 14260 */    93,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 14270 */   100,  101,   78,  774,  707,  707,  707,  707,  707,  707,
+ /* 14280 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 14290 */   120,  707,  707,  707,  707,   18,   19,   24,   63,   64,
+ /* 14300 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 14310 */    88,  100,  101,  707,  776,  707,  707,  707,  707,  707,
+ /* 14320 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14330 */   707,  120,  707,  707,  707,  707,  707,  707,  707,  107,
+ /* 14340 */   117,  707,  707,  707,   78,  707,  707,  121,  126,  109,
+ /* 14350 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 14360 */   707,  707,  707,  707,  707,  707,   61,   18,   19,   24,
+ /* 14370 */    63,   64,   80,   93,   69,   70,   71,   83,   94,  104,
+ /* 14380 */    45,   54,   88,  100,  101,   78,  799,  707,  707,  707,
+ /* 14390 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 14400 */   707,  707,  707,  120,  707,  707,  707,  707,   18,   19,
+ /* 14410 */    24,   63,   64,   80,   93,   69,   70,   71,   83,   94,
+ /* 14420 */   104,   45,   54,   88,  100,  101,  707,   58,   59,   89,
+ /* 14430 */    90,   91,   97,   98,   99,  110,  111,  113,  707,  707,
+ /* 14440 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /* 14450 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /* 14460 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 14470 */   707,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14480 */    18,   19,   24,   63,   64,   80,   93,   69,   70,   71,
+ /* 14490 */    83,   94,  104,   45,   54,   88,  100,  101,   78,  707,
+ /* 14500 */   707,  707,  707,  707,  707,  120,  707,  102,  105,   57,
+ /* 14510 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /* 14520 */   707,   21,   19,   24,   63,   64,   80,   93,   69,   70,
+ /* 14530 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  107,
+ /* 14540 */   117,  707,  152,  707,  707,  707,  707,  121,  126,  109,
+ /* 14550 */   707,  707,  707,  707,  707,  707,  707,  340,  339,   78,
+ /* 14560 */   707,  707,  707,  707,  707,  707,   61,  707,  102,  105,
+ /* 14570 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /* 14580 */   707,  707,   23,   19,   24,   63,   64,   80,   93,   69,
+ /* 14590 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 14600 */   707,  707,  707,  707,  120,  707,  707,  707,  707,  707,
+ /* 14610 */   707,  707,  707,  707,  707,  707,  707,   46,   48,  707,
+ /* 14620 */   707,  707,  707,  707,   50,   52,  707,   58,   59,   89,
+ /* 14630 */    90,   91,   97,   98,   99,  110,  111,  113,  107,  117,
+ /* 14640 */   707,  152,  707,  707,  707,  707,  121,  126,  109,  707,
+ /* 14650 */   707,  707,  707,  707,  707,  707,  378,  377,   78,  707,
+ /* 14660 */   707,  707,  707,  707,  707,   61,  707,  102,  105,   57,
+ /* 14670 */   112,  707,   60,  707,  707,  707,  707,  707,  707,  707,
+ /* 14680 */   707,  707,  707,  151,   63,   64,   80,   93,   69,   70,
+ /* 14690 */    71,   83,   94,  104,   45,   54,   88,  100,  101,  707,
+ /* 14700 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14710 */   707,  707,  707,  707,  707,  707,   46,   48,  707,  707,
+ /* 14720 */   707,  707,  707,   50,   52,  707,   58,   59,   89,   90,
+ /* 14730 */    91,   97,   98,   99,  110,  111,  113,  107,  117,  707,
+ /* 14740 */   707,  707,  707,  707,  707,  121,  126,  109,  707,  707,
+ /* 14750 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14760 */   336,  707,  707,  103,   61,  341,  343,  345,  347,  349,
+ /* 14770 */   351,  353,  355,  357,  359,  361,  363,  365,  367,  369,
+ /* 14780 */   371,  707,  707,  707,  707,  707,  747,  751,  755,  707,
+ /* 14790 */   707,  707,  707,  707,  107,  117,  707,  707,  707,  707,
+ /* 14800 */   707,  707,  121,  126,  109,  707,  707,  707,  707,  707,
+ /* 14810 */   707,  707,  707,  707,  707,   46,   48,  707,  707,  707,
+ /* 14820 */   707,   61,   50,   52,  707,   58,   59,   89,   90,   91,
+ /* 14830 */    97,   98,   99,  110,  111,  113,  707,  707,  107,  117,
+ /* 14840 */   707,  707,  707,  763,  767,  771,  121,  126,  109,  707,
+ /* 14850 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14860 */   707,  707,  707,  707,  707,   61,  707,  707,  707,  707,
+ /* 14870 */   707,  707,   46,   48,  707,  707,  707,  707,  707,   50,
+ /* 14880 */    52,  707,   58,   59,   89,   90,   91,   97,   98,   99,
+ /* 14890 */   110,  111,  113,  707,  852,  117,  707,  707,  707,  545,
+ /* 14900 */   546,  803,  853,  854,  855,  811,  707,  707,  707,  707,
+ /* 14910 */   707,  707,  707,  707,  707,  707,   46,   48,  707,  707,
+ /* 14920 */   707,   61,  707,   50,   52,  707,   58,   59,   89,   90,
+ /* 14930 */    91,   97,   98,   99,  110,  111,  113,  107,  117,  707,
+ /* 14940 */   152,  707,  707,  707,  707,  121,  126,  109,  707,  707,
+ /* 14950 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 14960 */   707,  707,  707,  707,   61,  707,  707,  707,  707,  707,
+ /* 14970 */   707,  707,   46,   48,  707,  707,  707,  707,  707,   50,
+ /* 14980 */    52,  707,   58,   59,   89,   90,   91,   97,   98,   99,
+ /* 14990 */   110,  111,  113,  707,  707,  707,  707,  707,  707,  707,
+ /* 15000 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  707,
+ /* 15010 */   707,  120,  707,  707,  707,   46,   48,  707,  707,  707,
+ /* 15020 */   707,  707,   50,   52,  707,   58,   59,   89,   90,   91,
+ /* 15030 */    97,   98,   99,  110,  111,  113,  107,  117,  707,  707,
+ /* 15040 */   153,  707,  707,  707,  121,  126,  109,  707,  707,  707,
+ /* 15050 */   707,  707,  707,  707,  707,  707,  707,   78,  707,  707,
+ /* 15060 */   707,  707,  707,   61,  707,   78,  102,  105,   57,  112,
+ /* 15070 */   707,   60,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 15080 */   707,  707,  707,   26,   64,   80,   93,   69,   70,   71,
+ /* 15090 */    83,   94,  104,   45,   54,   88,  100,  101,   73,   94,
+ /* 15100 */   104,   45,   54,   88,  100,  101,  707,  707,  707,  707,
+ /* 15110 */   707,  707,  707,  707,   46,   48,  707,  707,  120,  707,
+ /* 15120 */   707,   50,   52,  707,   58,   59,   89,   90,   91,   97,
+ /* 15130 */    98,   99,  110,  111,  113,  107,  117,  707,  707,  707,
+ /* 15140 */   707,  707,  707,  121,  126,  109,  707,  707,  707,  707,
+ /* 15150 */   707,  707,  707,  455,  707,  707,  707,  707,  707,  707,
+ /* 15160 */   707,  707,   61,  707,  707,  707,  707,  707,  707,  707,
+ /* 15170 */   107,  117,   78,  707,  707,  707,  707,  707,  121,  126,
+ /* 15180 */   109,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 15190 */   707,  707,  707,  707,  707,  707,  707,   61,  707,   28,
+ /* 15200 */    80,   93,   69,   70,   71,   83,   94,  104,   45,   54,
+ /* 15210 */    88,  100,  101,   46,   48,  707,  707,  707,  707,  707,
+ /* 15220 */    50,   52,  120,   58,   59,   89,   90,   91,   97,   98,
+ /* 15230 */    99,  110,  111,  113,  707,  120,  707,  707,  707,  707,
+ /* 15240 */   707,  707,  707,  707,  707,  707,  707,  707,   46,   48,
+ /* 15250 */   707,  707,  707,  707,  707,   50,   52,  707,   58,   59,
+ /* 15260 */    89,   90,   91,   97,   98,   99,  110,  111,  113,  707,
+ /* 15270 */   707,  707,  707,  707,  707,  707,   78,  707,  707,  707,
+ /* 15280 */   707,  120,  707,  707,  707,  102,  105,   57,  112,   78,
+ /* 15290 */    60,  707,  707,  707,  707,  707,  707,  707,  102,  105,
+ /* 15300 */    57,  112,  707,   60,   66,   93,   69,   70,   71,   83,
+ /* 15310 */    94,  104,   45,   54,   88,  100,  101,  145,   93,   69,
+ /* 15320 */    70,   71,   83,   94,  104,   45,   54,   88,  100,  101,
+ /* 15330 */   707,  707,  707,  707,  707,   78,  707,  120,  707,  707,
+ /* 15340 */   707,  707,  707,  707,  102,  105,   57,  112,  707,   60,
+ /* 15350 */   120,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15360 */   707,  707,  707,  147,   93,   69,   70,   71,   83,   94,
+ /* 15370 */   104,   45,   54,   88,  100,  101,  707,  707,  707,  707,
+ /* 15380 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15390 */   707,   78,  707,  120,  707,  707,  707,  707,  707,  707,
+ /* 15400 */   102,  105,   57,  112,   78,   60,  120,  707,  707,  707,
+ /* 15410 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 15420 */    32,   69,   70,   71,   83,   94,  104,   45,   54,   88,
+ /* 15430 */   100,  101,  707,   68,   69,   70,   71,   83,   94,  104,
+ /* 15440 */    45,   54,   88,  100,  101,  707,  707,   78,  120,  707,
+ /* 15450 */   707,  707,  707,  707,  707,  707,  102,  105,   57,  112,
+ /* 15460 */    78,   60,  707,  707,  707,  707,  707,  707,  707,  102,
+ /* 15470 */   105,   57,  112,  707,   60,  707,   82,   69,   70,   71,
+ /* 15480 */    83,   94,  104,   45,   54,   88,  100,  101,  707,  141,
+ /* 15490 */    69,   70,   71,   83,   94,  104,   45,   54,   88,  100,
+ /* 15500 */   101,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /* 15510 */   707,  102,  105,   57,  112,  707,   60,  707,  707,  707,
+ /* 15520 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15530 */   707,  707,   34,   70,   71,   83,   94,  104,   45,   54,
+ /* 15540 */    88,  100,  101,  707,  374,  707,  707,  106,  707,  379,
+ /* 15550 */   381,  383,  385,  387,  389,  391,  393,  395,  397,  399,
+ /* 15560 */   401,  403,  405,  407,  409,  453,  707,  707,   79,  707,
+ /* 15570 */   456,  458,  460,  462,  464,  466,  468,  470,  472,  474,
+ /* 15580 */   476,  478,  480,  482,  484,  486,  412,  707,  707,  707,
+ /* 15590 */   707,  414,  416,  418,  420,  422,  424,  426,  428,  430,
+ /* 15600 */   432,  434,  436,  438,  440,  442,  444,  492,  120,  707,
+ /* 15610 */   707,  707,  494,  496,  498,  500,  502,  504,  506,  508,
+ /* 15620 */   510,  512,  514,  516,  518,  520,  522,  524,  310,  707,
+ /* 15630 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15640 */   120,  707,  707,  707,  707,  707,  535,  528,  707,  707,
+ /* 15650 */   707,  707,  707,  707,  707,   61,  707,  707,  707,  707,
+ /* 15660 */   707,  707,   78,  707,  707,  707,  707,  707,  707,  707,
+ /* 15670 */   707,  102,  105,   57,  112,  527,   60,  707,  707,  707,
+ /* 15680 */   707,  707,  120,  707,  707,  707,  707,  707,  120,  707,
+ /* 15690 */   707,  707,  707,  707,   78,  120,   75,  104,   45,   54,
+ /* 15700 */    88,  100,  101,  102,  105,   57,  112,  707,   60,  707,
+ /* 15710 */   707,  707,  707,  707,  707,  707,   58,   59,   89,   90,
+ /* 15720 */    91,  707,  707,  707,  707,  707,  707,  707,   85,  104,
+ /* 15730 */    45,   54,   88,  100,  101,  707,   78,  120,  707,  707,
+ /* 15740 */   707,  707,   78,  120,  707,  102,  105,   57,  112,   78,
+ /* 15750 */    60,  102,  105,   57,  112,  707,   60,  707,  102,  105,
+ /* 15760 */    57,  112,  707,   60,  707,  707,  707,  707,  707,  707,
+ /* 15770 */   707,   44,   45,   54,   88,  100,  101,   47,   45,   54,
+ /* 15780 */    88,  100,  101,  707,   49,   45,   54,   88,  100,  101,
+ /* 15790 */   707,   78,  707,  707,  707,  707,  707,   78,  707,  707,
+ /* 15800 */   102,  105,   57,  112,  707,   60,  102,  105,   57,  112,
+ /* 15810 */   120,   60,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15820 */   707,  707,  707,  707,  707,  707,   51,   45,   54,   88,
+ /* 15830 */   100,  101,   53,   45,   54,   88,  100,  101,  707,  707,
+ /* 15840 */   707,  707,  120,  707,  707,  707,  707,  707,  707,  707,
+ /* 15850 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15860 */   707,  707,  707,  707,   78,  707,  707,  707,  707,  707,
+ /* 15870 */   707,  707,  707,  102,  105,   57,  112,  707,   60,  707,
+ /* 15880 */   707,  707,  707,  120,  707,  707,  707,  707,  707,  120,
+ /* 15890 */   707,  707,  707,  707,  707,  707,   78,  707,  707,   77,
+ /* 15900 */    45,   54,   88,  100,  101,  102,  105,   57,  112,  707,
+ /* 15910 */    60,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15920 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15930 */   707,   87,   45,   54,   88,  100,  101,   78,  707,  707,
+ /* 15940 */   707,  707,  707,   78,  707,  707,  102,  105,   57,  112,
+ /* 15950 */   707,   60,  102,  105,   57,  112,  707,   60,  707,  707,
+ /* 15960 */   707,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+ /* 15970 */   707,  707,   96,   45,   54,   88,  100,  101,  707,   56,
+ /* 15980 */    54,   88,  100,  101,
+};
+static YYCODETYPE yy_lookahead[] = {
+ /*     0 */   107,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*    10 */   117,  118,  119,  120,    7,  122,  123,  124,  125,  126,
+ /*    20 */   127,  128,  129,  130,  131,  132,  133,  134,  135,  136,
+ /*    30 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*    40 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*    50 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*    60 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*    70 */   177,  178,  179,  180,  181,  182,  183,  184,  185,   95,
+ /*    80 */    96,   97,   98,   99,  191,   75,   76,   77,   78,  196,
+ /*    90 */     0,  198,    7,  200,  201,  202,  203,    1,  205,   14,
+ /*   100 */    15,   16,   17,   18,   97,   98,   99,  214,  215,  216,
+ /*   110 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*   120 */   227,  228,  229,  230,  231,  108,  109,  110,  111,  112,
+ /*   130 */   113,  114,  115,  116,  117,  118,  119,  120,   71,  122,
+ /*   140 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*   150 */   133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*   160 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*   170 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*   180 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*   190 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*   200 */   183,  184,  185,    1,   70,   56,   72,   74,  191,   88,
+ /*   210 */    89,   90,   91,  196,   12,  198,    7,  200,  201,  202,
+ /*   220 */   203,   73,  205,   14,   15,   16,   17,   18,   79,   80,
+ /*   230 */    81,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*   240 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  108,
+ /*   250 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*   260 */   119,  120,   58,  122,  123,  124,  125,  126,  127,  128,
+ /*   270 */   129,  130,  131,  132,  133,  134,  135,  136,  137,  138,
+ /*   280 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*   290 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*   300 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*   310 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*   320 */   179,  180,  181,  182,  183,  184,  185,   57,    9,    8,
+ /*   330 */     9,   12,  191,   12,   85,   86,   87,  196,   82,  198,
+ /*   340 */     7,  200,  201,  202,  203,   24,  205,   83,   15,   16,
+ /*   350 */    97,   98,   99,   94,   84,  214,  215,  216,  217,  218,
+ /*   360 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*   370 */   229,  230,  231,  108,  109,  110,  111,  112,  113,  114,
+ /*   380 */   115,  116,  117,  118,  119,  120,   35,  122,  123,  124,
+ /*   390 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  134,
+ /*   400 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*   410 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*   420 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*   430 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*   440 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*   450 */   185,   56,   57,   58,    9,    9,  191,   12,   12,   11,
+ /*   460 */    12,  196,   35,  198,   35,  200,  201,  202,  203,   35,
+ /*   470 */   205,  186,  187,    9,  187,  188,   12,   28,   29,  214,
+ /*   480 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*   490 */   225,  226,  227,  228,  229,  230,  231,  108,  109,  110,
+ /*   500 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*   510 */    35,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*   520 */   131,  132,  133,  134,  135,  136,  137,  138,  139,  140,
+ /*   530 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*   540 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*   550 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*   560 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*   570 */   181,  182,  183,  184,  185,    9,   12,  197,   12,  199,
+ /*   580 */   191,    7,    8,    7,    8,  196,    8,  198,   24,  200,
+ /*   590 */   201,  202,  203,   35,  205,    9,  191,    9,   12,    9,
+ /*   600 */    12,   36,   12,  214,  215,  216,  217,  218,  219,  220,
+ /*   610 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*   620 */   231,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*   630 */   117,  118,  119,  120,  229,  122,  123,  124,  125,  126,
+ /*   640 */   127,  128,  129,  130,  131,  132,  133,  134,  135,  136,
+ /*   650 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*   660 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*   670 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*   680 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*   690 */   177,  178,  179,  180,  181,  182,  183,  184,  185,   12,
+ /*   700 */    12,   12,   12,    9,  191,    9,   12,    9,   12,  196,
+ /*   710 */    12,  198,    9,  200,  201,  202,  203,    8,  205,    8,
+ /*   720 */   191,   36,   35,   35,   35,   35,   71,  214,  215,  216,
+ /*   730 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*   740 */   227,  228,  229,  230,  231,  108,  109,  110,  111,  112,
+ /*   750 */   113,  114,  115,  116,  117,  118,  119,  120,  229,  122,
+ /*   760 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*   770 */   133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*   780 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*   790 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*   800 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*   810 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*   820 */   183,  184,  185,   12,   12,   12,   12,    9,  191,    9,
+ /*   830 */    12,    9,   12,  196,   12,  198,   36,  200,  201,  202,
+ /*   840 */   203,   36,  205,   36,  191,   36,   35,   35,   35,   35,
+ /*   850 */    71,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*   860 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  108,
+ /*   870 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*   880 */   119,  120,  229,  122,  123,  124,  125,  126,  127,  128,
+ /*   890 */   129,  130,  131,  132,  133,  134,  135,  136,  137,  138,
+ /*   900 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*   910 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*   920 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*   930 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*   940 */   179,  180,  181,  182,  183,  184,  185,    9,    9,    7,
+ /*   950 */     8,    7,  191,    7,    8,    7,    8,  196,  137,  198,
+ /*   960 */     8,  200,  201,  202,  203,   10,  205,   11,  191,    7,
+ /*   970 */     8,    7,   11,   35,   35,  214,  215,  216,  217,  218,
+ /*   980 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*   990 */   229,  230,  231,  108,  109,  110,  111,  112,  113,  114,
+ /*  1000 */   115,  116,  117,  118,  119,  120,  229,  122,  123,  124,
+ /*  1010 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  134,
+ /*  1020 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*  1030 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*  1040 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  1050 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  1060 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  1070 */   185,    9,    9,    1,    9,    8,  191,   12,   10,   10,
+ /*  1080 */    10,  196,   11,  198,   12,  200,  201,  202,  203,   11,
+ /*  1090 */   205,   10,  191,   11,    8,   10,    9,   35,   35,  214,
+ /*  1100 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  1110 */   225,  226,  227,  228,  229,  230,  231,  108,  109,  110,
+ /*  1120 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  1130 */   229,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  1140 */   131,  132,  133,  134,  135,  136,  137,  138,  139,  140,
+ /*  1150 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*  1160 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*  1170 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*  1180 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*  1190 */   181,  182,  183,  184,  185,    9,    9,   21,    8,   11,
+ /*  1200 */   191,   10,    9,   11,    8,  196,  189,  198,   24,  200,
+ /*  1210 */   201,  202,  203,    9,  205,   10,  191,   11,    8,   10,
+ /*  1220 */     9,   35,   35,  214,  215,  216,  217,  218,  219,  220,
+ /*  1230 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  1240 */   231,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  1250 */   117,  118,  119,  120,  229,  122,  123,  124,  125,  126,
+ /*  1260 */   127,  128,  129,  130,  131,  132,  133,  134,  135,  136,
+ /*  1270 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*  1280 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*  1290 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  1300 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  1310 */   177,  178,  179,  180,  181,  182,  183,  184,  185,    8,
+ /*  1320 */    10,    9,    7,  200,  191,   11,   32,  200,   32,  196,
+ /*  1330 */   200,  198,   32,  200,  201,  202,  203,  200,  205,   32,
+ /*  1340 */   191,  200,  200,  200,   10,   32,  121,  214,  215,  216,
+ /*  1350 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  1360 */   227,  228,  229,  230,  231,  108,  109,  110,  111,  112,
+ /*  1370 */   113,  114,  115,  116,  117,  118,  119,  120,  229,  122,
+ /*  1380 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  1390 */   133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*  1400 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*  1410 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  1420 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  1430 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  1440 */   183,  184,  185,   32,   32,   35,   32,   32,  191,   36,
+ /*  1450 */    12,   12,   25,  196,   12,  198,   25,  200,  201,  202,
+ /*  1460 */   203,   12,  205,   12,  191,   25,   12,   12,   12,   12,
+ /*  1470 */    12,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  1480 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  108,
+ /*  1490 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  1500 */   119,  120,  229,  122,  123,  124,  125,  126,  127,  128,
+ /*  1510 */   129,  130,  131,  132,  133,  134,  135,  136,  137,  138,
+ /*  1520 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*  1530 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*  1540 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*  1550 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*  1560 */   179,  180,  181,  182,  183,  184,  185,   12,   12,   12,
+ /*  1570 */    12,   12,  191,   12,   12,   12,   12,  196,   12,  198,
+ /*  1580 */    12,  200,  201,  202,  203,   12,  205,   12,  191,   12,
+ /*  1590 */    12,   12,   12,   12,   12,  214,  215,  216,  217,  218,
+ /*  1600 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  1610 */   229,  230,  231,  108,  109,  110,  111,  112,  113,  114,
+ /*  1620 */   115,  116,  117,  118,  119,  120,  229,  122,  123,  124,
+ /*  1630 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  134,
+ /*  1640 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*  1650 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*  1660 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  1670 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  1680 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  1690 */   185,   12,   12,   12,   12,   12,  191,   12,   12,   12,
+ /*  1700 */    12,  196,   12,  198,   12,  200,  201,  202,  203,   12,
+ /*  1710 */   205,   12,  191,   12,   12,   12,   12,   12,   12,  214,
+ /*  1720 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  1730 */   225,  226,  227,  228,  229,  230,  231,  108,  109,  110,
+ /*  1740 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  1750 */   229,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  1760 */   131,  132,  133,  134,  135,  136,  137,  138,  139,  140,
+ /*  1770 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*  1780 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*  1790 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*  1800 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*  1810 */   181,  182,  183,  184,  185,   11,   10,    9,   11,   10,
+ /*  1820 */   191,   11,   10,   36,   11,  196,   10,  198,   11,  200,
+ /*  1830 */   201,  202,  203,    7,  205,    7,  191,    7,    7,    7,
+ /*  1840 */    11,  189,    9,  214,  215,  216,  217,  218,  219,  220,
+ /*  1850 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  1860 */   231,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  1870 */   117,  118,  119,  120,  229,  122,  123,  124,  125,  126,
+ /*  1880 */   127,  128,  129,  130,  131,  132,  133,  134,  135,  136,
+ /*  1890 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*  1900 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*  1910 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  1920 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  1930 */   177,  178,  179,  180,  181,  182,  183,  184,  185,   10,
+ /*  1940 */    10,   24,   11,   10,  191,   11,    9,   12,   10,  196,
+ /*  1950 */    11,  198,   10,  200,  201,  202,  203,   11,  205,   10,
+ /*  1960 */   191,   11,  189,    7,   32,    7,    7,  214,  215,  216,
+ /*  1970 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  1980 */   227,  228,  229,  230,  231,  108,  109,  110,  111,  112,
+ /*  1990 */   113,  114,  115,  116,  117,  118,  119,  120,  229,  122,
+ /*  2000 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  2010 */   133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*  2020 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*  2030 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  2040 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  2050 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  2060 */   183,  184,  185,   10,    7,   11,  187,    7,  191,    7,
+ /*  2070 */     7,    7,  187,  196,  237,  198,  237,  200,  201,  202,
+ /*  2080 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /*  2090 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  2100 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  108,
+ /*  2110 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  2120 */   119,  120,  237,  122,  123,  124,  125,  126,  127,  128,
+ /*  2130 */   129,  130,  131,  132,  133,  134,  135,  136,  137,  138,
+ /*  2140 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*  2150 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*  2160 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*  2170 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*  2180 */   179,  180,  181,  182,  183,  184,  185,  237,  237,  237,
+ /*  2190 */   237,  237,  191,  237,  237,  237,  237,  196,  237,  198,
+ /*  2200 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  2210 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  2220 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  2230 */   229,  230,  231,  108,  109,  110,  111,  112,  113,  114,
+ /*  2240 */   115,  116,  117,  118,  119,  120,  237,  122,  123,  124,
+ /*  2250 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  134,
+ /*  2260 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*  2270 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*  2280 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  2290 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  2300 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  2310 */   185,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /*  2320 */   237,  196,  237,  198,  237,  200,  201,  202,  203,  237,
+ /*  2330 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /*  2340 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  2350 */   225,  226,  227,  228,  229,  230,  231,  108,  109,  110,
+ /*  2360 */   111,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+ /*  2370 */   237,  122,  123,  124,  125,  126,  127,  128,  129,  130,
+ /*  2380 */   131,  132,  133,  134,  135,  136,  137,  138,  139,  140,
+ /*  2390 */   141,  142,  143,  144,  145,  146,  147,  148,  149,  150,
+ /*  2400 */   151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+ /*  2410 */   161,  162,  163,  164,  165,  166,  167,  168,  169,  170,
+ /*  2420 */   171,  172,  173,  174,  175,  176,  177,  178,  179,  180,
+ /*  2430 */   181,  182,  183,  184,  185,  237,  237,  237,  237,  237,
+ /*  2440 */   191,  237,  237,  237,  237,  196,  237,  198,  237,  200,
+ /*  2450 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /*  2460 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  2470 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  2480 */   231,  108,  109,  110,  111,  112,  113,  114,  115,  116,
+ /*  2490 */   117,  118,  119,  120,  237,  122,  123,  124,  125,  126,
+ /*  2500 */   127,  128,  129,  130,  131,  132,  133,  134,  135,  136,
+ /*  2510 */   137,  138,  139,  140,  141,  142,  143,  144,  145,  146,
+ /*  2520 */   147,  148,  149,  150,  151,  152,  153,  154,  155,  156,
+ /*  2530 */   157,  158,  159,  160,  161,  162,  163,  164,  165,  166,
+ /*  2540 */   167,  168,  169,  170,  171,  172,  173,  174,  175,  176,
+ /*  2550 */   177,  178,  179,  180,  181,  182,  183,  184,  185,  237,
+ /*  2560 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  196,
+ /*  2570 */   237,  198,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  2580 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /*  2590 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  2600 */   227,  228,  229,  230,  231,  108,  109,  110,  111,  112,
+ /*  2610 */   113,  114,  115,  116,  117,  118,  119,  120,  237,  122,
+ /*  2620 */   123,  124,  125,  126,  127,  128,  129,  130,  131,  132,
+ /*  2630 */   133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+ /*  2640 */   143,  144,  145,  146,  147,  148,  149,  150,  151,  152,
+ /*  2650 */   153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+ /*  2660 */   163,  164,  165,  166,  167,  168,  169,  170,  171,  172,
+ /*  2670 */   173,  174,  175,  176,  177,  178,  179,  180,  181,  182,
+ /*  2680 */   183,  184,  185,  237,  237,  237,  237,  237,  191,  237,
+ /*  2690 */   237,  237,  237,  196,  237,  198,  237,  200,  201,  202,
+ /*  2700 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /*  2710 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  2720 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  108,
+ /*  2730 */   109,  110,  111,  112,  113,  114,  115,  116,  117,  118,
+ /*  2740 */   119,  120,  237,  122,  123,  124,  125,  126,  127,  128,
+ /*  2750 */   129,  130,  131,  132,  133,  134,  135,  136,  137,  138,
+ /*  2760 */   139,  140,  141,  142,  143,  144,  145,  146,  147,  148,
+ /*  2770 */   149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+ /*  2780 */   159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+ /*  2790 */   169,  170,  171,  172,  173,  174,  175,  176,  177,  178,
+ /*  2800 */   179,  180,  181,  182,  183,  184,  185,  237,  237,  237,
+ /*  2810 */   237,  237,  191,  237,  237,  237,  237,  196,  237,  198,
+ /*  2820 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  2830 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  2840 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  2850 */   229,  230,  231,  108,  109,  110,  111,  112,  113,  114,
+ /*  2860 */   115,  116,  117,  118,  119,  120,  237,  122,  123,  124,
+ /*  2870 */   125,  126,  127,  128,  129,  130,  131,  132,  133,  134,
+ /*  2880 */   135,  136,  137,  138,  139,  140,  141,  142,  143,  144,
+ /*  2890 */   145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+ /*  2900 */   155,  156,  157,  158,  159,  160,  161,  162,  163,  164,
+ /*  2910 */   165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+ /*  2920 */   175,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+ /*  2930 */   185,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /*  2940 */   191,  196,  237,  198,  237,  200,  201,  202,  203,  237,
+ /*  2950 */   205,   56,   57,   58,  237,  237,  207,  237,  237,  214,
+ /*  2960 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  2970 */   225,  226,  227,  228,  229,  230,  231,  109,  229,  111,
+ /*  2980 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  237,
+ /*  2990 */   237,  237,   97,   98,   99,  237,  237,  237,  237,  237,
+ /*  3000 */   237,  237,  237,  237,  237,  137,  138,  139,  140,  141,
+ /*  3010 */   142,  143,  144,  145,  146,  147,  148,  149,  150,  151,
+ /*  3020 */   152,  153,  154,  155,  156,  157,  158,  159,  160,  161,
+ /*  3030 */   162,  163,  164,  165,  166,  167,  168,  169,  170,  171,
+ /*  3040 */   172,  173,  174,  175,  176,  177,  178,  179,  180,  181,
+ /*  3050 */   182,  183,  184,  185,  237,  237,  237,  189,  237,  191,
+ /*  3060 */   237,  193,  237,  191,  192,  191,  237,  237,  200,  201,
+ /*  3070 */   202,  203,  200,  205,  200,  201,  202,  237,  204,  205,
+ /*  3080 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  3090 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  3100 */   191,  229,  237,  229,  191,  237,  237,  237,  237,  200,
+ /*  3110 */   201,    7,  237,  200,  201,  109,  237,  111,  112,  113,
+ /*  3120 */   114,  115,  116,  117,  118,  119,  120,  237,  237,   25,
+ /*  3130 */    26,  237,  237,  237,  237,  237,  237,  237,  229,  237,
+ /*  3140 */   237,  237,  229,  137,  138,  139,  140,  141,  142,  143,
+ /*  3150 */   144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
+ /*  3160 */   154,  155,  156,  157,  158,  159,  160,  161,  162,  163,
+ /*  3170 */   164,  165,  166,  167,  168,  169,  170,  171,  172,  173,
+ /*  3180 */   174,  175,  176,  177,  178,  179,  180,  181,  182,  183,
+ /*  3190 */   184,  185,  237,  237,  237,  237,  237,  191,  237,  237,
+ /*  3200 */   194,   97,   98,   99,  191,  191,  200,  201,  202,  203,
+ /*  3210 */   237,  205,  237,  200,  201,  237,  202,  237,  237,  237,
+ /*  3220 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  3230 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  237,
+ /*  3240 */   191,  237,  229,  229,  237,  237,  237,  200,  201,  200,
+ /*  3250 */   201,  237,  237,  109,  237,  111,  112,  113,  114,  115,
+ /*  3260 */   116,  117,  118,  119,  120,  237,  237,  237,  237,  237,
+ /*  3270 */   237,  237,  237,  237,  237,  237,  229,  237,  229,  237,
+ /*  3280 */   237,  137,  138,  139,  140,  141,  142,  143,  144,  145,
+ /*  3290 */   146,  147,  148,  149,  150,  151,  152,  153,  154,  155,
+ /*  3300 */   156,  157,  158,  159,  160,  161,  162,  163,  164,  165,
+ /*  3310 */   166,  167,  168,  169,  170,  171,  172,  173,  174,  175,
+ /*  3320 */   176,  177,  178,  179,  180,  181,  182,  183,  184,  185,
+ /*  3330 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  195,
+ /*  3340 */   191,  191,  192,  237,  200,  201,  202,  203,  237,  205,
+ /*  3350 */   200,  237,  237,  237,  237,  237,  207,  237,  214,  215,
+ /*  3360 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  3370 */   226,  227,  228,  229,  230,  231,  191,  192,  229,  229,
+ /*  3380 */   237,  237,  237,  237,  237,  200,  237,  237,  237,  237,
+ /*  3390 */   237,  109,  237,  111,  112,  113,  114,  115,  116,  117,
+ /*  3400 */   118,  119,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  3410 */   237,  237,  237,  237,  229,  237,  237,  237,  237,  137,
+ /*  3420 */   138,  139,  140,  141,  142,  143,  144,  145,  146,  147,
+ /*  3430 */   148,  149,  150,  151,  152,  153,  154,  155,  156,  157,
+ /*  3440 */   158,  159,  160,  161,  162,  163,  164,  165,  166,  167,
+ /*  3450 */   168,  169,  170,  171,  172,  173,  174,  175,  176,  177,
+ /*  3460 */   178,  179,  180,  181,  182,  183,  184,  185,  237,  237,
+ /*  3470 */   237,  237,  237,  191,  237,  237,  191,  191,  237,  237,
+ /*  3480 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  3490 */   237,  237,  207,  207,  237,  237,  214,  215,  216,  217,
+ /*  3500 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  3510 */   228,  229,  230,  231,  229,  229,  237,  237,  237,  237,
+ /*  3520 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  109,
+ /*  3530 */   237,  111,  112,  113,  114,  115,  116,  117,  118,  119,
+ /*  3540 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  3550 */   237,  237,  237,  237,  237,  237,  237,  137,  138,  139,
+ /*  3560 */   140,  141,  142,  143,  144,  145,  146,  147,  148,  149,
+ /*  3570 */   150,  151,  152,  153,  154,  155,  156,  157,  158,  159,
+ /*  3580 */   160,  161,  162,  163,  164,  165,  166,  167,  168,  169,
+ /*  3590 */   170,  171,  172,  173,  174,  175,  176,  177,  178,  179,
+ /*  3600 */   180,  181,  182,  183,  184,  185,  237,  237,  237,  237,
+ /*  3610 */   237,  191,  237,  237,  191,  237,  237,  237,  237,  237,
+ /*  3620 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /*  3630 */   237,  237,  237,  210,  214,  215,  216,  217,  218,  219,
+ /*  3640 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  3650 */   230,  231,  229,  237,  237,  237,  237,  237,  237,  237,
+ /*  3660 */   237,  237,  237,  237,  237,  237,  237,  109,  237,  111,
+ /*  3670 */   112,  113,  114,  115,  116,  117,  118,  119,  120,  237,
+ /*  3680 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  3690 */   237,  237,  237,  237,  237,  137,  138,  139,  140,  141,
+ /*  3700 */   142,  143,  144,  145,  146,  147,  148,  149,  150,  151,
+ /*  3710 */   152,  153,  154,  155,  156,  157,  158,  159,  160,  161,
+ /*  3720 */   162,  163,  164,  165,  166,  167,  168,  169,  170,  171,
+ /*  3730 */   172,  173,  174,  175,  176,  177,  178,  179,  180,  181,
+ /*  3740 */   182,  183,  184,  185,  237,    7,  237,  237,    7,  191,
+ /*  3750 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  3760 */   202,  203,  237,  205,   26,  237,  237,   26,  237,  237,
+ /*  3770 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  3780 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  3790 */     1,    2,    3,    4,    5,    6,    7,    8,  237,  237,
+ /*  3800 */   237,  237,   13,   14,   15,   16,   17,   18,   19,   20,
+ /*  3810 */    21,   22,   23,    8,   25,  237,   27,  237,  237,   30,
+ /*  3820 */    31,  237,   33,   34,  237,  237,  191,  191,  191,  237,
+ /*  3830 */   237,   26,  237,  237,  237,   97,   98,   99,   97,   98,
+ /*  3840 */    99,  237,   53,  237,   55,  210,  210,  210,   59,   60,
+ /*  3850 */    61,   62,   63,   64,   65,   66,   67,  237,  237,   54,
+ /*  3860 */   237,   56,   57,   58,  229,  229,  229,  237,  237,  237,
+ /*  3870 */   237,  237,  237,  237,   85,   86,  237,  237,  237,  137,
+ /*  3880 */   237,   92,   93,  237,   95,   96,   97,   98,   99,  100,
+ /*  3890 */   101,  102,  103,  104,  105,    2,    3,    4,    5,    6,
+ /*  3900 */     7,    8,   97,   98,   99,  237,   13,   14,   15,   16,
+ /*  3910 */    17,   18,   19,   20,   21,   22,   23,  237,   25,  237,
+ /*  3920 */    27,  237,  237,   30,   31,  237,   33,   34,  237,  237,
+ /*  3930 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /*  3940 */   237,  237,  200,  201,  202,  203,   53,  205,   55,  237,
+ /*  3950 */   237,  237,   59,   60,   61,   62,   63,   64,   65,   66,
+ /*  3960 */    67,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  3970 */   228,  229,  230,  231,  237,  237,  237,  237,   85,   86,
+ /*  3980 */   137,  237,  191,  237,  237,   92,   93,    7,   95,   96,
+ /*  3990 */    97,   98,   99,  100,  101,  102,  103,  104,  105,    2,
+ /*  4000 */     3,    4,    5,  212,    7,    8,  237,  237,  237,  237,
+ /*  4010 */   237,   14,   15,   16,   17,   18,  237,  237,  237,   22,
+ /*  4020 */   229,  237,   25,  237,  237,  237,  237,   30,   31,  237,
+ /*  4030 */    33,   34,  237,  237,  191,  237,   56,   57,   58,  237,
+ /*  4040 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  4050 */    53,  237,   55,  237,  237,  237,   59,   60,   61,   62,
+ /*  4060 */    63,   64,   65,   66,   67,  222,  223,  224,  225,  226,
+ /*  4070 */   227,  228,  229,  230,  231,  237,  237,   97,   98,   99,
+ /*  4080 */   237,  237,   85,   86,  137,  237,  191,  237,  237,   92,
+ /*  4090 */    93,  191,   95,   96,   97,   98,   99,  100,  101,  102,
+ /*  4100 */   103,  104,  105,    2,    3,    4,    5,  212,    7,    8,
+ /*  4110 */   237,  237,  212,  237,  237,   14,   15,   16,   17,   18,
+ /*  4120 */   237,  237,  237,   22,  229,  237,   25,  237,  237,  229,
+ /*  4130 */   237,   30,   31,  237,   33,   34,  120,  237,  191,  237,
+ /*  4140 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  4150 */   203,  237,  205,  137,   53,  237,   55,  237,  237,  237,
+ /*  4160 */    59,   60,   61,   62,   63,   64,   65,   66,   67,  237,
+ /*  4170 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /*  4180 */   237,  237,  237,  237,  237,  237,   85,   86,  237,  237,
+ /*  4190 */   191,  237,  237,   92,   93,  237,   95,   96,   97,   98,
+ /*  4200 */    99,  100,  101,  102,  103,  104,  105,  191,  237,  137,
+ /*  4210 */   120,  212,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  4220 */   237,  205,  237,  237,  237,  237,  237,  137,  229,  237,
+ /*  4230 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  4240 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  233,
+ /*  4250 */   234,  235,  120,  121,  237,  237,  237,  237,  237,  237,
+ /*  4260 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  137,
+ /*  4270 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  4280 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  4290 */   200,  201,  202,  203,  237,  205,  224,  225,  226,  227,
+ /*  4300 */   228,  229,  230,  231,  214,  215,  216,  217,  218,  219,
+ /*  4310 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  4320 */   230,  231,  120,  191,  234,  235,  237,  237,  237,  237,
+ /*  4330 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  137,
+ /*  4340 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  4350 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  4360 */   228,  229,  230,  231,  120,  121,  237,  237,  236,  237,
+ /*  4370 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  4380 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  137,
+ /*  4390 */   237,  189,  190,  191,  237,  237,  237,  237,  237,  237,
+ /*  4400 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  4410 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  4420 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  4430 */   228,  229,  230,  231,  120,  191,  237,  237,  237,  237,
+ /*  4440 */   237,  237,  237,  191,  200,  201,  202,  203,  237,  205,
+ /*  4450 */   237,  137,  200,  201,  202,  203,  237,  205,  214,  215,
+ /*  4460 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  4470 */   226,  227,  228,  229,  230,  231,  120,  225,  226,  227,
+ /*  4480 */   228,  229,  230,  231,  237,  237,  237,  237,  237,  237,
+ /*  4490 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /*  4500 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /*  4510 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  4520 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /*  4530 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  4540 */   226,  227,  228,  229,  230,  231,  232,  191,  120,    8,
+ /*  4550 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  4560 */   237,  205,  237,  237,  237,  137,  237,   26,  237,  237,
+ /*  4570 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  4580 */   224,  225,  226,  227,  228,  229,  230,  231,  232,  237,
+ /*  4590 */   120,  121,  237,  237,  237,   54,  237,   56,   57,   58,
+ /*  4600 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /*  4610 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /*  4620 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  4630 */   202,  203,  237,  205,  237,  237,  237,  237,   97,   98,
+ /*  4640 */    99,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  4650 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  4660 */   232,  191,  120,  121,    8,  237,  237,  237,  237,  237,
+ /*  4670 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /*  4680 */   237,  237,   26,  237,  214,  215,  216,  217,  218,  219,
+ /*  4690 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  4700 */   230,  231,  237,  120,  121,    8,  237,  237,  237,  237,
+ /*  4710 */    54,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  4720 */   137,  237,  237,   26,  237,  237,  237,  237,  237,  237,
+ /*  4730 */   237,  237,    8,  191,  237,  237,  237,  237,  237,  237,
+ /*  4740 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  4750 */    26,   54,  237,   97,   98,   99,  214,  215,  216,  217,
+ /*  4760 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  4770 */   228,  229,  230,  231,  191,  120,  237,  237,   54,  237,
+ /*  4780 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  4790 */   237,  237,  137,  237,   97,   98,   99,  214,  215,  216,
+ /*  4800 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  4810 */   227,  228,  229,  230,  231,  237,  120,  237,    8,  237,
+ /*  4820 */   237,   97,   98,   99,  237,  237,  237,  237,  237,  237,
+ /*  4830 */   237,  237,  237,  137,  237,  237,   26,  237,  237,  237,
+ /*  4840 */   237,  237,  237,  237,  237,    8,  191,  237,  237,  237,
+ /*  4850 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  4860 */   205,  206,  237,   26,   54,  237,  237,  237,  237,  214,
+ /*  4870 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  4880 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /*  4890 */   237,   54,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  4900 */   237,  205,  206,  237,  237,  137,  237,   97,   98,   99,
+ /*  4910 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  4920 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /*  4930 */   237,    8,  237,  237,   97,   98,   99,  237,  237,  237,
+ /*  4940 */   237,  237,  237,  237,  237,  237,  137,  237,  237,   26,
+ /*  4950 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /*  4960 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  4970 */   202,  203,  237,  205,  206,  237,  237,   54,  237,  237,
+ /*  4980 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  4990 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  5000 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  5010 */   201,  202,  203,  237,  205,  206,  237,  237,  137,  237,
+ /*  5020 */    97,   98,   99,  214,  215,  216,  217,  218,  219,  220,
+ /*  5030 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  5040 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  5050 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /*  5060 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5070 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /*  5080 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  208,
+ /*  5090 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  5100 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  5110 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /*  5120 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  5130 */   208,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  5140 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  5150 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /*  5160 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5170 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /*  5180 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /*  5190 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  5200 */   237,  237,  208,  237,  237,  237,  237,  237,  214,  215,
+ /*  5210 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  5220 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /*  5230 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  5240 */   205,  206,  237,  237,  137,  237,  237,  237,  237,  214,
+ /*  5250 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  5260 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /*  5270 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5280 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /*  5290 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /*  5300 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  5310 */   203,  237,  205,  237,  237,  208,  237,  237,  237,  237,
+ /*  5320 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  5330 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /*  5340 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  5350 */   202,  203,  237,  205,  237,  237,  208,  137,  237,  237,
+ /*  5360 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  5370 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  5380 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5390 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /*  5400 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5410 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5420 */   200,  201,  202,  203,  237,  205,  237,  237,  208,  237,
+ /*  5430 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  5440 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  5450 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /*  5460 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  5470 */   137,  237,  211,  237,  237,  214,  215,  216,  217,  218,
+ /*  5480 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  5490 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /*  5500 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5510 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5520 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /*  5530 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  206,
+ /*  5540 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /*  5550 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  5560 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /*  5570 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  5580 */   237,  237,  208,  137,  237,  237,  237,  237,  214,  215,
+ /*  5590 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  5600 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /*  5610 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5620 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /*  5630 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /*  5640 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  5650 */   237,  205,  237,  237,  208,  237,  237,  237,  237,  237,
+ /*  5660 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  5670 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /*  5680 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  5690 */   203,  237,  205,  237,  237,  208,  137,  237,  237,  237,
+ /*  5700 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  5710 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /*  5720 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5730 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /*  5740 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5750 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  5760 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /*  5770 */   211,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  5780 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  5790 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  5800 */   200,  201,  202,  203,  237,  205,  237,  237,  208,  137,
+ /*  5810 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  5820 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  5830 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /*  5840 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5850 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5860 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /*  5870 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  5880 */   208,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  5890 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  5900 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /*  5910 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  5920 */   237,  208,  137,  237,  237,  237,  237,  214,  215,  216,
+ /*  5930 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  5940 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /*  5950 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  5960 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /*  5970 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /*  5980 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  5990 */   205,  237,  237,  237,  237,  237,  211,  237,  237,  214,
+ /*  6000 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  6010 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /*  6020 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  6030 */   237,  205,  237,  237,  237,  137,  237,  211,  237,  237,
+ /*  6040 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  6050 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /*  6060 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6070 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /*  6080 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /*  6090 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  6100 */   202,  203,  237,  205,  237,  237,  237,  209,  237,  237,
+ /*  6110 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  6120 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  6130 */   191,  237,  120,  237,  237,  237,  237,  237,  237,  200,
+ /*  6140 */   201,  202,  203,  237,  205,  237,  237,  237,  209,  137,
+ /*  6150 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  6160 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  6170 */   231,  237,  237,  120,  237,  237,  237,  237,  237,  237,
+ /*  6180 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6190 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6200 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /*  6210 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  6220 */   237,  209,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  6230 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  6240 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /*  6250 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  206,
+ /*  6260 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /*  6270 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  6280 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /*  6290 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6300 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /*  6310 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /*  6320 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  6330 */   205,  237,  237,  237,  209,  237,  237,  237,  237,  214,
+ /*  6340 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  6350 */   225,  226,  227,  228,  229,  230,  231,  191,  237,  120,
+ /*  6360 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  6370 */   237,  205,  237,  237,  237,  209,  137,  237,  237,  237,
+ /*  6380 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  6390 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  237,
+ /*  6400 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6410 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /*  6420 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6430 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  6440 */   201,  202,  203,  237,  205,  237,  237,  237,  209,  237,
+ /*  6450 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  6460 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  6470 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  6480 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /*  6490 */   237,  237,  237,  213,  214,  215,  216,  217,  218,  219,
+ /*  6500 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  6510 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /*  6520 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6530 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6540 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /*  6550 */   237,  237,  200,  201,  202,  203,  237,  205,  206,  237,
+ /*  6560 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  6570 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  6580 */   228,  229,  230,  231,  191,  237,  120,  237,  237,  237,
+ /*  6590 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  6600 */   237,  237,  209,  137,  237,  237,  237,  214,  215,  216,
+ /*  6610 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  6620 */   227,  228,  229,  230,  231,  237,  237,  120,  237,  237,
+ /*  6630 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6640 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /*  6650 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /*  6660 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  6670 */   237,  205,  237,  237,  237,  209,  237,  237,  237,  237,
+ /*  6680 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  6690 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  237,
+ /*  6700 */   120,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  6710 */   203,  237,  205,  237,  237,  237,  209,  137,  237,  237,
+ /*  6720 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  6730 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /*  6740 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6750 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /*  6760 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6770 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6780 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /*  6790 */   237,  237,  237,  213,  214,  215,  216,  217,  218,  219,
+ /*  6800 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  6810 */   230,  231,  191,  237,  120,  237,  237,  237,  237,  237,
+ /*  6820 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  6830 */   209,  137,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  6840 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  6850 */   229,  230,  231,  237,  237,  120,  237,  237,  237,  237,
+ /*  6860 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6870 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /*  6880 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /*  6890 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  6900 */   237,  237,  237,  209,  237,  237,  237,  237,  214,  215,
+ /*  6910 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  6920 */   226,  227,  228,  229,  230,  231,  191,  237,  120,  237,
+ /*  6930 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  6940 */   205,  237,  237,  237,  209,  137,  237,  237,  237,  214,
+ /*  6950 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  6960 */   225,  226,  227,  228,  229,  230,  231,  237,  237,  120,
+ /*  6970 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  6980 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /*  6990 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /*  7000 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  7010 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /*  7020 */   237,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  7030 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  7040 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  7050 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /*  7060 */   237,  237,  213,  214,  215,  216,  217,  218,  219,  220,
+ /*  7070 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  7080 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  7090 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /*  7100 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7110 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /*  7120 */   237,  200,  201,  202,  203,  237,  205,  206,  237,  237,
+ /*  7130 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  7140 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  7150 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /*  7160 */   237,  237,  200,  201,  202,  203,  237,  205,  206,  237,
+ /*  7170 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  7180 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  7190 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /*  7200 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7210 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /*  7220 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /*  7230 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  7240 */   206,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /*  7250 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  7260 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /*  7270 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  7280 */   205,  206,  237,  237,  137,  237,  237,  237,  237,  214,
+ /*  7290 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  7300 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /*  7310 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7320 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /*  7330 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /*  7340 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  7350 */   203,  237,  205,  206,  237,  237,  237,  237,  237,  237,
+ /*  7360 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  7370 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /*  7380 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  7390 */   202,  203,  237,  205,  206,  237,  237,  137,  237,  237,
+ /*  7400 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  7410 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  7420 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7430 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /*  7440 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7450 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7460 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /*  7470 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  7480 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  7490 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /*  7500 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  7510 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  7520 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  7530 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /*  7540 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7550 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7560 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /*  7570 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  7580 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /*  7590 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  7600 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /*  7610 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  7620 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /*  7630 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  7640 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /*  7650 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7660 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /*  7670 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /*  7680 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  7690 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7700 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  7710 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /*  7720 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  7730 */   203,  237,  205,  237,  237,  237,  137,  237,  237,  237,
+ /*  7740 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  7750 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /*  7760 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7770 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /*  7780 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7790 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  7800 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /*  7810 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  7820 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  7830 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  7840 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /*  7850 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  7860 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  7870 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /*  7880 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7890 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  7900 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /*  7910 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  7920 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  7930 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  7940 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /*  7950 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  7960 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /*  7970 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  7980 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /*  7990 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8000 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /*  8010 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /*  8020 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  8030 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /*  8040 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  8050 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /*  8060 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  8070 */   237,  205,  237,  237,  237,  137,  237,  237,  237,  237,
+ /*  8080 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  8090 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /*  8100 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8110 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /*  8120 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /*  8130 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  8140 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /*  8150 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  8160 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  8170 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  8180 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /*  8190 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  8200 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  8210 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  8220 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /*  8230 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8240 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /*  8250 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  8260 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  8270 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  8280 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /*  8290 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  8300 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  8310 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  8320 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /*  8330 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8340 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /*  8350 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /*  8360 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  8370 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /*  8380 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  8390 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /*  8400 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  8410 */   205,  237,  237,  237,  137,  237,  237,  237,  237,  214,
+ /*  8420 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  8430 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /*  8440 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8450 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /*  8460 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /*  8470 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  8480 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /*  8490 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  8500 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /*  8510 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  8520 */   202,  203,  237,  205,  237,  237,  237,  137,  237,  237,
+ /*  8530 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  8540 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  8550 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8560 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /*  8570 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8580 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8590 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /*  8600 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  8610 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  8620 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /*  8630 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  8640 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  8650 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  8660 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /*  8670 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8680 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8690 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /*  8700 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  8710 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /*  8720 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  8730 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /*  8740 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  8750 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /*  8760 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  8770 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /*  8780 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8790 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /*  8800 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /*  8810 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  8820 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8830 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  8840 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /*  8850 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  8860 */   203,  237,  205,  237,  237,  237,  137,  237,  237,  237,
+ /*  8870 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  8880 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /*  8890 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8900 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /*  8910 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  8920 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  8930 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /*  8940 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  8950 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  8960 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  8970 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /*  8980 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  8990 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  9000 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /*  9010 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9020 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9030 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /*  9040 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  9050 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  9060 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  9070 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /*  9080 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  9090 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /*  9100 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  9110 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /*  9120 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9130 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /*  9140 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /*  9150 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  9160 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /*  9170 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  9180 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /*  9190 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  9200 */   237,  205,  237,  237,  237,  137,  237,  237,  237,  237,
+ /*  9210 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  9220 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /*  9230 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9240 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /*  9250 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /*  9260 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  9270 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /*  9280 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  9290 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  9300 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /*  9310 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /*  9320 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /*  9330 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /*  9340 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /*  9350 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /*  9360 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9370 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /*  9380 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  9390 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  9400 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  9410 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /*  9420 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /*  9430 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /*  9440 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /*  9450 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /*  9460 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9470 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /*  9480 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /*  9490 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  9500 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /*  9510 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  9520 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /*  9530 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /*  9540 */   205,  237,  237,  237,  137,  237,  237,  237,  237,  214,
+ /*  9550 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /*  9560 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /*  9570 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9580 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /*  9590 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /*  9600 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  9610 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /*  9620 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  9630 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /*  9640 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /*  9650 */   202,  203,  237,  205,  237,  237,  237,  137,  237,  237,
+ /*  9660 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*  9670 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /*  9680 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9690 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /*  9700 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9710 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9720 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /*  9730 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /*  9740 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /*  9750 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /*  9760 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /*  9770 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /*  9780 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /*  9790 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /*  9800 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9810 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9820 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /*  9830 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /*  9840 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /*  9850 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /*  9860 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /*  9870 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /*  9880 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /*  9890 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /*  9900 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /*  9910 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9920 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /*  9930 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /*  9940 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /*  9950 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /*  9960 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*  9970 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /*  9980 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /*  9990 */   203,  237,  205,  237,  237,  237,  137,  237,  237,  237,
+ /* 10000 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 10010 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /* 10020 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10030 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /* 10040 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10050 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 10060 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /* 10070 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 10080 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 10090 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 10100 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /* 10110 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 10120 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 10130 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /* 10140 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10150 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10160 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /* 10170 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 10180 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 10190 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 10200 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /* 10210 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 10220 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /* 10230 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 10240 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /* 10250 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10260 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /* 10270 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /* 10280 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 10290 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /* 10300 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 10310 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /* 10320 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 10330 */   237,  205,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 10340 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 10350 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /* 10360 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10370 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /* 10380 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /* 10390 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 10400 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /* 10410 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 10420 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 10430 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 10440 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /* 10450 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 10460 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 10470 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 10480 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /* 10490 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10500 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /* 10510 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 10520 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 10530 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 10540 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /* 10550 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 10560 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 10570 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 10580 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /* 10590 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10600 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /* 10610 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /* 10620 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 10630 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /* 10640 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 10650 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /* 10660 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 10670 */   205,  237,  237,  237,  137,  237,  237,  237,  237,  214,
+ /* 10680 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 10690 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /* 10700 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10710 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 10720 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /* 10730 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 10740 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /* 10750 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 10760 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /* 10770 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 10780 */   202,  203,  237,  205,  237,  237,  237,  137,  237,  237,
+ /* 10790 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 10800 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 10810 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10820 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /* 10830 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10840 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10850 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /* 10860 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 10870 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 10880 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /* 10890 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 10900 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 10910 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 10920 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /* 10930 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10940 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 10950 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /* 10960 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 10970 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /* 10980 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 10990 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /* 11000 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 11010 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /* 11020 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 11030 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /* 11040 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11050 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /* 11060 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /* 11070 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 11080 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11090 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 11100 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /* 11110 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 11120 */   203,  237,  205,  237,  237,  237,  137,  237,  237,  237,
+ /* 11130 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 11140 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /* 11150 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11160 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /* 11170 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11180 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 11190 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /* 11200 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 11210 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 11220 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 11230 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /* 11240 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 11250 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 11260 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /* 11270 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11280 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11290 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /* 11300 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 11310 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 11320 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 11330 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /* 11340 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 11350 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /* 11360 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 11370 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /* 11380 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11390 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /* 11400 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /* 11410 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 11420 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /* 11430 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 11440 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /* 11450 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 11460 */   237,  205,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 11470 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 11480 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /* 11490 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11500 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /* 11510 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /* 11520 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 11530 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /* 11540 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 11550 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 11560 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 11570 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /* 11580 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 11590 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 11600 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 11610 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /* 11620 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11630 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /* 11640 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 11650 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 11660 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 11670 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /* 11680 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 11690 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 11700 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 11710 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /* 11720 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11730 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /* 11740 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /* 11750 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 11760 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /* 11770 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 11780 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /* 11790 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 11800 */   205,  237,  237,  237,  137,  237,  237,  237,  237,  214,
+ /* 11810 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 11820 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /* 11830 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11840 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 11850 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /* 11860 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 11870 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /* 11880 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 11890 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /* 11900 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 11910 */   202,  203,  237,  205,  237,  237,  237,  137,  237,  237,
+ /* 11920 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 11930 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 11940 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11950 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /* 11960 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11970 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 11980 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /* 11990 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 12000 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 12010 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /* 12020 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 12030 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 12040 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 12050 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /* 12060 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12070 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12080 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /* 12090 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 12100 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /* 12110 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 12120 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /* 12130 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 12140 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /* 12150 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 12160 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /* 12170 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12180 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /* 12190 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /* 12200 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 12210 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12220 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 12230 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /* 12240 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 12250 */   203,  237,  205,  237,  237,  237,  137,  237,  237,  237,
+ /* 12260 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 12270 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /* 12280 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12290 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /* 12300 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12310 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 12320 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /* 12330 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 12340 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 12350 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 12360 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /* 12370 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 12380 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 12390 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /* 12400 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12410 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12420 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /* 12430 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 12440 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 12450 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 12460 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /* 12470 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 12480 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /* 12490 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 12500 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /* 12510 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12520 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /* 12530 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /* 12540 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 12550 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /* 12560 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 12570 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /* 12580 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 12590 */   237,  205,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 12600 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 12610 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /* 12620 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12630 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /* 12640 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /* 12650 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 12660 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /* 12670 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 12680 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 12690 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 12700 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /* 12710 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 12720 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 12730 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 12740 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /* 12750 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12760 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /* 12770 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 12780 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 12790 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 12800 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /* 12810 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 12820 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 12830 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 12840 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /* 12850 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12860 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /* 12870 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /* 12880 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 12890 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /* 12900 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 12910 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /* 12920 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 12930 */   205,  237,  237,  237,  137,  237,  237,  237,  237,  214,
+ /* 12940 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 12950 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /* 12960 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 12970 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 12980 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /* 12990 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 13000 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /* 13010 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 13020 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /* 13030 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 13040 */   202,  203,  237,  205,  237,  237,  237,  137,  237,  237,
+ /* 13050 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 13060 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 13070 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13080 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /* 13090 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13100 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13110 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /* 13120 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 13130 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 13140 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /* 13150 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 13160 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 13170 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 13180 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /* 13190 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13200 */   237,  137,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13210 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /* 13220 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 13230 */   237,  237,  237,  237,  237,  237,  237,  214,  215,  216,
+ /* 13240 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 13250 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /* 13260 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 13270 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /* 13280 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 13290 */   226,  227,  228,  229,  230,  231,  237,  120,  237,  237,
+ /* 13300 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13310 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /* 13320 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /* 13330 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 13340 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13350 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 13360 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  120,
+ /* 13370 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 13380 */   203,  237,  205,  237,  237,  237,  137,  237,  237,  237,
+ /* 13390 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 13400 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /* 13410 */   120,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13420 */   237,  237,  237,  237,  237,  237,  237,  137,  237,  237,
+ /* 13430 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13440 */   191,  237,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 13450 */   201,  202,  203,  237,  205,  237,  237,  237,  237,  237,
+ /* 13460 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 13470 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 13480 */   231,  191,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 13490 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  137,
+ /* 13500 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 13510 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 13520 */   230,  231,  237,  120,  237,  237,  237,  237,  237,  237,
+ /* 13530 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13540 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13550 */   237,  237,  237,  191,  237,  237,  237,  237,  237,  237,
+ /* 13560 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 13570 */   237,  237,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 13580 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 13590 */   228,  229,  230,  231,  191,  120,  237,  237,  237,  237,
+ /* 13600 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 13610 */   237,  237,  137,  237,  237,  237,  237,  214,  215,  216,
+ /* 13620 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 13630 */   227,  228,  229,  230,  231,  237,  120,  237,  237,  237,
+ /* 13640 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13650 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /* 13660 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /* 13670 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 13680 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  214,
+ /* 13690 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 13700 */   225,  226,  227,  228,  229,  230,  231,  191,  120,  237,
+ /* 13710 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 13720 */   237,  205,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 13730 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 13740 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  120,
+ /* 13750 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13760 */   237,  237,  237,  237,  237,  237,  137,  237,  237,  237,
+ /* 13770 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  191,
+ /* 13780 */   237,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 13790 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /* 13800 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 13810 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 13820 */   191,  120,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 13830 */   201,  202,  203,  237,  205,  237,  237,  237,  137,  237,
+ /* 13840 */   237,  237,  237,  214,  215,  216,  217,  218,  219,  220,
+ /* 13850 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 13860 */   231,  237,  120,  237,  237,  237,  237,  237,  237,  237,
+ /* 13870 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  137,
+ /* 13880 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13890 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /* 13900 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 13910 */   237,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 13920 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 13930 */   229,  230,  231,  191,  120,  237,  237,  237,  237,  237,
+ /* 13940 */   237,  237,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 13950 */   237,  137,  237,  237,  237,  237,  214,  215,  216,  217,
+ /* 13960 */   218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+ /* 13970 */   228,  229,  230,  231,  237,  120,  237,  237,  237,  237,
+ /* 13980 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 13990 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /* 14000 */   237,  237,  237,  237,  237,  191,  237,  237,  237,  237,
+ /* 14010 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 14020 */   237,  237,  237,  237,  237,  237,  237,  237,  214,  215,
+ /* 14030 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 14040 */   226,  227,  228,  229,  230,  231,  191,  120,  237,  237,
+ /* 14050 */   237,  237,  237,  237,  237,  200,  201,  202,  203,  237,
+ /* 14060 */   205,  237,  237,  237,  137,  237,  237,  237,  237,  214,
+ /* 14070 */   215,  216,  217,  218,  219,  220,  221,  222,  223,  224,
+ /* 14080 */   225,  226,  227,  228,  229,  230,  231,  237,  120,  237,
+ /* 14090 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14100 */   237,  237,  237,  237,  237,  137,  237,  237,  237,  237,
+ /* 14110 */   237,  237,  237,  237,  237,  237,  237,  237,  191,  237,
+ /* 14120 */   237,  237,  237,  237,  237,  237,  237,  200,  201,  202,
+ /* 14130 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /* 14140 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 14150 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  191,
+ /* 14160 */   120,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 14170 */   202,  203,  237,  205,  237,  237,  237,  137,  237,  237,
+ /* 14180 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 14190 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 14200 */   237,  120,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14210 */   237,  237,  237,  237,  237,  237,  237,  237,  137,  237,
+ /* 14220 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14230 */   237,  191,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14240 */   200,  201,  202,  203,  237,  205,  237,  237,  237,  237,
+ /* 14250 */   237,  237,  237,  237,  214,  215,  216,  217,  218,  219,
+ /* 14260 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 14270 */   230,  231,  191,  120,  237,  237,  237,  237,  237,  237,
+ /* 14280 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 14290 */   137,  237,  237,  237,  237,  214,  215,  216,  217,  218,
+ /* 14300 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 14310 */   229,  230,  231,  237,  120,  237,  237,  237,  237,  237,
+ /* 14320 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14330 */   237,  137,  237,  237,  237,  237,  237,  237,  237,    7,
+ /* 14340 */     8,  237,  237,  237,  191,  237,  237,   15,   16,   17,
+ /* 14350 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 14360 */   237,  237,  237,  237,  237,  237,   34,  214,  215,  216,
+ /* 14370 */   217,  218,  219,  220,  221,  222,  223,  224,  225,  226,
+ /* 14380 */   227,  228,  229,  230,  231,  191,  120,  237,  237,  237,
+ /* 14390 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 14400 */   237,  237,  237,  137,  237,  237,  237,  237,  214,  215,
+ /* 14410 */   216,  217,  218,  219,  220,  221,  222,  223,  224,  225,
+ /* 14420 */   226,  227,  228,  229,  230,  231,  237,   95,   96,   97,
+ /* 14430 */    98,   99,  100,  101,  102,  103,  104,  105,  237,  237,
+ /* 14440 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /* 14450 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /* 14460 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 14470 */   237,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14480 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /* 14490 */   224,  225,  226,  227,  228,  229,  230,  231,  191,  237,
+ /* 14500 */   237,  237,  237,  237,  237,  137,  237,  200,  201,  202,
+ /* 14510 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /* 14520 */   237,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /* 14530 */   223,  224,  225,  226,  227,  228,  229,  230,  231,    7,
+ /* 14540 */     8,  237,   10,  237,  237,  237,  237,   15,   16,   17,
+ /* 14550 */   237,  237,  237,  237,  237,  237,  237,   25,   26,  191,
+ /* 14560 */   237,  237,  237,  237,  237,  237,   34,  237,  200,  201,
+ /* 14570 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /* 14580 */   237,  237,  214,  215,  216,  217,  218,  219,  220,  221,
+ /* 14590 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 14600 */   237,  237,  237,  237,  137,  237,  237,  237,  237,  237,
+ /* 14610 */   237,  237,  237,  237,  237,  237,  237,   85,   86,  237,
+ /* 14620 */   237,  237,  237,  237,   92,   93,  237,   95,   96,   97,
+ /* 14630 */    98,   99,  100,  101,  102,  103,  104,  105,    7,    8,
+ /* 14640 */   237,   10,  237,  237,  237,  237,   15,   16,   17,  237,
+ /* 14650 */   237,  237,  237,  237,  237,  237,   25,   26,  191,  237,
+ /* 14660 */   237,  237,  237,  237,  237,   34,  237,  200,  201,  202,
+ /* 14670 */   203,  237,  205,  237,  237,  237,  237,  237,  237,  237,
+ /* 14680 */   237,  237,  237,  216,  217,  218,  219,  220,  221,  222,
+ /* 14690 */   223,  224,  225,  226,  227,  228,  229,  230,  231,  237,
+ /* 14700 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14710 */   237,  237,  237,  237,  237,  237,   85,   86,  237,  237,
+ /* 14720 */   237,  237,  237,   92,   93,  237,   95,   96,   97,   98,
+ /* 14730 */    99,  100,  101,  102,  103,  104,  105,    7,    8,  237,
+ /* 14740 */   237,  237,  237,  237,  237,   15,   16,   17,  237,  237,
+ /* 14750 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14760 */    32,  237,  237,   35,   34,   37,   38,   39,   40,   41,
+ /* 14770 */    42,   43,   44,   45,   46,   47,   48,   49,   50,   51,
+ /* 14780 */    52,  237,  237,  237,  237,  237,   56,   57,   58,  237,
+ /* 14790 */   237,  237,  237,  237,    7,    8,  237,  237,  237,  237,
+ /* 14800 */   237,  237,   15,   16,   17,  237,  237,  237,  237,  237,
+ /* 14810 */   237,  237,  237,  237,  237,   85,   86,  237,  237,  237,
+ /* 14820 */   237,   34,   92,   93,  237,   95,   96,   97,   98,   99,
+ /* 14830 */   100,  101,  102,  103,  104,  105,  237,  237,    7,    8,
+ /* 14840 */   237,  237,  237,   56,   57,   58,   15,   16,   17,  237,
+ /* 14850 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14860 */   237,  237,  237,  237,  237,   34,  237,  237,  237,  237,
+ /* 14870 */   237,  237,   85,   86,  237,  237,  237,  237,  237,   92,
+ /* 14880 */    93,  237,   95,   96,   97,   98,   99,  100,  101,  102,
+ /* 14890 */   103,  104,  105,  237,    7,    8,  237,  237,  237,   68,
+ /* 14900 */    69,   14,   15,   16,   17,   18,  237,  237,  237,  237,
+ /* 14910 */   237,  237,  237,  237,  237,  237,   85,   86,  237,  237,
+ /* 14920 */   237,   34,  237,   92,   93,  237,   95,   96,   97,   98,
+ /* 14930 */    99,  100,  101,  102,  103,  104,  105,    7,    8,  237,
+ /* 14940 */    10,  237,  237,  237,  237,   15,   16,   17,  237,  237,
+ /* 14950 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 14960 */   237,  237,  237,  237,   34,  237,  237,  237,  237,  237,
+ /* 14970 */   237,  237,   85,   86,  237,  237,  237,  237,  237,   92,
+ /* 14980 */    93,  237,   95,   96,   97,   98,   99,  100,  101,  102,
+ /* 14990 */   103,  104,  105,  237,  237,  237,  237,  237,  237,  237,
+ /* 15000 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  237,
+ /* 15010 */   237,  137,  237,  237,  237,   85,   86,  237,  237,  237,
+ /* 15020 */   237,  237,   92,   93,  237,   95,   96,   97,   98,   99,
+ /* 15030 */   100,  101,  102,  103,  104,  105,    7,    8,  237,  237,
+ /* 15040 */    11,  237,  237,  237,   15,   16,   17,  237,  237,  237,
+ /* 15050 */   237,  237,  237,  237,  237,  237,  237,  191,  237,  237,
+ /* 15060 */   237,  237,  237,   34,  237,  191,  200,  201,  202,  203,
+ /* 15070 */   237,  205,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 15080 */   237,  237,  237,  217,  218,  219,  220,  221,  222,  223,
+ /* 15090 */   224,  225,  226,  227,  228,  229,  230,  231,  224,  225,
+ /* 15100 */   226,  227,  228,  229,  230,  231,  237,  237,  237,  237,
+ /* 15110 */   237,  237,  237,  237,   85,   86,  237,  237,  137,  237,
+ /* 15120 */   237,   92,   93,  237,   95,   96,   97,   98,   99,  100,
+ /* 15130 */   101,  102,  103,  104,  105,    7,    8,  237,  237,  237,
+ /* 15140 */   237,  237,  237,   15,   16,   17,  237,  237,  237,  237,
+ /* 15150 */   237,  237,  237,   25,  237,  237,  237,  237,  237,  237,
+ /* 15160 */   237,  237,   34,  237,  237,  237,  237,  237,  237,  237,
+ /* 15170 */     7,    8,  191,  237,  237,  237,  237,  237,   15,   16,
+ /* 15180 */    17,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 15190 */   237,  237,  237,  237,  237,  237,  237,   34,  237,  218,
+ /* 15200 */   219,  220,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 15210 */   229,  230,  231,   85,   86,  237,  237,  237,  237,  237,
+ /* 15220 */    92,   93,  137,   95,   96,   97,   98,   99,  100,  101,
+ /* 15230 */   102,  103,  104,  105,  237,  137,  237,  237,  237,  237,
+ /* 15240 */   237,  237,  237,  237,  237,  237,  237,  237,   85,   86,
+ /* 15250 */   237,  237,  237,  237,  237,   92,   93,  237,   95,   96,
+ /* 15260 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  237,
+ /* 15270 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  237,
+ /* 15280 */   237,  137,  237,  237,  237,  200,  201,  202,  203,  191,
+ /* 15290 */   205,  237,  237,  237,  237,  237,  237,  237,  200,  201,
+ /* 15300 */   202,  203,  237,  205,  219,  220,  221,  222,  223,  224,
+ /* 15310 */   225,  226,  227,  228,  229,  230,  231,  219,  220,  221,
+ /* 15320 */   222,  223,  224,  225,  226,  227,  228,  229,  230,  231,
+ /* 15330 */   237,  237,  237,  237,  237,  191,  237,  137,  237,  237,
+ /* 15340 */   237,  237,  237,  237,  200,  201,  202,  203,  237,  205,
+ /* 15350 */   137,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15360 */   237,  237,  237,  219,  220,  221,  222,  223,  224,  225,
+ /* 15370 */   226,  227,  228,  229,  230,  231,  237,  237,  237,  237,
+ /* 15380 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15390 */   237,  191,  237,  137,  237,  237,  237,  237,  237,  237,
+ /* 15400 */   200,  201,  202,  203,  191,  205,  137,  237,  237,  237,
+ /* 15410 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 15420 */   220,  221,  222,  223,  224,  225,  226,  227,  228,  229,
+ /* 15430 */   230,  231,  237,  220,  221,  222,  223,  224,  225,  226,
+ /* 15440 */   227,  228,  229,  230,  231,  237,  237,  191,  137,  237,
+ /* 15450 */   237,  237,  237,  237,  237,  237,  200,  201,  202,  203,
+ /* 15460 */   191,  205,  237,  237,  237,  237,  237,  237,  237,  200,
+ /* 15470 */   201,  202,  203,  237,  205,  237,  220,  221,  222,  223,
+ /* 15480 */   224,  225,  226,  227,  228,  229,  230,  231,  237,  220,
+ /* 15490 */   221,  222,  223,  224,  225,  226,  227,  228,  229,  230,
+ /* 15500 */   231,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /* 15510 */   237,  200,  201,  202,  203,  237,  205,  237,  237,  237,
+ /* 15520 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15530 */   237,  237,  221,  222,  223,  224,  225,  226,  227,  228,
+ /* 15540 */   229,  230,  231,  237,   32,  237,  237,   35,  237,   37,
+ /* 15550 */    38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+ /* 15560 */    48,   49,   50,   51,   52,   32,  237,  237,   35,  237,
+ /* 15570 */    37,   38,   39,   40,   41,   42,   43,   44,   45,   46,
+ /* 15580 */    47,   48,   49,   50,   51,   52,   32,  237,  237,  237,
+ /* 15590 */   237,   37,   38,   39,   40,   41,   42,   43,   44,   45,
+ /* 15600 */    46,   47,   48,   49,   50,   51,   52,   32,  137,  237,
+ /* 15610 */   237,  237,   37,   38,   39,   40,   41,   42,   43,   44,
+ /* 15620 */    45,   46,   47,   48,   49,   50,   51,   52,    7,  237,
+ /* 15630 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15640 */   137,  237,  237,  237,  237,  237,   25,   26,  237,  237,
+ /* 15650 */   237,  237,  237,  237,  237,   34,  237,  237,  237,  237,
+ /* 15660 */   237,  237,  191,  237,  237,  237,  237,  237,  237,  237,
+ /* 15670 */   237,  200,  201,  202,  203,   54,  205,  237,  237,  237,
+ /* 15680 */   237,  237,  137,  237,  237,  237,  237,  237,  137,  237,
+ /* 15690 */   237,  237,  237,  237,  191,  137,  225,  226,  227,  228,
+ /* 15700 */   229,  230,  231,  200,  201,  202,  203,  237,  205,  237,
+ /* 15710 */   237,  237,  237,  237,  237,  237,   95,   96,   97,   98,
+ /* 15720 */    99,  237,  237,  237,  237,  237,  237,  237,  225,  226,
+ /* 15730 */   227,  228,  229,  230,  231,  237,  191,  137,  237,  237,
+ /* 15740 */   237,  237,  191,  137,  237,  200,  201,  202,  203,  191,
+ /* 15750 */   205,  200,  201,  202,  203,  237,  205,  237,  200,  201,
+ /* 15760 */   202,  203,  237,  205,  237,  237,  237,  237,  237,  237,
+ /* 15770 */   237,  226,  227,  228,  229,  230,  231,  226,  227,  228,
+ /* 15780 */   229,  230,  231,  237,  226,  227,  228,  229,  230,  231,
+ /* 15790 */   237,  191,  237,  237,  237,  237,  237,  191,  237,  237,
+ /* 15800 */   200,  201,  202,  203,  237,  205,  200,  201,  202,  203,
+ /* 15810 */   137,  205,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15820 */   237,  237,  237,  237,  237,  237,  226,  227,  228,  229,
+ /* 15830 */   230,  231,  226,  227,  228,  229,  230,  231,  237,  237,
+ /* 15840 */   237,  237,  137,  237,  237,  237,  237,  237,  237,  237,
+ /* 15850 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15860 */   237,  237,  237,  237,  191,  237,  237,  237,  237,  237,
+ /* 15870 */   237,  237,  237,  200,  201,  202,  203,  237,  205,  237,
+ /* 15880 */   237,  237,  237,  137,  237,  237,  237,  237,  237,  137,
+ /* 15890 */   237,  237,  237,  237,  237,  237,  191,  237,  237,  226,
+ /* 15900 */   227,  228,  229,  230,  231,  200,  201,  202,  203,  237,
+ /* 15910 */   205,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15920 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15930 */   237,  226,  227,  228,  229,  230,  231,  191,  237,  237,
+ /* 15940 */   237,  237,  237,  191,  237,  237,  200,  201,  202,  203,
+ /* 15950 */   237,  205,  200,  201,  202,  203,  237,  205,  237,  237,
+ /* 15960 */   237,  237,  237,  237,  237,  237,  237,  237,  237,  237,
+ /* 15970 */   237,  237,  226,  227,  228,  229,  230,  231,  237,  227,
+ /* 15980 */   228,  229,  230,  231,
+};
+#define YY_SHIFT_USE_DFLT (-17)
+static short yy_shift_ofst[] = {
+ /*     0 */  3893,   90,   96, 3893, 3789,  -17,  -17,  -17,  -17,  -17,
+ /*    10 */   -17,  -17,  -17,  -17,  -17, 14930,  -17,  -17,  -17,  134,
+ /*    20 */  15163,   67, 15163,  -17,  148, 15163,  133, 15163,   10, 15163,
+ /*    30 */   149, 15163,  204, 15163,  256, 15163,  264, 15163,  270, 15163,
+ /*    40 */   249, 15163,  121, 15163,  -17,  -17, 15163,  -17, 15163,  -17,
+ /*    50 */  15163,  -17, 15163,  -17,  259, 14332,  -17,  -17,  -17,  -17,
+ /*    60 */   -17,  351, 15163,  133,   10, 15163,  149, 15163,  204,  256,
+ /*    70 */   264,  270, 15163,  249, 15163,  121, 15163,  -17,  427, 15163,
+ /*    80 */   149, 15163,  204,  249, 15163,  121, 15163,  -17,  -17,  -17,
+ /*    90 */   -17,  429, 15163,  204,  121, 15163,  -17,  -17,  -17,  -17,
+ /*   100 */   -17,  -17,  434, 15163,  -17,  475, 15163,  578, 15163,  -17,
+ /*   110 */   -17,  -17,  -17,  558, 15163,  565,  -17, 15163,  703,  -17,
+ /*   120 */   -17,  709, 15163,  319,  -17, 15163,  711, 15163,  445,  -17,
+ /*   130 */   -17,  -17,  446,  -17,  685,  -17,  800,  -17,  805,  -17,
+ /*   140 */  15163,  204,  807,  -17, 15163,  149, 15163,  149,  809,  -17,
+ /*   150 */  15163,  148, 15029,  -17,  448,  -17, 15163,  -17,  655, 14930,
+ /*   160 */   -17,  -17,  -17,  779,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   170 */   -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   180 */   333,  -17,  578,  -17,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   190 */   -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   200 */   -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   210 */   -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   220 */   -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,  -17,
+ /*   230 */   -17,  -17,  -17,  944,  952,   85,  464,  955, 3893,  956,
+ /*   240 */   -17,  964, 1067,   85,  566, 1068, 3893,  961,  -17, 1069,
+ /*   250 */  3893, 1071,  -17, 1070, 3893, 1078,  -17, 1081, 3893, 1082,
+ /*   260 */   -17, 1086, 15163, 1087, 1085, 3893, 1188,  -17, 1191, 3893,
+ /*   270 */  1192, 1176, 1190, 15163, 1193,  -17, 1196, 3997,  564,  209,
+ /*   280 */  1184, 3104, 1204, 1205, 3893, 1206,  -17,  449,  -17,  -17,
+ /*   290 */  1210, 15163, 1211, 1209, 3893,  -17, 1311, 15163, 1312, 1310,
+ /*   300 */  3893, 1314,  -17, 15163,  -17, 1315, 1294, 14930,  -17,  -17,
+ /*   310 */   -17, 1315, 1296, 15163,  -17,  574, 1300, 15163,  -17,  576,
+ /*   320 */  1307, 15163,  -17, 1315, 1313, 15163,  -17, 1315, 1411, 15163,
+ /*   330 */   -17, 1315, 1412, 1334,  -17, 14728, 14532,  -17,  -17,  -17,
+ /*   340 */   -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,
+ /*   350 */   -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,
+ /*   360 */   -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,
+ /*   370 */   -17, 15163,  -17, 15512, 14631,  -17,  -17,  -17,  -17, 15163,
+ /*   380 */   -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,
+ /*   390 */   -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,
+ /*   400 */   -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,
+ /*   410 */   -17, 15554, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   420 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   430 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   440 */  15163,  -17, 15163,  -17, 15163,  -17, 1410, 15163, 1413, 1414,
+ /*   450 */  15163,  -17, 15533, 15128,  -17,  -17, 15163,  -17, 15163,  -17,
+ /*   460 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   470 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   480 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 1415,  253,
+ /*   490 */   427, 15575, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   500 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   510 */  15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17, 15163,  -17,
+ /*   520 */  15163,  -17, 15163,  -17, 15163,  -17, 15621,  -17,  -17, 1438,
+ /*   530 */   -16,  -17,  427,  -17,  -17,  -17,  427,  434,  475,  395,
+ /*   540 */  14831, 1439, 1427,  -17,  -17,  -17,  -17, 14831, 1442, 1431,
+ /*   550 */   -17, 15163, 1449, 1440,  -17, 2895, 1451,  253,  427,  427,
+ /*   560 */  14831, 1454,  253, 1451, 14831, 1455,  253, 1451, 15163, 1456,
+ /*   570 */   253, 1451, 3805, 1457, 15163, 1458, 15163,  -17,  -17, 1555,
+ /*   580 */  15163, 1458,  687, 15163, 1458, 14831, 1556, 4656, 1557, 15163,
+ /*   590 */  1458, 1558, 15163, 1458,  688, 15163, 1458,  253,  586, 1559,
+ /*   600 */  15163, 1561, 15163,  -17,  -17,  253,  427,  427, 14831, 1562,
+ /*   610 */  4697, 1563, 15163, 1458, 1564, 15163, 1458,  689, 15163, 1458,
+ /*   620 */   253,  588, 1566, 15163, 1561, 15163, 1568, 4724, 1573, 15163,
+ /*   630 */  1458, 1575, 15163, 1458,  690, 15163, 1458,  253,  590, 1577,
+ /*   640 */  15163, 1561,  253,  694, 1578, 15163, 1561, 4541, 1579, 15163,
+ /*   650 */  1580, 15163,  -17,  -17, 1581, 15163, 1580,  811, 15163, 1580,
+ /*   660 */  14831, 1582, 4810, 1679, 15163, 1580, 1680, 15163, 1580,  812,
+ /*   670 */  15163, 1580,  253,  696, 1681, 15163, 1682, 15163,  -17,  -17,
+ /*   680 */   253,  427,  427, 14831, 1683, 4837, 1685, 15163, 1580, 1686,
+ /*   690 */  15163, 1580,  813, 15163, 1580,  253,  698, 1687, 15163, 1682,
+ /*   700 */  15163, 1688, 4923, 1690, 15163, 1580, 1692, 15163, 1580,  814,
+ /*   710 */  15163, 1580,  253,  818, 1697, 15163, 1682,  253,  820, 1699,
+ /*   720 */  15163, 1682, 3980, 14831,    7,  434,  475,  427, 14831,    7,
+ /*   730 */   434,  475,  427, 15163,    7,  434,  475,  427,  434,  475,
+ /*   740 */   427,    7,  434,  475,  427, 14730,  -17, 14831, 1701, 15163,
+ /*   750 */   -17, 14831, 1702, 15163,  -17, 15163, 1703, 15163,  -17, 15163,
+ /*   760 */   -17, 14787,  -17, 14831, 1704, 15163,  -17, 14831, 1705, 15163,
+ /*   770 */   -17, 15163, 1706, 15163,  -17, 15163,  -17, 1804,  -17, 1806,
+ /*   780 */  3893, 1807,  -17, 1808, 1809, 3893, 1810,  -17,  938, 1812,
+ /*   790 */  3893, 1813,  -17,  939, 1816, 3893, 1817,  -17, 15163, 1787,
+ /*   800 */   -17,  -17,  -17, 1826,  -17, 1828,  -17, 1830,  -17, 1831,
+ /*   810 */   -17, 1832,  -17, 3738, 1833, 1929, 3893, 1829,  -17, 1062,
+ /*   820 */  1930, 3893, 1931,  -17, 1063, 1933, 3893, 1934,  -17, 14887,
+ /*   830 */   822, 1935,  209, 1917, 3741, 1937, 1938, 3893, 1939,  -17,
+ /*   840 */  1186, 1942, 3893, 1946,  -17, 1187, 1949, 3893, 1950,  -17,
+ /*   850 */   209,  -17,  321,  942,  946, 1831,  -17, 1956, 1932,  948,
+ /*   860 */  1932,  962, 1932, 1958, 1932, 1959, 1932,  202, 4101, 1072,
+ /*   870 */  4101, 1065, 2053, 3893, 2054,  -17, 4101,  -17,  -17,  -17,
+ /*   880 */  4101,  -17,  -17, 4101,  -17,  -17,   85,  -17,  -17, 2057,
+ /*   890 */   -17, 2060,  -17, 2062,  -17, 2063,  -17, 2064,  -17,  -17,
+ /*   900 */    85,  -17,  -17,  -17,
+};
+#define YY_REDUCE_USE_DFLT (-108)
+static short yy_reduce_ofst[] = {
+ /*     0 */  -107, -108, -108,   17,  141, -108, -108, -108, -108, -108,
+ /*    10 */  -108, -108, -108, -108, -108, 4244, -108, -108, -108, -108,
+ /*    20 */  14307, -108, 14368, -108, -108, 14866, -108, 14981, -108, 3742,
+ /*    30 */  -108, 15200, -108, 15311, -108, 3843, -108, 3947, -108, 4072,
+ /*    40 */  -108, 4252, -108, 15545, -108, -108, 15551, -108, 15558, -108,
+ /*    50 */  15600, -108, 15606, -108, -108, 15752, -108, -108, -108, -108,
+ /*    60 */  -108, -108, 7260, -108, -108, 15085, -108, 15213, -108, -108,
+ /*    70 */  -108, -108, 14874, -108, 15471, -108, 15673, -108, -108, 7301,
+ /*    80 */  -108, 15256, -108, -108, 15503, -108, 15705, -108, -108, -108,
+ /*    90 */  -108, -108, 7373, -108, -108, 15746, -108, -108, -108, -108,
+ /*   100 */  -108, -108, -108, 7414, -108, -108, 7486, -108, 4314, -108,
+ /*   110 */  -108, -108, -108, -108, 7527, -108, -108, 7599, -108, -108,
+ /*   120 */  -108, -108, 4356, -108, -108, 7640, -108, 4428, -108, -108,
+ /*   130 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   140 */  15269, -108, -108, -108, 15098, -108, 15144, -108, -108, -108,
+ /*   150 */  14467, -108, 4016, -108, -108, -108, 4090, -108, -108, 4132,
+ /*   160 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   170 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   180 */   821, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   190 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   200 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   210 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   220 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   230 */  -108, -108, -108, -108, -108,  285, -108, -108,  265, -108,
+ /*   240 */  -108, -108, -108,  287, -108, -108,  389, -108, -108, -108,
+ /*   250 */   513, -108, -108, -108,  637, -108, -108, -108,  761, -108,
+ /*   260 */  -108, -108, 7712, -108, -108,  885, -108, -108, -108, 1009,
+ /*   270 */  -108, -108, -108, 7753, -108, -108, -108, 2868, -108, 1017,
+ /*   280 */  -108, 2872, -108, -108, 1133, -108, -108,  380, -108, -108,
+ /*   290 */  -108, 7825, -108, -108, 1257, -108, -108, 7866, -108, -108,
+ /*   300 */  1381, -108, -108, 7938, -108, 1123, -108, 4470, -108, -108,
+ /*   310 */  -108, 1127, -108, 7979, -108, 1130, -108, 8051, -108, 1137,
+ /*   320 */  -108, 8092, -108, 1141, -108, 8164, -108, 1142, -108, 8205,
+ /*   330 */  -108, 1143, -108, 1225, -108, -108, 4542, -108, -108, -108,
+ /*   340 */  -108, 8277, -108, 8318, -108, 8390, -108, 8431, -108, 8503,
+ /*   350 */  -108, 8544, -108, 8616, -108, 8657, -108, 8729, -108, 8770,
+ /*   360 */  -108, 8842, -108, 8883, -108, 8955, -108, 8996, -108, 9068,
+ /*   370 */  -108, 9109, -108, -108, 4583, -108, -108, -108, -108, 9181,
+ /*   380 */  -108, 9222, -108, 9294, -108, 9335, -108, 9407, -108, 9448,
+ /*   390 */  -108, 9520, -108, 9561, -108, 9633, -108, 9674, -108, 9746,
+ /*   400 */  -108, 9787, -108, 9859, -108, 9900, -108, 9972, -108, 10013,
+ /*   410 */  -108, -108, 10085, -108, 10126, -108, 10198, -108, 10239, -108,
+ /*   420 */  10311, -108, 10352, -108, 10424, -108, 10465, -108, 10537, -108,
+ /*   430 */  10578, -108, 10650, -108, 10691, -108, 10763, -108, 10804, -108,
+ /*   440 */  10876, -108, 10917, -108, 10989, -108, -108, 11030, -108, -108,
+ /*   450 */  11102, -108, -108, 11143, -108, -108, 11215, -108, 11256, -108,
+ /*   460 */  11328, -108, 11369, -108, 11441, -108, 11482, -108, 11554, -108,
+ /*   470 */  11595, -108, 11667, -108, 11708, -108, 11780, -108, 11821, -108,
+ /*   480 */  11893, -108, 11934, -108, 12006, -108, 12047, -108, -108,  405,
+ /*   490 */  -108, -108, 12119, -108, 12160, -108, 12232, -108, 12273, -108,
+ /*   500 */  12345, -108, 12386, -108, 12458, -108, 12499, -108, 12571, -108,
+ /*   510 */  12612, -108, 12684, -108, 12725, -108, 12797, -108, 12838, -108,
+ /*   520 */  12910, -108, 12951, -108, 13023, -108, 2874, -108, -108, -108,
+ /*   530 */  3014, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   540 */  4655, -108, -108, -108, -108, -108, -108, 4696, -108, -108,
+ /*   550 */  -108, 13064, -108, -108, -108, 2749, -108,  529, -108, -108,
+ /*   560 */  4768, -108, 3149, -108, 4809, -108, 3285, -108, 13136, -108,
+ /*   570 */  3286, -108,  653, -108, 4881, -108, 13177, -108, -108, -108,
+ /*   580 */  4922, -108, -108, 4994, -108, 5035, -108,  777, -108, 5107,
+ /*   590 */  -108, -108, 5148, -108, -108, 5220, -108, 3423, -108, -108,
+ /*   600 */  5261, -108, 13249, -108, -108,  901, -108, -108, 5333, -108,
+ /*   610 */  1025, -108, 5374, -108, -108, 5446, -108, -108, 5487, -108,
+ /*   620 */  3635, -108, -108, 5559, -108, 13290, -108, 1149, -108, 5600,
+ /*   630 */  -108, -108, 5672, -108, -108, 5713, -108, 3636, -108, -108,
+ /*   640 */  5785, -108, 3637, -108, -108, 5826, -108, 1273, -108, 5898,
+ /*   650 */  -108, 13362, -108, -108, -108, 5939, -108, -108, 6012, -108,
+ /*   660 */  6053, -108, 1397, -108, 6125, -108, -108, 6166, -108, -108,
+ /*   670 */  6239, -108, 3791, -108, -108, 6280, -108, 13403, -108, -108,
+ /*   680 */  1521, -108, -108, 6352, -108, 1645, -108, 6393, -108, -108,
+ /*   690 */  6466, -108, -108, 6507, -108, 3895, -108, -108, 6580, -108,
+ /*   700 */  13475, -108, 1769, -108, 6621, -108, -108, 6694, -108, -108,
+ /*   710 */  6735, -108, 3900, -108, -108, 6808, -108, 3999, -108, -108,
+ /*   720 */  6849, -108, 2909, 6921, 2913, -108, -108, -108, 6962, 3013,
+ /*   730 */  -108, -108, -108, 13516, 3047, -108, -108, -108, -108, -108,
+ /*   740 */  -108, 3049, -108, -108, -108, 13588, -108, 7034, -108, 13629,
+ /*   750 */  -108, 7075, -108, 13701, -108, 13742, -108, 13814, -108, 13855,
+ /*   760 */  -108, 13927, -108, 7147, -108, 13968, -108, 7188, -108, 14040,
+ /*   770 */  -108, 14081, -108, 14153, -108, 14194, -108, -108, -108, -108,
+ /*   780 */  1505, -108, -108, -108, -108, 1629, -108, -108, -108, -108,
+ /*   790 */  1753, -108, -108, -108, -108, 1877, -108, -108, 14266, -108,
+ /*   800 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   810 */  -108, -108, -108, 3150, -108, -108, 2001, -108, -108, -108,
+ /*   820 */  -108, 2125, -108, -108, -108, -108, 2249, -108, -108, 4202,
+ /*   830 */  -108, -108, 1652, -108, 3185, -108, -108, 2373, -108, -108,
+ /*   840 */  -108, -108, 2497, -108, -108, -108, -108, 2621, -108, -108,
+ /*   850 */  1773, -108, -108, -108, -108, -108, -108, 1127, -108, 1130,
+ /*   860 */  -108, 1137, -108, 1142, -108, 1141, -108, -108, 3006, -108,
+ /*   870 */  3144, -108, -108, 2745, -108, -108, 3282, -108, -108, -108,
+ /*   880 */  3420, -108, -108, 3558, -108, -108, 1879, -108, -108, -108,
+ /*   890 */  -108, -108, -108, -108, -108, -108, -108, -108, -108, -108,
+ /*   900 */  1885, -108, -108, -108,
+};
+static YYACTIONTYPE yy_default[] = {
+ /*     0 */   909, 1372,  905,  909,  906,  908,  910,  911,  912,  913,
+ /*    10 */   914,  915,  916,  917,  918,  921,  919,  920, 1284, 1286,
+ /*    20 */  1372, 1372, 1372, 1285, 1287, 1372, 1290, 1372, 1292, 1372,
+ /*    30 */  1294, 1372, 1299, 1372, 1304, 1372, 1306, 1372, 1308, 1372,
+ /*    40 */  1310, 1372, 1313, 1372, 1317, 1321, 1372, 1322, 1372, 1323,
+ /*    50 */  1372, 1324, 1372, 1325, 1326, 1372, 1327, 1328, 1329, 1330,
+ /*    60 */  1331, 1372, 1372, 1289, 1291, 1372, 1295, 1372, 1300, 1303,
+ /*    70 */  1305, 1307, 1372, 1311, 1372, 1314, 1372, 1318, 1333, 1372,
+ /*    80 */  1293, 1372, 1301, 1309, 1372, 1315, 1372, 1319, 1334, 1336,
+ /*    90 */  1337, 1372, 1372, 1298, 1312, 1372, 1320, 1341, 1342, 1343,
+ /*   100 */  1344, 1345, 1346, 1372, 1316, 1347, 1372, 1348, 1361, 1351,
+ /*   110 */  1352, 1353, 1354, 1372, 1372, 1372, 1355, 1372, 1372, 1356,
+ /*   120 */  1357, 1372, 1361, 1372, 1359, 1372, 1372, 1361, 1372, 1360,
+ /*   130 */  1362, 1363, 1372, 1358, 1372, 1350, 1372, 1349, 1372, 1338,
+ /*   140 */  1372, 1302, 1372, 1335, 1372, 1296, 1372, 1297, 1372, 1332,
+ /*   150 */  1372, 1288, 1372, 1364, 1372, 1365, 1372, 1367, 1372, 1372,
+ /*   160 */  1368, 1370, 1371, 1372, 1366,  922,  923,  924,  925,  926,
+ /*   170 */   927,  928,  929,  930,  931,  932,  933,  934,  935,  936,
+ /*   180 */  1372,  937, 1372,  938,  939,  940,  941,  942,  943,  944,
+ /*   190 */   945,  946,  947,  948,  949,  950,  951,  952,  953,  954,
+ /*   200 */   955,  956,  957,  958,  959,  960,  961,  962,  963,  964,
+ /*   210 */   965,  966,  967,  968,  969,  970,  971,  972,  973,  974,
+ /*   220 */   975,  976,  977,  978,  979,  980,  981,  982,  983,  984,
+ /*   230 */   985,  986,  987, 1372, 1372,  989, 1372, 1372,  909, 1372,
+ /*   240 */   988, 1372, 1372,  993, 1372, 1372,  909, 1372,  992, 1372,
+ /*   250 */   909, 1372, 1002, 1372,  909, 1372, 1003, 1039,  909, 1372,
+ /*   260 */  1004, 1372, 1372, 1372, 1372,  909, 1372, 1005, 1372,  909,
+ /*   270 */  1372, 1372, 1372, 1372, 1372, 1006, 1372,  909, 1372, 1372,
+ /*   280 */  1372, 1372, 1372, 1372,  909, 1372, 1007, 1032, 1033, 1035,
+ /*   290 */  1372, 1372, 1372, 1372,  909, 1034, 1372, 1372, 1372, 1372,
+ /*   300 */   909, 1372, 1036, 1372, 1040, 1372, 1372, 1372, 1041, 1047,
+ /*   310 */  1348, 1372, 1372, 1372, 1042, 1372, 1372, 1372, 1043, 1372,
+ /*   320 */  1372, 1372, 1044, 1372, 1372, 1372, 1045, 1351, 1372, 1372,
+ /*   330 */  1046, 1372, 1372, 1372, 1048, 1346, 1372, 1049, 1051, 1053,
+ /*   340 */  1055, 1372, 1095, 1372, 1096, 1372, 1097, 1372, 1098, 1372,
+ /*   350 */  1099, 1372, 1100, 1372, 1101, 1372, 1102, 1372, 1103, 1372,
+ /*   360 */  1104, 1372, 1105, 1372, 1106, 1372, 1107, 1372, 1108, 1372,
+ /*   370 */  1109, 1372, 1110, 1347, 1372, 1050, 1052, 1054, 1056, 1372,
+ /*   380 */  1111, 1372, 1112, 1372, 1113, 1372, 1114, 1372, 1115, 1372,
+ /*   390 */  1116, 1372, 1117, 1372, 1118, 1372, 1119, 1372, 1120, 1372,
+ /*   400 */  1121, 1372, 1122, 1372, 1123, 1372, 1124, 1372, 1125, 1372,
+ /*   410 */  1126, 1328, 1372, 1057, 1372, 1063, 1372, 1064, 1372, 1065,
+ /*   420 */  1372, 1066, 1372, 1067, 1372, 1068, 1372, 1069, 1372, 1070,
+ /*   430 */  1372, 1071, 1372, 1072, 1372, 1073, 1372, 1074, 1372, 1075,
+ /*   440 */  1372, 1076, 1372, 1077, 1372, 1078, 1372, 1372, 1372, 1332,
+ /*   450 */  1372, 1058, 1333, 1372, 1059, 1060, 1372, 1079, 1372, 1080,
+ /*   460 */  1372, 1081, 1372, 1082, 1372, 1083, 1372, 1084, 1372, 1085,
+ /*   470 */  1372, 1086, 1372, 1087, 1372, 1088, 1372, 1089, 1372, 1090,
+ /*   480 */  1372, 1091, 1372, 1092, 1372, 1093, 1372, 1094, 1372, 1372,
+ /*   490 */  1061, 1354, 1372, 1062, 1372, 1127, 1372, 1128, 1372, 1129,
+ /*   500 */  1372, 1130, 1372, 1131, 1372, 1132, 1372, 1133, 1372, 1134,
+ /*   510 */  1372, 1135, 1372, 1136, 1372, 1137, 1372, 1138, 1372, 1139,
+ /*   520 */  1372, 1140, 1372, 1141, 1372, 1142, 1146, 1143, 1144, 1145,
+ /*   530 */  1372, 1153, 1154, 1147, 1148, 1149, 1150, 1151, 1152, 1372,
+ /*   540 */  1372, 1372, 1372, 1155, 1281, 1282, 1283, 1372, 1372, 1372,
+ /*   550 */  1156, 1372, 1372, 1372, 1157, 1159, 1158, 1372, 1161, 1160,
+ /*   560 */  1372, 1372, 1159, 1162, 1372, 1372, 1159, 1163, 1372, 1372,
+ /*   570 */  1159, 1164, 1372, 1165, 1372, 1167, 1372, 1190, 1189, 1166,
+ /*   580 */  1372, 1168, 1169, 1372, 1170, 1372, 1372, 1372, 1171, 1372,
+ /*   590 */  1172, 1173, 1372, 1174, 1175, 1372, 1176, 1372, 1372, 1219,
+ /*   600 */  1372, 1220, 1372, 1228, 1227, 1372, 1226, 1225, 1372, 1372,
+ /*   610 */  1372, 1177, 1372, 1178, 1179, 1372, 1180, 1181, 1372, 1182,
+ /*   620 */  1372, 1372, 1221, 1372, 1222, 1372, 1372, 1372, 1183, 1372,
+ /*   630 */  1184, 1185, 1372, 1186, 1187, 1372, 1188, 1372, 1372, 1223,
+ /*   640 */  1372, 1224, 1372, 1372, 1217, 1372, 1218, 1372, 1191, 1372,
+ /*   650 */  1193, 1372, 1216, 1215, 1192, 1372, 1194, 1195, 1372, 1196,
+ /*   660 */  1372, 1372, 1372, 1197, 1372, 1198, 1199, 1372, 1200, 1201,
+ /*   670 */  1372, 1202, 1372, 1372, 1231, 1372, 1232, 1372, 1240, 1239,
+ /*   680 */  1372, 1238, 1237, 1372, 1372, 1372, 1203, 1372, 1204, 1205,
+ /*   690 */  1372, 1206, 1207, 1372, 1208, 1372, 1372, 1233, 1372, 1234,
+ /*   700 */  1372, 1372, 1372, 1209, 1372, 1210, 1211, 1372, 1212, 1213,
+ /*   710 */  1372, 1214, 1372, 1372, 1235, 1372, 1236, 1372, 1372, 1229,
+ /*   720 */  1372, 1230, 1241, 1372, 1243, 1248, 1253, 1258, 1372, 1244,
+ /*   730 */  1249, 1254, 1259, 1372, 1245, 1250, 1255, 1260, 1246, 1251,
+ /*   740 */  1256, 1242, 1247, 1252, 1257, 1266, 1261, 1372, 1268, 1372,
+ /*   750 */  1263, 1372, 1269, 1372, 1264, 1372, 1270, 1372, 1265, 1267,
+ /*   760 */  1262, 1276, 1271, 1372, 1278, 1372, 1273, 1372, 1279, 1372,
+ /*   770 */  1274, 1372, 1280, 1372, 1275, 1277, 1272, 1372, 1037, 1372,
+ /*   780 */   909, 1372, 1038, 1372, 1372,  909, 1372, 1008, 1372, 1372,
+ /*   790 */   909, 1372, 1011, 1372, 1372,  909, 1372, 1022, 1372, 1372,
+ /*   800 */  1340, 1339, 1013, 1372, 1014, 1372, 1015, 1372, 1016, 1372,
+ /*   810 */  1017, 1372, 1018, 1372, 1372, 1372,  909, 1372, 1010, 1372,
+ /*   820 */  1372,  909, 1372, 1021, 1372, 1372,  909, 1372, 1024, 1372,
+ /*   830 */  1372, 1372, 1372, 1372, 1372, 1372, 1372,  909, 1372, 1009,
+ /*   840 */  1372, 1372,  909, 1372, 1012, 1372, 1372,  909, 1372, 1023,
+ /*   850 */  1372, 1020, 1348, 1372, 1372, 1351, 1019, 1372, 1014, 1372,
+ /*   860 */  1015, 1372, 1016, 1351, 1017, 1372, 1018, 1372,  909, 1372,
+ /*   870 */   909, 1372, 1372,  909, 1372, 1025,  909, 1031, 1039, 1030,
+ /*   880 */   909, 1029, 1028,  909, 1027, 1026, 1372,  995,  996, 1372,
+ /*   890 */   997, 1372,  998, 1372,  999, 1372, 1000, 1372, 1001,  994,
+ /*   900 */  1372,  991,  990,  907,
+};
+#define YY_SZ_ACTTAB (sizeof(yy_action)/sizeof(yy_action[0]))
+
+/* The next table maps tokens into fallback tokens.  If a construct
+** like the following:
+**
+**      %fallback ID X Y Z.
+**
+** appears in the grammar, then ID becomes a fallback token for X, Y,
+** and Z.  Whenever one of the tokens X, Y, or Z is input to the parser
+** but it does not parse, the type of the token is changed to ID and
+** the parse is retried before an error is thrown.
+*/
+#ifdef YYFALLBACK
+static const YYCODETYPE yyFallback[] = {
+};
+#endif /* YYFALLBACK */
+
+/* The following structure represents a single element of the
+** parser's stack.  Information stored includes:
+**
+**   +  The state number for the parser at this level of the stack.
+**
+**   +  The value of the token stored at this level of the stack.
+**      (In other words, the "major" token.)
+**
+**   +  The semantic value stored at this level of the stack.  This is
+**      the information used by the action routines in the grammar.
+**      It is sometimes called the "minor" token.
+*/
+struct yyStackEntry {
+	int stateno;       /* The state-number */
+	int major;         /* The major token value.  This is the code
+										 ** number for the token at this stack level */
+	YYMINORTYPE minor; /* The user-supplied minor token value.  This
+										 ** is the value of the token  */
+};
+typedef struct yyStackEntry yyStackEntry;
+
+/* The state of the parser is completely contained in an instance of
+** the following structure. */
+struct _lemon_parser_t {
+	int yyidx;                    /* Index of top element in stack */
+	int yyerrcnt;                 /* Shifts left before out of the error */
+	ParseARG_SDECL                /* A place to hold %extra_argument */
+	yyStackEntry yystack[YYSTACKDEPTH];  /* The parser's stack */
+};
+typedef struct _lemon_parser_t lemon_parser_t;
+
+#ifndef NDEBUG
+#include <stdio.h>
+static FILE *yyTraceFILE   = 0;
+static char *yyTracePrompt = 0;
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/*
+** Turn parser tracing on by giving a stream to which to write the trace
+** and a prompt to preface each trace message.  Tracing is turned off
+** by making either argument NULL
+**
+** Inputs:
+** <ul>
+** <li> A FILE* to which trace output should be written.
+**      If NULL, then tracing is turned off.
+** <li> A prefix string written at the beginning of every
+**      line of trace output.  If NULL, then tracing is
+**      turned off.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+void mlr_dsl_ParseTrace(FILE *TraceFILE, char *zTracePrompt) {
+	yyTraceFILE = TraceFILE;
+	yyTracePrompt = zTracePrompt;
+	if (yyTraceFILE==0)
+		yyTracePrompt = 0;
+	else if (yyTracePrompt==0)
+		yyTraceFILE = 0;
+}
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* For tracing shifts, the names of all terminals and nonterminals
+** are required.  The following table supplies these names */
+static const char *yyTokenName[] = {
+  "$",             "MD_TOKEN_SEMICOLON",  "MD_TOKEN_RETURN",  "MD_TOKEN_SUBR_CALL",
+  "MD_TOKEN_BREAK",  "MD_TOKEN_CONTINUE",  "MD_TOKEN_FUNC_DEF",  "MD_TOKEN_NON_SIGIL_NAME",
+  "MD_TOKEN_LPAREN",  "MD_TOKEN_RPAREN",  "MD_TOKEN_LBRACE",  "MD_TOKEN_RBRACE",
+  "MD_TOKEN_COMMA",  "MD_TOKEN_SUBR_DEF",  "MD_TOKEN_NUMERIC",  "MD_TOKEN_INT",
+  "MD_TOKEN_FLOAT",  "MD_TOKEN_STRING",  "MD_TOKEN_BOOLEAN",  "MD_TOKEN_BEGIN",
+  "MD_TOKEN_END",  "MD_TOKEN_WHILE",  "MD_TOKEN_DO",   "MD_TOKEN_FOR",
+  "MD_TOKEN_IN",   "MD_TOKEN_FULL_SREC",  "MD_TOKEN_FULL_OOSVAR",  "MD_TOKEN_IF", 
+  "MD_TOKEN_ELIF",  "MD_TOKEN_ELSE",  "MD_TOKEN_FILTER",  "MD_TOKEN_VAR",
+  "MD_TOKEN_ASSIGN",  "MD_TOKEN_MAP",  "MD_TOKEN_DOLLAR_SIGN",  "MD_TOKEN_LEFT_BRACKET",
+  "MD_TOKEN_RIGHT_BRACKET",  "MD_TOKEN_LOGICAL_OR_EQUALS",  "MD_TOKEN_LOGICAL_XOR_EQUALS",  "MD_TOKEN_LOGICAL_AND_EQUALS",
+  "MD_TOKEN_BITWISE_OR_EQUALS",  "MD_TOKEN_BITWISE_XOR_EQUALS",  "MD_TOKEN_BITWISE_AND_EQUALS",  "MD_TOKEN_BITWISE_LSH_EQUALS",
+  "MD_TOKEN_BITWISE_RSH_EQUALS",  "MD_TOKEN_PLUS_EQUALS",  "MD_TOKEN_MINUS_EQUALS",  "MD_TOKEN_DOT_EQUALS",
+  "MD_TOKEN_TIMES_EQUALS",  "MD_TOKEN_DIVIDE_EQUALS",  "MD_TOKEN_INT_DIVIDE_EQUALS",  "MD_TOKEN_MOD_EQUALS",
+  "MD_TOKEN_POW_EQUALS",  "MD_TOKEN_UNSET",  "MD_TOKEN_ALL",  "MD_TOKEN_TEE",
+  "MD_TOKEN_GT",   "MD_TOKEN_BITWISE_RSH",  "MD_TOKEN_BITWISE_OR",  "MD_TOKEN_EMITF",
+  "MD_TOKEN_EMITP",  "MD_TOKEN_EMIT",  "MD_TOKEN_DUMP",  "MD_TOKEN_EDUMP",
+  "MD_TOKEN_PRINT",  "MD_TOKEN_EPRINT",  "MD_TOKEN_PRINTN",  "MD_TOKEN_EPRINTN",
+  "MD_TOKEN_STDOUT",  "MD_TOKEN_STDERR",  "MD_TOKEN_QUESTION_MARK",  "MD_TOKEN_COLON",
+  "MD_TOKEN_LOGICAL_OR",  "MD_TOKEN_LOGICAL_XOR",  "MD_TOKEN_LOGICAL_AND",  "MD_TOKEN_MATCHES",
+  "MD_TOKEN_DOES_NOT_MATCH",  "MD_TOKEN_EQ",   "MD_TOKEN_NE",   "MD_TOKEN_GE", 
+  "MD_TOKEN_LT",   "MD_TOKEN_LE",   "MD_TOKEN_BITWISE_XOR",  "MD_TOKEN_BITWISE_AND",
+  "MD_TOKEN_BITWISE_LSH",  "MD_TOKEN_PLUS",  "MD_TOKEN_MINUS",  "MD_TOKEN_DOT",
+  "MD_TOKEN_TIMES",  "MD_TOKEN_DIVIDE",  "MD_TOKEN_INT_DIVIDE",  "MD_TOKEN_MOD",
+  "MD_TOKEN_LOGICAL_NOT",  "MD_TOKEN_BITWISE_NOT",  "MD_TOKEN_POW",  "MD_TOKEN_FIELD_NAME",
+  "MD_TOKEN_BRACED_FIELD_NAME",  "MD_TOKEN_UNBRACED_OOSVAR_NAME",  "MD_TOKEN_BRACED_OOSVAR_NAME",  "MD_TOKEN_AT_SIGN",
+  "MD_TOKEN_NUMBER",  "MD_TOKEN_TRUE",  "MD_TOKEN_FALSE",  "MD_TOKEN_REGEXI",
+  "MD_TOKEN_CONTEXT_VARIABLE",  "MD_TOKEN_ENV",  "error",         "md_body",     
+  "md_statement_block",  "md_statement_not_braced_end",  "md_statement_braced_end",  "md_untyped_local_definition",
+  "md_numeric_local_definition",  "md_int_local_definition",  "md_float_local_definition",  "md_boolean_local_definition",
+  "md_string_local_definition",  "md_map_local_definition",  "md_nonindexed_local_assignment",  "md_indexed_local_assignment",
+  "md_rhs",        "md_map_literal",  "md_func_block",  "md_subr_block",
+  "md_begin_block",  "md_end_block",  "md_cond_block",  "md_while_block",
+  "md_for_loop_full_srec",  "md_for_loop_full_oosvar",  "md_for_loop_full_oosvar_key_only",  "md_for_loop_oosvar",
+  "md_for_loop_oosvar_key_only",  "md_for_loop_local_map",  "md_for_loop_local_map_key_only",  "md_triple_for",
+  "md_if_chain",   "md_fcn_or_subr_call",  "md_srec_assignment",  "md_srec_indirect_assignment",
+  "md_oosvar_from_full_srec_assignment",  "md_full_srec_from_oosvar_assignment",  "md_env_assignment",  "md_do_while_block",
+  "md_bare_boolean",  "md_oosvar_assignment",  "md_filter",     "md_unset",    
+  "md_tee_write",  "md_tee_append",  "md_tee_pipe",   "md_emitf",    
+  "md_emitf_write",  "md_emitf_append",  "md_emitf_pipe",  "md_emitp",    
+  "md_emitp_write",  "md_emitp_append",  "md_emitp_pipe",  "md_emit",     
+  "md_emit_write",  "md_emit_append",  "md_emit_pipe",  "md_emitp_lashed",
+  "md_emitp_lashed_write",  "md_emitp_lashed_append",  "md_emitp_lashed_pipe",  "md_emit_lashed",
+  "md_emit_lashed_write",  "md_emit_lashed_append",  "md_emit_lashed_pipe",  "md_dump",     
+  "md_dump_write",  "md_dump_append",  "md_dump_pipe",  "md_edump",    
+  "md_print",      "md_eprint",     "md_print_write",  "md_print_append",
+  "md_print_pipe",  "md_printn",     "md_eprintn",    "md_printn_write",
+  "md_printn_append",  "md_printn_pipe",  "md_func_args",  "md_func_or_subr_arg",
+  "md_subr_args",  "md_for_loop_index",  "md_for_map_keylist",  "md_oosvar_keylist",
+  "md_local_map_keylist",  "md_triple_for_start",  "md_triple_for_continuation",  "md_triple_for_update",
+  "md_if_elif_star",  "md_else_block",  "md_if_block",   "md_elif_block",
+  "md_nonindexed_local_variable",  "md_indexed_local_variable",  "md_field_name",  "md_env_index",
+  "md_unset_args",  "md_indirect_field_name",  "md_output_file",  "md_emitf_args",
+  "md_emitp_namelist",  "md_emit_namelist",  "md_emitp_lashed_keylists",  "md_emitp_lashed_namelist",
+  "md_emit_lashed_keylists",  "md_emit_lashed_namelist",  "md_ternary",    "md_logical_or_term",
+  "md_logical_xor_term",  "md_logical_and_term",  "md_eqne_term",  "md_cmp_term", 
+  "md_bitwise_or_term",  "md_bitwise_xor_term",  "md_bitwise_and_term",  "md_bitwise_shift_term",
+  "md_addsubdot_term",  "md_muldiv_term",  "md_unary_bitwise_op_term",  "md_pow_term", 
+  "md_atom_or_fcn",  "md_oosvar_basename",  "md_string",     "md_regexi",   
+  "md_fcn_args",   "md_map_literal_elements",  "md_map_literal_element",  "md_map_literal_key",
+  "md_map_literal_value",
+};
+#endif /* NDEBUG */
+
+#ifndef NDEBUG
+/* For tracing reduce actions, the names of all rules are required.
+*/
+static const char *yyRuleName[] = {
+ /*   0 */ "md_body ::= md_statement_block",
+ /*   1 */ "md_statement_block ::= md_statement_not_braced_end",
+ /*   2 */ "md_statement_block ::= md_statement_braced_end",
+ /*   3 */ "md_statement_block ::= md_statement_not_braced_end MD_TOKEN_SEMICOLON md_statement_block",
+ /*   4 */ "md_statement_block ::= md_statement_braced_end md_statement_block",
+ /*   5 */ "md_statement_not_braced_end ::=",
+ /*   6 */ "md_statement_not_braced_end ::= md_untyped_local_definition",
+ /*   7 */ "md_statement_not_braced_end ::= md_numeric_local_definition",
+ /*   8 */ "md_statement_not_braced_end ::= md_int_local_definition",
+ /*   9 */ "md_statement_not_braced_end ::= md_float_local_definition",
+ /*  10 */ "md_statement_not_braced_end ::= md_boolean_local_definition",
+ /*  11 */ "md_statement_not_braced_end ::= md_string_local_definition",
+ /*  12 */ "md_statement_not_braced_end ::= md_map_local_definition",
+ /*  13 */ "md_statement_not_braced_end ::= md_nonindexed_local_assignment",
+ /*  14 */ "md_statement_not_braced_end ::= md_indexed_local_assignment",
+ /*  15 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN md_rhs",
+ /*  16 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN md_map_literal",
+ /*  17 */ "md_statement_not_braced_end ::= MD_TOKEN_RETURN",
+ /*  18 */ "md_statement_braced_end ::= md_func_block",
+ /*  19 */ "md_statement_braced_end ::= md_subr_block",
+ /*  20 */ "md_statement_braced_end ::= md_begin_block",
+ /*  21 */ "md_statement_braced_end ::= md_end_block",
+ /*  22 */ "md_statement_braced_end ::= md_cond_block",
+ /*  23 */ "md_statement_braced_end ::= md_while_block",
+ /*  24 */ "md_statement_braced_end ::= md_for_loop_full_srec",
+ /*  25 */ "md_statement_braced_end ::= md_for_loop_full_oosvar",
+ /*  26 */ "md_statement_braced_end ::= md_for_loop_full_oosvar_key_only",
+ /*  27 */ "md_statement_braced_end ::= md_for_loop_oosvar",
+ /*  28 */ "md_statement_braced_end ::= md_for_loop_oosvar_key_only",
+ /*  29 */ "md_statement_braced_end ::= md_for_loop_local_map",
+ /*  30 */ "md_statement_braced_end ::= md_for_loop_local_map_key_only",
+ /*  31 */ "md_statement_braced_end ::= md_triple_for",
+ /*  32 */ "md_statement_braced_end ::= md_if_chain",
+ /*  33 */ "md_statement_not_braced_end ::= MD_TOKEN_SUBR_CALL md_fcn_or_subr_call",
+ /*  34 */ "md_statement_not_braced_end ::= md_srec_assignment",
+ /*  35 */ "md_statement_not_braced_end ::= md_srec_indirect_assignment",
+ /*  36 */ "md_statement_not_braced_end ::= md_oosvar_from_full_srec_assignment",
+ /*  37 */ "md_statement_not_braced_end ::= md_full_srec_from_oosvar_assignment",
+ /*  38 */ "md_statement_not_braced_end ::= md_env_assignment",
+ /*  39 */ "md_statement_not_braced_end ::= md_do_while_block",
+ /*  40 */ "md_statement_not_braced_end ::= md_bare_boolean",
+ /*  41 */ "md_statement_not_braced_end ::= md_oosvar_assignment",
+ /*  42 */ "md_statement_not_braced_end ::= md_filter",
+ /*  43 */ "md_statement_not_braced_end ::= md_unset",
+ /*  44 */ "md_statement_not_braced_end ::= md_tee_write",
+ /*  45 */ "md_statement_not_braced_end ::= md_tee_append",
+ /*  46 */ "md_statement_not_braced_end ::= md_tee_pipe",
+ /*  47 */ "md_statement_not_braced_end ::= md_emitf",
+ /*  48 */ "md_statement_not_braced_end ::= md_emitf_write",
+ /*  49 */ "md_statement_not_braced_end ::= md_emitf_append",
+ /*  50 */ "md_statement_not_braced_end ::= md_emitf_pipe",
+ /*  51 */ "md_statement_not_braced_end ::= md_emitp",
+ /*  52 */ "md_statement_not_braced_end ::= md_emitp_write",
+ /*  53 */ "md_statement_not_braced_end ::= md_emitp_append",
+ /*  54 */ "md_statement_not_braced_end ::= md_emitp_pipe",
+ /*  55 */ "md_statement_not_braced_end ::= md_emit",
+ /*  56 */ "md_statement_not_braced_end ::= md_emit_write",
+ /*  57 */ "md_statement_not_braced_end ::= md_emit_append",
+ /*  58 */ "md_statement_not_braced_end ::= md_emit_pipe",
+ /*  59 */ "md_statement_not_braced_end ::= md_emitp_lashed",
+ /*  60 */ "md_statement_not_braced_end ::= md_emitp_lashed_write",
+ /*  61 */ "md_statement_not_braced_end ::= md_emitp_lashed_append",
+ /*  62 */ "md_statement_not_braced_end ::= md_emitp_lashed_pipe",
+ /*  63 */ "md_statement_not_braced_end ::= md_emit_lashed",
+ /*  64 */ "md_statement_not_braced_end ::= md_emit_lashed_write",
+ /*  65 */ "md_statement_not_braced_end ::= md_emit_lashed_append",
+ /*  66 */ "md_statement_not_braced_end ::= md_emit_lashed_pipe",
+ /*  67 */ "md_statement_not_braced_end ::= md_dump",
+ /*  68 */ "md_statement_not_braced_end ::= md_dump_write",
+ /*  69 */ "md_statement_not_braced_end ::= md_dump_append",
+ /*  70 */ "md_statement_not_braced_end ::= md_dump_pipe",
+ /*  71 */ "md_statement_not_braced_end ::= md_edump",
+ /*  72 */ "md_statement_not_braced_end ::= md_print",
+ /*  73 */ "md_statement_not_braced_end ::= md_eprint",
+ /*  74 */ "md_statement_not_braced_end ::= md_print_write",
+ /*  75 */ "md_statement_not_braced_end ::= md_print_append",
+ /*  76 */ "md_statement_not_braced_end ::= md_print_pipe",
+ /*  77 */ "md_statement_not_braced_end ::= md_printn",
+ /*  78 */ "md_statement_not_braced_end ::= md_eprintn",
+ /*  79 */ "md_statement_not_braced_end ::= md_printn_write",
+ /*  80 */ "md_statement_not_braced_end ::= md_printn_append",
+ /*  81 */ "md_statement_not_braced_end ::= md_printn_pipe",
+ /*  82 */ "md_statement_not_braced_end ::= MD_TOKEN_BREAK",
+ /*  83 */ "md_statement_not_braced_end ::= MD_TOKEN_CONTINUE",
+ /*  84 */ "md_func_block ::= MD_TOKEN_FUNC_DEF MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_func_args MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /*  85 */ "md_func_args ::=",
+ /*  86 */ "md_func_args ::= md_func_or_subr_arg",
+ /*  87 */ "md_func_args ::= md_func_args MD_TOKEN_COMMA md_func_or_subr_arg",
+ /*  88 */ "md_subr_block ::= MD_TOKEN_SUBR_DEF MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_subr_args MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /*  89 */ "md_subr_args ::=",
+ /*  90 */ "md_subr_args ::= md_func_or_subr_arg",
+ /*  91 */ "md_subr_args ::= md_subr_args MD_TOKEN_COMMA md_func_or_subr_arg",
+ /*  92 */ "md_func_or_subr_arg ::= MD_TOKEN_NON_SIGIL_NAME",
+ /*  93 */ "md_func_or_subr_arg ::= MD_TOKEN_NUMERIC MD_TOKEN_NON_SIGIL_NAME",
+ /*  94 */ "md_func_or_subr_arg ::= MD_TOKEN_INT MD_TOKEN_NON_SIGIL_NAME",
+ /*  95 */ "md_func_or_subr_arg ::= MD_TOKEN_FLOAT MD_TOKEN_NON_SIGIL_NAME",
+ /*  96 */ "md_func_or_subr_arg ::= MD_TOKEN_STRING MD_TOKEN_NON_SIGIL_NAME",
+ /*  97 */ "md_func_or_subr_arg ::= MD_TOKEN_BOOLEAN MD_TOKEN_NON_SIGIL_NAME",
+ /*  98 */ "md_begin_block ::= MD_TOKEN_BEGIN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /*  99 */ "md_end_block ::= MD_TOKEN_END MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 100 */ "md_cond_block ::= md_rhs MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 101 */ "md_while_block ::= MD_TOKEN_WHILE MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 102 */ "md_do_while_block ::= MD_TOKEN_DO MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE MD_TOKEN_WHILE MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN",
+ /* 103 */ "md_for_loop_full_srec ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_SREC MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 104 */ "md_for_loop_full_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_OOSVAR MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 105 */ "md_for_loop_full_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_OOSVAR MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 106 */ "md_for_loop_full_oosvar_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN MD_TOKEN_FULL_OOSVAR MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 107 */ "md_for_loop_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_oosvar_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 108 */ "md_for_loop_oosvar ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_oosvar_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 109 */ "md_for_loop_index ::= MD_TOKEN_NON_SIGIL_NAME",
+ /* 110 */ "md_for_loop_index ::= MD_TOKEN_NUMERIC MD_TOKEN_NON_SIGIL_NAME",
+ /* 111 */ "md_for_loop_index ::= MD_TOKEN_INT MD_TOKEN_NON_SIGIL_NAME",
+ /* 112 */ "md_for_loop_index ::= MD_TOKEN_FLOAT MD_TOKEN_NON_SIGIL_NAME",
+ /* 113 */ "md_for_loop_index ::= MD_TOKEN_STRING MD_TOKEN_NON_SIGIL_NAME",
+ /* 114 */ "md_for_loop_index ::= MD_TOKEN_BOOLEAN MD_TOKEN_NON_SIGIL_NAME",
+ /* 115 */ "md_for_map_keylist ::= md_for_loop_index",
+ /* 116 */ "md_for_map_keylist ::= md_for_map_keylist MD_TOKEN_COMMA md_for_loop_index",
+ /* 117 */ "md_for_loop_oosvar_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN md_oosvar_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 118 */ "md_for_loop_local_map ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_local_map_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 119 */ "md_for_loop_local_map ::= MD_TOKEN_FOR MD_TOKEN_LPAREN MD_TOKEN_LPAREN md_for_map_keylist MD_TOKEN_RPAREN MD_TOKEN_COMMA md_for_loop_index MD_TOKEN_IN md_local_map_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 120 */ "md_for_loop_local_map_key_only ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_for_loop_index MD_TOKEN_IN md_local_map_keylist MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 121 */ "md_triple_for ::= MD_TOKEN_FOR MD_TOKEN_LPAREN md_triple_for_start MD_TOKEN_SEMICOLON md_triple_for_continuation MD_TOKEN_SEMICOLON md_triple_for_update MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 122 */ "md_triple_for_start ::= md_statement_not_braced_end",
+ /* 123 */ "md_triple_for_start ::= md_triple_for_start MD_TOKEN_COMMA md_statement_not_braced_end",
+ /* 124 */ "md_triple_for_continuation ::= md_statement_not_braced_end",
+ /* 125 */ "md_triple_for_continuation ::= md_triple_for_continuation MD_TOKEN_COMMA md_statement_not_braced_end",
+ /* 126 */ "md_triple_for_update ::= md_statement_not_braced_end",
+ /* 127 */ "md_triple_for_update ::= md_triple_for_update MD_TOKEN_COMMA md_statement_not_braced_end",
+ /* 128 */ "md_if_chain ::= md_if_elif_star",
+ /* 129 */ "md_if_chain ::= md_if_elif_star md_else_block",
+ /* 130 */ "md_if_elif_star ::= md_if_block",
+ /* 131 */ "md_if_elif_star ::= md_if_elif_star md_elif_block",
+ /* 132 */ "md_if_block ::= MD_TOKEN_IF MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 133 */ "md_elif_block ::= MD_TOKEN_ELIF MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 134 */ "md_else_block ::= MD_TOKEN_ELSE MD_TOKEN_LBRACE md_statement_block MD_TOKEN_RBRACE",
+ /* 135 */ "md_bare_boolean ::= md_rhs",
+ /* 136 */ "md_filter ::= MD_TOKEN_FILTER md_rhs",
+ /* 137 */ "md_untyped_local_definition ::= MD_TOKEN_VAR md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 138 */ "md_numeric_local_definition ::= MD_TOKEN_NUMERIC md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 139 */ "md_int_local_definition ::= MD_TOKEN_INT md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 140 */ "md_float_local_definition ::= MD_TOKEN_FLOAT md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 141 */ "md_boolean_local_definition ::= MD_TOKEN_BOOLEAN md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 142 */ "md_string_local_definition ::= MD_TOKEN_STRING md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 143 */ "md_untyped_local_definition ::= MD_TOKEN_VAR md_nonindexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 144 */ "md_map_local_definition ::= MD_TOKEN_MAP md_nonindexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 145 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 146 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN md_rhs",
+ /* 147 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 148 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN md_map_literal",
+ /* 149 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 150 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_OOSVAR",
+ /* 151 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 152 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 153 */ "md_srec_assignment ::= md_field_name MD_TOKEN_ASSIGN md_rhs",
+ /* 154 */ "md_srec_indirect_assignment ::= MD_TOKEN_DOLLAR_SIGN MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET MD_TOKEN_ASSIGN md_rhs",
+ /* 155 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_ASSIGN md_rhs",
+ /* 156 */ "md_oosvar_from_full_srec_assignment ::= md_oosvar_keylist MD_TOKEN_ASSIGN MD_TOKEN_FULL_SREC",
+ /* 157 */ "md_full_srec_from_oosvar_assignment ::= MD_TOKEN_FULL_SREC MD_TOKEN_ASSIGN md_oosvar_keylist",
+ /* 158 */ "md_env_assignment ::= md_env_index MD_TOKEN_ASSIGN md_rhs",
+ /* 159 */ "md_srec_assignment ::= md_field_name MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 160 */ "md_srec_assignment ::= md_field_name MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 161 */ "md_srec_assignment ::= md_field_name MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 162 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 163 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 164 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 165 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 166 */ "md_srec_assignment ::= md_field_name MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 167 */ "md_srec_assignment ::= md_field_name MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 168 */ "md_srec_assignment ::= md_field_name MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 169 */ "md_srec_assignment ::= md_field_name MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 170 */ "md_srec_assignment ::= md_field_name MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 171 */ "md_srec_assignment ::= md_field_name MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 172 */ "md_srec_assignment ::= md_field_name MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 173 */ "md_srec_assignment ::= md_field_name MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 174 */ "md_srec_assignment ::= md_field_name MD_TOKEN_POW_EQUALS md_rhs",
+ /* 175 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 176 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 177 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 178 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 179 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 180 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 181 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 182 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 183 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 184 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 185 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 186 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 187 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 188 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 189 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 190 */ "md_oosvar_assignment ::= md_oosvar_keylist MD_TOKEN_POW_EQUALS md_rhs",
+ /* 191 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 192 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 193 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 194 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 195 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 196 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 197 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 198 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 199 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 200 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 201 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 202 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 203 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 204 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 205 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 206 */ "md_nonindexed_local_assignment ::= md_nonindexed_local_variable MD_TOKEN_POW_EQUALS md_rhs",
+ /* 207 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 208 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 209 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 210 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 211 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 212 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 213 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 214 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 215 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 216 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 217 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 218 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 219 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 220 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 221 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 222 */ "md_indexed_local_assignment ::= md_indexed_local_variable MD_TOKEN_POW_EQUALS md_rhs",
+ /* 223 */ "md_env_assignment ::= md_env_index MD_TOKEN_LOGICAL_OR_EQUALS md_rhs",
+ /* 224 */ "md_env_assignment ::= md_env_index MD_TOKEN_LOGICAL_XOR_EQUALS md_rhs",
+ /* 225 */ "md_env_assignment ::= md_env_index MD_TOKEN_LOGICAL_AND_EQUALS md_rhs",
+ /* 226 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_OR_EQUALS md_rhs",
+ /* 227 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_XOR_EQUALS md_rhs",
+ /* 228 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_AND_EQUALS md_rhs",
+ /* 229 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_LSH_EQUALS md_rhs",
+ /* 230 */ "md_env_assignment ::= md_env_index MD_TOKEN_BITWISE_RSH_EQUALS md_rhs",
+ /* 231 */ "md_env_assignment ::= md_env_index MD_TOKEN_PLUS_EQUALS md_rhs",
+ /* 232 */ "md_env_assignment ::= md_env_index MD_TOKEN_MINUS_EQUALS md_rhs",
+ /* 233 */ "md_env_assignment ::= md_env_index MD_TOKEN_DOT_EQUALS md_rhs",
+ /* 234 */ "md_env_assignment ::= md_env_index MD_TOKEN_TIMES_EQUALS md_rhs",
+ /* 235 */ "md_env_assignment ::= md_env_index MD_TOKEN_DIVIDE_EQUALS md_rhs",
+ /* 236 */ "md_env_assignment ::= md_env_index MD_TOKEN_INT_DIVIDE_EQUALS md_rhs",
+ /* 237 */ "md_env_assignment ::= md_env_index MD_TOKEN_MOD_EQUALS md_rhs",
+ /* 238 */ "md_env_assignment ::= md_env_index MD_TOKEN_POW_EQUALS md_rhs",
+ /* 239 */ "md_unset ::= MD_TOKEN_UNSET MD_TOKEN_ALL",
+ /* 240 */ "md_unset ::= MD_TOKEN_UNSET MD_TOKEN_FULL_OOSVAR",
+ /* 241 */ "md_unset ::= MD_TOKEN_UNSET md_unset_args",
+ /* 242 */ "md_unset_args ::=",
+ /* 243 */ "md_unset_args ::= md_field_name",
+ /* 244 */ "md_unset_args ::= md_indirect_field_name",
+ /* 245 */ "md_unset_args ::= MD_TOKEN_FULL_SREC",
+ /* 246 */ "md_unset_args ::= md_oosvar_keylist",
+ /* 247 */ "md_unset_args ::= md_nonindexed_local_variable",
+ /* 248 */ "md_unset_args ::= md_indexed_local_variable",
+ /* 249 */ "md_unset_args ::= md_unset_args MD_TOKEN_COMMA md_field_name",
+ /* 250 */ "md_unset_args ::= md_unset_args MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 251 */ "md_tee_write ::= MD_TOKEN_TEE MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_SREC",
+ /* 252 */ "md_tee_append ::= MD_TOKEN_TEE MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_SREC",
+ /* 253 */ "md_tee_pipe ::= MD_TOKEN_TEE MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_FULL_SREC",
+ /* 254 */ "md_emitf ::= MD_TOKEN_EMITF md_emitf_args",
+ /* 255 */ "md_emitf_args ::=",
+ /* 256 */ "md_emitf_args ::= md_oosvar_keylist",
+ /* 257 */ "md_emitf_args ::= md_emitf_args MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 258 */ "md_emitf_write ::= MD_TOKEN_EMITF MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_emitf_args",
+ /* 259 */ "md_emitf_append ::= MD_TOKEN_EMITF MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_emitf_args",
+ /* 260 */ "md_emitf_pipe ::= MD_TOKEN_EMITF MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_emitf_args",
+ /* 261 */ "md_emitp ::= MD_TOKEN_EMITP MD_TOKEN_ALL",
+ /* 262 */ "md_emitp ::= MD_TOKEN_EMITP MD_TOKEN_FULL_OOSVAR",
+ /* 263 */ "md_emitp ::= MD_TOKEN_EMITP MD_TOKEN_ALL MD_TOKEN_COMMA md_emitp_namelist",
+ /* 264 */ "md_emitp ::= MD_TOKEN_EMITP MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emitp_namelist",
+ /* 265 */ "md_emitp ::= MD_TOKEN_EMITP md_oosvar_keylist",
+ /* 266 */ "md_emitp ::= MD_TOKEN_EMITP md_oosvar_keylist MD_TOKEN_COMMA md_emitp_namelist",
+ /* 267 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL",
+ /* 268 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL MD_TOKEN_COMMA md_emitp_namelist",
+ /* 269 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR",
+ /* 270 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emitp_namelist",
+ /* 271 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 272 */ "md_emitp_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_oosvar_keylist MD_TOKEN_COMMA md_emitp_namelist",
+ /* 273 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL",
+ /* 274 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL MD_TOKEN_COMMA md_emitp_namelist",
+ /* 275 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR",
+ /* 276 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emitp_namelist",
+ /* 277 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 278 */ "md_emitp_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_oosvar_keylist MD_TOKEN_COMMA md_emitp_namelist",
+ /* 279 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_ALL",
+ /* 280 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_ALL MD_TOKEN_COMMA md_emitp_namelist",
+ /* 281 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR",
+ /* 282 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emitp_namelist",
+ /* 283 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 284 */ "md_emitp_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_oosvar_keylist MD_TOKEN_COMMA md_emitp_namelist",
+ /* 285 */ "md_emitp_namelist ::= md_rhs",
+ /* 286 */ "md_emitp_namelist ::= md_emitp_namelist MD_TOKEN_COMMA md_rhs",
+ /* 287 */ "md_emit ::= MD_TOKEN_EMIT MD_TOKEN_ALL",
+ /* 288 */ "md_emit ::= MD_TOKEN_EMIT MD_TOKEN_FULL_OOSVAR",
+ /* 289 */ "md_emit ::= MD_TOKEN_EMIT MD_TOKEN_ALL MD_TOKEN_COMMA md_emit_namelist",
+ /* 290 */ "md_emit ::= MD_TOKEN_EMIT MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emit_namelist",
+ /* 291 */ "md_emit ::= MD_TOKEN_EMIT md_oosvar_keylist",
+ /* 292 */ "md_emit ::= MD_TOKEN_EMIT md_oosvar_keylist MD_TOKEN_COMMA md_emit_namelist",
+ /* 293 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL",
+ /* 294 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL MD_TOKEN_COMMA md_emit_namelist",
+ /* 295 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR",
+ /* 296 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emit_namelist",
+ /* 297 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 298 */ "md_emit_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_oosvar_keylist MD_TOKEN_COMMA md_emit_namelist",
+ /* 299 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL",
+ /* 300 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_ALL MD_TOKEN_COMMA md_emit_namelist",
+ /* 301 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR",
+ /* 302 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emit_namelist",
+ /* 303 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 304 */ "md_emit_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_oosvar_keylist MD_TOKEN_COMMA md_emit_namelist",
+ /* 305 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_ALL",
+ /* 306 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_ALL MD_TOKEN_COMMA md_emit_namelist",
+ /* 307 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR",
+ /* 308 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_FULL_OOSVAR MD_TOKEN_COMMA md_emit_namelist",
+ /* 309 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 310 */ "md_emit_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_oosvar_keylist MD_TOKEN_COMMA md_emit_namelist",
+ /* 311 */ "md_emit_namelist ::= md_rhs",
+ /* 312 */ "md_emit_namelist ::= md_emit_namelist MD_TOKEN_COMMA md_rhs",
+ /* 313 */ "md_emitp_lashed ::= MD_TOKEN_EMITP MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 314 */ "md_emitp_lashed ::= MD_TOKEN_EMITP MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 315 */ "md_emitp_lashed_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 316 */ "md_emitp_lashed_write ::= MD_TOKEN_EMITP MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 317 */ "md_emitp_lashed_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 318 */ "md_emitp_lashed_append ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 319 */ "md_emitp_lashed_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN",
+ /* 320 */ "md_emitp_lashed_pipe ::= MD_TOKEN_EMITP MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emitp_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emitp_lashed_namelist",
+ /* 321 */ "md_emitp_lashed_keylists ::= md_oosvar_keylist",
+ /* 322 */ "md_emitp_lashed_keylists ::= md_emitp_lashed_keylists MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 323 */ "md_emitp_lashed_namelist ::= md_rhs",
+ /* 324 */ "md_emitp_lashed_namelist ::= md_emitp_lashed_namelist MD_TOKEN_COMMA md_rhs",
+ /* 325 */ "md_emit_lashed ::= MD_TOKEN_EMIT MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 326 */ "md_emit_lashed ::= MD_TOKEN_EMIT MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 327 */ "md_emit_lashed_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 328 */ "md_emit_lashed_write ::= MD_TOKEN_EMIT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 329 */ "md_emit_lashed_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 330 */ "md_emit_lashed_append ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 331 */ "md_emit_lashed_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN",
+ /* 332 */ "md_emit_lashed_pipe ::= MD_TOKEN_EMIT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA MD_TOKEN_LPAREN md_emit_lashed_keylists MD_TOKEN_RPAREN MD_TOKEN_COMMA md_emit_lashed_namelist",
+ /* 333 */ "md_emit_lashed_keylists ::= md_oosvar_keylist",
+ /* 334 */ "md_emit_lashed_keylists ::= md_emit_lashed_keylists MD_TOKEN_COMMA md_oosvar_keylist",
+ /* 335 */ "md_emit_lashed_namelist ::= md_rhs",
+ /* 336 */ "md_emit_lashed_namelist ::= md_emit_lashed_namelist MD_TOKEN_COMMA md_rhs",
+ /* 337 */ "md_dump ::= MD_TOKEN_DUMP",
+ /* 338 */ "md_edump ::= MD_TOKEN_EDUMP",
+ /* 339 */ "md_dump_write ::= MD_TOKEN_DUMP MD_TOKEN_GT md_output_file",
+ /* 340 */ "md_dump_append ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_RSH md_output_file",
+ /* 341 */ "md_dump_pipe ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_OR md_rhs",
+ /* 342 */ "md_dump ::= MD_TOKEN_DUMP md_nonindexed_local_variable",
+ /* 343 */ "md_edump ::= MD_TOKEN_EDUMP md_nonindexed_local_variable",
+ /* 344 */ "md_dump_write ::= MD_TOKEN_DUMP MD_TOKEN_GT md_output_file md_nonindexed_local_variable",
+ /* 345 */ "md_dump_append ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_RSH md_output_file md_nonindexed_local_variable",
+ /* 346 */ "md_dump_pipe ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_OR md_rhs md_nonindexed_local_variable",
+ /* 347 */ "md_dump ::= MD_TOKEN_DUMP md_indexed_local_variable",
+ /* 348 */ "md_edump ::= MD_TOKEN_EDUMP md_indexed_local_variable",
+ /* 349 */ "md_dump_write ::= MD_TOKEN_DUMP MD_TOKEN_GT md_output_file md_indexed_local_variable",
+ /* 350 */ "md_dump_append ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_RSH md_output_file md_indexed_local_variable",
+ /* 351 */ "md_dump_pipe ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_OR md_rhs md_indexed_local_variable",
+ /* 352 */ "md_dump ::= MD_TOKEN_DUMP md_oosvar_keylist",
+ /* 353 */ "md_edump ::= MD_TOKEN_EDUMP md_oosvar_keylist",
+ /* 354 */ "md_dump_write ::= MD_TOKEN_DUMP MD_TOKEN_GT md_output_file md_oosvar_keylist",
+ /* 355 */ "md_dump_append ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_RSH md_output_file md_oosvar_keylist",
+ /* 356 */ "md_dump_pipe ::= MD_TOKEN_DUMP MD_TOKEN_BITWISE_OR md_rhs md_oosvar_keylist",
+ /* 357 */ "md_print ::= MD_TOKEN_PRINT md_rhs",
+ /* 358 */ "md_eprint ::= MD_TOKEN_EPRINT md_rhs",
+ /* 359 */ "md_print_write ::= MD_TOKEN_PRINT MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_rhs",
+ /* 360 */ "md_print_append ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_rhs",
+ /* 361 */ "md_print_pipe ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_rhs",
+ /* 362 */ "md_print ::= MD_TOKEN_PRINT",
+ /* 363 */ "md_eprint ::= MD_TOKEN_EPRINT",
+ /* 364 */ "md_print_write ::= MD_TOKEN_PRINT MD_TOKEN_GT md_output_file",
+ /* 365 */ "md_print_append ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_RSH md_output_file",
+ /* 366 */ "md_print_pipe ::= MD_TOKEN_PRINT MD_TOKEN_BITWISE_OR md_rhs",
+ /* 367 */ "md_printn ::= MD_TOKEN_PRINTN md_rhs",
+ /* 368 */ "md_eprintn ::= MD_TOKEN_EPRINTN md_rhs",
+ /* 369 */ "md_printn_write ::= MD_TOKEN_PRINTN MD_TOKEN_GT md_output_file MD_TOKEN_COMMA md_rhs",
+ /* 370 */ "md_printn_append ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_RSH md_output_file MD_TOKEN_COMMA md_rhs",
+ /* 371 */ "md_printn_pipe ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_OR md_rhs MD_TOKEN_COMMA md_rhs",
+ /* 372 */ "md_printn ::= MD_TOKEN_PRINTN",
+ /* 373 */ "md_eprintn ::= MD_TOKEN_EPRINTN",
+ /* 374 */ "md_printn_write ::= MD_TOKEN_PRINTN MD_TOKEN_GT md_output_file",
+ /* 375 */ "md_printn_append ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_RSH md_output_file",
+ /* 376 */ "md_printn_pipe ::= MD_TOKEN_PRINTN MD_TOKEN_BITWISE_OR md_rhs",
+ /* 377 */ "md_output_file ::= md_rhs",
+ /* 378 */ "md_output_file ::= MD_TOKEN_STDOUT",
+ /* 379 */ "md_output_file ::= MD_TOKEN_STDERR",
+ /* 380 */ "md_rhs ::= md_ternary",
+ /* 381 */ "md_ternary ::= md_logical_or_term MD_TOKEN_QUESTION_MARK md_ternary MD_TOKEN_COLON md_ternary",
+ /* 382 */ "md_ternary ::= md_logical_or_term",
+ /* 383 */ "md_logical_or_term ::= md_logical_xor_term",
+ /* 384 */ "md_logical_or_term ::= md_logical_or_term MD_TOKEN_LOGICAL_OR md_logical_xor_term",
+ /* 385 */ "md_logical_xor_term ::= md_logical_and_term",
+ /* 386 */ "md_logical_xor_term ::= md_logical_xor_term MD_TOKEN_LOGICAL_XOR md_logical_and_term",
+ /* 387 */ "md_logical_and_term ::= md_eqne_term",
+ /* 388 */ "md_logical_and_term ::= md_logical_and_term MD_TOKEN_LOGICAL_AND md_eqne_term",
+ /* 389 */ "md_eqne_term ::= md_cmp_term",
+ /* 390 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_MATCHES md_cmp_term",
+ /* 391 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_DOES_NOT_MATCH md_cmp_term",
+ /* 392 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_EQ md_cmp_term",
+ /* 393 */ "md_eqne_term ::= md_eqne_term MD_TOKEN_NE md_cmp_term",
+ /* 394 */ "md_cmp_term ::= md_bitwise_or_term",
+ /* 395 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_GT md_bitwise_or_term",
+ /* 396 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_GE md_bitwise_or_term",
+ /* 397 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_LT md_bitwise_or_term",
+ /* 398 */ "md_cmp_term ::= md_cmp_term MD_TOKEN_LE md_bitwise_or_term",
+ /* 399 */ "md_bitwise_or_term ::= md_bitwise_xor_term",
+ /* 400 */ "md_bitwise_or_term ::= md_bitwise_or_term MD_TOKEN_BITWISE_OR md_bitwise_xor_term",
+ /* 401 */ "md_bitwise_xor_term ::= md_bitwise_and_term",
+ /* 402 */ "md_bitwise_xor_term ::= md_bitwise_xor_term MD_TOKEN_BITWISE_XOR md_bitwise_and_term",
+ /* 403 */ "md_bitwise_and_term ::= md_bitwise_shift_term",
+ /* 404 */ "md_bitwise_and_term ::= md_bitwise_and_term MD_TOKEN_BITWISE_AND md_bitwise_shift_term",
+ /* 405 */ "md_bitwise_shift_term ::= md_addsubdot_term",
+ /* 406 */ "md_bitwise_shift_term ::= md_bitwise_shift_term MD_TOKEN_BITWISE_LSH md_addsubdot_term",
+ /* 407 */ "md_bitwise_shift_term ::= md_bitwise_shift_term MD_TOKEN_BITWISE_RSH md_addsubdot_term",
+ /* 408 */ "md_addsubdot_term ::= md_muldiv_term",
+ /* 409 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_PLUS md_muldiv_term",
+ /* 410 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_MINUS md_muldiv_term",
+ /* 411 */ "md_addsubdot_term ::= md_addsubdot_term MD_TOKEN_DOT md_muldiv_term",
+ /* 412 */ "md_muldiv_term ::= md_unary_bitwise_op_term",
+ /* 413 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_TIMES md_unary_bitwise_op_term",
+ /* 414 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_DIVIDE md_unary_bitwise_op_term",
+ /* 415 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_INT_DIVIDE md_unary_bitwise_op_term",
+ /* 416 */ "md_muldiv_term ::= md_muldiv_term MD_TOKEN_MOD md_unary_bitwise_op_term",
+ /* 417 */ "md_unary_bitwise_op_term ::= md_pow_term",
+ /* 418 */ "md_unary_bitwise_op_term ::= MD_TOKEN_PLUS md_unary_bitwise_op_term",
+ /* 419 */ "md_unary_bitwise_op_term ::= MD_TOKEN_MINUS md_unary_bitwise_op_term",
+ /* 420 */ "md_unary_bitwise_op_term ::= MD_TOKEN_LOGICAL_NOT md_unary_bitwise_op_term",
+ /* 421 */ "md_unary_bitwise_op_term ::= MD_TOKEN_BITWISE_NOT md_unary_bitwise_op_term",
+ /* 422 */ "md_pow_term ::= md_atom_or_fcn",
+ /* 423 */ "md_pow_term ::= md_atom_or_fcn MD_TOKEN_POW md_pow_term",
+ /* 424 */ "md_atom_or_fcn ::= md_field_name",
+ /* 425 */ "md_field_name ::= MD_TOKEN_FIELD_NAME",
+ /* 426 */ "md_field_name ::= MD_TOKEN_BRACED_FIELD_NAME",
+ /* 427 */ "md_atom_or_fcn ::= md_indirect_field_name",
+ /* 428 */ "md_indirect_field_name ::= MD_TOKEN_DOLLAR_SIGN MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 429 */ "md_atom_or_fcn ::= md_oosvar_keylist",
+ /* 430 */ "md_oosvar_keylist ::= md_oosvar_basename",
+ /* 431 */ "md_oosvar_keylist ::= md_oosvar_keylist MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 432 */ "md_oosvar_basename ::= MD_TOKEN_UNBRACED_OOSVAR_NAME",
+ /* 433 */ "md_oosvar_basename ::= MD_TOKEN_BRACED_OOSVAR_NAME",
+ /* 434 */ "md_oosvar_basename ::= MD_TOKEN_AT_SIGN MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 435 */ "md_local_map_keylist ::= md_nonindexed_local_variable",
+ /* 436 */ "md_local_map_keylist ::= md_local_map_keylist MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 437 */ "md_atom_or_fcn ::= MD_TOKEN_NUMBER",
+ /* 438 */ "md_atom_or_fcn ::= MD_TOKEN_TRUE",
+ /* 439 */ "md_atom_or_fcn ::= MD_TOKEN_FALSE",
+ /* 440 */ "md_atom_or_fcn ::= md_string",
+ /* 441 */ "md_atom_or_fcn ::= md_regexi",
+ /* 442 */ "md_atom_or_fcn ::= md_nonindexed_local_variable",
+ /* 443 */ "md_atom_or_fcn ::= md_indexed_local_variable",
+ /* 444 */ "md_nonindexed_local_variable ::= MD_TOKEN_NON_SIGIL_NAME",
+ /* 445 */ "md_indexed_local_variable ::= md_nonindexed_local_variable MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 446 */ "md_indexed_local_variable ::= md_indexed_local_variable MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 447 */ "md_string ::= MD_TOKEN_STRING",
+ /* 448 */ "md_regexi ::= MD_TOKEN_REGEXI",
+ /* 449 */ "md_atom_or_fcn ::= MD_TOKEN_CONTEXT_VARIABLE",
+ /* 450 */ "md_atom_or_fcn ::= md_env_index",
+ /* 451 */ "md_env_index ::= MD_TOKEN_ENV MD_TOKEN_LEFT_BRACKET md_rhs MD_TOKEN_RIGHT_BRACKET",
+ /* 452 */ "md_atom_or_fcn ::= MD_TOKEN_LPAREN md_rhs MD_TOKEN_RPAREN",
+ /* 453 */ "md_atom_or_fcn ::= md_fcn_or_subr_call",
+ /* 454 */ "md_fcn_or_subr_call ::= MD_TOKEN_NON_SIGIL_NAME MD_TOKEN_LPAREN md_fcn_args MD_TOKEN_RPAREN",
+ /* 455 */ "md_fcn_or_subr_call ::= MD_TOKEN_INT MD_TOKEN_LPAREN md_fcn_args MD_TOKEN_RPAREN",
+ /* 456 */ "md_fcn_or_subr_call ::= MD_TOKEN_FLOAT MD_TOKEN_LPAREN md_fcn_args MD_TOKEN_RPAREN",
+ /* 457 */ "md_fcn_args ::=",
+ /* 458 */ "md_fcn_args ::= md_rhs",
+ /* 459 */ "md_fcn_args ::= md_fcn_args MD_TOKEN_COMMA md_rhs",
+ /* 460 */ "md_map_literal ::= MD_TOKEN_LBRACE MD_TOKEN_RBRACE",
+ /* 461 */ "md_map_literal ::= MD_TOKEN_LBRACE md_map_literal_elements MD_TOKEN_RBRACE",
+ /* 462 */ "md_map_literal_elements ::= md_map_literal_element",
+ /* 463 */ "md_map_literal_elements ::= md_map_literal_elements MD_TOKEN_COMMA md_map_literal_element",
+ /* 464 */ "md_map_literal_element ::= md_map_literal_key MD_TOKEN_COLON md_map_literal_value",
+ /* 465 */ "md_map_literal_key ::= md_rhs",
+ /* 466 */ "md_map_literal_value ::= md_rhs",
+ /* 467 */ "md_map_literal_value ::= md_map_literal",
+};
+#endif /* NDEBUG */
+
+/*
+** This function returns the symbolic name associated with a token
+** value.
+*/
+const char *mlr_dsl_ParseTokenName(int tokenType) {
+#ifndef NDEBUG
+	if (tokenType>0 && tokenType<(sizeof(yyTokenName)/sizeof(yyTokenName[0]))) {
+		return yyTokenName[tokenType];
+	} else {
+		return "Unknown";
+	}
+#else
+	return "";
+#endif
+}
+
+/*
+** This function allocates a new parser.
+** The only argument is a pointer to a function which works like
+** malloc.
+**
+** Inputs:
+** A pointer to the function used to allocate memory.
+**
+** Outputs:
+** A pointer to a parser.  This pointer is used in subsequent calls
+** to Parse and mlr_dsl_lemon_parser_free.
+*/
+void *mlr_dsl_lemon_parser_alloc(void *(*mallocProc)(size_t)){
+	lemon_parser_t *pParser;
+	pParser = (lemon_parser_t*)(*mallocProc) ((size_t)sizeof(lemon_parser_t)) ;
+	if (pParser) {
+		pParser->yyidx = -1;
+	}
+	return pParser;
+}
+
+/* The following function deletes the value associated with a
+** symbol.  The symbol can be either a terminal or nonterminal.
+** "yymajor" is the symbol code, and "yypminor" is a pointer to
+** the value.
+*/
+void mlr_dsl_yy_destructor(YYCODETYPE yymajor, YYMINORTYPE *yypminor){
+	switch (yymajor) {
+		/* Here is inserted the actions which take place when a
+		** terminal or non-terminal is destroyed.  This can happen
+		** when the symbol is popped from the stack during a
+		** reduce or during error processing or when a parser is
+		** being destroyed before it is finished parsing.
+		**
+		** Note: during a reduce, the only symbols destroyed are those
+		** which appear on the RHS of the rule, but which are not used
+		** inside the C code.
+		*/
+		default:  break;   /* If no destructor action specified: do nothing */
+	}
+}
+
+/*
+** Pop the parser's stack once.
+**
+** If there is a destructor routine associated with the token which
+** is popped from the stack, then call it.
+**
+** Return the major token number for the symbol popped.
+*/
+static int yy_pop_parser_stack(lemon_parser_t *pParser){
+	YYCODETYPE yymajor;
+	yyStackEntry *yytos = &pParser->yystack[pParser->yyidx];
+
+	if (pParser->yyidx<0)  return 0;
+#ifndef NDEBUG
+	if (yyTraceFILE && pParser->yyidx>=0) {
+		fprintf(yyTraceFILE,"%sPopping %s\n", yyTracePrompt, yyTokenName[yytos->major]);
+	}
+#endif
+	yymajor = yytos->major;
+	mlr_dsl_yy_destructor (yymajor, &yytos->minor);
+	pParser->yyidx--;
+	return yymajor;
+}
+
+/*
+** Deallocate and destroy a parser.  Destructors are all called for
+** all stack elements before shutting the parser down.
+**
+** Inputs:
+** <ul>
+** <li>  A pointer to the parser.  This should be a pointer
+**       obtained from mlr_dsl_lemon_parser_alloc.
+** <li>  A pointer to a function used to reclaim memory obtained
+**       from malloc.
+** </ul>
+*/
+void mlr_dsl_lemon_parser_free(
+	void *pvparser,             /* The parser to be deleted */
+	void (*freeProc)(void*))    /* Function used to reclaim memory */
+{
+	lemon_parser_t *pparser = (lemon_parser_t*)pvparser;
+	if (pparser==0)  return;
+	while (pparser->yyidx>=0)  yy_pop_parser_stack(pparser);
+	(*freeProc)((void*)pparser);
+}
+
+/*
+** Find the appropriate action for a parser given the terminal
+** look-ahead token iLookAhead.
+**
+** If the look-ahead token is YYNOCODE, then check to see if the action is
+** independent of the look-ahead.  If it is, return the action, otherwise
+** return YY_NO_ACTION.
+*/
+static int yy_find_shift_action(
+	lemon_parser_t *pparser,        /* The parser */
+	int iLookAhead)           /* The look-ahead token */
+{
+	int i;
+	int stateno = pparser->yystack[pparser->yyidx].stateno;
+
+	/* if (pparser->yyidx<0)  return YY_NO_ACTION;  */
+	i = yy_shift_ofst[stateno];
+	if (i==YY_SHIFT_USE_DFLT) {
+		return yy_default[stateno];
+	}
+	if (iLookAhead==YYNOCODE) {
+		return YY_NO_ACTION;
+	}
+	i += iLookAhead;
+	if (i<0 || i>=YY_SZ_ACTTAB || yy_lookahead[i]!=iLookAhead) {
+#ifdef YYFALLBACK
+		int iFallback;            /* Fallback token */
+		if (iLookAhead<sizeof(yyFallback)/sizeof(yyFallback[0])
+					 && (iFallback = yyFallback[iLookAhead])!=0) {
+#ifndef NDEBUG
+			if (yyTraceFILE) {
+				fprintf(yyTraceFILE, "%sFALLBACK %s => %s\n",
+					 yyTracePrompt, yyTokenName[iLookAhead], yyTokenName[iFallback]);
+			}
+#endif
+			return yy_find_shift_action(pparser, iFallback);
+		}
+#endif
+		return yy_default[stateno];
+	} else {
+		return yy_action[i];
+	}
+}
+
+/*
+** Find the appropriate action for a parser given the non-terminal
+** look-ahead token iLookAhead.
+**
+** If the look-ahead token is YYNOCODE, then check to see if the action is
+** independent of the look-ahead.  If it is, return the action, otherwise
+** return YY_NO_ACTION.
+*/
+static int yy_find_reduce_action(
+	lemon_parser_t *pparser,        /* The parser */
+	int iLookAhead)           /* The look-ahead token */
+{
+	int i;
+	int stateno = pparser->yystack[pparser->yyidx].stateno;
+
+	i = yy_reduce_ofst[stateno];
+	if (i==YY_REDUCE_USE_DFLT) {
+		return yy_default[stateno];
+	}
+	if (iLookAhead==YYNOCODE) {
+		return YY_NO_ACTION;
+	}
+	i += iLookAhead;
+	if (i<0 || i>=YY_SZ_ACTTAB || yy_lookahead[i]!=iLookAhead) {
+		return yy_default[stateno];
+	} else {
+		return yy_action[i];
+	}
+}
+
+/*
+** Perform a shift action.
+*/
+static void yy_shift(
+	lemon_parser_t *pparser,          /* The parser to be shifted */
+	int yyNewState,               /* The new state to shift in */
+	int yyMajor,                  /* The major token to shift in */
+	YYMINORTYPE *yypMinor)        /* Pointer ot the minor token to shift in */
+{
+	yyStackEntry *yytos;
+	pparser->yyidx++;
+	if (pparser->yyidx>=YYSTACKDEPTH) {
+		 ParseARG_FETCH;
+		 pparser->yyidx--;
+#ifndef NDEBUG
+		 if (yyTraceFILE) {
+			 fprintf(yyTraceFILE,"%sStack Overflow!\n",yyTracePrompt);
+		 }
+#endif
+		 while (pparser->yyidx>=0)  yy_pop_parser_stack(pparser);
+		 /* Here code is inserted which will execute if the parser
+		 ** stack every overflows */
+		 ParseARG_STORE; /* Suppress warning about unused %extra_argument var */
+		 return;
+	}
+	yytos = &pparser->yystack[pparser->yyidx];
+	yytos->stateno = yyNewState;
+	yytos->major = yyMajor;
+	yytos->minor = *yypMinor;
+#ifndef NDEBUG
+	if (yyTraceFILE && pparser->yyidx>0) {
+		int i;
+		fprintf(yyTraceFILE,"%sShift %d\n",yyTracePrompt,yyNewState);
+		fprintf(yyTraceFILE,"%sStack:",yyTracePrompt);
+		for(i=1; i<=pparser->yyidx; i++)
+			fprintf(yyTraceFILE," %s", yyTokenName[pparser->yystack[i].major]);
+		fprintf(yyTraceFILE,"\n");
+	}
+#endif
+}
+
+/* The following table contains information about every rule that
+** is used during the reduce.
+*/
+static struct {
+	YYCODETYPE lhs;         /* Symbol on the left-hand side of the rule */
+	unsigned char nrhs;     /* Number of right-hand side symbols in the rule */
+} yyRuleInfo[] = {
+  { 107, 1 },
+  { 108, 1 },
+  { 108, 1 },
+  { 108, 3 },
+  { 108, 2 },
+  { 109, 0 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 2 },
+  { 109, 2 },
+  { 109, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 110, 1 },
+  { 109, 2 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 109, 1 },
+  { 122, 8 },
+  { 186, 0 },
+  { 186, 1 },
+  { 186, 3 },
+  { 123, 8 },
+  { 188, 0 },
+  { 188, 1 },
+  { 188, 3 },
+  { 187, 1 },
+  { 187, 2 },
+  { 187, 2 },
+  { 187, 2 },
+  { 187, 2 },
+  { 187, 2 },
+  { 124, 4 },
+  { 125, 4 },
+  { 126, 4 },
+  { 127, 7 },
+  { 143, 8 },
+  { 128, 11 },
+  { 129, 11 },
+  { 129, 13 },
+  { 130, 9 },
+  { 131, 11 },
+  { 131, 13 },
+  { 189, 1 },
+  { 189, 2 },
+  { 189, 2 },
+  { 189, 2 },
+  { 189, 2 },
+  { 189, 2 },
+  { 190, 1 },
+  { 190, 3 },
+  { 132, 9 },
+  { 133, 11 },
+  { 133, 13 },
+  { 134, 9 },
+  { 135, 11 },
+  { 193, 1 },
+  { 193, 3 },
+  { 194, 1 },
+  { 194, 3 },
+  { 195, 1 },
+  { 195, 3 },
+  { 136, 1 },
+  { 136, 2 },
+  { 196, 1 },
+  { 196, 2 },
+  { 198, 7 },
+  { 199, 7 },
+  { 197, 4 },
+  { 144, 1 },
+  { 146, 2 },
+  { 111, 4 },
+  { 112, 4 },
+  { 113, 4 },
+  { 114, 4 },
+  { 115, 4 },
+  { 116, 4 },
+  { 111, 4 },
+  { 117, 4 },
+  { 118, 3 },
+  { 119, 3 },
+  { 118, 3 },
+  { 119, 3 },
+  { 118, 3 },
+  { 119, 3 },
+  { 118, 3 },
+  { 119, 3 },
+  { 138, 3 },
+  { 139, 6 },
+  { 145, 3 },
+  { 140, 3 },
+  { 141, 3 },
+  { 142, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 138, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 145, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 118, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 119, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 142, 3 },
+  { 147, 2 },
+  { 147, 2 },
+  { 147, 2 },
+  { 204, 0 },
+  { 204, 1 },
+  { 204, 1 },
+  { 204, 1 },
+  { 204, 1 },
+  { 204, 1 },
+  { 204, 1 },
+  { 204, 3 },
+  { 204, 3 },
+  { 148, 5 },
+  { 149, 5 },
+  { 150, 5 },
+  { 151, 2 },
+  { 207, 0 },
+  { 207, 1 },
+  { 207, 3 },
+  { 152, 5 },
+  { 153, 5 },
+  { 154, 5 },
+  { 155, 2 },
+  { 155, 2 },
+  { 155, 4 },
+  { 155, 4 },
+  { 155, 2 },
+  { 155, 4 },
+  { 156, 5 },
+  { 156, 7 },
+  { 156, 5 },
+  { 156, 7 },
+  { 156, 5 },
+  { 156, 7 },
+  { 157, 5 },
+  { 157, 7 },
+  { 157, 5 },
+  { 157, 7 },
+  { 157, 5 },
+  { 157, 7 },
+  { 158, 5 },
+  { 158, 7 },
+  { 158, 5 },
+  { 158, 7 },
+  { 158, 5 },
+  { 158, 7 },
+  { 208, 1 },
+  { 208, 3 },
+  { 159, 2 },
+  { 159, 2 },
+  { 159, 4 },
+  { 159, 4 },
+  { 159, 2 },
+  { 159, 4 },
+  { 160, 5 },
+  { 160, 7 },
+  { 160, 5 },
+  { 160, 7 },
+  { 160, 5 },
+  { 160, 7 },
+  { 161, 5 },
+  { 161, 7 },
+  { 161, 5 },
+  { 161, 7 },
+  { 161, 5 },
+  { 161, 7 },
+  { 162, 5 },
+  { 162, 7 },
+  { 162, 5 },
+  { 162, 7 },
+  { 162, 5 },
+  { 162, 7 },
+  { 209, 1 },
+  { 209, 3 },
+  { 163, 4 },
+  { 163, 6 },
+  { 164, 7 },
+  { 164, 9 },
+  { 165, 7 },
+  { 165, 9 },
+  { 166, 7 },
+  { 166, 9 },
+  { 210, 1 },
+  { 210, 3 },
+  { 211, 1 },
+  { 211, 3 },
+  { 167, 4 },
+  { 167, 6 },
+  { 168, 7 },
+  { 168, 9 },
+  { 169, 7 },
+  { 169, 9 },
+  { 170, 7 },
+  { 170, 9 },
+  { 212, 1 },
+  { 212, 3 },
+  { 213, 1 },
+  { 213, 3 },
+  { 171, 1 },
+  { 175, 1 },
+  { 172, 3 },
+  { 173, 3 },
+  { 174, 3 },
+  { 171, 2 },
+  { 175, 2 },
+  { 172, 4 },
+  { 173, 4 },
+  { 174, 4 },
+  { 171, 2 },
+  { 175, 2 },
+  { 172, 4 },
+  { 173, 4 },
+  { 174, 4 },
+  { 171, 2 },
+  { 175, 2 },
+  { 172, 4 },
+  { 173, 4 },
+  { 174, 4 },
+  { 176, 2 },
+  { 177, 2 },
+  { 178, 5 },
+  { 179, 5 },
+  { 180, 5 },
+  { 176, 1 },
+  { 177, 1 },
+  { 178, 3 },
+  { 179, 3 },
+  { 180, 3 },
+  { 181, 2 },
+  { 182, 2 },
+  { 183, 5 },
+  { 184, 5 },
+  { 185, 5 },
+  { 181, 1 },
+  { 182, 1 },
+  { 183, 3 },
+  { 184, 3 },
+  { 185, 3 },
+  { 206, 1 },
+  { 206, 1 },
+  { 206, 1 },
+  { 120, 1 },
+  { 214, 5 },
+  { 214, 1 },
+  { 215, 1 },
+  { 215, 3 },
+  { 216, 1 },
+  { 216, 3 },
+  { 217, 1 },
+  { 217, 3 },
+  { 218, 1 },
+  { 218, 3 },
+  { 218, 3 },
+  { 218, 3 },
+  { 218, 3 },
+  { 219, 1 },
+  { 219, 3 },
+  { 219, 3 },
+  { 219, 3 },
+  { 219, 3 },
+  { 220, 1 },
+  { 220, 3 },
+  { 221, 1 },
+  { 221, 3 },
+  { 222, 1 },
+  { 222, 3 },
+  { 223, 1 },
+  { 223, 3 },
+  { 223, 3 },
+  { 224, 1 },
+  { 224, 3 },
+  { 224, 3 },
+  { 224, 3 },
+  { 225, 1 },
+  { 225, 3 },
+  { 225, 3 },
+  { 225, 3 },
+  { 225, 3 },
+  { 226, 1 },
+  { 226, 2 },
+  { 226, 2 },
+  { 226, 2 },
+  { 226, 2 },
+  { 227, 1 },
+  { 227, 3 },
+  { 228, 1 },
+  { 202, 1 },
+  { 202, 1 },
+  { 228, 1 },
+  { 205, 4 },
+  { 228, 1 },
+  { 191, 1 },
+  { 191, 4 },
+  { 229, 1 },
+  { 229, 1 },
+  { 229, 4 },
+  { 192, 1 },
+  { 192, 4 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 200, 1 },
+  { 201, 4 },
+  { 201, 4 },
+  { 230, 1 },
+  { 231, 1 },
+  { 228, 1 },
+  { 228, 1 },
+  { 203, 4 },
+  { 228, 3 },
+  { 228, 1 },
+  { 137, 4 },
+  { 137, 4 },
+  { 137, 4 },
+  { 232, 0 },
+  { 232, 1 },
+  { 232, 3 },
+  { 121, 2 },
+  { 121, 3 },
+  { 233, 1 },
+  { 233, 3 },
+  { 234, 3 },
+  { 235, 1 },
+  { 236, 1 },
+  { 236, 1 },
+};
+
+static void yy_accept(lemon_parser_t*);  /* Forward Declaration */
+
+/*
+** Perform a reduce action and the shift that must immediately
+** follow the reduce.
+*/
+static void yy_reduce(
+	lemon_parser_t *pparser,         /* The parser */
+	int yyruleno)                /* Number of the rule by which to reduce */
+{
+	int yygoto = -999 ;                     /* The next state */
+	int yyact = -999;                      /* The next action */
+	YYMINORTYPE yygotominor;        /* The LHS of the rule reduced */
+	yyStackEntry *yymsp;            /* The top of the parser's stack */
+	int yysize;                     /* Amount to pop the stack */
+	ParseARG_FETCH;
+	yymsp = &pparser->yystack[pparser->yyidx];
+#ifndef NDEBUG
+	if (yyTraceFILE && yyruleno>=0
+				&& yyruleno<sizeof(yyRuleName)/sizeof(yyRuleName[0])) {
+		fprintf(yyTraceFILE, "%sReduce [%s].\n", yyTracePrompt,
+			yyRuleName[yyruleno]);
+	}
+#endif /* NDEBUG */
+
+	switch (yyruleno) {
+	/* Beginning here are the reduction cases.  A typical example
+	** follows:
+	**   case 0:
+	**  #line <lineno> <grammarfile>
+	**     { ... }           // User supplied code
+	**  #line <lineno> <thisfile>
+	**     break;
+	*/
+      case 0:
+#line 70 "mlr_dsl_parse.y"
+{
+	past->proot = yymsp[0].minor.yy433;
+}
+#line 5005 "mlr_dsl_parse.c"
+        break;
+      case 1:
+      case 2:
+#line 86 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("block", MD_AST_NODE_TYPE_STATEMENT_BLOCK);
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("block", MD_AST_NODE_TYPE_STATEMENT_BLOCK, yymsp[0].minor.yy433);
+	}
+}
+#line 5017 "mlr_dsl_parse.c"
+        break;
+      case 3:
+#line 105 "mlr_dsl_parse.y"
+{
+	if (yymsp[-2].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = yymsp[0].minor.yy433;
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_prepend_arg(yymsp[0].minor.yy433, yymsp[-2].minor.yy433);
+	}
+}
+#line 5028 "mlr_dsl_parse.c"
+        break;
+      case 4:
+#line 113 "mlr_dsl_parse.y"
+{
+	if (yymsp[-1].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = yymsp[0].minor.yy433;
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_prepend_arg(yymsp[0].minor.yy433, yymsp[-1].minor.yy433);
+	}
+}
+#line 5039 "mlr_dsl_parse.c"
+        break;
+      case 5:
+#line 122 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("nop", MD_AST_NODE_TYPE_NOP);
+}
+#line 5046 "mlr_dsl_parse.c"
+        break;
+      case 6:
+      case 7:
+      case 8:
+      case 9:
+      case 10:
+      case 11:
+      case 12:
+      case 13:
+      case 14:
+      case 18:
+      case 19:
+      case 20:
+      case 21:
+      case 22:
+      case 23:
+      case 24:
+      case 25:
+      case 26:
+      case 27:
+      case 28:
+      case 29:
+      case 30:
+      case 31:
+      case 32:
+      case 34:
+      case 35:
+      case 36:
+      case 37:
+      case 38:
+      case 39:
+      case 40:
+      case 41:
+      case 42:
+      case 43:
+      case 44:
+      case 45:
+      case 46:
+      case 47:
+      case 48:
+      case 49:
+      case 50:
+      case 51:
+      case 52:
+      case 53:
+      case 54:
+      case 55:
+      case 56:
+      case 57:
+      case 58:
+      case 59:
+      case 60:
+      case 61:
+      case 62:
+      case 63:
+      case 64:
+      case 65:
+      case 66:
+      case 67:
+      case 68:
+      case 69:
+      case 70:
+      case 71:
+      case 72:
+      case 73:
+      case 74:
+      case 75:
+      case 76:
+      case 77:
+      case 78:
+      case 79:
+      case 80:
+      case 81:
+      case 377:
+#line 127 "mlr_dsl_parse.y"
+{ yygotominor.yy433 = yymsp[0].minor.yy433; }
+#line 5123 "mlr_dsl_parse.c"
+        break;
+      case 15:
+      case 16:
+#line 138 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("return_value", MD_AST_NODE_TYPE_RETURN_VALUE, yymsp[0].minor.yy433);
+}
+#line 5131 "mlr_dsl_parse.c"
+        break;
+      case 17:
+#line 145 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("return_void", MD_AST_NODE_TYPE_RETURN_VOID);
+}
+#line 5138 "mlr_dsl_parse.c"
+        break;
+      case 33:
+#line 168 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("subr_call", MD_AST_NODE_TYPE_SUBR_CALLSITE, yymsp[0].minor.yy433);
+}
+#line 5145 "mlr_dsl_parse.c"
+        break;
+      case 82:
+#line 228 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_BREAK);
+}
+#line 5152 "mlr_dsl_parse.c"
+        break;
+      case 83:
+#line 231 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_CONTINUE);
+}
+#line 5159 "mlr_dsl_parse.c"
+        break;
+      case 84:
+#line 246 "mlr_dsl_parse.y"
+{
+	yymsp[-4].minor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[-4].minor.yy433, yymsp[-6].minor.yy0->text);
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "func_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_FUNC_DEF, yymsp[-4].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5168 "mlr_dsl_parse.c"
+        break;
+      case 85:
+      case 89:
+      case 457:
+#line 252 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("anon", MD_AST_NODE_TYPE_NON_SIGIL_NAME);
+}
+#line 5177 "mlr_dsl_parse.c"
+        break;
+      case 86:
+      case 90:
+      case 458:
+#line 255 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("anon", MD_AST_NODE_TYPE_NON_SIGIL_NAME, yymsp[0].minor.yy433);
+}
+#line 5186 "mlr_dsl_parse.c"
+        break;
+      case 87:
+      case 91:
+      case 116:
+      case 249:
+      case 250:
+      case 257:
+      case 286:
+      case 312:
+      case 322:
+      case 324:
+      case 334:
+      case 336:
+      case 459:
+      case 463:
+#line 258 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_append_arg(yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5206 "mlr_dsl_parse.c"
+        break;
+      case 88:
+#line 265 "mlr_dsl_parse.y"
+{
+	yymsp[-4].minor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[-4].minor.yy433, yymsp[-6].minor.yy0->text);
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "subr_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_SUBR_DEF, yymsp[-4].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5215 "mlr_dsl_parse.c"
+        break;
+      case 92:
+#line 281 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_PARAMETER_DEFINITION);
+}
+#line 5222 "mlr_dsl_parse.c"
+        break;
+      case 93:
+#line 284 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_NUMERIC_PARAMETER_DEFINITION);
+}
+#line 5229 "mlr_dsl_parse.c"
+        break;
+      case 94:
+#line 287 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_INT_PARAMETER_DEFINITION);
+}
+#line 5236 "mlr_dsl_parse.c"
+        break;
+      case 95:
+#line 290 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_FLOAT_PARAMETER_DEFINITION);
+}
+#line 5243 "mlr_dsl_parse.c"
+        break;
+      case 96:
+#line 293 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_STRING_PARAMETER_DEFINITION);
+}
+#line 5250 "mlr_dsl_parse.c"
+        break;
+      case 97:
+#line 296 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_BOOLEAN_PARAMETER_DEFINITION);
+}
+#line 5257 "mlr_dsl_parse.c"
+        break;
+      case 98:
+#line 301 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "begin_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_BEGIN, yymsp[-1].minor.yy433);
+}
+#line 5265 "mlr_dsl_parse.c"
+        break;
+      case 99:
+#line 305 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "end_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_END, yymsp[-1].minor.yy433);
+}
+#line 5273 "mlr_dsl_parse.c"
+        break;
+      case 100:
+#line 311 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "cond_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("cond", MD_AST_NODE_TYPE_CONDITIONAL_BLOCK, yymsp[-3].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5281 "mlr_dsl_parse.c"
+        break;
+      case 101:
+#line 321 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "while_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_WHILE, yymsp[-4].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5289 "mlr_dsl_parse.c"
+        break;
+      case 102:
+#line 332 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-5].minor.yy433, "do_while_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-7].minor.yy0->text, MD_AST_NODE_TYPE_DO_WHILE, yymsp[-5].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5297 "mlr_dsl_parse.c"
+        break;
+      case 103:
+#line 347 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_full_srec_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_SREC,
+		mlr_dsl_ast_node_alloc_binary(
+			"variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-8].minor.yy433,
+			yymsp[-6].minor.yy433
+		),
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5315 "mlr_dsl_parse.c"
+        break;
+      case 104:
+#line 371 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_full_oosvar_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy433
+			),
+			yymsp[-6].minor.yy433
+		),
+		mlr_dsl_ast_node_alloc_zary("empty_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST),
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5338 "mlr_dsl_parse.c"
+        break;
+      case 105:
+#line 401 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_full_oosvar_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy433,
+			yymsp[-6].minor.yy433
+		),
+		mlr_dsl_ast_node_alloc_zary("empty_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST),
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5357 "mlr_dsl_parse.c"
+        break;
+      case 106:
+#line 427 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_full_oosvar_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR_KEY_ONLY,
+		yymsp[-6].minor.yy433,
+		mlr_dsl_ast_node_alloc_zary("empty_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST),
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5371 "mlr_dsl_parse.c"
+        break;
+      case 107:
+#line 447 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_loop_oosvar_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy433
+			),
+			yymsp[-6].minor.yy433
+		),
+		yymsp[-4].minor.yy433,
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5394 "mlr_dsl_parse.c"
+        break;
+      case 108:
+#line 477 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_loop_oosvar_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy433,
+			yymsp[-6].minor.yy433
+		),
+		yymsp[-4].minor.yy433,
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5413 "mlr_dsl_parse.c"
+        break;
+      case 109:
+#line 493 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_LOCAL_DEFINITION);
+}
+#line 5420 "mlr_dsl_parse.c"
+        break;
+      case 110:
+#line 496 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION);
+}
+#line 5427 "mlr_dsl_parse.c"
+        break;
+      case 111:
+#line 499 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION);
+}
+#line 5434 "mlr_dsl_parse.c"
+        break;
+      case 112:
+#line 502 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION);
+}
+#line 5441 "mlr_dsl_parse.c"
+        break;
+      case 113:
+#line 505 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION);
+}
+#line 5448 "mlr_dsl_parse.c"
+        break;
+      case 114:
+#line 508 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION);
+}
+#line 5455 "mlr_dsl_parse.c"
+        break;
+      case 115:
+#line 512 "mlr_dsl_parse.y"
+{ // xxx rename
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("key_variables", MD_AST_NODE_TYPE_FOR_VARIABLES, yymsp[0].minor.yy433);
+}
+#line 5462 "mlr_dsl_parse.c"
+        break;
+      case 117:
+#line 528 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_loop_oosvar_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_OOSVAR_KEY_ONLY,
+		yymsp[-6].minor.yy433,
+		yymsp[-4].minor.yy433,
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5476 "mlr_dsl_parse.c"
+        break;
+      case 118:
+#line 549 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_loop_local_map_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-10].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_LOCAL_MAP,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			mlr_dsl_ast_node_alloc_unary(
+				"key_variables",
+				MD_AST_NODE_TYPE_FOR_VARIABLES,
+				yymsp[-8].minor.yy433
+			),
+			yymsp[-6].minor.yy433
+		),
+		yymsp[-4].minor.yy433,
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5499 "mlr_dsl_parse.c"
+        break;
+      case 119:
+#line 579 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_loop_local_map_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-12].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_LOCAL_MAP,
+		mlr_dsl_ast_node_alloc_binary(
+			"key_and_value_variables",
+			MD_AST_NODE_TYPE_FOR_VARIABLES,
+			yymsp[-9].minor.yy433,
+			yymsp[-6].minor.yy433
+		),
+		yymsp[-4].minor.yy433,
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5518 "mlr_dsl_parse.c"
+        break;
+      case 120:
+#line 604 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "for_loop_local_map_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary(
+		yymsp[-8].minor.yy0->text,
+		MD_AST_NODE_TYPE_FOR_LOCAL_MAP_KEY_ONLY,
+		yymsp[-6].minor.yy433,
+		yymsp[-4].minor.yy433,
+		yymsp[-1].minor.yy433
+	);
+}
+#line 5532 "mlr_dsl_parse.c"
+        break;
+      case 121:
+#line 627 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "triple_for_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_quaternary(yymsp[-10].minor.yy0->text, MD_AST_NODE_TYPE_TRIPLE_FOR, yymsp[-8].minor.yy433, yymsp[-6].minor.yy433, yymsp[-4].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5540 "mlr_dsl_parse.c"
+        break;
+      case 122:
+#line 632 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("triple_for_start_statements", MD_AST_NODE_TYPE_STATEMENT_LIST);
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("triple_for_start_statements", MD_AST_NODE_TYPE_STATEMENT_LIST, yymsp[0].minor.yy433);
+	}
+}
+#line 5551 "mlr_dsl_parse.c"
+        break;
+      case 123:
+      case 125:
+      case 127:
+#line 639 "mlr_dsl_parse.y"
+{
+	if (yymsp[-2].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = yymsp[0].minor.yy433;
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_append_arg(yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+	}
+}
+#line 5564 "mlr_dsl_parse.c"
+        break;
+      case 124:
+#line 647 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("triple_for_continuation_statements", MD_AST_NODE_TYPE_STATEMENT_LIST);
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("triple_for_continuation_statements", MD_AST_NODE_TYPE_STATEMENT_LIST, yymsp[0].minor.yy433);
+	}
+}
+#line 5575 "mlr_dsl_parse.c"
+        break;
+      case 126:
+#line 662 "mlr_dsl_parse.y"
+{
+	if (yymsp[0].minor.yy433->type == MD_AST_NODE_TYPE_NOP) {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("triple_for_update_statements", MD_AST_NODE_TYPE_STATEMENT_LIST);
+	} else {
+		yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("triple_for_update_statements", MD_AST_NODE_TYPE_STATEMENT_LIST, yymsp[0].minor.yy433);
+	}
+}
+#line 5586 "mlr_dsl_parse.c"
+        break;
+      case 128:
+      case 135:
+      case 380:
+      case 382:
+      case 383:
+      case 385:
+      case 387:
+      case 389:
+      case 394:
+      case 399:
+      case 401:
+      case 403:
+      case 405:
+      case 408:
+      case 412:
+      case 417:
+      case 422:
+      case 424:
+      case 427:
+      case 429:
+      case 430:
+      case 435:
+      case 440:
+      case 441:
+      case 442:
+      case 443:
+      case 450:
+      case 453:
+#line 682 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = yymsp[0].minor.yy433;
+}
+#line 5620 "mlr_dsl_parse.c"
+        break;
+      case 129:
+      case 131:
+#line 685 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_append_arg(yymsp[-1].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5628 "mlr_dsl_parse.c"
+        break;
+      case 130:
+#line 688 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("if_head", MD_AST_NODE_TYPE_IF_HEAD, yymsp[0].minor.yy433);
+}
+#line 5635 "mlr_dsl_parse.c"
+        break;
+      case 132:
+#line 699 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "if_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_IF_ITEM, yymsp[-4].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5643 "mlr_dsl_parse.c"
+        break;
+      case 133:
+#line 708 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "elif_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_IF_ITEM, yymsp[-4].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 5651 "mlr_dsl_parse.c"
+        break;
+      case 134:
+#line 716 "mlr_dsl_parse.y"
+{
+	mlr_dsl_ast_node_replace_text(yymsp[-1].minor.yy433, "else_block");
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_IF_ITEM, yymsp[-1].minor.yy433);
+}
+#line 5659 "mlr_dsl_parse.c"
+        break;
+      case 136:
+#line 727 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FILTER, yymsp[0].minor.yy433);
+}
+#line 5666 "mlr_dsl_parse.c"
+        break;
+      case 137:
+#line 732 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_UNTYPED_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5673 "mlr_dsl_parse.c"
+        break;
+      case 138:
+#line 735 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5680 "mlr_dsl_parse.c"
+        break;
+      case 139:
+#line 738 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5687 "mlr_dsl_parse.c"
+        break;
+      case 140:
+#line 741 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5694 "mlr_dsl_parse.c"
+        break;
+      case 141:
+#line 744 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5701 "mlr_dsl_parse.c"
+        break;
+      case 142:
+#line 747 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5708 "mlr_dsl_parse.c"
+        break;
+      case 143:
+      case 144:
+#line 750 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_MAP_LOCAL_DEFINITION, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5716 "mlr_dsl_parse.c"
+        break;
+      case 145:
+      case 147:
+#line 757 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5724 "mlr_dsl_parse.c"
+        break;
+      case 146:
+      case 148:
+#line 760 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5732 "mlr_dsl_parse.c"
+        break;
+      case 149:
+      case 151:
+#line 771 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy0);
+}
+#line 5740 "mlr_dsl_parse.c"
+        break;
+      case 150:
+      case 152:
+#line 774 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy0);
+}
+#line 5748 "mlr_dsl_parse.c"
+        break;
+      case 153:
+#line 786 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5755 "mlr_dsl_parse.c"
+        break;
+      case 154:
+#line 792 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_INDIRECT_SREC_ASSIGNMENT, yymsp[-3].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5762 "mlr_dsl_parse.c"
+        break;
+      case 155:
+#line 796 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5769 "mlr_dsl_parse.c"
+        break;
+      case 156:
+#line 800 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OOSVAR_FROM_FULL_SREC_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy0);
+}
+#line 5776 "mlr_dsl_parse.c"
+        break;
+      case 157:
+#line 804 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_FULL_SREC_FROM_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy0, yymsp[0].minor.yy433);
+}
+#line 5783 "mlr_dsl_parse.c"
+        break;
+      case 158:
+#line 808 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 5790 "mlr_dsl_parse.c"
+        break;
+      case 159:
+#line 813 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5798 "mlr_dsl_parse.c"
+        break;
+      case 160:
+#line 817 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5806 "mlr_dsl_parse.c"
+        break;
+      case 161:
+#line 821 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5814 "mlr_dsl_parse.c"
+        break;
+      case 162:
+#line 825 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5822 "mlr_dsl_parse.c"
+        break;
+      case 163:
+#line 829 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5830 "mlr_dsl_parse.c"
+        break;
+      case 164:
+#line 833 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5838 "mlr_dsl_parse.c"
+        break;
+      case 165:
+#line 837 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5846 "mlr_dsl_parse.c"
+        break;
+      case 166:
+#line 841 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5854 "mlr_dsl_parse.c"
+        break;
+      case 167:
+#line 845 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5862 "mlr_dsl_parse.c"
+        break;
+      case 168:
+#line 849 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5870 "mlr_dsl_parse.c"
+        break;
+      case 169:
+#line 853 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5878 "mlr_dsl_parse.c"
+        break;
+      case 170:
+#line 857 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5886 "mlr_dsl_parse.c"
+        break;
+      case 171:
+#line 861 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5894 "mlr_dsl_parse.c"
+        break;
+      case 172:
+#line 865 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5902 "mlr_dsl_parse.c"
+        break;
+      case 173:
+#line 869 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5910 "mlr_dsl_parse.c"
+        break;
+      case 174:
+#line 873 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_SREC_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5918 "mlr_dsl_parse.c"
+        break;
+      case 175:
+#line 879 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5926 "mlr_dsl_parse.c"
+        break;
+      case 176:
+#line 883 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5934 "mlr_dsl_parse.c"
+        break;
+      case 177:
+#line 887 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5942 "mlr_dsl_parse.c"
+        break;
+      case 178:
+#line 891 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5950 "mlr_dsl_parse.c"
+        break;
+      case 179:
+#line 895 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5958 "mlr_dsl_parse.c"
+        break;
+      case 180:
+#line 899 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5966 "mlr_dsl_parse.c"
+        break;
+      case 181:
+#line 903 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5974 "mlr_dsl_parse.c"
+        break;
+      case 182:
+#line 907 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5982 "mlr_dsl_parse.c"
+        break;
+      case 183:
+#line 911 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5990 "mlr_dsl_parse.c"
+        break;
+      case 184:
+#line 915 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 5998 "mlr_dsl_parse.c"
+        break;
+      case 185:
+#line 919 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6006 "mlr_dsl_parse.c"
+        break;
+      case 186:
+#line 923 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6014 "mlr_dsl_parse.c"
+        break;
+      case 187:
+#line 927 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6022 "mlr_dsl_parse.c"
+        break;
+      case 188:
+#line 931 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6030 "mlr_dsl_parse.c"
+        break;
+      case 189:
+#line 935 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6038 "mlr_dsl_parse.c"
+        break;
+      case 190:
+#line 939 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_OOSVAR_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6046 "mlr_dsl_parse.c"
+        break;
+      case 191:
+#line 944 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6054 "mlr_dsl_parse.c"
+        break;
+      case 192:
+#line 948 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6062 "mlr_dsl_parse.c"
+        break;
+      case 193:
+#line 952 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6070 "mlr_dsl_parse.c"
+        break;
+      case 194:
+#line 956 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6078 "mlr_dsl_parse.c"
+        break;
+      case 195:
+#line 960 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6086 "mlr_dsl_parse.c"
+        break;
+      case 196:
+#line 964 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6094 "mlr_dsl_parse.c"
+        break;
+      case 197:
+#line 968 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6102 "mlr_dsl_parse.c"
+        break;
+      case 198:
+#line 972 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6110 "mlr_dsl_parse.c"
+        break;
+      case 199:
+#line 976 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6118 "mlr_dsl_parse.c"
+        break;
+      case 200:
+#line 980 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6126 "mlr_dsl_parse.c"
+        break;
+      case 201:
+#line 984 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6134 "mlr_dsl_parse.c"
+        break;
+      case 202:
+#line 988 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6142 "mlr_dsl_parse.c"
+        break;
+      case 203:
+#line 992 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6150 "mlr_dsl_parse.c"
+        break;
+      case 204:
+#line 996 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6158 "mlr_dsl_parse.c"
+        break;
+      case 205:
+#line 1000 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6166 "mlr_dsl_parse.c"
+        break;
+      case 206:
+#line 1004 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_NONINDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6174 "mlr_dsl_parse.c"
+        break;
+      case 207:
+#line 1009 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6182 "mlr_dsl_parse.c"
+        break;
+      case 208:
+#line 1013 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6190 "mlr_dsl_parse.c"
+        break;
+      case 209:
+#line 1017 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6198 "mlr_dsl_parse.c"
+        break;
+      case 210:
+#line 1021 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6206 "mlr_dsl_parse.c"
+        break;
+      case 211:
+#line 1025 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6214 "mlr_dsl_parse.c"
+        break;
+      case 212:
+#line 1029 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6222 "mlr_dsl_parse.c"
+        break;
+      case 213:
+#line 1033 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6230 "mlr_dsl_parse.c"
+        break;
+      case 214:
+#line 1037 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6238 "mlr_dsl_parse.c"
+        break;
+      case 215:
+#line 1041 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6246 "mlr_dsl_parse.c"
+        break;
+      case 216:
+#line 1045 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6254 "mlr_dsl_parse.c"
+        break;
+      case 217:
+#line 1049 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6262 "mlr_dsl_parse.c"
+        break;
+      case 218:
+#line 1053 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6270 "mlr_dsl_parse.c"
+        break;
+      case 219:
+#line 1057 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6278 "mlr_dsl_parse.c"
+        break;
+      case 220:
+#line 1061 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6286 "mlr_dsl_parse.c"
+        break;
+      case 221:
+#line 1065 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6294 "mlr_dsl_parse.c"
+        break;
+      case 222:
+#line 1069 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_INDEXED_LOCAL_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6302 "mlr_dsl_parse.c"
+        break;
+      case 223:
+#line 1075 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("||", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6310 "mlr_dsl_parse.c"
+        break;
+      case 224:
+#line 1079 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6318 "mlr_dsl_parse.c"
+        break;
+      case 225:
+#line 1083 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6326 "mlr_dsl_parse.c"
+        break;
+      case 226:
+#line 1087 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("|", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6334 "mlr_dsl_parse.c"
+        break;
+      case 227:
+#line 1091 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("^", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6342 "mlr_dsl_parse.c"
+        break;
+      case 228:
+#line 1095 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("&", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6350 "mlr_dsl_parse.c"
+        break;
+      case 229:
+#line 1099 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("<<", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6358 "mlr_dsl_parse.c"
+        break;
+      case 230:
+#line 1103 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(">>", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6366 "mlr_dsl_parse.c"
+        break;
+      case 231:
+#line 1107 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("+", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6374 "mlr_dsl_parse.c"
+        break;
+      case 232:
+#line 1111 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("-", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6382 "mlr_dsl_parse.c"
+        break;
+      case 233:
+#line 1115 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary(".", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6390 "mlr_dsl_parse.c"
+        break;
+      case 234:
+#line 1119 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("*", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6398 "mlr_dsl_parse.c"
+        break;
+      case 235:
+#line 1123 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("/", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6406 "mlr_dsl_parse.c"
+        break;
+      case 236:
+#line 1127 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("//", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6414 "mlr_dsl_parse.c"
+        break;
+      case 237:
+#line 1131 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("%", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6422 "mlr_dsl_parse.c"
+        break;
+      case 238:
+#line 1135 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("=", MD_AST_NODE_TYPE_ENV_ASSIGNMENT, yymsp[-2].minor.yy433,
+		mlr_dsl_ast_node_alloc_binary("**", MD_AST_NODE_TYPE_OPERATOR, mlr_dsl_ast_tree_copy(yymsp[-2].minor.yy433) , yymsp[0].minor.yy433));
+}
+#line 6430 "mlr_dsl_parse.c"
+        break;
+      case 239:
+      case 240:
+#line 1141 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_UNSET, yymsp[0].minor.yy0);
+}
+#line 6438 "mlr_dsl_parse.c"
+        break;
+      case 241:
+#line 1147 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy433, yymsp[-1].minor.yy0->text);
+}
+#line 6445 "mlr_dsl_parse.c"
+        break;
+      case 242:
+#line 1151 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("temp", MD_AST_NODE_TYPE_UNSET);
+}
+#line 6452 "mlr_dsl_parse.c"
+        break;
+      case 243:
+      case 244:
+      case 246:
+      case 247:
+      case 248:
+#line 1155 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("temp", MD_AST_NODE_TYPE_UNSET, yymsp[0].minor.yy433);
+}
+#line 6463 "mlr_dsl_parse.c"
+        break;
+      case 245:
+#line 1161 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("temp", MD_AST_NODE_TYPE_UNSET, yymsp[0].minor.yy0);
+}
+#line 6470 "mlr_dsl_parse.c"
+        break;
+      case 251:
+#line 1182 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_TEE,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-2].minor.yy433));
+}
+#line 6478 "mlr_dsl_parse.c"
+        break;
+      case 252:
+#line 1187 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_TEE,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-2].minor.yy433));
+}
+#line 6486 "mlr_dsl_parse.c"
+        break;
+      case 253:
+#line 1192 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_TEE,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-2].minor.yy433));
+}
+#line 6494 "mlr_dsl_parse.c"
+        break;
+      case 254:
+#line 1205 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy433, yymsp[-1].minor.yy0->text);
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6503 "mlr_dsl_parse.c"
+        break;
+      case 255:
+#line 1211 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("temp", MD_AST_NODE_TYPE_EMITF);
+}
+#line 6510 "mlr_dsl_parse.c"
+        break;
+      case 256:
+#line 1214 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("temp", MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy433);
+}
+#line 6517 "mlr_dsl_parse.c"
+        break;
+      case 258:
+#line 1221 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy433, yymsp[-4].minor.yy0->text);
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-2].minor.yy433));
+}
+#line 6526 "mlr_dsl_parse.c"
+        break;
+      case 259:
+#line 1227 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy433, yymsp[-4].minor.yy0->text);
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-2].minor.yy433));
+}
+#line 6535 "mlr_dsl_parse.c"
+        break;
+      case 260:
+#line 1233 "mlr_dsl_parse.y"
+{
+	yymsp[0].minor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[0].minor.yy433, yymsp[-4].minor.yy0->text);
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITF, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-2].minor.yy433));
+}
+#line 6544 "mlr_dsl_parse.c"
+        break;
+      case 261:
+      case 262:
+#line 1241 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6554 "mlr_dsl_parse.c"
+        break;
+      case 263:
+      case 264:
+#line 1252 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6564 "mlr_dsl_parse.c"
+        break;
+      case 265:
+#line 1263 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6573 "mlr_dsl_parse.c"
+        break;
+      case 266:
+#line 1268 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6582 "mlr_dsl_parse.c"
+        break;
+      case 267:
+      case 269:
+#line 1276 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-2].minor.yy433));
+}
+#line 6593 "mlr_dsl_parse.c"
+        break;
+      case 268:
+      case 270:
+#line 1284 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-4].minor.yy433));
+}
+#line 6604 "mlr_dsl_parse.c"
+        break;
+      case 271:
+#line 1308 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-2].minor.yy433));
+}
+#line 6614 "mlr_dsl_parse.c"
+        break;
+      case 272:
+#line 1316 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-4].minor.yy433));
+}
+#line 6624 "mlr_dsl_parse.c"
+        break;
+      case 273:
+      case 275:
+#line 1326 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-2].minor.yy433));
+}
+#line 6635 "mlr_dsl_parse.c"
+        break;
+      case 274:
+      case 276:
+#line 1334 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-4].minor.yy433));
+}
+#line 6646 "mlr_dsl_parse.c"
+        break;
+      case 277:
+#line 1358 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-2].minor.yy433));
+}
+#line 6656 "mlr_dsl_parse.c"
+        break;
+      case 278:
+#line 1366 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-4].minor.yy433));
+}
+#line 6666 "mlr_dsl_parse.c"
+        break;
+      case 279:
+      case 281:
+#line 1376 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-2].minor.yy433));
+}
+#line 6677 "mlr_dsl_parse.c"
+        break;
+      case 280:
+      case 282:
+#line 1384 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-4].minor.yy433));
+}
+#line 6688 "mlr_dsl_parse.c"
+        break;
+      case 283:
+#line 1408 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-2].minor.yy433));
+}
+#line 6698 "mlr_dsl_parse.c"
+        break;
+      case 284:
+#line 1416 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-4].minor.yy433));
+}
+#line 6708 "mlr_dsl_parse.c"
+        break;
+      case 285:
+#line 1423 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("emitp_namelist", MD_AST_NODE_TYPE_EMITP, yymsp[0].minor.yy433);
+}
+#line 6715 "mlr_dsl_parse.c"
+        break;
+      case 287:
+      case 288:
+#line 1431 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6725 "mlr_dsl_parse.c"
+        break;
+      case 289:
+      case 290:
+#line 1442 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6735 "mlr_dsl_parse.c"
+        break;
+      case 291:
+#line 1453 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6744 "mlr_dsl_parse.c"
+        break;
+      case 292:
+#line 1458 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6753 "mlr_dsl_parse.c"
+        break;
+      case 293:
+      case 295:
+#line 1467 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-2].minor.yy433));
+}
+#line 6764 "mlr_dsl_parse.c"
+        break;
+      case 294:
+      case 296:
+#line 1475 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-4].minor.yy433));
+}
+#line 6775 "mlr_dsl_parse.c"
+        break;
+      case 297:
+#line 1499 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-2].minor.yy433));
+}
+#line 6785 "mlr_dsl_parse.c"
+        break;
+      case 298:
+#line 1507 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+		yymsp[-4].minor.yy433));
+}
+#line 6795 "mlr_dsl_parse.c"
+        break;
+      case 299:
+      case 301:
+#line 1517 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-2].minor.yy433));
+}
+#line 6806 "mlr_dsl_parse.c"
+        break;
+      case 300:
+      case 302:
+#line 1525 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-4].minor.yy433));
+}
+#line 6817 "mlr_dsl_parse.c"
+        break;
+      case 303:
+#line 1549 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-2].minor.yy433));
+}
+#line 6827 "mlr_dsl_parse.c"
+        break;
+      case 304:
+#line 1557 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+		yymsp[-4].minor.yy433));
+}
+#line 6837 "mlr_dsl_parse.c"
+        break;
+      case 305:
+      case 307:
+#line 1567 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy0),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-2].minor.yy433));
+}
+#line 6848 "mlr_dsl_parse.c"
+        break;
+      case 306:
+      case 308:
+#line 1575 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy0, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-4].minor.yy433));
+}
+#line 6859 "mlr_dsl_parse.c"
+        break;
+      case 309:
+#line 1599 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-2].minor.yy433));
+}
+#line 6869 "mlr_dsl_parse.c"
+        break;
+      case 310:
+#line 1607 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT, yymsp[-2].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+		yymsp[-4].minor.yy433));
+}
+#line 6879 "mlr_dsl_parse.c"
+        break;
+      case 311:
+#line 1615 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("emit_namelist", MD_AST_NODE_TYPE_EMIT, yymsp[0].minor.yy433);
+}
+#line 6886 "mlr_dsl_parse.c"
+        break;
+      case 313:
+#line 1625 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6895 "mlr_dsl_parse.c"
+        break;
+      case 314:
+#line 1633 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6904 "mlr_dsl_parse.c"
+        break;
+      case 315:
+#line 1641 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-4].minor.yy433));
+}
+#line 6913 "mlr_dsl_parse.c"
+        break;
+      case 316:
+#line 1649 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-6].minor.yy433));
+}
+#line 6922 "mlr_dsl_parse.c"
+        break;
+      case 317:
+#line 1657 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-4].minor.yy433));
+}
+#line 6931 "mlr_dsl_parse.c"
+        break;
+      case 318:
+#line 1665 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-6].minor.yy433));
+}
+#line 6940 "mlr_dsl_parse.c"
+        break;
+      case 319:
+#line 1673 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-4].minor.yy433));
+}
+#line 6949 "mlr_dsl_parse.c"
+        break;
+      case 320:
+#line 1681 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-6].minor.yy433));
+}
+#line 6958 "mlr_dsl_parse.c"
+        break;
+      case 321:
+#line 1687 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("lashed_keylists", MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[0].minor.yy433);
+}
+#line 6965 "mlr_dsl_parse.c"
+        break;
+      case 323:
+#line 1694 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("lashed_namelist", MD_AST_NODE_TYPE_EMITP_LASHED, yymsp[0].minor.yy433);
+}
+#line 6972 "mlr_dsl_parse.c"
+        break;
+      case 325:
+#line 1704 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6981 "mlr_dsl_parse.c"
+        break;
+      case 326:
+#line 1712 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-5].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_zary("stream", MD_AST_NODE_TYPE_STREAM));
+}
+#line 6990 "mlr_dsl_parse.c"
+        break;
+      case 327:
+#line 1720 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-4].minor.yy433));
+}
+#line 6999 "mlr_dsl_parse.c"
+        break;
+      case 328:
+#line 1728 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[-6].minor.yy433));
+}
+#line 7008 "mlr_dsl_parse.c"
+        break;
+      case 329:
+#line 1736 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-4].minor.yy433));
+}
+#line 7017 "mlr_dsl_parse.c"
+        break;
+      case 330:
+#line 1744 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[-6].minor.yy433));
+}
+#line 7026 "mlr_dsl_parse.c"
+        break;
+      case 331:
+#line 1752 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_unary(yymsp[-6].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-1].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-4].minor.yy433));
+}
+#line 7035 "mlr_dsl_parse.c"
+        break;
+      case 332:
+#line 1760 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED,
+		mlr_dsl_ast_node_alloc_binary(yymsp[-8].minor.yy0->text, MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[-3].minor.yy433, yymsp[0].minor.yy433),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[-6].minor.yy433));
+}
+#line 7044 "mlr_dsl_parse.c"
+        break;
+      case 333:
+#line 1767 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("lashed_keylists", MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[0].minor.yy433);
+}
+#line 7051 "mlr_dsl_parse.c"
+        break;
+      case 335:
+#line 1774 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("lashed_namelist", MD_AST_NODE_TYPE_EMIT_LASHED, yymsp[0].minor.yy433);
+}
+#line 7058 "mlr_dsl_parse.c"
+        break;
+      case 337:
+#line 1782 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 7067 "mlr_dsl_parse.c"
+        break;
+      case 338:
+#line 1787 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 7076 "mlr_dsl_parse.c"
+        break;
+      case 339:
+#line 1792 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[0].minor.yy433));
+}
+#line 7085 "mlr_dsl_parse.c"
+        break;
+      case 340:
+#line 1797 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[0].minor.yy433));
+}
+#line 7094 "mlr_dsl_parse.c"
+        break;
+      case 341:
+#line 1802 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[0].minor.yy433));
+}
+#line 7103 "mlr_dsl_parse.c"
+        break;
+      case 342:
+      case 347:
+      case 352:
+#line 1808 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)),
+		yymsp[0].minor.yy433);
+}
+#line 7115 "mlr_dsl_parse.c"
+        break;
+      case 343:
+      case 348:
+      case 353:
+#line 1814 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)),
+		yymsp[0].minor.yy433);
+}
+#line 7127 "mlr_dsl_parse.c"
+        break;
+      case 344:
+      case 349:
+      case 354:
+#line 1820 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[-1].minor.yy433),
+		yymsp[0].minor.yy433);
+}
+#line 7139 "mlr_dsl_parse.c"
+        break;
+      case 345:
+      case 350:
+      case 355:
+#line 1826 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[-1].minor.yy433),
+		yymsp[0].minor.yy433);
+}
+#line 7151 "mlr_dsl_parse.c"
+        break;
+      case 346:
+      case 351:
+      case 356:
+#line 1832 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-3].minor.yy0->text, MD_AST_NODE_TYPE_DUMP,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[-1].minor.yy433),
+		yymsp[0].minor.yy433);
+}
+#line 7163 "mlr_dsl_parse.c"
+        break;
+      case 357:
+#line 1903 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 7172 "mlr_dsl_parse.c"
+        break;
+      case 358:
+#line 1908 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 7181 "mlr_dsl_parse.c"
+        break;
+      case 359:
+#line 1913 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[-2].minor.yy433));
+}
+#line 7190 "mlr_dsl_parse.c"
+        break;
+      case 360:
+#line 1918 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[-2].minor.yy433));
+}
+#line 7199 "mlr_dsl_parse.c"
+        break;
+      case 361:
+#line 1923 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINT, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[-2].minor.yy433));
+}
+#line 7208 "mlr_dsl_parse.c"
+        break;
+      case 362:
+#line 1930 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 7218 "mlr_dsl_parse.c"
+        break;
+      case 363:
+#line 1936 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 7228 "mlr_dsl_parse.c"
+        break;
+      case 364:
+#line 1942 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[0].minor.yy433));
+}
+#line 7237 "mlr_dsl_parse.c"
+        break;
+      case 365:
+#line 1947 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[0].minor.yy433));
+}
+#line 7246 "mlr_dsl_parse.c"
+        break;
+      case 366:
+#line 1952 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINT,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[0].minor.yy433));
+}
+#line 7255 "mlr_dsl_parse.c"
+        break;
+      case 367:
+#line 1959 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 7264 "mlr_dsl_parse.c"
+        break;
+      case 368:
+#line 1964 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 7273 "mlr_dsl_parse.c"
+        break;
+      case 369:
+#line 1969 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			yymsp[-2].minor.yy433));
+}
+#line 7282 "mlr_dsl_parse.c"
+        break;
+      case 370:
+#line 1974 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND,
+			yymsp[-2].minor.yy433));
+}
+#line 7291 "mlr_dsl_parse.c"
+        break;
+      case 371:
+#line 1979 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-4].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN, yymsp[0].minor.yy433,
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE,
+			yymsp[-2].minor.yy433));
+}
+#line 7300 "mlr_dsl_parse.c"
+        break;
+      case 372:
+#line 1987 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDOUT)));
+}
+#line 7310 "mlr_dsl_parse.c"
+        break;
+      case 373:
+#line 1993 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE,
+			mlr_dsl_ast_node_alloc_zary("stdout", MD_AST_NODE_TYPE_STDERR)));
+}
+#line 7320 "mlr_dsl_parse.c"
+        break;
+      case 374:
+#line 1999 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">", MD_AST_NODE_TYPE_FILE_WRITE, yymsp[0].minor.yy433));
+}
+#line 7329 "mlr_dsl_parse.c"
+        break;
+      case 375:
+#line 2004 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary(">>", MD_AST_NODE_TYPE_FILE_APPEND, yymsp[0].minor.yy433));
+}
+#line 7338 "mlr_dsl_parse.c"
+        break;
+      case 376:
+#line 2009 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-2].minor.yy0->text, MD_AST_NODE_TYPE_PRINTN,
+		mlr_dsl_ast_node_alloc("", MD_AST_NODE_TYPE_NUMERIC_LITERAL),
+		mlr_dsl_ast_node_alloc_unary("|", MD_AST_NODE_TYPE_PIPE, yymsp[0].minor.yy433));
+}
+#line 7347 "mlr_dsl_parse.c"
+        break;
+      case 378:
+      case 379:
+#line 2017 "mlr_dsl_parse.y"
+{ yygotominor.yy433 = yymsp[0].minor.yy0; }
+#line 7353 "mlr_dsl_parse.c"
+        break;
+      case 381:
+#line 2027 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_ternary("? :", MD_AST_NODE_TYPE_OPERATOR, yymsp[-4].minor.yy433, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 7360 "mlr_dsl_parse.c"
+        break;
+      case 384:
+      case 386:
+      case 388:
+      case 390:
+      case 391:
+      case 392:
+      case 393:
+      case 395:
+      case 396:
+      case 397:
+      case 398:
+      case 400:
+      case 402:
+      case 404:
+      case 406:
+      case 407:
+      case 409:
+      case 410:
+      case 411:
+      case 413:
+      case 414:
+      case 415:
+      case 416:
+      case 423:
+#line 2039 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OPERATOR, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 7390 "mlr_dsl_parse.c"
+        break;
+      case 418:
+      case 419:
+      case 420:
+      case 421:
+#line 2163 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-1].minor.yy0->text, MD_AST_NODE_TYPE_OPERATOR, yymsp[0].minor.yy433);
+}
+#line 7400 "mlr_dsl_parse.c"
+        break;
+      case 425:
+#line 2194 "mlr_dsl_parse.y"
+{
+	char* dollar_name = yymsp[0].minor.yy0->text;
+	char* no_dollar_name = &dollar_name[1];
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(no_dollar_name, yymsp[0].minor.yy0->type);
+}
+#line 7409 "mlr_dsl_parse.c"
+        break;
+      case 426:
+#line 2199 "mlr_dsl_parse.y"
+{
+	// Replace "${field.name}" with just "field.name"
+	char* dollar_name = yymsp[0].minor.yy0->text;
+	char* no_dollar_name = &dollar_name[2];
+	int len = strlen(no_dollar_name);
+	if (len > 0)
+		no_dollar_name[len-1] = 0;
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(no_dollar_name, yymsp[0].minor.yy0->type);
+}
+#line 7422 "mlr_dsl_parse.c"
+        break;
+      case 428:
+#line 2212 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("indirect_field_name", MD_AST_NODE_TYPE_INDIRECT_FIELD_NAME, yymsp[-1].minor.yy433);
+}
+#line 7429 "mlr_dsl_parse.c"
+        break;
+      case 431:
+      case 436:
+      case 446:
+#line 2224 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_append_arg(yymsp[-3].minor.yy433, yymsp[-1].minor.yy433);
+}
+#line 7438 "mlr_dsl_parse.c"
+        break;
+      case 432:
+#line 2229 "mlr_dsl_parse.y"
+{
+	char* at_name = yymsp[0].minor.yy0->text;
+	char* no_at_name = &at_name[1];
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("oosvar_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST,
+		mlr_dsl_ast_node_alloc(no_at_name, yymsp[0].minor.yy0->type));
+}
+#line 7448 "mlr_dsl_parse.c"
+        break;
+      case 433:
+#line 2237 "mlr_dsl_parse.y"
+{
+	// Replace "@%{field.name}" with just "field.name"
+	char* at_name = yymsp[0].minor.yy0->text;
+	char* no_at_name = &at_name[2];
+	int len = strlen(no_at_name);
+	if (len > 0)
+		no_at_name[len-1] = 0;
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("oosvar_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST,
+		mlr_dsl_ast_node_alloc(no_at_name, yymsp[0].minor.yy0->type));
+}
+#line 7462 "mlr_dsl_parse.c"
+        break;
+      case 434:
+#line 2249 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("oosvar_keylist", MD_AST_NODE_TYPE_OOSVAR_KEYLIST, yymsp[-1].minor.yy433);
+}
+#line 7469 "mlr_dsl_parse.c"
+        break;
+      case 437:
+      case 438:
+      case 439:
+      case 449:
+#line 2261 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = yymsp[0].minor.yy0;
+}
+#line 7479 "mlr_dsl_parse.c"
+        break;
+      case 444:
+#line 2285 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(yymsp[0].minor.yy0->text, MD_AST_NODE_TYPE_NONINDEXED_LOCAL_VARIABLE);
+}
+#line 7486 "mlr_dsl_parse.c"
+        break;
+      case 445:
+#line 2288 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary(yymsp[-3].minor.yy433->text, MD_AST_NODE_TYPE_INDEXED_LOCAL_VARIABLE, yymsp[-1].minor.yy433);
+}
+#line 7493 "mlr_dsl_parse.c"
+        break;
+      case 447:
+#line 2295 "mlr_dsl_parse.y"
+{
+	char* input = yymsp[0].minor.yy0->text;
+	char* stripped = &input[1];
+	int len = strlen(input);
+	stripped[len-2] = 0;
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(mlr_alloc_unbackslash(stripped), yymsp[0].minor.yy0->type);
+}
+#line 7504 "mlr_dsl_parse.c"
+        break;
+      case 448:
+#line 2302 "mlr_dsl_parse.y"
+{
+	char* input = yymsp[0].minor.yy0->text;
+	char* stripped = &input[1];
+	int len = strlen(input);
+	stripped[len-3] = 0;
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc(mlr_alloc_unbackslash(stripped), yymsp[0].minor.yy0->type);
+}
+#line 7515 "mlr_dsl_parse.c"
+        break;
+      case 451:
+#line 2317 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("env", MD_AST_NODE_TYPE_ENV, yymsp[-3].minor.yy0, yymsp[-1].minor.yy433);
+}
+#line 7522 "mlr_dsl_parse.c"
+        break;
+      case 452:
+      case 461:
+#line 2321 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = yymsp[-1].minor.yy433;
+}
+#line 7530 "mlr_dsl_parse.c"
+        break;
+      case 454:
+      case 455:
+      case 456:
+#line 2336 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_set_function_name(yymsp[-1].minor.yy433, yymsp[-3].minor.yy0->text);
+	yygotominor.yy433->type = MD_AST_NODE_TYPE_FUNCTION_CALLSITE;
+}
+#line 7540 "mlr_dsl_parse.c"
+        break;
+      case 460:
+#line 2366 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_zary("map_literal", MD_AST_NODE_TYPE_MAP_LITERAL);
+}
+#line 7547 "mlr_dsl_parse.c"
+        break;
+      case 462:
+#line 2372 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("map_literal", MD_AST_NODE_TYPE_MAP_LITERAL, yymsp[0].minor.yy433);
+}
+#line 7554 "mlr_dsl_parse.c"
+        break;
+      case 464:
+#line 2378 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_binary("mappair", MD_AST_NODE_TYPE_MAP_LITERAL_PAIR, yymsp[-2].minor.yy433, yymsp[0].minor.yy433);
+}
+#line 7561 "mlr_dsl_parse.c"
+        break;
+      case 465:
+#line 2381 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("mapkey", MD_AST_NODE_TYPE_MAP_LITERAL_KEY, yymsp[0].minor.yy433);
+}
+#line 7568 "mlr_dsl_parse.c"
+        break;
+      case 466:
+#line 2384 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("mapval", MD_AST_NODE_TYPE_MAP_LITERAL_VALUE, yymsp[0].minor.yy433);
+}
+#line 7575 "mlr_dsl_parse.c"
+        break;
+      case 467:
+#line 2387 "mlr_dsl_parse.y"
+{
+	yygotominor.yy433 = mlr_dsl_ast_node_alloc_unary("mapval", MD_AST_NODE_TYPE_MAP_LITERAL, yymsp[0].minor.yy433);
+}
+#line 7582 "mlr_dsl_parse.c"
+        break;
+	};
+	yygoto = yyRuleInfo[yyruleno].lhs;
+	yysize = yyRuleInfo[yyruleno].nrhs;
+	pparser->yyidx -= yysize;
+	yyact = yy_find_reduce_action(pparser,yygoto);
+	if (yyact < YYNSTATE) {
+		yy_shift(pparser,yyact,yygoto,&yygotominor);
+	} else if (yyact == YYNSTATE + YYNRULE + 1) {
+		yy_accept(pparser);
+	}
+}
+
+/*
+** The following code executes when the parse fails
+*/
+static void yy_parse_failed(lemon_parser_t *pparser) {
+	ParseARG_FETCH;
+#ifndef NDEBUG
+	if (yyTraceFILE) {
+		fprintf(yyTraceFILE,"%sFail!\n",yyTracePrompt);
+	}
+#endif
+	while (pparser->yyidx >= 0)
+		yy_pop_parser_stack(pparser);
+	/* Here code is inserted which will be executed whenever the
+	** parser fails */
+	ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
+}
+
+/*
+** The following code executes when a syntax error first occurs.
+*/
+static void yy_syntax_error(
+	lemon_parser_t *pparser,           /* The parser */
+	int yymajor,                   /* The major type of the error token */
+	YYMINORTYPE yyminor            /* The minor type of the error token */
+){
+	ParseARG_FETCH;
+#define TOKEN (yyminor.yy0)
+#line 54 "mlr_dsl_parse.y"
+
+	fprintf(stderr, "mlr DSL: syntax error at \"%s\"\n", TOKEN->text);
+
+//	xxx may or may not publish this ... it's confusing and maybe not better than nothing.
+//	xxx ideally we want the position within the input of the syntax error.
+//
+//	int n = sizeof(yyTokenName) / sizeof(yyTokenName[0]);
+//	for (int i = 0; i < n; ++i) {
+//			int a = yy_find_shift_action(pparser, (YYCODETYPE)i);
+//			if (a < YYNSTATE + YYNRULE) {
+//				fprintf(stderr, "Possible token \"%s\"\n", yyTokenName[i]);
+//			}
+//	}
+
+#line 7638 "mlr_dsl_parse.c"
+	ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
+}
+
+/*
+** The following is executed when the parser accepts
+*/
+static void yy_accept(lemon_parser_t *pparser) {
+	ParseARG_FETCH;
+#ifndef NDEBUG
+	if (yyTraceFILE) {
+		fprintf(yyTraceFILE,"%sAccept!\n", yyTracePrompt);
+	}
+#endif
+	while (pparser->yyidx>=0)
+		yy_pop_parser_stack(pparser);
+	/* Here code is inserted which will be executed whenever the
+	** parser accepts */
+#line 50 "mlr_dsl_parse.y"
+
+
+#line 7659 "mlr_dsl_parse.c"
+	ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
+}
+
+/* The main parser program.
+** The first argument is a pointer to a structure obtained from
+** "mlr_dsl_lemon_parser_alloc" which describes the current state of the parser.
+** The second argument is the major token number.  The third is
+** the minor token.  The fourth optional argument is whatever the
+** user wants (and specified in the grammar) and is available for
+** use by the action routines.
+**
+** Inputs:
+** <ul>
+** <li> A pointer to the parser (an opaque structure).
+** <li> The major token number.
+** <li> The minor token number.
+** <li> An option argument of a grammar-specified type.
+** </ul>
+**
+** Outputs:
+** None.
+*/
+
+int mlr_dsl_lemon_parser_parse_token(
+	void *pvparser,              /* The parser */
+	int yymajor,                 /* The major token code number */
+	ParseTOKENTYPE yyminor       /* The value for the token */
+	ParseARG_PDECL)              /* Optional %extra_argument parameter */
+{
+	YYMINORTYPE yyminorunion;
+	int yyact;            /* The parser action. */
+	int yyendofinput;     /* True if we are at the end of input */
+	int yyerrorhit = 0;   /* True if yymajor has invoked an error */
+	lemon_parser_t *pparser;  /* The parser */
+
+	int parse_code = 1;
+
+	/* (re)initialize the parser, if necessary */
+	pparser = (lemon_parser_t*)pvparser;
+	if (pparser->yyidx<0) {
+		if (yymajor==0)  return 1;
+		pparser->yyidx = 0;
+		pparser->yyerrcnt = -1;
+		pparser->yystack[0].stateno = 0;
+		pparser->yystack[0].major = 0;
+	}
+	yyminorunion.yy0 = yyminor;
+	yyendofinput = (yymajor==0);
+	ParseARG_STORE;
+
+#ifndef NDEBUG
+	if (yyTraceFILE) {
+		fprintf(yyTraceFILE,"%sInput %s\n", yyTracePrompt, yyTokenName[yymajor]);
+	}
+#endif
+
+	do {
+		yyact = yy_find_shift_action(pparser,yymajor);
+		if (yyact<YYNSTATE) {
+			yy_shift(pparser,yyact,yymajor,&yyminorunion);
+			pparser->yyerrcnt--;
+			if (yyendofinput && pparser->yyidx>=0) {
+				yymajor = 0;
+			} else {
+				yymajor = YYNOCODE;
+			}
+		} else if (yyact < YYNSTATE + YYNRULE) {
+			yy_reduce(pparser,yyact-YYNSTATE);
+		} else if (yyact == YY_ERROR_ACTION) {
+			int yymx;
+#ifndef NDEBUG
+			if (yyTraceFILE) {
+				fprintf(yyTraceFILE,"%sSyntax Error!\n",yyTracePrompt);
+			}
+#endif
+#ifdef YYERRORSYMBOL
+			/* A syntax error has occurred.
+			** The response to an error depends upon whether or not the
+			** grammar defines an error token "ERROR".
+			**
+			** This is what we do if the grammar does define ERROR:
+			**
+			**  * Call the %syntax_error function.
+			**
+			**  * Begin popping the stack until we enter a state where
+			**    it is legal to shift the error symbol, then shift
+			**    the error symbol.
+			**
+			**  * Set the error count to three.
+			**
+			**  * Begin accepting and shifting new tokens.  No new error
+			**    processing will occur until three tokens have been
+			**    shifted successfully.
+			**
+			*/
+			if (pparser->yyerrcnt<0) {
+				yy_syntax_error(pparser, yymajor, yyminorunion);
+				return 0;
+			}
+			yymx = pparser->yystack[pparser->yyidx].major;
+			if (yymx==YYERRORSYMBOL || yyerrorhit) {
+#ifndef NDEBUG
+				if (yyTraceFILE) {
+					fprintf(yyTraceFILE,"%sDiscard input token %s\n",
+						 yyTracePrompt, yyTokenName[yymajor]);
+				}
+#endif
+				mlr_dsl_yy_destructor(yymajor,&yyminorunion);
+				yymajor = YYNOCODE;
+			} else {
+				 while(
+					pparser->yyidx >= 0 &&
+					yymx != YYERRORSYMBOL &&
+					(yyact = yy_find_shift_action(pparser,YYERRORSYMBOL)) >= YYNSTATE
+				){
+					yy_pop_parser_stack(pparser);
+				}
+				if (pparser->yyidx < 0 || yymajor==0) {
+					mlr_dsl_yy_destructor(yymajor,&yyminorunion);
+					yy_parse_failed(pparser);
+					parse_code = 0;
+					yymajor = YYNOCODE;
+				} else if (yymx!=YYERRORSYMBOL) {
+					YYMINORTYPE u2;
+					u2.YYERRSYMDT = 0;
+					yy_shift(pparser,yyact,YYERRORSYMBOL,&u2);
+				}
+			}
+			pparser->yyerrcnt = 3;
+			yyerrorhit = 1;
+#else  /* YYERRORSYMBOL is not defined */
+			/* This is what we do if the grammar does not define ERROR:
+			**
+			**  * Report an error message, and throw away the input token.
+			**
+			**  * If the input token is $, then fail the parse.
+			**
+			** As before, subsequent error messages are suppressed until
+			** three input tokens have been successfully shifted.
+			*/
+			if (pparser->yyerrcnt<=0) {
+				yy_syntax_error(pparser, yymajor, yyminorunion);
+				return 0;
+			}
+			pparser->yyerrcnt = 3;
+			mlr_dsl_yy_destructor(yymajor,&yyminorunion);
+			if (yyendofinput) {
+				yy_parse_failed(pparser);
+				parse_code = 0;
+			}
+			yymajor = YYNOCODE;
+#endif
+		} else {
+			yy_accept(pparser);
+			yymajor = YYNOCODE;
+		}
+	} while (yymajor!=YYNOCODE && pparser->yyidx>=0) ;
+	return parse_code;
+}
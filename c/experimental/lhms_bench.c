@@ -0,0 +1,166 @@
+// ================================================================
+// Timings for the lhms* maps on a few access patterns seen in Miller: large
+// maps of distinct keys (e.g. count-distinct), repeated lookups over a few
+// group-by keys (e.g. stats1 -g), and many small short-lived maps (e.g. typed
+// overlays, or per-record field names). Uses only the maps' public API, so the
+// same source builds against older checkouts for comparison. Output is DKVP.
+// ================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "lib/mlrutil.h"
+#include "containers/slls.h"
+#include "containers/lhmss.h"
+#include "containers/lhmsv.h"
+#include "containers/lhmsll.h"
+#include "containers/lhmslv.h"
+
+#define NUM_KEYS        1000000
+#define NUM_GROUP_KEYS  1000
+#define NUM_LOOKUPS     10000000
+#define NUM_SMALL_MAPS  2000000
+
+static long sink = 0;
+
+// ----------------------------------------------------------------
+static void bench_large(char** keys, char** misses) {
+	double s = get_systime();
+	lhmss_t* pmap = lhmss_alloc();
+	for (int i = 0; i < NUM_KEYS; i++)
+		lhmss_put(pmap, keys[i], keys[i], NO_FREE);
+	double e = get_systime();
+	printf("map=lhmss,op=put,n=%d,t=%.6lf\n", NUM_KEYS, e - s);
+
+	s = get_systime();
+	for (int i = 0; i < NUM_KEYS; i++)
+		sink += lhmss_get(pmap, keys[i]) != NULL;
+	e = get_systime();
+	printf("map=lhmss,op=get_hit,n=%d,t=%.6lf\n", NUM_KEYS, e - s);
+
+	s = get_systime();
+	for (int i = 0; i < NUM_KEYS; i++)
+		sink += lhmss_get(pmap, misses[i]) != NULL;
+	e = get_systime();
+	printf("map=lhmss,op=get_miss,n=%d,t=%.6lf\n", NUM_KEYS, e - s);
+
+	s = get_systime();
+	for (lhmsse_t* pe = pmap->phead; pe != NULL; pe = pe->pnext)
+		sink += pe->key[0];
+	e = get_systime();
+	printf("map=lhmss,op=iterate,n=%d,t=%.6lf\n", NUM_KEYS, e - s);
+	lhmss_free(pmap);
+
+	s = get_systime();
+	lhmsll_t* pcounts = lhmsll_alloc();
+	for (int i = 0; i < NUM_KEYS; i++) {
+		lhmslle_t* pe = lhmsll_get_entry(pcounts, keys[i % (NUM_KEYS / 5)]);
+		if (pe == NULL)
+			lhmsll_put(pcounts, keys[i % (NUM_KEYS / 5)], 1, NO_FREE);
+		else
+			pe->value++;
+	}
+	lhmsll_free(pcounts);
+	e = get_systime();
+	printf("map=lhmsll,op=count_distinct,n=%d,t=%.6lf\n", NUM_KEYS, e - s);
+}
+
+// ----------------------------------------------------------------
+static void bench_group_by(char** keys) {
+	slls_t** group_keys = mlr_malloc_or_die(NUM_GROUP_KEYS * sizeof(slls_t*));
+	for (int i = 0; i < NUM_GROUP_KEYS; i++) {
+		group_keys[i] = slls_alloc();
+		slls_append_no_free(group_keys[i], keys[i % 37]);
+		slls_append_no_free(group_keys[i], keys[i]);
+	}
+
+	double s = get_systime();
+	lhmslv_t* pmap = lhmslv_alloc();
+	unsigned seed = 1;
+	for (int i = 0; i < NUM_LOOKUPS; i++) {
+		seed = seed * 1103515245 + 12345;
+		slls_t* pkey = group_keys[(seed >> 8) % NUM_GROUP_KEYS];
+		if (lhmslv_get(pmap, pkey) == NULL)
+			lhmslv_put(pmap, pkey, pkey, NO_FREE);
+		else
+			sink++;
+	}
+	double e = get_systime();
+	printf("map=lhmslv,op=group_by,n=%d,t=%.6lf\n", NUM_LOOKUPS, e - s);
+
+	lhmslv_free(pmap);
+	for (int i = 0; i < NUM_GROUP_KEYS; i++)
+		slls_free(group_keys[i]);
+	free(group_keys);
+}
+
+// ----------------------------------------------------------------
+static void bench_small(char** keys) {
+	double s = get_systime();
+	for (int i = 0; i < NUM_SMALL_MAPS; i++) {
+		lhmsv_t* pmap = lhmsv_alloc();
+		for (int j = 0; j < 8; j++)
+			sink += lhmsv_get(pmap, keys[j]) != NULL;
+		lhmsv_free(pmap);
+	}
+	double e = get_systime();
+	printf("map=lhmsv,op=small_empty,n=%d,t=%.6lf\n", NUM_SMALL_MAPS, e - s);
+
+	s = get_systime();
+	for (int i = 0; i < NUM_SMALL_MAPS; i++) {
+		lhmsv_t* pmap = lhmsv_alloc();
+		for (int j = 0; j < 5; j++)
+			lhmsv_put(pmap, keys[j], keys[j], NO_FREE);
+		for (int j = 0; j < 8; j++)
+			sink += lhmsv_get(pmap, keys[j]) != NULL;
+		lhmsv_free(pmap);
+	}
+	e = get_systime();
+	printf("map=lhmsv,op=small_5,n=%d,t=%.6lf\n", NUM_SMALL_MAPS, e - s);
+
+	// Short alphabetic keys, as for per-record field names, with hits and misses.
+	char* names[] = { "a", "b", "i", "x", "y", "z", "aa", "ab" };
+	s = get_systime();
+	for (int i = 0; i < NUM_SMALL_MAPS; i++) {
+		lhmsv_t* pmap = lhmsv_alloc();
+		for (int j = 0; j < 5; j++)
+			lhmsv_put(pmap, names[j], names[j], NO_FREE);
+		for (int j = 0; j < 8; j++)
+			sink += lhmsv_get(pmap, names[j]) != NULL;
+		lhmsv_free(pmap);
+	}
+	e = get_systime();
+	printf("map=lhmsv,op=small_5_names,n=%d,t=%.6lf\n", NUM_SMALL_MAPS, e - s);
+}
+
+// ================================================================
+int main(int argc, char** argv) {
+	int nreps = 1;
+	if (argc > 2) {
+		fprintf(stderr, "Usage: %s [number of repetitions]\n", argv[0]);
+		exit(1);
+	}
+	if (argc == 2)
+		(void)sscanf(argv[1], "%d", &nreps);
+
+	char** keys   = mlr_malloc_or_die(NUM_KEYS * sizeof(char*));
+	char** misses = mlr_malloc_or_die(NUM_KEYS * sizeof(char*));
+	for (int i = 0; i < NUM_KEYS; i++) {
+		keys[i]   = mlr_alloc_string_from_ll(i);
+		misses[i] = mlr_paste_2_strings("m", keys[i]);
+	}
+
+	for (int i = 0; i < nreps; i++) {
+		bench_large(keys, misses);
+		bench_group_by(keys);
+		bench_small(keys);
+		fflush(stdout);
+	}
+
+	for (int i = 0; i < NUM_KEYS; i++) {
+		free(keys[i]);
+		free(misses[i]);
+	}
+	free(keys);
+	free(misses);
+	return sink == -1;
+}
@@ -44,7 +44,10 @@ file_reader_mmap_state_t* file_reader_mmap_open(char* prepipe, char* file_name)
 			exit(1);
 		}
 	}
+	pstate->sof = pstate->sol;
 	pstate->eof = pstate->sol + stat.st_size;
+	pstate->rsof = NULL;
+	pstate->rend = NULL;
 	// POSIX semantics: the mmap itself increments a reference count to the file, in addition to the
 	// open.  We close the file but keep the mmap reference until a subsequent munmap.
 	if (close(pstate->fd) < 0) {
@@ -65,6 +68,147 @@ void file_reader_mmap_close(file_reader_mmap_state_t* pstate, char* prepipe) {
 	free(pstate);
 }
 
+// ----------------------------------------------------------------
+// Separators such as ";;" can't be found scanning backward since matches may overlap, and the forward
+// parse takes the leftmost one.
+static int irs_has_border(char* irs, int irslen) {
+	for (int len = 1; len < irslen; len++)
+		if (memcmp(irs, irs + irslen - len, len) == 0)
+			return TRUE;
+	return FALSE;
+}
+
+static int irs_at(char* p, char* irs, int irslen) {
+	return *p == irs[0] && (irslen == 1 || memcmp(p, irs, irslen) == 0);
+}
+
+// Returns the first IRS in [p, end), or NULL if none.
+static char* find_irs(char* p, char* end, char* irs, int irslen) {
+	while (end - p >= irslen) {
+		char* q = memchr(p, irs[0], end - p - irslen + 1);
+		if (q == NULL)
+			return NULL;
+		if (irs_at(q, irs, irslen))
+			return q;
+		p = q + 1;
+	}
+	return NULL;
+}
+
+// Counts the IRSes in [p, end). This is much cheaper than parsing the records they terminate.
+static long long count_irses(char* p, char* end, char* irs, int irslen) {
+	long long count = 0LL;
+	for (char* q = find_irs(p, end, irs, irslen); q != NULL; q = find_irs(q + irslen, end, irs, irslen))
+		count++;
+	return count;
+}
+
+// A final IRS terminates the last record rather than starting an empty one.
+static char* end_of_records(file_reader_mmap_state_t* pstate, char* irs, int irslen) {
+	char* end = pstate->eof;
+	if (end - pstate->sol >= irslen && irs_at(end - irslen, irs, irslen))
+		end -= irslen;
+	return end;
+}
+
+long long file_reader_mmap_skip_to_last_records(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	unsigned long long count)
+{
+	MLR_INTERNAL_CODING_ERROR_IF(count == 0LL);
+	if (irslen < 1 || irs_has_border(irs, irslen))
+		return -1LL;
+
+	char* end = end_of_records(pstate, irs, irslen);
+
+	long long num_skipped = 0LL;
+	unsigned long long num_found = 0LL;
+	for (char* p = end - irslen; p >= pstate->sol; p--) {
+		if (irs_at(p, irs, irslen) && ++num_found == count) {
+			num_skipped = count_irses(pstate->sol, p + irslen, irs, irslen);
+			pstate->sol = p + irslen;
+			break;
+		}
+	}
+	return num_skipped;
+}
+
+// ----------------------------------------------------------------
+// Any bytes before end of file make a record, as for the parsers.
+long long file_reader_mmap_skip_records(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	unsigned long long count)
+{
+	long long num_skipped = 0LL;
+	while (num_skipped < count && pstate->sol < pstate->eof) {
+		char* q = find_irs(pstate->sol, pstate->eof, irs, irslen);
+		pstate->sol = (q == NULL) ? pstate->eof : q + irslen;
+		num_skipped++;
+	}
+	return num_skipped;
+}
+
+// ----------------------------------------------------------------
+long long file_reader_mmap_start_reverse(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	int disallow_empty)
+{
+	if (irslen < 1 || irs_has_border(irs, irslen))
+		return -1LL;
+	pstate->rsof = pstate->sol;
+	pstate->rend = NULL;
+	if (pstate->sol >= pstate->eof)
+		return 0LL;
+
+	char* end = end_of_records(pstate, irs, irslen);
+	long long num_records = 0LL;
+	char* p = pstate->sol;
+	while (TRUE) {
+		char* q = find_irs(p, end, irs, irslen);
+		if (disallow_empty && (q == NULL ? end : q) == p)
+			return -1LL;
+		num_records++;
+		if (q == NULL)
+			break;
+		p = q + irslen;
+	}
+	pstate->rend = end;
+	return num_records;
+}
+
+// Only the region before rend is scanned. The parser writes NULs only within the records it has been given
+// and at their terminating IRSes, which come after that region.
+int file_reader_mmap_prev_record(file_reader_mmap_state_t* pstate, char* irs, int irslen) {
+	if (pstate->rend == NULL)
+		return FALSE;
+	char* start = pstate->rsof;
+	for (char* p = pstate->rend - irslen; p >= pstate->rsof; p--) {
+		if (irs_at(p, irs, irslen)) {
+			start = p + irslen;
+			break;
+		}
+	}
+	pstate->sol = start;
+	pstate->rend = (start == pstate->rsof) ? NULL : start - irslen;
+	return TRUE;
+}
+
+// ----------------------------------------------------------------
+int file_reader_mmap_irs_is_unambiguous(char* irs, int irslen) {
+	return irslen >= 1 && !irs_has_border(irs, irslen);
+}
+
+// A record starts at p if p is the start of file or just after an IRS. The bytes searched haven't been given
+// to the parser yet, so they are as in the file.
+void file_reader_mmap_seek_record(file_reader_mmap_state_t* pstate, char* p, char* irs, int irslen) {
+	if (p <= pstate->sol)
+		return;
+	if (p >= pstate->eof) {
+		pstate->sol = pstate->eof;
+		return;
+	}
+	char* from = (p - pstate->sol >= irslen) ? p - irslen : pstate->sol;
+	char* q = find_irs(from, pstate->eof, irs, irslen);
+	pstate->sol = (q == NULL) ? pstate->eof : q + irslen;
+}
+
 // ----------------------------------------------------------------
 void* file_reader_mmap_vopen(void* pvstate, char* prepipe, char* file_name) {
 	return file_reader_mmap_open(prepipe, file_name);
@@ -74,3 +218,16 @@ void* file_reader_mmap_vopen(void* pvstate, char* prepipe, char* file_name) {
 void file_reader_mmap_vclose(void* pvstate, void* pvhandle, char* prepipe) {
 	file_reader_mmap_close(pvhandle, prepipe);
 }
+
+// The caller guarantees that no records from the file remain, so the reason for not unmapping in
+// file_reader_mmap_close doesn't apply. Else the pages the parser wrote to would stay in memory.
+void file_reader_mmap_vrelease(void* pvstate, void* pvhandle, char* prepipe) {
+	file_reader_mmap_state_t* pstate = pvhandle;
+	if (pstate->eof > pstate->sof) {
+		if (munmap(pstate->sof, pstate->eof - pstate->sof) < 0) {
+			perror("munmap");
+			exit(1);
+		}
+	}
+	file_reader_mmap_close(pstate, prepipe);
+}
@@ -6,15 +6,50 @@
 #define FILE_READER_MMAP_H
 
 typedef struct _file_reader_mmap_state_t {
+	char* sof;
 	char* sol;
 	char* eof;
 	int   fd;
+	char* rsof; // For reverse iteration: start of the first record
+	char* rend; // For reverse iteration: end of the records not yet read, or NULL when all have been
 } file_reader_mmap_state_t;
 
 file_reader_mmap_state_t* file_reader_mmap_open(char* prepipe, char* file_name);
 void file_reader_mmap_close(file_reader_mmap_state_t* pstate, char* prepipe);
 
+// For readers whose records are each terminated by the IRS, e.g. DKVP and NIDX: advances the handle past all
+// but the last count records, scanning backward from the end of the file, so that only those need parsing.
+// The count must be positive. Returns the number of records skipped, or -1 if the IRS isn't unambiguous when
+// scanning backward, i.e. some proper prefix of it equals a suffix, such as ";;".
+long long file_reader_mmap_skip_to_last_records(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	unsigned long long count);
+
+// Advances the handle past the next count records, for readers whose records are each terminated by the IRS,
+// without parsing them, e.g. for mlr sample. Returns the number skipped, which is less than count only at end
+// of file.
+long long file_reader_mmap_skip_records(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	unsigned long long count);
+
+// Reverse iteration over the records from the current position to end of file, for readers whose records
+// are each terminated by the IRS, e.g. mlr tac. Returns the number of records, or -1 as above, or if
+// disallow_empty is set and some record is empty, e.g. a CSV-lite schema change. Then each call to
+// file_reader_mmap_prev_record sets sol to the start of the previous record, for the reader's usual parser,
+// returning FALSE when there are no more.
+long long file_reader_mmap_start_reverse(file_reader_mmap_state_t* pstate, char* irs, int irslen,
+	int disallow_empty);
+int file_reader_mmap_prev_record(file_reader_mmap_state_t* pstate, char* irs, int irslen);
+
+// Whether records can be found by searching for the IRS from an arbitrary position, as for
+// file_reader_mmap_seek_record: false if some proper prefix of it equals a suffix, as above.
+int file_reader_mmap_irs_is_unambiguous(char* irs, int irslen);
+// Advances the handle to the first record starting at or after p, for readers whose records are each
+// terminated by an unambiguous IRS, e.g. for block-sampled reading with --sample-fraction.
+void file_reader_mmap_seek_record(file_reader_mmap_state_t* pstate, char* p, char* irs, int irslen);
+
 void* file_reader_mmap_vopen(void* pvstate, char* prepipe, char* file_name);
 void file_reader_mmap_vclose(void* pvstate, void* pvhandle, char* prepipe);
+// Closes and unmaps, for readers whose records point into the mapping but which keep nothing else there
+// across records, e.g. DKVP and NIDX but not CSV-lite with its header.
+void file_reader_mmap_vrelease(void* pvstate, void* pvhandle, char* prepipe);
 
 #endif // FILE_READER_MMAP_H
@@ -14,6 +14,20 @@ typedef void    lrec_reader_close_func_t(void* pvstate, void* pvhandle, char* pr
 typedef lrec_t* lrec_reader_process_func_t(void* pvstate, void* pvhandle, context_t* pctx);
 typedef void    lrec_reader_sof_func_t(void* pvstate, void* pvhandle);
 typedef void    lrec_reader_free_func_t(struct _lrec_reader_t* preader);
+// Positions an opened handle so that only the last count records remain to be read, e.g. for mlr tail.
+// Returns the number of records skipped, or -1 if the handle can't be so positioned.
+typedef long long lrec_reader_skip_func_t(void* pvstate, void* pvhandle, unsigned long long count);
+// Skips past the next count records without parsing them, e.g. for mlr sample, returning the number skipped,
+// which is less than count only at end of input.
+typedef long long lrec_reader_advance_func_t(void* pvstate, void* pvhandle, unsigned long long count);
+// Prepares an opened handle for reading its records last to first, e.g. for mlr tac, returning the number
+// of records, or -1 if the handle can't be so read. Each call to the prev function then positions the handle
+// at the previous record, for the process function to read, returning FALSE when there are no more.
+typedef long long lrec_reader_start_reverse_func_t(void* pvstate, void* pvhandle, context_t* pctx);
+typedef int       lrec_reader_prev_func_t(void* pvstate, void* pvhandle);
+// Closes a handle once all the records read from it have been freed, also freeing what they were read into,
+// e.g. unmapping an mmapped file, for the stream driver's first pass of two-pass reading.
+typedef void      lrec_reader_release_func_t(void* pvstate, void* pvhandle, char* prepipe);
 
 typedef struct _lrec_reader_t {
 	void*                       pvstate;
@@ -22,6 +36,11 @@ typedef struct _lrec_reader_t {
 	lrec_reader_process_func_t* pprocess_func;
 	lrec_reader_sof_func_t*     psof_func;
 	lrec_reader_free_func_t*    pfree_func; // virtual destructor
+	lrec_reader_skip_func_t*    pskip_func; // NULL if unsupported
+	lrec_reader_advance_func_t* padvance_func; // NULL if unsupported
+	lrec_reader_start_reverse_func_t* pstart_reverse_func; // NULL if unsupported
+	lrec_reader_prev_func_t*    pprev_func;
+	lrec_reader_release_func_t* prelease_func; // NULL if unsupported, or the same as closing
 } lrec_reader_t;
 
 #endif // LREC_READER_H
@@ -115,6 +115,11 @@ lrec_reader_t* lrec_reader_mmap_csv_alloc(char* irs, char* ifs, int use_implicit
 	plrec_reader->pprocess_func = lrec_reader_mmap_csv_process;
 	plrec_reader->psof_func     = lrec_reader_mmap_csv_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_csv_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = NULL;
+	plrec_reader->pprev_func    = NULL;
+	plrec_reader->prelease_func = file_reader_mmap_vrelease;
 
 	return plrec_reader;
 }
@@ -172,8 +177,12 @@ static lrec_t* lrec_reader_mmap_csv_process(void* pvstate, void* pvhandle, conte
 
 		pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
 		if (pstate->pheader_keeper == NULL) {
-			pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_fields);
-			lhmslv_put(pstate->pheader_keepers, pheader_fields, pstate->pheader_keeper,
+			// The names are copied out of the mapping so that it can be released after a first pass over the file:
+			// see file_reader_mmap_vrelease.
+			slls_t* pheader_names = slls_copy(pheader_fields);
+			slls_free(pheader_fields);
+			pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_names);
+			lhmslv_put(pstate->pheader_keepers, pheader_names, pstate->pheader_keeper,
 				NO_FREE); // freed by header-keeper
 		} else { // Re-use the header-keeper in the header cache
 			slls_free(pheader_fields);
@@ -362,5 +371,6 @@ static lrec_t* paste_header_and_data(lrec_reader_mmap_csv_state_t* pstate, rslls
 		lrec_put_ext(prec, ph->value, pd->value, pd->free_flag, pd->quote_flag);
 		pd->free_flag = 0;
 	}
+	lrec_stamp_header_schema(prec, pstate->pheader_keeper);
 	return prec;
 }
@@ -40,10 +40,17 @@ typedef struct _lrec_reader_mmap_csvlite_state_t {
 	int  expect_header_line_next;
 	header_keeper_t* pheader_keeper;
 	lhmslv_t*     pheader_keepers;
+
+	long long  reverse_header_ilno; // For reverse iteration: line number of the header
+	long long  reverse_num_left;    // For reverse iteration: records not yet read
 } lrec_reader_mmap_csvlite_state_t;
 
 static void    lrec_reader_mmap_csvlite_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_csvlite_sof(void* pvstate, void* pvhandle);
+static long long lrec_reader_mmap_csvlite_start_reverse(void* pvstate, void* pvhandle, context_t* pctx);
+static int     lrec_reader_mmap_csvlite_prev(void* pvstate, void* pvhandle);
+static void    lrec_reader_mmap_csvlite_use_header(lrec_reader_mmap_csvlite_state_t* pstate,
+	slls_t* pheader_fields, context_t* pctx);
 static lrec_t* lrec_reader_mmap_csvlite_process_single_seps(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_csvlite_process_multi_seps(void* pvstate, void* pvhandle, context_t* pctx);
 
@@ -81,6 +88,8 @@ lrec_reader_t* lrec_reader_mmap_csvlite_alloc(char* irs, char* ifs, int allow_re
 	pstate->expect_header_line_next  = use_implicit_header ? FALSE : TRUE;
 	pstate->pheader_keeper           = NULL;
 	pstate->pheader_keepers          = lhmslv_alloc();
+	pstate->reverse_header_ilno      = 0LL;
+	pstate->reverse_num_left         = 0LL;
 
 	plrec_reader->pvstate       = (void*)pstate;
 	plrec_reader->popen_func    = file_reader_mmap_vopen;
@@ -92,6 +101,11 @@ lrec_reader_t* lrec_reader_mmap_csvlite_alloc(char* irs, char* ifs, int allow_re
 
 	plrec_reader->psof_func     = lrec_reader_mmap_csvlite_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_csvlite_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = lrec_reader_mmap_csvlite_start_reverse;
+	plrec_reader->pprev_func    = lrec_reader_mmap_csvlite_prev;
+	plrec_reader->prelease_func = file_reader_mmap_vrelease;
 
 	return plrec_reader;
 }
@@ -115,6 +129,62 @@ static void lrec_reader_mmap_csvlite_sof(void* pvstate, void* pvhandle) {
 	pstate->expect_header_line_next = pstate->use_implicit_header ? FALSE : TRUE;
 }
 
+// ----------------------------------------------------------------
+// Reverse iteration, e.g. for mlr tac, needs a single header: a blank line, for a schema change, anywhere in
+// the data makes it decline, and the caller reads forward from just past the header.
+static long long lrec_reader_mmap_csvlite_start_reverse(void* pvstate, void* pvhandle, context_t* pctx) {
+	file_reader_mmap_state_t* phandle = pvhandle;
+	lrec_reader_mmap_csvlite_state_t* pstate = pvstate;
+
+	if (pstate->expect_header_line_next) {
+		slls_t* pheader_fields = (pstate->irslen == 1 && pstate->ifslen == 1)
+			? lrec_reader_mmap_csvlite_get_header_single_seps(phandle, pstate)
+			: lrec_reader_mmap_csvlite_get_header_multi_seps(phandle, pstate);
+		lrec_reader_mmap_csvlite_use_header(pstate, pheader_fields, pctx);
+	}
+
+	pstate->reverse_header_ilno = pstate->ilno;
+	pstate->reverse_num_left = file_reader_mmap_start_reverse(phandle, pstate->irs, pstate->irslen, TRUE);
+	return pstate->reverse_num_left;
+}
+
+// The line number is set as it would be reading forward, for error messages.
+static int lrec_reader_mmap_csvlite_prev(void* pvstate, void* pvhandle) {
+	lrec_reader_mmap_csvlite_state_t* pstate = pvstate;
+	if (!file_reader_mmap_prev_record(pvhandle, pstate->irs, pstate->irslen))
+		return FALSE;
+	pstate->reverse_num_left--;
+	pstate->ilno = pstate->reverse_header_ilno + pstate->reverse_num_left;
+	return TRUE;
+}
+
+// ----------------------------------------------------------------
+static void lrec_reader_mmap_csvlite_use_header(lrec_reader_mmap_csvlite_state_t* pstate,
+	slls_t* pheader_fields, context_t* pctx)
+{
+	for (sllse_t* pe = pheader_fields->phead; pe != NULL; pe = pe->pnext) {
+		if (*pe->value == 0) {
+			fprintf(stderr, "%s: unacceptable empty CSV key at file \"%s\" line %lld.\n",
+				MLR_GLOBALS.bargv0, pctx->filename, pstate->ilno);
+			exit(1);
+		}
+	}
+
+	pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
+	if (pstate->pheader_keeper == NULL) {
+		// The names are copied out of the mapping so that it can be released after a first pass over the file:
+		// see file_reader_mmap_vrelease.
+		slls_t* pheader_names = slls_copy(pheader_fields);
+		slls_free(pheader_fields);
+		pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_names);
+		lhmslv_put(pstate->pheader_keepers, pheader_names, pstate->pheader_keeper,
+			NO_FREE); // freed by header-keeper
+	} else { // Re-use the header-keeper in the header cache
+		slls_free(pheader_fields);
+	}
+	pstate->expect_header_line_next = FALSE;
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_mmap_csvlite_process_single_seps(void* pvstate, void* pvhandle, context_t* pctx) {
 	file_reader_mmap_state_t* phandle = pvhandle;
@@ -127,24 +197,7 @@ static lrec_t* lrec_reader_mmap_csvlite_process_single_seps(void* pvstate, void*
 			if (pheader_fields == NULL) { // EOF
 				return NULL;
 			}
-
-			for (sllse_t* pe = pheader_fields->phead; pe != NULL; pe = pe->pnext) {
-				if (*pe->value == 0) {
-					fprintf(stderr, "%s: unacceptable empty CSV key at file \"%s\" line %lld.\n",
-						MLR_GLOBALS.bargv0, pctx->filename, pstate->ilno);
-					exit(1);
-				}
-			}
-
-			pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
-			if (pstate->pheader_keeper == NULL) {
-				pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_fields);
-				lhmslv_put(pstate->pheader_keepers, pheader_fields, pstate->pheader_keeper,
-					NO_FREE); // freed by header-keeper
-			} else { // Re-use the header-keeper in the header cache
-				slls_free(pheader_fields);
-			}
-			pstate->expect_header_line_next = FALSE;
+			lrec_reader_mmap_csvlite_use_header(pstate, pheader_fields, pctx);
 		}
 
 		int end_of_stanza = FALSE;
@@ -173,24 +226,7 @@ static lrec_t* lrec_reader_mmap_csvlite_process_multi_seps(void* pvstate, void*
 			slls_t* pheader_fields = lrec_reader_mmap_csvlite_get_header_multi_seps(phandle, pstate);
 			if (pheader_fields == NULL) // EOF
 				return NULL;
-
-			for (sllse_t* pe = pheader_fields->phead; pe != NULL; pe = pe->pnext) {
-				if (*pe->value == 0) {
-					fprintf(stderr, "%s: unacceptable empty CSV key at file \"%s\" line %lld.\n",
-						MLR_GLOBALS.bargv0, pctx->filename, pstate->ilno);
-					exit(1);
-				}
-			}
-
-			pstate->pheader_keeper = lhmslv_get(pstate->pheader_keepers, pheader_fields);
-			if (pstate->pheader_keeper == NULL) {
-				pstate->pheader_keeper = header_keeper_alloc(NULL, pheader_fields);
-				lhmslv_put(pstate->pheader_keepers, pheader_fields, pstate->pheader_keeper,
-					NO_FREE); // freed by header-keeper
-			} else { // Re-use the header-keeper in the header cache
-				slls_free(pheader_fields);
-			}
-			pstate->expect_header_line_next = FALSE;
+			lrec_reader_mmap_csvlite_use_header(pstate, pheader_fields, pctx);
 		}
 
 		int end_of_stanza = FALSE;
@@ -409,6 +445,7 @@ static lrec_t* lrec_reader_mmap_csvlite_get_record_single_seps(file_reader_mmap_
 		exit(1);
 	}
 
+	lrec_stamp_header_schema(prec, pheader_keeper);
 	return prec;
 }
 
@@ -502,6 +539,7 @@ static lrec_t* lrec_reader_mmap_csvlite_get_record_multi_seps(file_reader_mmap_s
 		exit(1);
 	}
 
+	lrec_stamp_header_schema(prec, pheader_keeper);
 	return prec;
 }
 
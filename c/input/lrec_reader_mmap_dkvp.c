@@ -17,6 +17,10 @@ typedef struct _lrec_reader_mmap_dkvp_state_t {
 
 static void    lrec_reader_mmap_dkvp_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_dkvp_sof(void* pvstate, void* pvhandle);
+static long long lrec_reader_mmap_dkvp_skip(void* pvstate, void* pvhandle, unsigned long long count);
+static long long lrec_reader_mmap_dkvp_advance(void* pvstate, void* pvhandle, unsigned long long count);
+static long long lrec_reader_mmap_dkvp_start_reverse(void* pvstate, void* pvhandle, context_t* pctx);
+static int     lrec_reader_mmap_dkvp_prev(void* pvstate, void* pvhandle);
 static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_multi_others(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_dkvp_process_multi_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx);
@@ -49,6 +53,11 @@ lrec_reader_t* lrec_reader_mmap_dkvp_alloc(char* irs, char* ifs, char* ips, int
 	}
 	plrec_reader->psof_func   = lrec_reader_mmap_dkvp_sof;
 	plrec_reader->pfree_func  = lrec_reader_mmap_dkvp_free;
+	plrec_reader->pskip_func  = lrec_reader_mmap_dkvp_skip;
+	plrec_reader->padvance_func = lrec_reader_mmap_dkvp_advance;
+	plrec_reader->pstart_reverse_func = lrec_reader_mmap_dkvp_start_reverse;
+	plrec_reader->pprev_func  = lrec_reader_mmap_dkvp_prev;
+	plrec_reader->prelease_func = file_reader_mmap_vrelease;
 
 	return plrec_reader;
 }
@@ -62,6 +71,28 @@ static void lrec_reader_mmap_dkvp_free(lrec_reader_t* preader) {
 static void lrec_reader_mmap_dkvp_sof(void* pvstate, void* pvhandle) {
 }
 
+// Each record is one line, so the last ones are found by scanning backward for IRSes, as are the records
+// in reverse order.
+static long long lrec_reader_mmap_dkvp_skip(void* pvstate, void* pvhandle, unsigned long long count) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	return file_reader_mmap_skip_to_last_records(pvhandle, pstate->irs, pstate->irslen, count);
+}
+
+static long long lrec_reader_mmap_dkvp_advance(void* pvstate, void* pvhandle, unsigned long long count) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	return file_reader_mmap_skip_records(pvhandle, pstate->irs, pstate->irslen, count);
+}
+
+static long long lrec_reader_mmap_dkvp_start_reverse(void* pvstate, void* pvhandle, context_t* pctx) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	return file_reader_mmap_start_reverse(pvhandle, pstate->irs, pstate->irslen, FALSE);
+}
+
+static int lrec_reader_mmap_dkvp_prev(void* pvstate, void* pvhandle) {
+	lrec_reader_mmap_dkvp_state_t* pstate = pvstate;
+	return file_reader_mmap_prev_record(pvhandle, pstate->irs, pstate->irslen);
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_mmap_dkvp_process_single_irs_single_others(void* pvstate, void* pvhandle, context_t* pctx) {
 	file_reader_mmap_state_t* phandle = pvhandle;
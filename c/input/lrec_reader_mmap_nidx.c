@@ -13,6 +13,10 @@ typedef struct _lrec_reader_mmap_nidx_state_t {
 
 static void    lrec_reader_mmap_nidx_free(lrec_reader_t* preader);
 static void    lrec_reader_mmap_nidx_sof(void* pvstate, void* pvhandle);
+static long long lrec_reader_mmap_nidx_skip(void* pvstate, void* pvhandle, unsigned long long count);
+static long long lrec_reader_mmap_nidx_advance(void* pvstate, void* pvhandle, unsigned long long count);
+static long long lrec_reader_mmap_nidx_start_reverse(void* pvstate, void* pvhandle, context_t* pctx);
+static int     lrec_reader_mmap_nidx_prev(void* pvstate, void* pvhandle);
 static lrec_t* lrec_reader_mmap_nidx_process_single_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_nidx_process_single_irs_multi_ifs(void* pvstate, void* pvhandle, context_t* pctx);
 static lrec_t* lrec_reader_mmap_nidx_process_multi_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx);
@@ -45,6 +49,11 @@ lrec_reader_t* lrec_reader_mmap_nidx_alloc(char* irs, char* ifs, int allow_repea
 
 	plrec_reader->psof_func     = lrec_reader_mmap_nidx_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_nidx_free;
+	plrec_reader->pskip_func    = lrec_reader_mmap_nidx_skip;
+	plrec_reader->padvance_func = lrec_reader_mmap_nidx_advance;
+	plrec_reader->pstart_reverse_func = lrec_reader_mmap_nidx_start_reverse;
+	plrec_reader->pprev_func    = lrec_reader_mmap_nidx_prev;
+	plrec_reader->prelease_func = file_reader_mmap_vrelease;
 
 	return plrec_reader;
 }
@@ -58,6 +67,28 @@ static void lrec_reader_mmap_nidx_free(lrec_reader_t* preader) {
 static void lrec_reader_mmap_nidx_sof(void* pvstate, void* pvhandle) {
 }
 
+// Each record is one line, so the last ones are found by scanning backward for IRSes, as are the records
+// in reverse order.
+static long long lrec_reader_mmap_nidx_skip(void* pvstate, void* pvhandle, unsigned long long count) {
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	return file_reader_mmap_skip_to_last_records(pvhandle, pstate->irs, pstate->irslen, count);
+}
+
+static long long lrec_reader_mmap_nidx_advance(void* pvstate, void* pvhandle, unsigned long long count) {
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	return file_reader_mmap_skip_records(pvhandle, pstate->irs, pstate->irslen, count);
+}
+
+static long long lrec_reader_mmap_nidx_start_reverse(void* pvstate, void* pvhandle, context_t* pctx) {
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	return file_reader_mmap_start_reverse(pvhandle, pstate->irs, pstate->irslen, FALSE);
+}
+
+static int lrec_reader_mmap_nidx_prev(void* pvstate, void* pvhandle) {
+	lrec_reader_mmap_nidx_state_t* pstate = pvstate;
+	return file_reader_mmap_prev_record(pvhandle, pstate->irs, pstate->irslen);
+}
+
 // ----------------------------------------------------------------
 static lrec_t* lrec_reader_mmap_nidx_process_single_irs_single_ifs(void* pvstate, void* pvhandle, context_t* pctx) {
 	file_reader_mmap_state_t* phandle = pvhandle;
@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lib/mlr_globals.h"
+#include "lib/mlrutil.h"
+#include "lib/mtrand.h"
+#include "input/file_reader_mmap.h"
+#include "input/lrec_readers.h"
+
+// ----------------------------------------------------------------
+// lrec_reader_t impl for --sample-fraction: wraps an mmap reader whose records are each terminated by the IRS,
+// e.g. DKVP or NIDX, reading only the records which start in randomly selected blocks of the file. Each block
+// is selected independently with probability equal to the fraction, so each record is included with that
+// probability, and the blocks in between are never paged in. A record is read in full even if it runs past
+// the end of its block; a record starting mid-block is found by seeking from the block start to just after
+// the next IRS.
+//
+// This is for approximate answers over large files, at the cost of records in the same block being sampled
+// together rather than independently.
+// ================================================================
+
+#define LREC_READER_MMAP_SAMPLED_BLOCK_SIZE (64LL * 1024LL)
+// Caps the geometric gap for tiny fractions; any gap past end of file is the same.
+#define LREC_READER_MMAP_SAMPLED_MAX_GAP    1e15
+
+typedef struct _lrec_reader_mmap_sampled_state_t {
+	lrec_reader_t* pinner;
+	double         log_complement; // log(1 - sample_fraction)
+	char*          irs;
+	int            irslen;
+	char*          sof;
+	long long      block_end;      // Offset from start of file of the end of the current block
+} lrec_reader_mmap_sampled_state_t;
+
+static void    lrec_reader_mmap_sampled_free(lrec_reader_t* preader);
+static void    lrec_reader_mmap_sampled_sof(void* pvstate, void* pvhandle);
+static lrec_t* lrec_reader_mmap_sampled_process(void* pvstate, void* pvhandle, context_t* pctx);
+static void*   lrec_reader_mmap_sampled_vopen(void* pvstate, char* prepipe, char* filename);
+static void    lrec_reader_mmap_sampled_vclose(void* pvstate, void* pvhandle, char* prepipe);
+
+// ----------------------------------------------------------------
+lrec_reader_t* lrec_reader_mmap_sampled_alloc(lrec_reader_t* pinner, double sample_fraction, char* irs) {
+	MLR_INTERNAL_CODING_ERROR_IF(sample_fraction <= 0.0 || sample_fraction >= 1.0);
+	lrec_reader_t* plrec_reader = mlr_malloc_or_die(sizeof(lrec_reader_t));
+
+	lrec_reader_mmap_sampled_state_t* pstate = mlr_malloc_or_die(sizeof(lrec_reader_mmap_sampled_state_t));
+	pstate->pinner         = pinner;
+	pstate->log_complement = log1p(-sample_fraction);
+	pstate->irs            = irs;
+	pstate->irslen         = strlen(irs);
+	pstate->sof            = NULL;
+	pstate->block_end      = 0LL;
+
+	if (!file_reader_mmap_irs_is_unambiguous(pstate->irs, pstate->irslen)) {
+		fprintf(stderr, "%s: --sample-fraction needs a record separator which can't overlap itself,\n",
+			MLR_GLOBALS.bargv0);
+		fprintf(stderr, "e.g. LF or CRLF, so that records can be found from mid-file.\n");
+		exit(1);
+	}
+
+	plrec_reader->pvstate       = (void*)pstate;
+	plrec_reader->popen_func    = lrec_reader_mmap_sampled_vopen;
+	plrec_reader->pclose_func   = lrec_reader_mmap_sampled_vclose;
+	plrec_reader->pprocess_func = lrec_reader_mmap_sampled_process;
+	plrec_reader->psof_func     = lrec_reader_mmap_sampled_sof;
+	plrec_reader->pfree_func    = lrec_reader_mmap_sampled_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = NULL;
+	plrec_reader->pprev_func    = NULL;
+	plrec_reader->prelease_func = NULL;
+
+	return plrec_reader;
+}
+
+static void lrec_reader_mmap_sampled_free(lrec_reader_t* preader) {
+	lrec_reader_mmap_sampled_state_t* pstate = preader->pvstate;
+	pstate->pinner->pfree_func(pstate->pinner);
+	free(pstate);
+	free(preader);
+}
+
+static void lrec_reader_mmap_sampled_sof(void* pvstate, void* pvhandle) {
+	lrec_reader_mmap_sampled_state_t* pstate = pvstate;
+	file_reader_mmap_state_t* phandle = pvhandle;
+	pstate->sof       = phandle->sol;
+	pstate->block_end = 0LL;
+	pstate->pinner->psof_func(pstate->pinner->pvstate, pvhandle);
+}
+
+// ----------------------------------------------------------------
+// The number of unselected blocks before the next selected one is geometric; drawing it directly costs one
+// random number per selected block rather than one per block.
+static long long lrec_reader_mmap_sampled_draw_gap(lrec_reader_mmap_sampled_state_t* pstate) {
+	double u = 1.0 - get_mtrand_double(); // In (0,1]
+	double gap = floor(log(u) / pstate->log_complement);
+	return (gap > LREC_READER_MMAP_SAMPLED_MAX_GAP) ? (long long)LREC_READER_MMAP_SAMPLED_MAX_GAP : (long long)gap;
+}
+
+static lrec_t* lrec_reader_mmap_sampled_process(void* pvstate, void* pvhandle, context_t* pctx) {
+	lrec_reader_mmap_sampled_state_t* pstate = pvstate;
+	file_reader_mmap_state_t* phandle = pvhandle;
+	long long file_size = phandle->eof - pstate->sof;
+
+	while (phandle->sol - pstate->sof >= pstate->block_end) {
+		long long gap = lrec_reader_mmap_sampled_draw_gap(pstate);
+		long long blocks_left = (file_size - pstate->block_end) / LREC_READER_MMAP_SAMPLED_BLOCK_SIZE;
+		if (gap > blocks_left) {
+			phandle->sol = phandle->eof;
+			return NULL;
+		}
+		long long block_start = pstate->block_end + gap * LREC_READER_MMAP_SAMPLED_BLOCK_SIZE;
+		pstate->block_end = block_start + LREC_READER_MMAP_SAMPLED_BLOCK_SIZE;
+		file_reader_mmap_seek_record(phandle, pstate->sof + block_start, pstate->irs, pstate->irslen);
+	}
+	if (phandle->sol >= phandle->eof)
+		return NULL;
+	return pstate->pinner->pprocess_func(pstate->pinner->pvstate, pvhandle, pctx);
+}
+
+// ----------------------------------------------------------------
+static void* lrec_reader_mmap_sampled_vopen(void* pvstate, char* prepipe, char* filename) {
+	lrec_reader_mmap_sampled_state_t* pstate = pvstate;
+	return pstate->pinner->popen_func(pstate->pinner->pvstate, prepipe, filename);
+}
+
+static void lrec_reader_mmap_sampled_vclose(void* pvstate, void* pvhandle, char* prepipe) {
+	lrec_reader_mmap_sampled_state_t* pstate = pvstate;
+	pstate->pinner->pclose_func(pstate->pinner->pvstate, pvhandle, prepipe);
+}
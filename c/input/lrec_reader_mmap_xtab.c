@@ -46,6 +46,11 @@ lrec_reader_t* lrec_reader_mmap_xtab_alloc(char* ifs, char* ips, int allow_repea
 
 	plrec_reader->psof_func     = lrec_reader_mmap_xtab_sof;
 	plrec_reader->pfree_func    = lrec_reader_mmap_xtab_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = NULL;
+	plrec_reader->pprev_func    = NULL;
+	plrec_reader->prelease_func = NULL;
 
 	return plrec_reader;
 }
@@ -77,6 +77,11 @@ lrec_reader_t* lrec_reader_stdio_csvlite_alloc(char* irs, char* ifs, int allow_r
 	plrec_reader->pprocess_func = lrec_reader_stdio_csvlite_process;
 	plrec_reader->psof_func     = lrec_reader_stdio_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_csvlite_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = NULL;
+	plrec_reader->pprev_func    = NULL;
+	plrec_reader->prelease_func = NULL;
 
 	return plrec_reader;
 }
@@ -302,6 +307,7 @@ lrec_t* lrec_parse_stdio_csvlite_data_line_single_ifs(header_keeper_t* pheader_k
 		}
 	}
 
+	lrec_stamp_header_schema(prec, pheader_keeper);
 	return prec;
 }
 
@@ -357,6 +363,7 @@ lrec_t* lrec_parse_stdio_csvlite_data_line_multi_ifs(header_keeper_t* pheader_ke
 		}
 	}
 
+	lrec_stamp_header_schema(prec, pheader_keeper);
 	return prec;
 }
 
@@ -47,6 +47,11 @@ lrec_reader_t* lrec_reader_stdio_json_alloc(char* input_json_flatten_separator)
 	plrec_reader->pprocess_func = lrec_reader_stdio_json_process;
 	plrec_reader->psof_func     = lrec_reader_stdio_json_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_json_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = NULL;
+	plrec_reader->pprev_func    = NULL;
+	plrec_reader->prelease_func = NULL;
 
 	return plrec_reader;
 }
@@ -44,6 +44,11 @@ lrec_reader_t* lrec_reader_stdio_nidx_alloc(char* irs, char* ifs, int allow_repe
 	}
 	plrec_reader->psof_func     = lrec_reader_stdio_nidx_sof;
 	plrec_reader->pfree_func    = lrec_reader_stdio_nidx_free;
+	plrec_reader->pskip_func    = NULL;
+	plrec_reader->padvance_func = NULL;
+	plrec_reader->pstart_reverse_func = NULL;
+	plrec_reader->pprev_func    = NULL;
+	plrec_reader->prelease_func = NULL;
 
 	return plrec_reader;
 }
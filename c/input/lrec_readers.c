@@ -3,7 +3,20 @@
 #include "input/lrec_readers.h"
 #include "input/byte_readers.h"
 
+static lrec_reader_t* lrec_reader_alloc_unsampled(cli_reader_opts_t* popts);
+
 lrec_reader_t*  lrec_reader_alloc(cli_reader_opts_t* popts) {
+	if (popts->sample_fraction >= 1.0)
+		return lrec_reader_alloc_unsampled(popts);
+	if (!popts->use_mmap_for_read || !(streq(popts->ifile_fmt, "dkvp") || streq(popts->ifile_fmt, "nidx"))) {
+		fprintf(stderr, "%s: --sample-fraction is supported only for DKVP or NIDX files read with mmap.\n",
+			MLR_GLOBALS.bargv0);
+		exit(1);
+	}
+	return lrec_reader_mmap_sampled_alloc(lrec_reader_alloc_unsampled(popts), popts->sample_fraction, popts->irs);
+}
+
+static lrec_reader_t* lrec_reader_alloc_unsampled(cli_reader_opts_t* popts) {
 	if (streq(popts->ifile_fmt, "dkvp")) {
 		if (popts->use_mmap_for_read)
 			return lrec_reader_mmap_dkvp_alloc(popts->irs, popts->ifs, popts->ips, popts->allow_repeat_ifs);
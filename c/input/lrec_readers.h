@@ -24,6 +24,9 @@ lrec_reader_t* lrec_reader_mmap_json_alloc(char* input_json_flatten_separator);
 
 lrec_reader_t* lrec_reader_in_memory_alloc(sllv_t* precords);
 
+// Wraps an mmap DKVP or NIDX reader for --sample-fraction, with the fraction in (0,1).
+lrec_reader_t* lrec_reader_mmap_sampled_alloc(lrec_reader_t* pinner, double sample_fraction, char* irs);
+
 // ----------------------------------------------------------------
 // These entry points are made public for unit test
 
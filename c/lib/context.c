@@ -2,10 +2,13 @@
 #include "lib/context.h"
 
 void context_init(context_t* pctx, char* first_file_name) {
-	pctx->nr       = 0;
-	pctx->fnr      = 0;
-	pctx->filenum  = 1;
-	pctx->filename = first_file_name;
+	pctx->nr          = 0;
+	pctx->fnr         = 0;
+	pctx->filenum     = 1;
+	pctx->filename    = first_file_name;
+	pctx->force_eof   = 0;
+	pctx->more_output = 0;
+	pctx->sample_rate = 1.0;
 }
 
 void context_print(context_t* pctx, char* indent) {
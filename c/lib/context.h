@@ -9,6 +9,12 @@ typedef struct _context_t {
 	int       filenum;
 	char*     filename;
 	int       force_eof; // e.g. mlr head
+	// Set by a mapper at end of stream to return its output in batches, e.g. mlr sort --max-memory merging
+	// spilled runs: the stream driver writes out each batch, then calls the mapper with null input again.
+	// Only for mappers which emit nothing before end of stream.
+	int       more_output;
+	// The fraction of input records read, with --sample-fraction; else 1. E.g. for mlr stats1 --scale.
+	double    sample_rate;
 } context_t;
 
 void context_init(context_t* pctx, char* first_file_name);
@@ -56,30 +56,35 @@ regex_t* regcomp_or_die(regex_t* pregex, char* regex_string, int cflags) {
 	return pregex;
 }
 
-// Always uses cflags with REG_EXTENDED.
-// If the regex_string is of the form a.*b, compiles it using cflags without REG_ICASE.
-// If the regex_string is of the form "a.*b", compiles a.*b using cflags without REG_ICASE.
-// If the regex_string is of the form "a.*b"i, compiles a.*b using cflags with REG_ICASE.
-regex_t* regcomp_or_die_quoted(regex_t* pregex, char* orig_regex_string, int cflags) {
-	cflags |= REG_EXTENDED;
-	if (string_starts_with(orig_regex_string, "\"")) {
-		char* regex_string = mlr_strdup_or_die(orig_regex_string);
+// Returns a newly allocated copy of the regex string, with the double quotes stripped off if it is of the
+// form "a.*b" or "a.*b"i. In the latter case, REG_ICASE is added to the cflags.
+static char* alloc_unquoted_regex_string(char* orig_regex_string, int* pcflags) {
+	char* regex_string = mlr_strdup_or_die(orig_regex_string);
+	if (string_starts_with(regex_string, "\"")) {
 		int len = 0;
 		if (string_ends_with(regex_string, "\"", &len)) {
 			regex_string[len-1] = 0;
 		} else if (string_ends_with(regex_string, "\"i", &len)) {
 			regex_string[len-2] = 0;
-			cflags |= REG_ICASE;
+			*pcflags |= REG_ICASE;
 		} else {
 			fprintf(stderr, "%s: imbalanced double-quote in regex [%s].\n",
 				MLR_GLOBALS.bargv0, regex_string);
 			exit(1);
 		}
-		regcomp_or_die(pregex, regex_string+1, cflags);
-		free(regex_string);
-	} else {
-		regcomp_or_die(pregex, orig_regex_string, cflags);
+		memmove(regex_string, regex_string+1, strlen(regex_string+1) + 1);
 	}
+	return regex_string;
+}
+
+// Always uses cflags with REG_EXTENDED.
+// If the regex_string is of the form a.*b, compiles it using cflags without REG_ICASE.
+// If the regex_string is of the form "a.*b", compiles a.*b using cflags without REG_ICASE.
+// If the regex_string is of the form "a.*b"i, compiles a.*b using cflags with REG_ICASE.
+regex_t* regcomp_or_die_quoted(regex_t* pregex, char* orig_regex_string, int cflags) {
+	char* regex_string = alloc_unquoted_regex_string(orig_regex_string, &cflags);
+	regcomp_or_die(pregex, regex_string, cflags);
+	free(regex_string);
 	return pregex;
 }
 
@@ -213,13 +218,29 @@ char* regex_gsub(char* input, regex_t* pregex, string_builder_t* psb, char* repl
 // matches[2].rm_so = -1, matches[2].rm_eo = -1
 //
 // pregex_captures->length = 2
-// pregex_captures->strings[0] = "abcde"
-// pregex_captures->strings[1] = "bcd"
+// pregex_captures->input = "abcde"
+// pregex_captures->offsets[0] = 0,5 for "abcde"
+// pregex_captures->offsets[1] = 1,4 for "bcd"
 //
-// Note that even if there is no match, a non-null zero-length regex-captures array is returned (by reference).
+// Note that even if there is no match, a non-null zero-length regex-captures is returned (by reference).
 // This is important: see the comments in mapper_put for details.
 
-void save_regex_captures(string_array_t** ppregex_captures, char* input, regmatch_t matches[], int nmatchmax) {
+static regex_captures_t* regex_captures_alloc() {
+	regex_captures_t* pregex_captures = mlr_malloc_or_die(sizeof(regex_captures_t));
+	pregex_captures->length = 0;
+	pregex_captures->input = NULL;
+	pregex_captures->input_alloc_length = 0;
+	return pregex_captures;
+}
+
+void regex_captures_free(regex_captures_t* pregex_captures) {
+	if (pregex_captures == NULL)
+		return;
+	free(pregex_captures->input);
+	free(pregex_captures);
+}
+
+void save_regex_captures(regex_captures_t** ppregex_captures, char* input, regmatch_t matches[], int nmatchmax) {
 	int match_count = nmatchmax; // In fully occupied case, there will be no slots with -1's
 	for (int i = 0; i < nmatchmax; i++) {
 		if (matches[i].rm_so == -1) {
@@ -227,34 +248,46 @@ void save_regex_captures(string_array_t** ppregex_captures, char* input, regmatc
 			break;
 		}
 	}
-	if (*ppregex_captures != NULL)
-		string_array_realloc(*ppregex_captures, match_count);
-	else
-		*ppregex_captures = string_array_alloc(match_count);
-	string_array_t* pregex_captures = *ppregex_captures;
+	if (match_count > REGEX_CAPTURES_MAX)
+		match_count = REGEX_CAPTURES_MAX;
+	if (*ppregex_captures == NULL)
+		*ppregex_captures = regex_captures_alloc();
+	regex_captures_t* pregex_captures = *ppregex_captures;
+
+	pregex_captures->length = match_count;
 	if (match_count >= 1) {
-		for (int i = 0; i < match_count; i++) {
-			int len = matches[i].rm_eo - matches[i].rm_so;
-			pregex_captures->strings[i] = mlr_alloc_string_from_char_range(&input[matches[i].rm_so], len);
+		// Only the prefix of the input through the end of the entire-string match is needed.
+		int input_length = matches[0].rm_eo;
+		if (input_length + 1 > pregex_captures->input_alloc_length) {
+			pregex_captures->input_alloc_length = input_length + 1;
+			pregex_captures->input = mlr_realloc_or_die(pregex_captures->input, pregex_captures->input_alloc_length);
 		}
-		pregex_captures->strings_need_freeing = TRUE;
+		memcpy(pregex_captures->input, input, input_length);
+		pregex_captures->input[input_length] = 0;
+		memcpy(pregex_captures->offsets, matches, match_count * sizeof(regmatch_t));
 	}
 }
 
+void save_regex_captures_no_match(regex_captures_t** ppregex_captures) {
+	if (*ppregex_captures == NULL)
+		*ppregex_captures = regex_captures_alloc();
+	(*ppregex_captures)->length = 0;
+}
+
 // ----------------------------------------------------------------
 // Using the above example:
 // Input "abcde"
 // Regex "a(.*)e"
 //
 // pregex_captures->length = 2
-// pregex_captures->strings[0] = "abcde"
-// pregex_captures->strings[1] = "bcd"
+// pregex_captures->offsets[0] = 0,5 for "abcde"
+// pregex_captures->offsets[1] = 1,4 for "bcd"
 //
 // "\0" should be replaced with "abcde".
 // "\1" should be replaced with "bcd".
 // "\2" through "\9" should be replaced with "".
 
-char* interpolate_regex_captures(char* input, string_array_t* pregex_captures, int* pwas_allocated) {
+char* interpolate_regex_captures(char* input, regex_captures_t* pregex_captures, int* pwas_allocated) {
 	*pwas_allocated = FALSE;
 
 	string_builder_t* psb = sb_alloc(32);
@@ -264,8 +297,10 @@ char* interpolate_regex_captures(char* input, string_array_t* pregex_captures, i
 		if (p[0] == '\\' && isdigit(p[1])) {
 			*pwas_allocated = TRUE;
 			int idx = p[1] - '0';
-			if (idx < pregex_captures->length)
-				sb_append_string(psb, pregex_captures->strings[idx]);
+			if (idx < pregex_captures->length) {
+				regmatch_t* pmatch = &pregex_captures->offsets[idx];
+				sb_append_chars(psb, pregex_captures->input, pmatch->rm_so, pmatch->rm_eo - 1);
+			}
 			p += 2;
 		} else {
 			sb_append_char(psb, *p);
@@ -282,3 +317,390 @@ char* interpolate_regex_captures(char* input, string_array_t* pregex_captures, i
 		return input;
 	}
 }
+
+// ----------------------------------------------------------------
+// Compiled-regex cache. Lookups first check the most recently used entry, since the common case is one
+// non-literal regex evaluated once per record; otherwise they scan the (small) table comparing hashes.
+// When the table is full, the least recently used entry is evicted.
+
+#define REGCACHE_CAPACITY 64
+
+typedef struct _regcache_entry_t {
+	char*              regex_string;
+	int                cflags;
+	int                hash;
+	unsigned long long last_used;
+	regex_t            regex;
+} regcache_entry_t;
+
+static regcache_entry_t regcache_entries[REGCACHE_CAPACITY];
+static int regcache_count = 0;
+static int regcache_mru_index = -1;
+static unsigned long long regcache_clock = 0LL;
+
+static int regcache_entry_matches(regcache_entry_t* pentry, char* regex_string, int cflags, int hash) {
+	return pentry->hash == hash && pentry->cflags == cflags && streq(pentry->regex_string, regex_string);
+}
+
+regex_t* regcache_get_or_die(char* regex_string, int cflags) {
+	int hash = mlr_string_hash_func(regex_string);
+	regcache_clock++;
+
+	if (regcache_mru_index >= 0) {
+		regcache_entry_t* pentry = &regcache_entries[regcache_mru_index];
+		if (regcache_entry_matches(pentry, regex_string, cflags, hash)) {
+			pentry->last_used = regcache_clock;
+			return &pentry->regex;
+		}
+	}
+
+	int lru_index = 0;
+	for (int i = 0; i < regcache_count; i++) {
+		regcache_entry_t* pentry = &regcache_entries[i];
+		if (regcache_entry_matches(pentry, regex_string, cflags, hash)) {
+			pentry->last_used = regcache_clock;
+			regcache_mru_index = i;
+			return &pentry->regex;
+		}
+		if (pentry->last_used < regcache_entries[lru_index].last_used)
+			lru_index = i;
+	}
+
+	regcache_entry_t* pentry = NULL;
+	if (regcache_count < REGCACHE_CAPACITY) {
+		regcache_mru_index = regcache_count++;
+		pentry = &regcache_entries[regcache_mru_index];
+	} else {
+		regcache_mru_index = lru_index;
+		pentry = &regcache_entries[regcache_mru_index];
+		free(pentry->regex_string);
+		regfree(&pentry->regex);
+	}
+	pentry->regex_string = mlr_strdup_or_die(regex_string);
+	pentry->cflags       = cflags;
+	pentry->hash         = hash;
+	pentry->last_used    = regcache_clock;
+	regcomp_or_die(&pentry->regex, regex_string, cflags);
+	return &pentry->regex;
+}
+
+// ================================================================
+// Literal analysis for fast_regex_t. This operates on the regex string as given by the user, before
+// double-backslashing: since regcomp_or_die doubles all backslashes, a backslash in the user's regex
+// string is always a literal backslash, and all other ERE metacharacters are unescaped.
+// ================================================================
+
+// Given the index of a '[', returns the index just after the matching ']', or -1 if there is none.
+static int fast_regex_skip_bracket(char* s, int i, int end) {
+	int j = i + 1;
+	if (j < end && s[j] == '^')
+		j++;
+	if (j < end && s[j] == ']')
+		j++;
+	while (j < end) {
+		if (s[j] == '[' && j+1 < end && (s[j+1] == ':' || s[j+1] == '.' || s[j+1] == '=')) {
+			char delimiter = s[j+1];
+			j += 2;
+			while (j+1 < end && !(s[j] == delimiter && s[j+1] == ']'))
+				j++;
+			if (j+1 >= end)
+				return -1;
+			j += 2;
+		} else if (s[j] == ']') {
+			return j + 1;
+		} else {
+			j++;
+		}
+	}
+	return -1;
+}
+
+// Given the index of a '(', returns the index just after the matching ')', or -1 if there is none.
+static int fast_regex_skip_group(char* s, int i, int end) {
+	int depth = 0;
+	int j = i;
+	while (j < end) {
+		if (s[j] == '[') {
+			j = fast_regex_skip_bracket(s, j, end);
+			if (j < 0)
+				return -1;
+		} else if (s[j] == '(') {
+			depth++;
+			j++;
+		} else if (s[j] == ')') {
+			depth--;
+			j++;
+			if (depth == 0)
+				return j;
+		} else {
+			j++;
+		}
+	}
+	return -1;
+}
+
+// Scans one top-level alternation branch s[begin..end). Returns TRUE if the branch is a plain literal,
+// apart from leading ^ and trailing $, in which case the literal and anchors are returned. In either case
+// the longest run of literal characters which every match of the branch must contain is returned, or NULL
+// if there is none. Anything not understood here is left to the regex library.
+static int fast_regex_scan_branch(char* s, int begin, int end, char** pliteral, int* panchors,
+	char** prequired_literal)
+{
+	char* run = mlr_malloc_or_die(end - begin + 1);
+	char* best_run = mlr_malloc_or_die(end - begin + 1);
+	int run_length = 0;
+	int best_run_length = 0;
+	int is_literal = TRUE;
+	int analyzable = TRUE;
+	int anchors = 0;
+
+	int i = begin;
+	if (i < end && s[i] == '^') {
+		anchors |= FAST_REGEX_ANCHOR_START;
+		i++;
+	}
+	if (end > i && s[end-1] == '$') {
+		anchors |= FAST_REGEX_ANCHOR_END;
+		end--;
+	}
+
+	while (i < end) {
+		char c = s[i];
+		int is_char = FALSE;
+		int next = i + 1;
+		if (c == '[') {
+			next = fast_regex_skip_bracket(s, i, end);
+		} else if (c == '(') {
+			next = fast_regex_skip_group(s, i, end);
+		} else if (c == '^' || c == '$' || c == '*' || c == '+' || c == '?' || c == '{' || c == ')') {
+			next = -1;
+		} else if (c != '.') {
+			is_char = TRUE;
+		}
+		if (next < 0) {
+			analyzable = FALSE;
+			break;
+		}
+
+		int is_optional = FALSE;
+		int is_repeated = FALSE;
+		if (next < end) {
+			if (s[next] == '?' || s[next] == '*') {
+				is_optional = TRUE;
+				next++;
+			} else if (s[next] == '+') {
+				is_repeated = TRUE;
+				next++;
+			} else if (s[next] == '{') {
+				// Conservatively treated as optional since {0,n} is allowed.
+				char* pclose = memchr(&s[next], '}', end - next);
+				if (pclose == NULL) {
+					analyzable = FALSE;
+					break;
+				}
+				is_optional = TRUE;
+				next = pclose - s + 1;
+			}
+		}
+
+		if (is_char && !is_optional)
+			run[run_length++] = c;
+		if (!is_char || is_optional || is_repeated) {
+			is_literal = FALSE;
+			if (run_length > best_run_length) {
+				memcpy(best_run, run, run_length);
+				best_run_length = run_length;
+			}
+			run_length = 0;
+		}
+		i = next;
+	}
+	if (run_length > best_run_length) {
+		memcpy(best_run, run, run_length);
+		best_run_length = run_length;
+	}
+	free(run);
+
+	*pliteral = NULL;
+	*prequired_literal = NULL;
+	if (!analyzable) {
+		free(best_run);
+		return FALSE;
+	}
+	best_run[best_run_length] = 0;
+	if (is_literal) {
+		*pliteral = mlr_strdup_or_die(best_run);
+		*panchors = anchors;
+	}
+	if (best_run_length > 0)
+		*prequired_literal = best_run;
+	else
+		free(best_run);
+	return is_literal;
+}
+
+static void fast_regex_analyze(fast_regex_t* pregex, char* regex_string) {
+	if (pregex->cflags & (REG_ICASE|REG_NEWLINE))
+		return;
+
+	// Split into top-level alternation branches.
+	int length = strlen(regex_string);
+	int num_branches = 1;
+	for (int i = 0; i < length; ) {
+		if (regex_string[i] == '[')
+			i = fast_regex_skip_bracket(regex_string, i, length);
+		else if (regex_string[i] == '(')
+			i = fast_regex_skip_group(regex_string, i, length);
+		else if (regex_string[i++] == '|')
+			num_branches++;
+		if (i < 0)
+			return;
+	}
+
+	char** literals = mlr_malloc_or_die(num_branches * sizeof(char*));
+	int* literal_lengths = mlr_malloc_or_die(num_branches * sizeof(int));
+	int* literal_anchors = mlr_malloc_or_die(num_branches * sizeof(int));
+	int num_literals = 0;
+	char* required_literal = NULL;
+
+	int all_literal = TRUE;
+	int begin = 0;
+	for (int i = 0; i <= length; ) {
+		if (i < length && regex_string[i] == '[') {
+			i = fast_regex_skip_bracket(regex_string, i, length);
+		} else if (i < length && regex_string[i] == '(') {
+			i = fast_regex_skip_group(regex_string, i, length);
+		} else if (i == length || regex_string[i] == '|') {
+			char* literal = NULL;
+			int anchors = 0;
+			fast_regex_scan_branch(regex_string, begin, i, &literal, &anchors, &required_literal);
+			if (num_branches > 1) {
+				free(required_literal);
+				required_literal = NULL;
+			}
+			if (literal == NULL) {
+				all_literal = FALSE;
+				break;
+			}
+			literals[num_literals] = literal;
+			literal_lengths[num_literals] = strlen(literal);
+			literal_anchors[num_literals] = anchors;
+			num_literals++;
+			begin = ++i;
+		} else {
+			i++;
+		}
+	}
+
+	if (all_literal) {
+		pregex->num_literals    = num_literals;
+		pregex->literals        = literals;
+		pregex->literal_lengths = literal_lengths;
+		pregex->literal_anchors = literal_anchors;
+		free(required_literal);
+	} else {
+		for (int k = 0; k < num_literals; k++)
+			free(literals[k]);
+		free(literals);
+		free(literal_lengths);
+		free(literal_anchors);
+		pregex->required_literal = required_literal;
+	}
+}
+
+// ----------------------------------------------------------------
+fast_regex_t* fast_regcomp_or_die(fast_regex_t* pregex, char* regex_string, int cflags) {
+	regcomp_or_die(&pregex->regex, regex_string, cflags);
+	pregex->cflags           = cflags | REG_EXTENDED;
+	pregex->num_literals     = 0;
+	pregex->literals         = NULL;
+	pregex->literal_lengths  = NULL;
+	pregex->literal_anchors  = NULL;
+	pregex->required_literal = NULL;
+	fast_regex_analyze(pregex, regex_string);
+	return pregex;
+}
+
+fast_regex_t* fast_regcomp_or_die_quoted(fast_regex_t* pregex, char* orig_regex_string, int cflags) {
+	char* regex_string = alloc_unquoted_regex_string(orig_regex_string, &cflags);
+	fast_regcomp_or_die(pregex, regex_string, cflags);
+	free(regex_string);
+	return pregex;
+}
+
+void fast_regfree(fast_regex_t* pregex) {
+	regfree(&pregex->regex);
+	for (int k = 0; k < pregex->num_literals; k++)
+		free(pregex->literals[k]);
+	free(pregex->literals);
+	free(pregex->literal_lengths);
+	free(pregex->literal_anchors);
+	free(pregex->required_literal);
+}
+
+// Finds the leftmost-longest match among the literal alternatives, as the regex library would.
+static int fast_regex_match_literals(fast_regex_t* pregex, const char* s, regoff_t* pso, regoff_t* peo) {
+	int s_length = -1;
+	regoff_t best_so = -1;
+	regoff_t best_eo = -1;
+	for (int k = 0; k < pregex->num_literals; k++) {
+		char* literal = pregex->literals[k];
+		int literal_length = pregex->literal_lengths[k];
+		int anchors = pregex->literal_anchors[k];
+		regoff_t so = -1;
+		if (anchors & FAST_REGEX_ANCHOR_END) {
+			if (s_length < 0)
+				s_length = strlen(s);
+			if (literal_length <= s_length && memcmp(&s[s_length - literal_length], literal, literal_length) == 0)
+				so = s_length - literal_length;
+			if ((anchors & FAST_REGEX_ANCHOR_START) && so != 0)
+				so = -1;
+		} else if (anchors & FAST_REGEX_ANCHOR_START) {
+			if (strncmp(s, literal, literal_length) == 0)
+				so = 0;
+		} else {
+			char* p = strstr(s, literal);
+			if (p != NULL)
+				so = p - s;
+		}
+		if (so >= 0 && (best_so < 0 || so < best_so || (so == best_so && so + literal_length > best_eo))) {
+			best_so = so;
+			best_eo = so + literal_length;
+		}
+	}
+	*pso = best_so;
+	*peo = best_eo;
+	return best_so >= 0;
+}
+
+int fast_regmatch_or_die(fast_regex_t* pregex, const char* restrict match_string,
+	size_t nmatchmax, regmatch_t pmatch[restrict])
+{
+	if (pregex->num_literals > 0) {
+		regoff_t so, eo;
+		if (!fast_regex_match_literals(pregex, match_string, &so, &eo))
+			return FALSE;
+		if (nmatchmax > 0 && pmatch != NULL && !(pregex->cflags & REG_NOSUB)) {
+			pmatch[0].rm_so = so;
+			pmatch[0].rm_eo = eo;
+			for (size_t i = 1; i < nmatchmax; i++) {
+				pmatch[i].rm_so = -1;
+				pmatch[i].rm_eo = -1;
+			}
+		}
+		return TRUE;
+	}
+	if (pregex->required_literal != NULL && strstr(match_string, pregex->required_literal) == NULL)
+		return FALSE;
+	return regmatch_or_die(&pregex->regex, match_string, nmatchmax, pmatch);
+}
+
+int fast_regex_may_match(fast_regex_t* pregex, const char* match_string) {
+	if (pregex->num_literals > 0) {
+		regoff_t so, eo;
+		return fast_regex_match_literals(pregex, match_string, &so, &eo);
+	}
+	if (pregex->required_literal != NULL)
+		return strstr(match_string, pregex->required_literal) != NULL;
+	return TRUE;
+}
@@ -10,9 +10,30 @@
 #include "string_builder.h"
 #include "string_array.h"
 
+// Capture-groups \1 through \9 are supported, along with entire-string match \0.
+#define REGEX_CAPTURES_MAX 10
+
+// Regex captures for "\0" through "\9" interpolation after the =~ operator. These are kept as offsets into a
+// copy of the matched string, rather than as separately allocated substrings, since captures are saved on
+// every successful match but only some are ever interpolated. The copy buffer is reused across matches.
+typedef struct _regex_captures_t {
+	int        length; // Number of captures; 0 means there was a match attempt with no match.
+	char*      input;
+	int        input_alloc_length;
+	regmatch_t offsets[REGEX_CAPTURES_MAX];
+} regex_captures_t;
+
+void regex_captures_free(regex_captures_t* pregex_captures);
+
 // Succeeds or aborts the process. cflag REG_EXTENDED is already included.
 // Returns its first argument (after compilation).
 regex_t* regcomp_or_die(regex_t* pregex, char* regex_string, int cflags);
+
+// For regexes which are known only at runtime, e.g. 'sub($x, $y, "z")' or '$x =~ @pattern', rather than
+// string literals which can be compiled once at alloc time. Compiled regexes are kept in a small
+// least-recently-used cache keyed by regex string and cflags, shared across call sites. The return value is
+// owned by the cache and must not be regfreed by the caller; it remains valid until the next call.
+regex_t* regcache_get_or_die(char* regex_string, int cflags);
 // Always uses cflags with REG_EXTENDED.
 // If the regex_string is of the form a.*b, compiles it using cflags without REG_ICASE.
 // If the regex_string is of the form "a.*b", compiles a.*b using cflags without REG_ICASE.
@@ -24,6 +45,46 @@ regex_t* regcomp_or_die_quoted(regex_t* pregex, char* regex_string, int cflags);
 int regmatch_or_die(const regex_t* pregex, const char* restrict match_string,
 	size_t nmatchmax, regmatch_t pmatch[restrict]);
 
+// ----------------------------------------------------------------
+// Regexes for verbs such as cut -r, having-fields, rename -r, and grep, which match one compiled regex
+// against many field names or lines. The POSIX regex is always compiled (for syntax checking and as the
+// general case), and the regex string is also analyzed at compile time:
+//
+// * If it is an alternation of plain literals, each optionally ^- and/or $-anchored -- e.g. "abc",
+//   "^abc", "^x$|^y$" -- matching is done by string comparison without calling regexec.
+// * Otherwise, if there is a literal substring which every match must contain -- e.g. "sum" in
+//   "^(in|out)_sum_[0-9]+$" -- strings not containing it are rejected without calling regexec.
+//
+// Case-insensitive regexes are always matched via regexec.
+
+#define FAST_REGEX_ANCHOR_START 0x1
+#define FAST_REGEX_ANCHOR_END   0x2
+
+typedef struct _fast_regex_t {
+	regex_t regex;
+	int     cflags;
+	int     num_literals;     // Nonzero when the regex is an alternation of plain literals.
+	char**  literals;
+	int*    literal_lengths;
+	int*    literal_anchors;
+	char*   required_literal; // Or NULL if none was found.
+} fast_regex_t;
+
+// Same semantics as regcomp_or_die and regcomp_or_die_quoted.
+fast_regex_t* fast_regcomp_or_die(fast_regex_t* pregex, char* regex_string, int cflags);
+fast_regex_t* fast_regcomp_or_die_quoted(fast_regex_t* pregex, char* regex_string, int cflags);
+void fast_regfree(fast_regex_t* pregex);
+
+// Same semantics as regmatch_or_die. For pure-literal regexes, pmatch[0] is the leftmost-longest match
+// and the remaining slots are set to -1, as there are no capture groups.
+int fast_regmatch_or_die(fast_regex_t* pregex, const char* restrict match_string,
+	size_t nmatchmax, regmatch_t pmatch[restrict]);
+
+// Returns FALSE if the string is known not to match the regex, else TRUE. For callers which go on to use
+// regex_sub or regex_gsub on &pregex->regex, this avoids regexec calls on strings which cannot match.
+int fast_regex_may_match(fast_regex_t* pregex, const char* match_string);
+
+// ----------------------------------------------------------------
 // If there is a match, the return value is dynamically allocated and returned.
 // If not, the input is returned.  So the caller should free the return value
 // if matched == TRUE.  The by-reference all-captured flag is true on return if
@@ -33,13 +94,15 @@ char* regex_sub(char* input, regex_t* pregex, string_builder_t* psb, char* repla
 
 char* regex_gsub(char* input, regex_t* pregex, string_builder_t* psb, char* replacement, int* pmatched, int* pall_captured, char *pfree_flags);
 
-// The regex library gives us an array of match pointers into the input string. This function strdups them
-// out into separate storage, to implement "\0", "\1", "\2", etc. regex-captures for the =~ and !=~ operators.
-// If the regex-captures array is null, it is allocated; otherwise it is resized. If the input regex does not
-// match the regex, then the regex-captures array will be non-null but will have length 0.
-void save_regex_captures(string_array_t** ppregex_captures, char* input, regmatch_t matches[], int nmatchmax);
+// The regex library gives us an array of match offsets into the input string. This function saves them, along
+// with a copy of the input string, to implement "\0", "\1", "\2", etc. regex-captures for the =~ and !=~
+// operators. If the regex-captures pointer is null, it is allocated; otherwise it is reused.
+void save_regex_captures(regex_captures_t** ppregex_captures, char* input, regmatch_t matches[], int nmatchmax);
+
+// If the input string does not match the regex, then the regex-captures will be non-null but will have length 0.
+void save_regex_captures_no_match(regex_captures_t** ppregex_captures);
 
-// Given an array of regex-captures and an input string, interpolates the matches. E.g. if capture 1 is "abc"
+// Given regex-captures and an input string, interpolates the matches. E.g. if capture 1 is "abc"
 // and capture 2 is "def" and the input is "hello \1 goodbye \2", then the output is a newly allocated string
 // with value "hello abc goodbye def".  The was-allocated flag is an output flag: if true upon return, there was
 // something modified and the returnv value should be freed; if false, nothing was modified and the input string was
@@ -47,6 +110,6 @@ void save_regex_captures(string_array_t** ppregex_captures, char* input, regmatc
 //
 // To avoid performance regressions in non-match cases, this function quickly returns if the regex-captures array is
 // NULL. See comments in mapper_put.c for more information.
-char* interpolate_regex_captures(char* input, string_array_t* pregex_captures, int* pwas_allocated);
+char* interpolate_regex_captures(char* input, regex_captures_t* pregex_captures, int* pwas_allocated);
 
 #endif // MLRREGEX_H
@@ -2,6 +2,8 @@
 #include <string.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <errno.h>
+#include <limits.h>
 #include <sys/time.h>
 #include <sys/stat.h>
 #include "lib/mlrutil.h"
@@ -174,6 +176,25 @@ double mlr_double_from_string_or_die(char* string) {
 	return d;
 }
 
+// ----------------------------------------------------------------
+long long mlr_memory_size_from_string_or_die(char* verb, char* string) {
+	char* end = NULL;
+	errno = 0;
+	long long size = strtoll(string, &end, 10);
+	int overflowed = errno == ERANGE;
+	long long multiplier = 1LL;
+	switch (*end) {
+	case 'k': case 'K': multiplier = 1LL << 10; end++; break;
+	case 'm': case 'M': multiplier = 1LL << 20; end++; break;
+	case 'g': case 'G': multiplier = 1LL << 30; end++; break;
+	}
+	if (end == string || *end != 0 || size <= 0LL || overflowed || size > LLONG_MAX / multiplier) {
+		fprintf(stderr, "%s %s: could not parse \"%s\" as memory size.\n", MLR_GLOBALS.bargv0, verb, string);
+		exit(1);
+	}
+	return size * multiplier;
+}
+
 // E.g. "300" is a number; "300ms" is not.
 int mlr_try_float_from_string(char* string, double* pval) {
 	int num_bytes_scanned;
@@ -106,6 +106,8 @@ char* mlr_alloc_hexfmt_from_ll(long long value);
 
 double mlr_double_from_string_or_die(char* string);
 long long mlr_int_from_string_or_die(char* string);
+// E.g. "500000000", "500m", or "2g", with k/m/g being powers of 1024. The verb is for the error message.
+long long mlr_memory_size_from_string_or_die(char* verb, char* string);
 int    mlr_try_float_from_string(char* string, double* pval);
 int    mlr_try_int_from_string(char* string, long long* pval);
 
@@ -43,7 +43,7 @@ static rval_evaluator_t* fmgr_alloc_evaluator_from_zary_func_name(char* function
 
 static rval_evaluator_t* fmgr_alloc_evaluator_from_unary_func_name(char* fnnm, rval_evaluator_t* parg1);
 
-static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(char* fnnm,
+static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(char* fnnm, int type1, int type2,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 
 static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_regex_arg2_func_name(char* fnnm,
@@ -57,6 +57,8 @@ static rval_evaluator_t* fmgr_alloc_evaluator_from_ternary_regex_arg2_func_name(
 
 static void resolve_func_callsite(fmgr_t* pfmgr, rval_evaluator_t* pev);
 
+static int fmgr_infer_static_type(mlr_dsl_ast_node_t* pnode, int type_inferencing);
+
 // ----------------------------------------------------------------
 fmgr_t* fmgr_alloc() {
 	fmgr_t* pfmgr = mlr_malloc_or_die(sizeof(fmgr_t));
@@ -629,7 +631,10 @@ static void resolve_func_callsite(fmgr_t* pfmgr, rval_evaluator_t* pev) {
 			// be slower.
 			rval_evaluator_t* parg1 = rval_evaluator_alloc_from_ast(parg1_node, pfmgr, type_inferencing, context_flags);
 			rval_evaluator_t* parg2 = rval_evaluator_alloc_from_ast(parg2_node, pfmgr, type_inferencing, context_flags);
-			pevaluator = fmgr_alloc_evaluator_from_binary_func_name(function_name, parg1, parg2);
+			pevaluator = fmgr_alloc_evaluator_from_binary_func_name(function_name,
+				fmgr_infer_static_type(parg1_node, type_inferencing),
+				fmgr_infer_static_type(parg2_node, type_inferencing),
+				parg1, parg2);
 		}
 
 	} else if (user_provided_arity == 3) {
@@ -676,6 +681,115 @@ static void resolve_func_callsite(fmgr_t* pfmgr, rval_evaluator_t* pev) {
 	free(pevaluator);
 }
 
+// ----------------------------------------------------------------
+// Static type inference for the type-specialized operator evaluators: returns
+// the MT_* type an expression is expected to evaluate to, or
+// STATIC_TYPE_UNKNOWN. Sources of type information are literals, built-in
+// context variables, and local variables declared with a single type (e.g.
+// 'int i = 0' or 'func f(float x)'). The result is a best guess rather than a
+// guarantee -- e.g. a typed local may still be absent, or integer addition may
+// overflow to float -- so the specialized evaluators recheck at runtime.
+
+#define STATIC_TYPE_UNKNOWN -1
+
+static int fmgr_infer_static_type_from_mask(int type_mask) {
+	if (type_mask == TYPE_MASK_INT)
+		return MT_INT;
+	else if (type_mask == TYPE_MASK_FLOAT)
+		return MT_FLOAT;
+	else if (type_mask == TYPE_MASK_BOOLEAN)
+		return MT_BOOLEAN;
+	else if (type_mask == TYPE_MASK_STRING)
+		return MT_STRING;
+	else
+		return STATIC_TYPE_UNKNOWN;
+}
+
+static int fmgr_infer_static_type(mlr_dsl_ast_node_t* pnode, int type_inferencing) {
+	long long intv;
+	double fltv;
+
+	switch (pnode->type) {
+
+	case MD_AST_NODE_TYPE_STRING_LITERAL:
+		return MT_STRING;
+
+	case MD_AST_NODE_TYPE_NUMERIC_LITERAL:
+		if (type_inferencing == TYPE_INFER_STRING_FLOAT_INT && mlr_try_int_from_string(pnode->text, &intv))
+			return MT_INT;
+		else if (type_inferencing != TYPE_INFER_STRING_ONLY && mlr_try_float_from_string(pnode->text, &fltv))
+			return MT_FLOAT;
+		else
+			return MT_STRING;
+
+	case MD_AST_NODE_TYPE_BOOLEAN_LITERAL:
+		return MT_BOOLEAN;
+
+	case MD_AST_NODE_TYPE_CONTEXT_VARIABLE:
+		if (streq(pnode->text, "NR") || streq(pnode->text, "FNR") || streq(pnode->text, "NF")
+			|| streq(pnode->text, "FILENUM"))
+			return MT_INT;
+		else if (streq(pnode->text, "PI") || streq(pnode->text, "E"))
+			return MT_FLOAT;
+		else
+			return STATIC_TYPE_UNKNOWN;
+
+	case MD_AST_NODE_TYPE_NONINDEXED_LOCAL_VARIABLE:
+		return fmgr_infer_static_type_from_mask(pnode->vardef_type_mask);
+
+	case MD_AST_NODE_TYPE_OPERATOR:
+		break;
+
+	default:
+		return STATIC_TYPE_UNKNOWN;
+	}
+
+	// Operators. User-defined functions can't be named with operator symbols so there is no shadowing here.
+	char* op = pnode->text;
+	int nargs = pnode->pchildren->length;
+	if (nargs == 1) {
+		int type1 = fmgr_infer_static_type(pnode->pchildren->phead->pvvalue, type_inferencing);
+		if (streq(op, "-") || streq(op, "+"))
+			return (type1 == MT_INT || type1 == MT_FLOAT) ? type1 : STATIC_TYPE_UNKNOWN;
+		else if (streq(op, "!"))
+			return MT_BOOLEAN;
+		else
+			return STATIC_TYPE_UNKNOWN;
+
+	} else if (nargs == 2) {
+		if (streq(op, "==") || streq(op, "!=") || streq(op, "<") || streq(op, "<=") || streq(op, ">")
+			|| streq(op, ">=") || streq(op, "&&") || streq(op, "||") || streq(op, "^^")
+			|| streq(op, "=~") || streq(op, "!=~"))
+			return MT_BOOLEAN;
+		if (streq(op, "."))
+			return MT_STRING;
+
+		int type1 = fmgr_infer_static_type(pnode->pchildren->phead->pvvalue, type_inferencing);
+		int type2 = fmgr_infer_static_type(pnode->pchildren->phead->pnext->pvvalue, type_inferencing);
+		if (streq(op, "+") || streq(op, "-") || streq(op, "*") || streq(op, "//") || streq(op, "%")) {
+			if (type1 == MT_INT && type2 == MT_INT)
+				return MT_INT;
+			else if ((type1 == MT_INT || type1 == MT_FLOAT) && (type2 == MT_INT || type2 == MT_FLOAT))
+				return MT_FLOAT;
+			else
+				return STATIC_TYPE_UNKNOWN;
+		} else if (streq(op, "/")) {
+			// Int-by-int division is int only when exact.
+			if ((type1 == MT_FLOAT && (type2 == MT_INT || type2 == MT_FLOAT)) || (type1 == MT_INT && type2 == MT_FLOAT))
+				return MT_FLOAT;
+			else
+				return STATIC_TYPE_UNKNOWN;
+		} else if (streq(op, "&") || streq(op, "|") || streq(op, "^")) {
+			return (type1 == MT_INT && type2 == MT_INT) ? MT_INT : STATIC_TYPE_UNKNOWN;
+		} else {
+			return STATIC_TYPE_UNKNOWN;
+		}
+
+	} else {
+		return STATIC_TYPE_UNKNOWN;
+	}
+}
+
 // ================================================================
 static rval_evaluator_t* fmgr_alloc_evaluator_from_variadic_func_name(char* fnnm, rval_evaluator_t** pargs, int nargs) {
 	if        (streq(fnnm, "min")) { return rval_evaluator_alloc_from_variadic_func(variadic_min_func, pargs, nargs);
@@ -789,7 +903,7 @@ static rval_evaluator_t* fmgr_alloc_evaluator_from_unary_func_name(char* fnnm, r
 }
 
 // ================================================================
-static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(char* fnnm,
+static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(char* fnnm, int type1, int type2,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2)
 {
 	if        (streq(fnnm, "&&"))   { return rval_evaluator_alloc_from_b_bb_and_func(parg1, parg2);
@@ -798,28 +912,28 @@ static rval_evaluator_t* fmgr_alloc_evaluator_from_binary_func_name(char* fnnm,
 	} else if (streq(fnnm, "=~"))   { return rval_evaluator_alloc_from_x_ssc_func(
 		matches_no_precomp_func, parg1, parg2);
 	} else if (streq(fnnm, "!=~"))  { return rval_evaluator_alloc_from_x_ssc_func(does_not_match_no_precomp_func, parg1, parg2);
-	} else if (streq(fnnm, "=="))   { return rval_evaluator_alloc_from_x_xx_func(eq_op_func,             parg1, parg2);
-	} else if (streq(fnnm, "!="))   { return rval_evaluator_alloc_from_x_xx_func(ne_op_func,             parg1, parg2);
-	} else if (streq(fnnm, ">"))    { return rval_evaluator_alloc_from_x_xx_func(gt_op_func,             parg1, parg2);
-	} else if (streq(fnnm, ">="))   { return rval_evaluator_alloc_from_x_xx_func(ge_op_func,             parg1, parg2);
-	} else if (streq(fnnm, "<"))    { return rval_evaluator_alloc_from_x_xx_func(lt_op_func,             parg1, parg2);
-	} else if (streq(fnnm, "<="))   { return rval_evaluator_alloc_from_x_xx_func(le_op_func,             parg1, parg2);
-	} else if (streq(fnnm, "."))    { return rval_evaluator_alloc_from_x_xx_func(s_xx_dot_func,          parg1, parg2);
-	} else if (streq(fnnm, "+"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_plus_func,         parg1, parg2);
-	} else if (streq(fnnm, "-"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_minus_func,        parg1, parg2);
-	} else if (streq(fnnm, "*"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_times_func,        parg1, parg2);
-	} else if (streq(fnnm, "/"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_divide_func,       parg1, parg2);
-	} else if (streq(fnnm, "//"))   { return rval_evaluator_alloc_from_x_xx_func(x_xx_int_divide_func,   parg1, parg2);
-	} else if (streq(fnnm, "%"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_mod_func,          parg1, parg2);
+	} else if (streq(fnnm, "=="))   { return rval_evaluator_alloc_from_x_xx_typed_func(eq_op_func,            type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "!="))   { return rval_evaluator_alloc_from_x_xx_typed_func(ne_op_func,            type1, type2, parg1, parg2);
+	} else if (streq(fnnm, ">"))    { return rval_evaluator_alloc_from_x_xx_typed_func(gt_op_func,            type1, type2, parg1, parg2);
+	} else if (streq(fnnm, ">="))   { return rval_evaluator_alloc_from_x_xx_typed_func(ge_op_func,            type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "<"))    { return rval_evaluator_alloc_from_x_xx_typed_func(lt_op_func,            type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "<="))   { return rval_evaluator_alloc_from_x_xx_typed_func(le_op_func,            type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "."))    { return rval_evaluator_alloc_from_x_xx_typed_func(s_xx_dot_func,         type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "+"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_plus_func,        type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "-"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_minus_func,       type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "*"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_times_func,       type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "/"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_divide_func,      type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "//"))   { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_int_divide_func,  type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "%"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_mod_func,         type1, type2, parg1, parg2);
 	} else if (streq(fnnm, "**"))   { return rval_evaluator_alloc_from_f_ff_func(f_ff_pow_func,          parg1, parg2);
 	} else if (streq(fnnm, "pow"))  { return rval_evaluator_alloc_from_f_ff_func(f_ff_pow_func,          parg1, parg2);
 	} else if (streq(fnnm, "atan2")){ return rval_evaluator_alloc_from_f_ff_func(f_ff_atan2_func,        parg1, parg2);
-	} else if (streq(fnnm, "roundm")) { return rval_evaluator_alloc_from_x_xx_func(x_xx_roundm_func,     parg1, parg2);
+	} else if (streq(fnnm, "roundm")) { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_roundm_func,      type1, type2, parg1, parg2);
 	} else if (streq(fnnm, "fmtnum")) { return rval_evaluator_alloc_from_s_xs_func(s_xs_fmtnum_func,     parg1, parg2);
 	} else if (streq(fnnm, "urandint")) { return rval_evaluator_alloc_from_i_ii_func(i_ii_urandint_func, parg1, parg2);
-	} else if (streq(fnnm, "&"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_band_func,         parg1, parg2);
-	} else if (streq(fnnm, "|"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_bor_func,          parg1, parg2);
-	} else if (streq(fnnm, "^"))    { return rval_evaluator_alloc_from_x_xx_func(x_xx_bxor_func,         parg1, parg2);
+	} else if (streq(fnnm, "&"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_band_func,        type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "|"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_bor_func,         type1, type2, parg1, parg2);
+	} else if (streq(fnnm, "^"))    { return rval_evaluator_alloc_from_x_xx_typed_func(x_xx_bxor_func,        type1, type2, parg1, parg2);
 	} else if (streq(fnnm, "<<"))   { return rval_evaluator_alloc_from_i_ii_func(i_ii_bitwise_lsh_func,  parg1, parg2);
 	} else if (streq(fnnm, ">>"))   { return rval_evaluator_alloc_from_i_ii_func(i_ii_bitwise_rsh_func,  parg1, parg2);
 	} else if (streq(fnnm, "strftime")) { return rval_evaluator_alloc_from_x_ns_func(s_ns_strftime_func, parg1, parg2);
@@ -4,6 +4,7 @@
 #include "containers/sllv.h"
 #include "containers/hss.h"
 #include "containers/mixutil.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -11,8 +12,9 @@ typedef struct _mapper_cut_state_t {
 	ap_state_t* pargp;
 	slls_t*  pfield_name_list;
 	hss_t*   pfield_name_set;
-	regex_t* regexes;
+	fast_regex_t* regexes;
 	int      nregex;
+	schema_cache_t* pschema_cache;
 	int      do_arg_order;
 	int      do_complement;
 } mapper_cut_state_t;
@@ -99,19 +101,21 @@ static mapper_t* mapper_cut_alloc(ap_state_t* pargp, slls_t* pfield_name_list,
 		pstate->pfield_name_set    = hss_from_slls(pfield_name_list);
 		pstate->nregex             = 0;
 		pstate->regexes            = NULL;
+		pstate->pschema_cache      = NULL;
 		pmapper->pprocess_func     = mapper_cut_process_no_regexes;
 	} else {
 		pstate->pfield_name_list   = NULL;
 		pstate->pfield_name_set    = NULL;
 		pstate->nregex = pfield_name_list->length;
-		pstate->regexes = mlr_malloc_or_die(pstate->nregex * sizeof(regex_t));
+		pstate->regexes = mlr_malloc_or_die(pstate->nregex * sizeof(fast_regex_t));
 		int i = 0;
 		for (sllse_t* pe = pfield_name_list->phead; pe != NULL; pe = pe->pnext, i++) {
 			// Let them type in a.*b if they want, or "a.*b", or "a.*b"i.
 			// Strip off the leading " and trailing " or "i.
-			regcomp_or_die_quoted(&pstate->regexes[i], pe->value, REG_NOSUB);
+			fast_regcomp_or_die_quoted(&pstate->regexes[i], pe->value, REG_NOSUB);
 		}
 		slls_free(pfield_name_list);
+		pstate->pschema_cache      = schema_cache_alloc(free);
 		pmapper->pprocess_func     = mapper_cut_process_with_regexes;
 	}
 	pstate->do_arg_order   = do_arg_order;
@@ -128,8 +132,9 @@ static void mapper_cut_free(mapper_t* pmapper) {
 	slls_free(pstate->pfield_name_list);
 	hss_free(pstate->pfield_name_set);
 	for (int i = 0; i < pstate->nregex; i++)
-		regfree(&pstate->regexes[i]);
+		fast_regfree(&pstate->regexes[i]);
 	free(pstate->regexes);
+	schema_cache_free(pstate->pschema_cache);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -174,26 +179,39 @@ static sllv_t* mapper_cut_process_no_regexes(lrec_t* pinrec, context_t* pctx, vo
 }
 
 // ----------------------------------------------------------------
+// The per-schema plan is an array of keep/discard flags, one per field position.
+static char* mapper_cut_make_regex_plan(mapper_cut_state_t* pstate, lrec_t* pinrec) {
+	char* pkeep_flags = mlr_malloc_or_die(pinrec->field_count + 1);
+	int j = 0;
+	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext, j++) {
+		int matches_any = FALSE;
+		for (int i = 0; i < pstate->nregex; i++) {
+			if (fast_regmatch_or_die(&pstate->regexes[i], pe->key, 0, NULL)) {
+				matches_any = TRUE;
+				break;
+			}
+		}
+		pkeep_flags[j] = matches_any ^ pstate->do_complement;
+	}
+	return pkeep_flags;
+}
+
 static sllv_t* mapper_cut_process_with_regexes(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec != NULL) {
 		mapper_cut_state_t* pstate = (mapper_cut_state_t*)pvstate;
+		char* pkeep_flags = schema_cache_get(pstate->pschema_cache, pinrec);
+		if (pkeep_flags == NULL) {
+			pkeep_flags = mapper_cut_make_regex_plan(pstate, pinrec);
+			schema_cache_put(pstate->pschema_cache, pinrec, pkeep_flags);
+		}
 		// Loop over the record and free the fields to be discarded, being
 		// careful about the fact that we're modifying what we're looping over.
-		for (lrece_t* pe = pinrec->phead; pe != NULL; /* next in loop */) {
-			int matches_any = FALSE;
-			for (int i = 0; i < pstate->nregex; i++) {
-				if (regmatch_or_die(&pstate->regexes[i], pe->key, 0, NULL)) {
-					matches_any = TRUE;
-					break;
-				}
-			}
-			if (matches_any ^ pstate->do_complement) {
-				pe = pe->pnext;
-			} else {
-				lrece_t* pf = pe->pnext;
-				lrec_remove(pinrec, pe->key);
-				pe = pf;
-			}
+		int j = 0;
+		for (lrece_t* pe = pinrec->phead; pe != NULL; j++) {
+			lrece_t* pnext = pe->pnext;
+			if (!pkeep_flags[j])
+				lrec_unlink_and_free(pinrec, pe);
+			pe = pnext;
 		}
 		return sllv_single(pinrec);
 	}
@@ -10,7 +10,7 @@
 typedef struct _mapper_grep_state_t {
 	ap_state_t* pargp;
 	int exclude;
-	regex_t regex;
+	fast_regex_t regex;
 	cli_writer_opts_t* pwriter_opts;
 } mapper_grep_state_t;
 
@@ -94,7 +94,7 @@ static mapper_t* mapper_grep_alloc(ap_state_t* pargp, char* regex_string, int ex
 	int cflags = REG_NOSUB;
 	if (ignore_case)
 		cflags |= REG_ICASE;
-	regcomp_or_die_quoted(&pstate->regex, regex_string, cflags);
+	fast_regcomp_or_die_quoted(&pstate->regex, regex_string, cflags);
 	pstate->exclude = exclude;
 	pstate->pwriter_opts = pwriter_opts;
 
@@ -105,7 +105,7 @@ static mapper_t* mapper_grep_alloc(ap_state_t* pargp, char* regex_string, int ex
 }
 static void mapper_grep_free(mapper_t* pmapper) {
 	mapper_grep_state_t* pstate = pmapper->pvstate;
-	regfree(&pstate->regex);
+	fast_regfree(&pstate->regex);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -123,7 +123,7 @@ static sllv_t* mapper_grep_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 		pstate->pwriter_opts->ofs,
 		pstate->pwriter_opts->ops);
 
-	int matches = regmatch_or_die(&pstate->regex, line, 0, NULL);
+	int matches = fast_regmatch_or_die(&pstate->regex, line, 0, NULL);
 	sllv_t* poutrecs = NULL;
 	if (matches ^ pstate->exclude) {
 		poutrecs = sllv_single(pinrec);
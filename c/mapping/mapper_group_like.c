@@ -4,19 +4,23 @@
 #include "lib/mlrutil.h"
 #include "containers/sllv.h"
 #include "containers/slls.h"
-#include "containers/lhmslv.h"
+#include "containers/lrec_store.h"
 #include "containers/mixutil.h"
 #include "mapping/mappers.h"
 
 typedef struct _mapper_group_like_state_t {
-	// map from list of string to list of record
-	lhmslv_t* precords_by_key_field_names;
+	// Records grouped by list of field names
+	lrec_store_t* pstore;
+	// The group for the previous record's schema, reused without key lookup when the next
+	// record has the same nonzero schema ID.
+	unsigned long long  last_schema_id;
+	lrec_store_group_t* plast_group;
 } mapper_group_like_state_t;
 
 static void      mapper_group_like_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_group_like_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
-static mapper_t* mapper_group_like_alloc();
+static mapper_t* mapper_group_like_alloc(long long max_memory);
 static void      mapper_group_like_free(mapper_t* pmapper);
 static sllv_t*   mapper_group_like_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
@@ -30,8 +34,15 @@ mapper_setup_t mapper_group_like_setup = {
 
 // ----------------------------------------------------------------
 static void mapper_group_like_usage(FILE* o, char* argv0, char* verb) {
-	fprintf(o, "Usage: %s %s\n", argv0, verb);
+	fprintf(o, "Usage: %s %s [options]\n", argv0, verb);
 	fprintf(o, "Outputs records in batches having identical field names.\n");
+	fprintf(o, "Options:\n");
+	fprintf(o, "--max-memory {size}  Keep at most about this much record data in memory, e.g.\n");
+	fprintf(o, "                     500000000, 500m, or 2g. Beyond that, records are spilled to\n");
+	fprintf(o, "                     temp files in $TMPDIR (default /tmp). Default: no limit.\n");
+	fprintf(o, "                     Once records are spilled, they are output in batches, so\n");
+	fprintf(o, "                     prints in end blocks of a put or filter after this verb\n");
+	fprintf(o, "                     come after the first batches rather than before them.\n");
 }
 
 static mapper_t* mapper_group_like_parse_cli(int* pargi, int argc, char** argv,
@@ -41,17 +52,30 @@ static mapper_t* mapper_group_like_parse_cli(int* pargi, int argc, char** argv,
 		mapper_group_like_usage(stderr, argv[0], argv[*pargi]);
 		return NULL;
 	}
-	mapper_t* pmapper = mapper_group_like_alloc();
+	char* verb = argv[*pargi];
 	*pargi += 1;
-	return pmapper;
+	long long max_memory = 0LL;
+
+	while ((argc - *pargi) >= 1 && argv[*pargi][0] == '-') {
+		if (streq(argv[*pargi], "--max-memory") && (argc - *pargi) >= 2) {
+			max_memory = mlr_memory_size_from_string_or_die(verb, argv[*pargi+1]);
+			*pargi += 2;
+		} else {
+			mapper_group_like_usage(stderr, argv[0], verb);
+			return NULL;
+		}
+	}
+	return mapper_group_like_alloc(max_memory);
 }
 
 // ----------------------------------------------------------------
-static mapper_t* mapper_group_like_alloc() {
+static mapper_t* mapper_group_like_alloc(long long max_memory) {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
 	mapper_group_like_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_group_like_state_t));
-	pstate->precords_by_key_field_names = lhmslv_alloc();
+	pstate->pstore = lrec_store_alloc(max_memory);
+	pstate->last_schema_id = LREC_SCHEMA_UNKNOWN;
+	pstate->plast_group = NULL;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_group_like_process;
@@ -62,12 +86,7 @@ static mapper_t* mapper_group_like_alloc() {
 
 static void mapper_group_like_free(mapper_t* pmapper) {
 	mapper_group_like_state_t* pstate = pmapper->pvstate;
-	// lhmslv_free will free the hashmap keys; we need to free the void-star hashmap values.
-	for (lhmslve_t* pa = pstate->precords_by_key_field_names->phead; pa != NULL; pa = pa->pnext) {
-		sllv_t* plist = pa->pvvalue;
-		sllv_free(plist);
-	}
-	lhmslv_free(pstate->precords_by_key_field_names);
+	lrec_store_free(pstate->pstore);
 	free(pstate);
 	free(pmapper);
 }
@@ -76,25 +95,19 @@ static void mapper_group_like_free(mapper_t* pmapper) {
 static sllv_t* mapper_group_like_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_group_like_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
-		slls_t* pkey_field_names = mlr_reference_keys_from_record(pinrec);
-		sllv_t* plist = lhmslv_get(pstate->precords_by_key_field_names, pkey_field_names);
-		if (plist == NULL) {
-			plist = sllv_alloc();
-			sllv_append(plist, pinrec);
-			lhmslv_put(pstate->precords_by_key_field_names, slls_copy(pkey_field_names), plist,
-				FREE_ENTRY_KEY);
-		} else {
-			sllv_append(plist, pinrec);
+		if (pinrec->schema_id != LREC_SCHEMA_UNKNOWN && pinrec->schema_id == pstate->last_schema_id) {
+			lrec_store_append(pstate->pstore, pstate->plast_group, pinrec);
+			return NULL;
 		}
+		slls_t* pkey_field_names = mlr_reference_keys_from_record(pinrec);
+		lrec_store_group_t* pgroup = lrec_store_get_group(pstate->pstore, pkey_field_names);
 		slls_free(pkey_field_names);
+		// Taken before the append, which may spill the record.
+		pstate->last_schema_id = pinrec->schema_id;
+		pstate->plast_group = pgroup;
+		lrec_store_append(pstate->pstore, pgroup, pinrec);
 		return NULL;
 	} else {
-		sllv_t* poutput = sllv_alloc();
-		for (lhmslve_t* pe = pstate->precords_by_key_field_names->phead; pe != NULL; pe = pe->pnext) {
-			sllv_t* plist = pe->pvvalue;
-			sllv_transfer(poutput, plist);
-		}
-		sllv_append(poutput, NULL);
-		return poutput;
+		return lrec_store_next_batch(pstate->pstore, FALSE, pctx);
 	}
 }
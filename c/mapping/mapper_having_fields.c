@@ -5,6 +5,7 @@
 #include "containers/lrec.h"
 #include "containers/sllv.h"
 #include "containers/hss.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -18,10 +19,16 @@ typedef enum _criterion_t {
 	HAVING_NO_FIELDS_MATCHING
 } criterion_t;
 
+struct _mapper_having_fields_state_t; // forward reference for method declarations
+typedef int having_fields_predicate_t(lrec_t* pinrec, struct _mapper_having_fields_state_t* pstate);
+
 typedef struct _mapper_having_fields_state_t {
 	slls_t* pfield_names;
 	hss_t*  pfield_name_set;
-	regex_t regex;
+	fast_regex_t regex;
+	having_fields_predicate_t* ppredicate;
+	// Pass/fail depends only on the field names, so it is computed once per schema.
+	schema_cache_t* pschema_cache;
 } mapper_having_fields_state_t;
 
 static void      mapper_having_fields_usage(FILE* o, char* argv0, char* verb);
@@ -31,13 +38,15 @@ static mapper_t* mapper_having_fields_parse_cli(int* pargi, int argc, char** arg
 static mapper_t* mapper_having_fields_alloc(slls_t* pfield_names, char* regex_string, criterion_t criterion);
 static void      mapper_having_fields_free(mapper_t* pmapper);
 
-static sllv_t*   mapper_having_fields_at_least_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_having_fields_which_are_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_having_fields_at_most_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_having_fields_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+
+static int mapper_having_fields_at_least(lrec_t* pinrec, mapper_having_fields_state_t* pstate);
+static int mapper_having_fields_which_are(lrec_t* pinrec, mapper_having_fields_state_t* pstate);
+static int mapper_having_fields_at_most(lrec_t* pinrec, mapper_having_fields_state_t* pstate);
 
-static sllv_t*   mapper_having_all_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_having_any_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-static sllv_t*   mapper_having_no_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static int mapper_having_all_fields_matching(lrec_t* pinrec, mapper_having_fields_state_t* pstate);
+static int mapper_having_any_fields_matching(lrec_t* pinrec, mapper_having_fields_state_t* pstate);
+static int mapper_having_no_fields_matching(lrec_t* pinrec, mapper_having_fields_state_t* pstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_having_fields_setup = {
@@ -157,32 +166,34 @@ static mapper_t* mapper_having_fields_alloc(slls_t* pfield_names, char* regex_st
 
 		// Let them type in a.*b if they want, or "a.*b", or "a.*b"i.
 		// Strip off the leading " and trailing " or "i.
-		regcomp_or_die_quoted(&pstate->regex, regex_string, REG_NOSUB);
+		fast_regcomp_or_die_quoted(&pstate->regex, regex_string, REG_NOSUB);
 
 		if (criterion == HAVING_ALL_FIELDS_MATCHING)
-			pmapper->pprocess_func = mapper_having_all_fields_matching_process;
+			pstate->ppredicate = mapper_having_all_fields_matching;
 		else if (criterion == HAVING_ANY_FIELDS_MATCHING)
-			pmapper->pprocess_func = mapper_having_any_fields_matching_process;
+			pstate->ppredicate = mapper_having_any_fields_matching;
 		else if (criterion == HAVING_NO_FIELDS_MATCHING)
-			pmapper->pprocess_func = mapper_having_no_fields_matching_process;
-		pmapper->pfree_func = mapper_having_fields_free;
+			pstate->ppredicate = mapper_having_no_fields_matching;
 
 	} else {
 		pstate->pfield_names    = pfield_names;
 		pstate->pfield_name_set = hss_alloc();
-		regcomp_or_die(&pstate->regex, ".", 0);
+		fast_regcomp_or_die(&pstate->regex, ".", 0);
 		for (sllse_t* pe = pfield_names->phead; pe != NULL; pe = pe->pnext)
 			hss_add(pstate->pfield_name_set, pe->value);
 
 		if (criterion == HAVING_FIELDS_AT_LEAST)
-			pmapper->pprocess_func = mapper_having_fields_at_least_process;
+			pstate->ppredicate = mapper_having_fields_at_least;
 		else if (criterion == HAVING_FIELDS_WHICH_ARE)
-			pmapper->pprocess_func = mapper_having_fields_which_are_process;
+			pstate->ppredicate = mapper_having_fields_which_are;
 		else if (criterion == HAVING_FIELDS_AT_MOST)
-			pmapper->pprocess_func = mapper_having_fields_at_most_process;
-		pmapper->pfree_func = mapper_having_fields_free;
+			pstate->ppredicate = mapper_having_fields_at_most;
 	}
 
+	pstate->pschema_cache  = schema_cache_alloc(free);
+	pmapper->pprocess_func = mapper_having_fields_process;
+	pmapper->pfree_func    = mapper_having_fields_free;
+
 	return pmapper;
 }
 
@@ -192,97 +203,90 @@ static void mapper_having_fields_free(mapper_t* pmapper) {
 		slls_free(pstate->pfield_names);
 	if (pstate->pfield_name_set != NULL)
 		hss_free(pstate->pfield_name_set);
-	regfree(&pstate->regex);
+	fast_regfree(&pstate->regex);
+	schema_cache_free(pstate->pschema_cache);
 	free(pstate);
 	free(pmapper);
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_having_fields_at_least_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+static sllv_t* mapper_having_fields_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec == NULL)
 		return sllv_single(NULL);
 	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
+
+	char* ppasses = schema_cache_get(pstate->pschema_cache, pinrec);
+	if (ppasses == NULL) {
+		ppasses = mlr_malloc_or_die(sizeof(char));
+		*ppasses = pstate->ppredicate(pinrec, pstate);
+		schema_cache_put(pstate->pschema_cache, pinrec, ppasses);
+	}
+	if (*ppasses) {
+		return sllv_single(pinrec);
+	} else {
+		lrec_free(pinrec);
+		return NULL;
+	}
+}
+
+// ----------------------------------------------------------------
+static int mapper_having_fields_at_least(lrec_t* pinrec, mapper_having_fields_state_t* pstate) {
 	int num_found = 0;
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
 		if (hss_has(pstate->pfield_name_set, pe->key)) {
 			num_found++;
 			if (num_found == pstate->pfield_name_set->num_occupied)
-				return sllv_single(pinrec);
+				return TRUE;
 		}
 	}
-	lrec_free(pinrec);
-	return NULL;
+	return FALSE;
 }
 
-static sllv_t* mapper_having_fields_which_are_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
-	if (pinrec == NULL)
-		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
+static int mapper_having_fields_which_are(lrec_t* pinrec, mapper_having_fields_state_t* pstate) {
 	if (pinrec->field_count != pstate->pfield_name_set->num_occupied) {
-		lrec_free(pinrec);
-		return NULL;
+		return FALSE;
 	}
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
 		if (!hss_has(pstate->pfield_name_set, pe->key)) {
-			lrec_free(pinrec);
-			return NULL;
+			return FALSE;
 		}
 	}
-	return sllv_single(pinrec);
+	return TRUE;
 }
 
-static sllv_t* mapper_having_fields_at_most_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
-	if (pinrec == NULL)
-		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
+static int mapper_having_fields_at_most(lrec_t* pinrec, mapper_having_fields_state_t* pstate) {
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
 		if (!hss_has(pstate->pfield_name_set, pe->key)) {
-			lrec_free(pinrec);
-			return NULL;
+			return FALSE;
 		}
 	}
-	return sllv_single(pinrec);
+	return TRUE;
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_having_all_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
-	if (pinrec == NULL)
-		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
-
+static int mapper_having_all_fields_matching(lrec_t* pinrec, mapper_having_fields_state_t* pstate) {
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		if (!regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
-			lrec_free(pinrec);
-			return NULL;
+		if (!fast_regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
+			return FALSE;
 		}
 	}
-	return sllv_single(pinrec);
+	return TRUE;
 }
 
-static sllv_t* mapper_having_any_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
-	if (pinrec == NULL)
-		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
-
+static int mapper_having_any_fields_matching(lrec_t* pinrec, mapper_having_fields_state_t* pstate) {
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		if (regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
-			return sllv_single(pinrec);
+		if (fast_regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
+			return TRUE;
 		}
 	}
-	lrec_free(pinrec);
-	return NULL;
+	return FALSE;
 }
 
-static sllv_t* mapper_having_no_fields_matching_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
-	if (pinrec == NULL)
-		return sllv_single(NULL);
-	mapper_having_fields_state_t* pstate = (mapper_having_fields_state_t*)pvstate;
-
+static int mapper_having_no_fields_matching(lrec_t* pinrec, mapper_having_fields_state_t* pstate) {
 	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		if (regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
-			lrec_free(pinrec);
-			return NULL;
+		if (fast_regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
+			return FALSE;
 		}
 	}
-	return sllv_single(pinrec);
+	return TRUE;
 }
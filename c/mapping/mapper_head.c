@@ -85,6 +85,16 @@ static mapper_t* mapper_head_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_na
 	return pmapper;
 }
 
+// For the CLI parser's sort-then-head fusion: see mapper_sort_fuse_head.
+int mapper_head_get_params(mapper_t* pmapper, unsigned long long* phead_count, slls_t** ppgroup_by_field_names) {
+	if (pmapper->pfree_func != mapper_head_free)
+		return FALSE;
+	mapper_head_state_t* pstate = pmapper->pvstate;
+	*phead_count            = pstate->head_count;
+	*ppgroup_by_field_names = pstate->pgroup_by_field_names;
+	return TRUE;
+}
+
 static void mapper_head_free(mapper_t* pmapper) {
 	mapper_head_state_t* pstate = pmapper->pvstate;
 	if (pstate->pgroup_by_field_names != NULL)
@@ -9,6 +9,7 @@
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/dvector.h"
+#include "containers/mlrval.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -23,14 +24,18 @@ typedef struct _mapper_histogram_state_t {
 	double mul;
 	lhmsv_t* pcounts_by_field;
 	lhmsv_t* pvectors_by_field; // For auto-mode
+	int    have_lo_hi;          // For auto-mode over two passes
+	int    do_scale;
+	double sample_rate;         // From the context, for do_scale
 } mapper_histogram_state_t;
 
 static void      mapper_histogram_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_names, double lo, int nbins, double hi,
-	int do_auto);
+	int do_auto, int do_scale);
 static void      mapper_histogram_free(mapper_t* pmapper);
+static char*     mapper_histogram_alloc_count_string(mapper_histogram_state_t* pstate, unsigned long long count);
 
 static void      mapper_histogram_ingest(lrec_t* pinrec, mapper_histogram_state_t* pstate);
 static sllv_t*   mapper_histogram_emit(mapper_histogram_state_t* pstate);
@@ -39,6 +44,7 @@ static sllv_t*   mapper_histogram_process(lrec_t* pinrec, context_t* pctx, void*
 static void      mapper_histogram_ingest_auto(lrec_t* pinrec, mapper_histogram_state_t* pstate);
 static sllv_t*   mapper_histogram_emit_auto(mapper_histogram_state_t* pstate);
 static sllv_t*   mapper_histogram_process_auto(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_histogram_process_limits(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_histogram_setup = {
@@ -56,7 +62,11 @@ static void mapper_histogram_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "--hi {hi}     Histogram high value\n");
 	fprintf(o, "--nbins {n}   Number of histogram bins\n");
 	fprintf(o, "--auto        Automatically computes limits, ignoring --lo and --hi.\n");
-	fprintf(o, "              Holds all values in memory before producing any output.\n");
+	fprintf(o, "              Holds all values in memory before producing any output,\n");
+	fprintf(o, "              unless this is the first verb and the inputs are files: then\n");
+	fprintf(o, "              they are read twice instead.\n");
+	fprintf(o, "--scale       Divide counts by the fraction of input read, with the main\n");
+	fprintf(o, "              option --sample-fraction, estimating them for all the input.\n");
 	fprintf(o, "Just a histogram. Input values < lo or > hi are not counted.\n");
 }
 
@@ -68,6 +78,7 @@ static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 	double hi = 0.0;
 	int nbins = 0;
 	int do_auto = FALSE;
+	int do_scale = FALSE;
 
 	char* verb = argv[(*pargi)++];
 
@@ -77,6 +88,7 @@ static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_float_flag(pstate, "--hi",     &hi);
 	ap_define_int_flag(pstate,   "--nbins",  &nbins);
 	ap_define_true_flag(pstate,  "--auto",   &do_auto);
+	ap_define_true_flag(pstate,  "--scale",  &do_scale);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_histogram_usage(stderr, argv[0], verb);
@@ -98,12 +110,12 @@ static mapper_t* mapper_histogram_parse_cli(int* pargi, int argc, char** argv,
 		return NULL;
 	}
 
-	return mapper_histogram_alloc(pstate, value_field_names, lo, nbins, hi, do_auto);
+	return mapper_histogram_alloc(pstate, value_field_names, lo, nbins, hi, do_auto, do_scale);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_names,
-	double lo, int nbins, double hi, int do_auto)
+	double lo, int nbins, double hi, int do_auto, int do_scale)
 {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
@@ -134,6 +146,10 @@ static mapper_t* mapper_histogram_alloc(ap_state_t* pargp, slls_t* value_field_n
 		pstate->mul = nbins / (hi - lo);
 	}
 
+	pstate->have_lo_hi  = FALSE;
+	pstate->do_scale    = do_scale;
+	pstate->sample_rate = 1.0;
+
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = do_auto ? mapper_histogram_process_auto : mapper_histogram_process;
 	pmapper->pfree_func    = mapper_histogram_free;
@@ -166,6 +182,7 @@ static void mapper_histogram_free(mapper_t* pmapper) {
 // ----------------------------------------------------------------
 static sllv_t* mapper_histogram_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_histogram_state_t* pstate = pvstate;
+	pstate->sample_rate = pctx->sample_rate;
 	if (pinrec != NULL) {
 		mapper_histogram_ingest(pinrec, pstate);
 		lrec_free(pinrec);
@@ -220,7 +237,7 @@ static sllv_t* mapper_histogram_emit(mapper_histogram_state_t* pstate) {
 
 			char* count_field_name = lhmss_get(pcount_field_names, value_field_name);
 
-			value = mlr_alloc_string_from_ull(pcounts[i]);
+			value = mapper_histogram_alloc_count_string(pstate, pcounts[i]);
 			lrec_put(poutrec, mlr_strdup_or_die(count_field_name), value, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
 		}
 
@@ -233,9 +250,21 @@ static sllv_t* mapper_histogram_emit(mapper_histogram_state_t* pstate) {
 	return poutrecs;
 }
 
+// ----------------------------------------------------------------
+// Records read with --sample-fraction each stand for 1/rate input records, so that's the expected ratio of
+// full-input count to sampled.
+static char* mapper_histogram_alloc_count_string(mapper_histogram_state_t* pstate, unsigned long long count) {
+	if (pstate->do_scale && pstate->sample_rate != 1.0) {
+		mv_t scaled = mv_from_float(count / pstate->sample_rate);
+		return mv_alloc_format_val(&scaled);
+	}
+	return mlr_alloc_string_from_ull(count);
+}
+
 // ----------------------------------------------------------------
 static sllv_t* mapper_histogram_process_auto(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_histogram_state_t* pstate = pvstate;
+	pstate->sample_rate = pctx->sample_rate;
 	if (pinrec != NULL) {
 		mapper_histogram_ingest_auto(pinrec, pstate);
 		lrec_free(pinrec);
@@ -324,7 +353,7 @@ static sllv_t* mapper_histogram_emit_auto(mapper_histogram_state_t* pstate) {
 			char* value_field_name = pe->value;
 			unsigned long long* pcounts = lhmsv_get(pstate->pcounts_by_field, value_field_name);
 			char* count_field_name = lhmss_get(pcount_field_names, value_field_name);
-			value = mlr_alloc_string_from_ull(pcounts[i]);
+			value = mapper_histogram_alloc_count_string(pstate, pcounts[i]);
 			lrec_put(poutrec, mlr_strdup_or_die(count_field_name), value, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
 		}
 
@@ -335,3 +364,46 @@ static sllv_t* mapper_histogram_emit_auto(mapper_histogram_state_t* pstate) {
 	lhmss_free(pcount_field_names);
 	return poutrecs;
 }
+
+// ----------------------------------------------------------------
+// For the stream driver's two-pass reading: with --auto, the first pass finds the limits and the second bins
+// as without --auto, so the values needn't be held.
+int mapper_histogram_start_first_pass(mapper_t* pmapper) {
+	if (pmapper->pprocess_func != mapper_histogram_process_auto)
+		return FALSE;
+	pmapper->pprocess_func = mapper_histogram_process_limits;
+	return TRUE;
+}
+
+void mapper_histogram_start_second_pass(mapper_t* pmapper) {
+	mapper_histogram_state_t* pstate = pmapper->pvstate;
+	if (!pstate->have_lo_hi) {
+		pstate->lo = 0.0;
+		pstate->hi = 1.0;
+	}
+	pstate->mul = pstate->nbins / (pstate->hi - pstate->lo);
+	pmapper->pprocess_func = mapper_histogram_process;
+}
+
+static sllv_t* mapper_histogram_process_limits(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_histogram_state_t* pstate = pvstate;
+	if (pinrec == NULL)
+		return NULL;
+	for (sllse_t* pe = pstate->value_field_names->phead; pe != NULL; pe = pe->pnext) {
+		char* strv = lrec_get(pinrec, pe->value);
+		if (strv != NULL) {
+			double val = mlr_double_from_string_or_die(strv);
+			if (!pstate->have_lo_hi) {
+				pstate->lo = val;
+				pstate->hi = val;
+				pstate->have_lo_hi = TRUE;
+			} else if (pstate->lo > val) {
+				pstate->lo = val;
+			} else if (pstate->hi < val) {
+				pstate->hi = val;
+			}
+		}
+	}
+	lrec_free(pinrec);
+	return NULL;
+}
@@ -1,10 +1,15 @@
+#include <sys/stat.h>
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "containers/lrec.h"
+#include "containers/lrec_spill.h"
 #include "containers/sllv.h"
 #include "containers/lhmslv.h"
 #include "containers/mixutil.h"
 #include "containers/join_bucket_keeper.h"
+#include "containers/join_index.h"
+#include "containers/bloom_filter.h"
+#include "lib/string_builder.h"
 #include "mapping/mappers.h"
 #include "input/lrec_readers.h"
 
@@ -22,6 +27,8 @@ typedef struct _mapper_join_opts_t {
 	int      emit_pairables;
 	int      emit_left_unpairables;
 	int      emit_right_unpairables;
+	long long max_memory; // 0 for no limit
+	char*    index_file_name; // NULL for no index
 
 	char*    prepipe;
 	char*    left_file_name;
@@ -44,9 +51,48 @@ typedef struct _mapper_join_state_t {
 	// For unsorted input
 	lhmslv_t* pleft_buckets_by_join_field_values;
 	sllv_t*   pleft_unpaired_records;
+	// Over the buckets' keys, so that most unpaired right records are found so without a hashmap lookup.
+	bloom_filter_t* pleft_key_filter;
+
+	// For unsorted input with a reusable index of the left file
+	join_index_t* pjoin_index;
+	char*         pindex_bucket_paired;
+
+	// For unsorted input beyond --max-memory: see the GRACE HASH JOIN section below.
+	long long           left_memory;
+	int                 num_partitions; // 0 until the left file outgrows max_memory
+	FILE**              left_partitions;
+	FILE**              right_partitions;
+	FILE**              pair_outputs;
+	FILE**              left_outputs;
+	FILE*               pleft_unpaired_spill;
+	FILE*               pright_unpaired_spill;
+	unsigned long long  left_sequence;
+	unsigned long long  right_sequence;
+	struct _join_run_t* runs;
+	int                 num_runs;
+	int                 output_phase;
 
 } mapper_join_state_t;
 
+// Records read back from tagged spill files, merged on their tags.
+typedef struct _join_run_t {
+	FILE*              fp;
+	unsigned long long tag;
+	lrec_t*            prec;
+} join_run_t;
+
+// A left-file bucket when joining one partition.
+typedef struct _join_partition_bucket_t {
+	sllv_t*            precords;
+	unsigned long long first_tag;
+	int                was_paired;
+} join_partition_bucket_t;
+
+#define JOIN_MIN_PARTITIONS 16
+#define JOIN_MAX_PARTITIONS 128
+#define JOIN_OUTPUT_BATCH_SIZE 1000
+
 // ----------------------------------------------------------------
 static void mapper_join_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
@@ -54,10 +100,18 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 static mapper_t* mapper_join_alloc(mapper_join_opts_t* popts);
 static void mapper_join_free(mapper_t* pmapper);
 static void ingest_left_file(mapper_join_state_t* pstate);
+static int  mapper_join_may_pair(lrec_t* pright_rec, mapper_join_state_t* pstate);
 static void mapper_join_form_pairs(sllv_t* pleft_records, lrec_t* pright_rec, mapper_join_state_t* pstate,
 	sllv_t* pout_recs);
 static sllv_t* mapper_join_process_sorted(lrec_t* pright_rec, context_t* pctx, void* pvstate);
 static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx, void* pvstate);
+static void    mapper_join_start_partitioning(mapper_join_state_t* pstate);
+static void    mapper_join_partition_left_record(mapper_join_state_t* pstate, lrec_t* pleft_rec,
+	slls_t* pleft_field_values);
+static sllv_t* mapper_join_process_partitioned(lrec_t* pright_rec, context_t* pctx, mapper_join_state_t* pstate);
+static void    mapper_join_free_partitioning(mapper_join_state_t* pstate);
+static void    mapper_join_open_or_build_index(mapper_join_state_t* pstate);
+static sllv_t* mapper_join_process_indexed(lrec_t* pright_rec, context_t* pctx, mapper_join_state_t* pstate);
 
 mapper_setup_t mapper_join_setup = {
 	.verb = "join",
@@ -91,6 +145,22 @@ static void mapper_join_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "               be loaded into memory. Without -u, records must be sorted\n");
 	fprintf(o, "               lexically by their join-field names, else not all records will\n");
 	fprintf(o, "               be paired.\n");
+	fprintf(o, "  --max-memory {size} With -u: keep at most about this much left-file record\n");
+	fprintf(o, "               data in memory, e.g. 500000000, 500m, or 2g. Beyond that, left and\n");
+	fprintf(o, "               right records are hash-partitioned on their join-field values\n");
+	fprintf(o, "               into temp files in $TMPDIR (default /tmp), and the partitions are\n");
+	fprintf(o, "               joined one at a time at end of stream. Output is the same, in the\n");
+	fprintf(o, "               same order, but is not produced until end of stream, and then in\n");
+	fprintf(o, "               batches, so prints in end blocks of a put or filter after this\n");
+	fprintf(o, "               verb come after the first batches rather than before them.\n");
+	fprintf(o, "  --index      With -u: keep an index of the left file in {left file name}.mlrjidx,\n");
+	fprintf(o, "               building it if missing or out of date, else memory-mapping it\n");
+	fprintf(o, "               instead of reading the left file. This is for a left file\n");
+	fprintf(o, "               joined against many times. The index holds a copy of the left\n");
+	fprintf(o, "               file's records, and is rebuilt when the left file's size or\n");
+	fprintf(o, "               modification time changes, or the left-file options or join-field\n");
+	fprintf(o, "               names differ.\n");
+	fprintf(o, "  --index-file {name} As --index, with the given index file name.\n");
 	fprintf(o, "  --prepipe {command} As in main input options; see %s --help for details.\n",
 		MLR_GLOBALS.bargv0);
 	fprintf(o, "               If you wish to use a prepipe command for the main input as well\n");
@@ -134,6 +204,9 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 	popts->emit_left_unpairables               = FALSE;
 	popts->emit_right_unpairables              = FALSE;
 	popts->allow_unsorted_input                = FALSE;
+	popts->max_memory                          = 0LL;
+	popts->index_file_name                     = NULL;
+	int use_index                              = FALSE;
 
 	int argi = *pargi;
 	char* verb = argv[argi++];
@@ -143,6 +216,12 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 		if (argv[argi][0] != '-') {
 			break; // No more flag options to process
 
+		} else if (streq(argv[argi], "--sample-fraction")) {
+			// Sampling the left file would silently drop pairings, and --index would keep them dropped.
+			fprintf(stderr, "%s %s: --sample-fraction is not supported for the left file.\n",
+				MLR_GLOBALS.bargv0, verb);
+			return NULL;
+
 		} else if (cli_handle_reader_options(argv, argc, &argi, &popts->reader_opts)) {
 			// handled
 
@@ -221,6 +300,26 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 			popts->allow_unsorted_input = TRUE;
 			argi += 1;
 
+		} else if (streq(argv[argi], "--max-memory")) {
+			if ((argc - argi) < 2) {
+				mapper_join_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			popts->max_memory = mlr_memory_size_from_string_or_die(verb, argv[argi+1]);
+			argi += 2;
+
+		} else if (streq(argv[argi], "--index")) {
+			use_index = TRUE;
+			argi += 1;
+
+		} else if (streq(argv[argi], "--index-file")) {
+			if ((argc - argi) < 2) {
+				mapper_join_usage(stderr, argv[0], verb);
+				return NULL;
+			}
+			popts->index_file_name = mlr_strdup_or_die(argv[argi+1]);
+			argi += 2;
+
 		} else {
 			mapper_join_usage(stderr, argv[0], verb);
 			return NULL;
@@ -240,6 +339,19 @@ static mapper_t* mapper_join_parse_cli(int* pargi, int argc, char** argv,
 		return NULL;
 	}
 
+	if (use_index && popts->index_file_name == NULL)
+		popts->index_file_name = mlr_paste_2_strings(popts->left_file_name, ".mlrjidx");
+	if (popts->index_file_name != NULL) {
+		if (!popts->allow_unsorted_input || popts->prepipe != NULL || popts->max_memory > 0LL) {
+			fprintf(stderr, "%s %s: --index needs -u, and can't be used with --prepipe or --max-memory.\n",
+				MLR_GLOBALS.bargv0, verb);
+			return NULL;
+		}
+	} else if (popts->max_memory > 0LL && !popts->allow_unsorted_input) {
+		fprintf(stderr, "%s %s: --max-memory needs -u.\n", MLR_GLOBALS.bargv0, verb);
+		return NULL;
+	}
+
 	if (!popts->emit_pairables && !popts->emit_left_unpairables && !popts->emit_right_unpairables) {
 		fprintf(stderr, "%s %s: all emit flags are unset; no output is possible.\n",
 			MLR_GLOBALS.bargv0, verb);
@@ -289,6 +401,23 @@ static mapper_t* mapper_join_alloc(mapper_join_opts_t* popts) {
 
 	pstate->pleft_buckets_by_join_field_values = NULL;
 	pstate->pleft_unpaired_records             = NULL;
+	pstate->pleft_key_filter                   = NULL;
+
+	pstate->left_memory                        = 0LL;
+	pstate->num_partitions                     = 0;
+	pstate->left_partitions                    = NULL;
+	pstate->right_partitions                   = NULL;
+	pstate->pair_outputs                       = NULL;
+	pstate->left_outputs                       = NULL;
+	pstate->pleft_unpaired_spill               = NULL;
+	pstate->pright_unpaired_spill              = NULL;
+	pstate->left_sequence                      = 0LL;
+	pstate->right_sequence                     = 0LL;
+	pstate->runs                               = NULL;
+	pstate->num_runs                           = 0;
+	pstate->output_phase                       = 0;
+	pstate->pjoin_index                        = NULL;
+	pstate->pindex_bucket_paired               = NULL;
 
 	pmapper->pvstate = (void*)pstate;
 	if (popts->allow_unsorted_input) {
@@ -321,6 +450,11 @@ static void mapper_join_free(mapper_t* pmapper) {
 	// The void-star payload, which is lrec_t*'s, should have been sllv_transferred out.
 	// Misses should be detected by valgrind --leak-check=full, e.g. reg_test/run --valgrind.
 	sllv_free(pstate->pleft_unpaired_records);
+	mapper_join_free_partitioning(pstate);
+	bloom_filter_free(pstate->pleft_key_filter);
+	join_index_free(pstate->pjoin_index);
+	free(pstate->pindex_bucket_paired);
+	free(pstate->popts->index_file_name);
 
 	join_bucket_keeper_free(pstate->pjoin_bucket_keeper, pstate->popts->prepipe);
 
@@ -410,8 +544,17 @@ static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx,
 
 	// This can't be done in the CLI-parser since it requires information which
 	// isn't known until after the CLI-parser is called.
-	if (pstate->pleft_buckets_by_join_field_values == NULL) // First call
-		ingest_left_file(pstate);
+	if (pstate->pleft_buckets_by_join_field_values == NULL) { // First call
+		if (pstate->popts->index_file_name != NULL)
+			mapper_join_open_or_build_index(pstate);
+		else
+			ingest_left_file(pstate);
+	}
+
+	if (pstate->pjoin_index != NULL)
+		return mapper_join_process_indexed(pright_rec, pctx, pstate);
+	if (pstate->num_partitions > 0)
+		return mapper_join_process_partitioned(pright_rec, pctx, pstate);
 
 	if (pright_rec == NULL) { // End of input record stream
 		if (pstate->popts->emit_left_unpairables) {
@@ -436,6 +579,15 @@ static sllv_t* mapper_join_process_unsorted(lrec_t* pright_rec, context_t* pctx,
 		}
 	}
 
+	if (!mapper_join_may_pair(pright_rec, pstate)) {
+		if (pstate->popts->emit_right_unpairables) {
+			return sllv_single(pright_rec);
+		} else {
+			lrec_free(pright_rec);
+			return NULL;
+		}
+	}
+
 	slls_t* pright_field_values = mlr_reference_selected_values_from_record(pright_rec, pstate->popts->pright_join_field_names);
 	if (pright_field_values != NULL) {
 		join_bucket_t* pleft_bucket = lhmslv_get(pstate->pleft_buckets_by_join_field_values, pright_field_values);
@@ -544,9 +696,25 @@ static void ingest_left_file(mapper_join_state_t* pstate) {
 		lrec_t* pleft_rec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, pctx);
 		if (pleft_rec == NULL)
 			break;
+		if (pstate->num_partitions == 0)
+			lrec_compact(pleft_rec);
 
 		slls_t* pleft_field_values = mlr_reference_selected_values_from_record(pleft_rec,
 			pstate->popts->pleft_join_field_names);
+		if (pstate->num_partitions > 0) {
+			mapper_join_partition_left_record(pstate, pleft_rec, pleft_field_values);
+			slls_free(pleft_field_values);
+			continue;
+		}
+		if (popts->max_memory > 0LL) {
+			pstate->left_memory += lrec_memory_footprint(pleft_rec);
+			if (pstate->left_memory > popts->max_memory) {
+				mapper_join_start_partitioning(pstate);
+				mapper_join_partition_left_record(pstate, pleft_rec, pleft_field_values);
+				slls_free(pleft_field_values);
+				continue;
+			}
+		}
 		if (pleft_field_values != NULL) {
 			join_bucket_t* pbucket = lhmslv_get(pstate->pleft_buckets_by_join_field_values, pleft_field_values);
 			if (pbucket == NULL) { // New key-field-value: new bucket and hash-map entry
@@ -570,4 +738,482 @@ static void ingest_left_file(mapper_join_state_t* pstate) {
 	plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, pstate->popts->prepipe);
 
 	plrec_reader->pfree_func(plrec_reader);
+
+	if (pstate->num_partitions == 0) {
+		lhmslv_t* pbuckets = pstate->pleft_buckets_by_join_field_values;
+		pstate->pleft_key_filter = bloom_filter_alloc(pbuckets->num_occupied);
+		for (lhmslve_t* pe = pbuckets->phead; pe != NULL; pe = pe->pnext) {
+			join_bucket_t* pbucket = pe->pvvalue;
+			bloom_filter_add(pstate->pleft_key_filter, bloom_hash_values(pbucket->pleft_field_values));
+		}
+	}
+}
+
+// False if the right record certainly doesn't pair: it lacks a join field, or the left-key filter rules
+// its values out. This hashes the values in place, without collecting them into a list.
+static int mapper_join_may_pair(lrec_t* pright_rec, mapper_join_state_t* pstate) {
+	if (pstate->pleft_key_filter == NULL)
+		return TRUE;
+	unsigned long long hash = BLOOM_HASH_SEED;
+	for (sllse_t* pe = pstate->popts->pright_join_field_names->phead; pe != NULL; pe = pe->pnext) {
+		char* value = lrec_get(pright_rec, pe->value);
+		if (value == NULL)
+			return FALSE;
+		hash = bloom_hash_append(hash, value);
+	}
+	return bloom_filter_may_contain(pstate->pleft_key_filter, hash);
+}
+
+// ================================================================
+// GRACE HASH JOIN
+//
+// With -u and --max-memory, once the left records read so far exceed the
+// limit, the left file is hash-partitioned on its join-field values into temp
+// files, the buckets already in memory first. Right records are routed to
+// the same partitions by their own join-field values, so each pairing is
+// found within one partition. At end of stream each partition is joined in
+// memory, one at a time, by the unsorted-join rules.
+//
+// Output order is kept the same as for the in-memory join by tagging spilled
+// records with sequence numbers and merging each partition's output on them:
+// * Pairs and unpaired right records are tagged with the right record's
+//   arrival number.
+// * Unpaired left records are tagged with their bucket's order of first
+//   appearance in the left file. The buckets already in memory are numbered
+//   0..n-1 as they're spilled, then later left records n, n+1, ...: in
+//   each partition file the first record of a bucket has the bucket's least
+//   tag.
+// * Left records lacking join fields, and right ones with --ur, go to their
+//   own spill files, the latter tagged for merging with the pairs.
+//
+// A single partition larger than the limit (e.g. one heavily repeated join
+// key) is still loaded whole.
+
+static unsigned join_partition_index(slls_t* pfield_values, int num_partitions) {
+	unsigned hash = 0;
+	for (sllse_t* pe = pfield_values->phead; pe != NULL; pe = pe->pnext)
+		hash = hash * 31 + (unsigned)mlr_string_hash_func(pe->value);
+	// Mix the bits, else each partition's keys would share their low bits, clustering them in its hashmap.
+	return (unsigned)(((unsigned long long)hash * 0x9E3779B97F4A7C15ULL) >> 40) % num_partitions;
+}
+
+// Aiming for partitions of about a third of the limit in file bytes, allowing for in-memory overhead.
+static int join_num_partitions(mapper_join_state_t* pstate) {
+	struct stat statbuf;
+	if (pstate->popts->prepipe != NULL || stat(pstate->popts->left_file_name, &statbuf) != 0)
+		return JOIN_MAX_PARTITIONS;
+	long long num_partitions = 3 * (long long)statbuf.st_size / pstate->popts->max_memory + 1;
+	if (num_partitions < JOIN_MIN_PARTITIONS)
+		return JOIN_MIN_PARTITIONS;
+	if (num_partitions > JOIN_MAX_PARTITIONS)
+		return JOIN_MAX_PARTITIONS;
+	return num_partitions;
+}
+
+static void spill_write_tagged(FILE* fp, unsigned long long tag, lrec_t* prec) {
+	spill_write_ull(fp, tag);
+	lrec_spill_write(fp, prec);
+}
+
+static lrec_t* spill_read_tagged(FILE* fp, unsigned long long* ptag) {
+	if (!spill_read_ull(fp, ptag))
+		return NULL;
+	lrec_t* prec = lrec_spill_read(fp);
+	if (prec == NULL) {
+		fprintf(stderr, "%s: truncated temp file.\n", MLR_GLOBALS.bargv0);
+		exit(1);
+	}
+	return prec;
+}
+
+// ----------------------------------------------------------------
+static void mapper_join_start_partitioning(mapper_join_state_t* pstate) {
+	int num_partitions = join_num_partitions(pstate);
+	pstate->num_partitions        = num_partitions;
+	pstate->left_partitions       = mlr_malloc_or_die(num_partitions * sizeof(FILE*));
+	pstate->right_partitions      = mlr_malloc_or_die(num_partitions * sizeof(FILE*));
+	// One more for the unpaired right records.
+	pstate->pair_outputs          = mlr_malloc_or_die((num_partitions + 1) * sizeof(FILE*));
+	pstate->left_outputs          = mlr_malloc_or_die(num_partitions * sizeof(FILE*));
+	for (int i = 0; i < num_partitions; i++) {
+		pstate->left_partitions[i]  = spill_file_open_or_die();
+		pstate->right_partitions[i] = spill_file_open_or_die();
+		pstate->pair_outputs[i]     = NULL;
+		pstate->left_outputs[i]     = NULL;
+	}
+	pstate->pair_outputs[num_partitions] = NULL;
+	pstate->pleft_unpaired_spill  = spill_file_open_or_die();
+	pstate->pright_unpaired_spill = spill_file_open_or_die();
+
+	// Tagged with their bucket's order of first appearance.
+	lhmslv_t* pbuckets = pstate->pleft_buckets_by_join_field_values;
+	for (lhmslve_t* pe = pbuckets->phead; pe != NULL; pe = pe->pnext) {
+		join_bucket_t* pbucket = pe->pvvalue;
+		FILE* fp = pstate->left_partitions[join_partition_index(pbucket->pleft_field_values, num_partitions)];
+		unsigned long long tag = pstate->left_sequence++;
+		while (pbucket->precords->phead) {
+			lrec_t* prec = sllv_pop(pbucket->precords);
+			spill_write_tagged(fp, tag, prec);
+			lrec_free(prec);
+		}
+		slls_free(pbucket->pleft_field_values);
+		sllv_free(pbucket->precords);
+		free(pbucket);
+	}
+	lhmslv_free(pbuckets);
+	// Left non-NULL: it marks the left file as ingested.
+	pstate->pleft_buckets_by_join_field_values = lhmslv_alloc();
+
+	while (pstate->pleft_unpaired_records->phead) {
+		lrec_t* prec = sllv_pop(pstate->pleft_unpaired_records);
+		lrec_spill_write(pstate->pleft_unpaired_spill, prec);
+		lrec_free(prec);
+	}
+}
+
+static void mapper_join_partition_left_record(mapper_join_state_t* pstate, lrec_t* pleft_rec,
+	slls_t* pleft_field_values)
+{
+	if (pleft_field_values == NULL) {
+		lrec_spill_write(pstate->pleft_unpaired_spill, pleft_rec);
+	} else {
+		FILE* fp = pstate->left_partitions[join_partition_index(pleft_field_values, pstate->num_partitions)];
+		spill_write_tagged(fp, pstate->left_sequence++, pleft_rec);
+	}
+	lrec_free(pleft_rec);
+}
+
+// ----------------------------------------------------------------
+static void mapper_join_join_partition(mapper_join_state_t* pstate, int partition);
+static void join_runs_start(mapper_join_state_t* pstate, FILE** files, int num_files);
+static lrec_t* join_runs_pop(mapper_join_state_t* pstate);
+
+static sllv_t* mapper_join_process_partitioned(lrec_t* pright_rec, context_t* pctx, mapper_join_state_t* pstate) {
+	mapper_join_opts_t* popts = pstate->popts;
+
+	if (pright_rec != NULL) {
+		unsigned long long tag = pstate->right_sequence++;
+		slls_t* pright_field_values = mlr_reference_selected_values_from_record(pright_rec,
+			popts->pright_join_field_names);
+		if (pright_field_values != NULL) {
+			FILE* fp = pstate->right_partitions[join_partition_index(pright_field_values, pstate->num_partitions)];
+			spill_write_tagged(fp, tag, pright_rec);
+			slls_free(pright_field_values);
+		} else if (popts->emit_right_unpairables) {
+			spill_write_tagged(pstate->pright_unpaired_spill, tag, pright_rec);
+		}
+		lrec_free(pright_rec);
+		return NULL;
+	}
+
+	// End of stream. Phases: join the partitions; merge the pairs and unpaired right records; merge the
+	// unpaired left records; then the left records lacking join fields. Output is returned in batches.
+	if (pstate->output_phase == 0) {
+		for (int i = 0; i < pstate->num_partitions; i++)
+			mapper_join_join_partition(pstate, i);
+		pstate->pair_outputs[pstate->num_partitions] = pstate->pright_unpaired_spill;
+		pstate->pright_unpaired_spill = NULL;
+		join_runs_start(pstate, pstate->pair_outputs, pstate->num_partitions + 1);
+		pstate->output_phase = 1;
+	}
+
+	sllv_t* poutrecs = sllv_alloc();
+	while (poutrecs->length < JOIN_OUTPUT_BATCH_SIZE) {
+		lrec_t* prec = NULL;
+		if (pstate->output_phase == 1) {
+			prec = join_runs_pop(pstate);
+			if (prec == NULL) {
+				if (popts->emit_left_unpairables)
+					join_runs_start(pstate, pstate->left_outputs, pstate->num_partitions);
+				pstate->output_phase = 2;
+				continue;
+			}
+		} else if (pstate->output_phase == 2) {
+			prec = join_runs_pop(pstate);
+			if (prec == NULL) {
+				rewind(pstate->pleft_unpaired_spill);
+				pstate->output_phase = 3;
+				continue;
+			}
+		} else {
+			if (popts->emit_left_unpairables)
+				prec = lrec_spill_read(pstate->pleft_unpaired_spill);
+			if (prec == NULL) {
+				sllv_append(poutrecs, NULL); // Signal end of output-record stream.
+				return poutrecs;
+			}
+		}
+		sllv_append(poutrecs, prec);
+	}
+	pctx->more_output = TRUE;
+	return poutrecs;
+}
+
+// ----------------------------------------------------------------
+// Writes the partition's pairs and unpaired right records, and unpaired left records if wanted, to
+// tagged output files, in the order the in-memory join would emit them.
+static void mapper_join_join_partition(mapper_join_state_t* pstate, int partition) {
+	mapper_join_opts_t* popts = pstate->popts;
+	lhmslv_t* pbuckets = lhmslv_alloc();
+	unsigned long long tag = 0LL;
+
+	FILE* pleft = pstate->left_partitions[partition];
+	rewind(pleft);
+	lrec_t* pleft_rec;
+	while ((pleft_rec = spill_read_tagged(pleft, &tag)) != NULL) {
+		slls_t* pleft_field_values = mlr_reference_selected_values_from_record(pleft_rec,
+			popts->pleft_join_field_names);
+		join_partition_bucket_t* pbucket = lhmslv_get(pbuckets, pleft_field_values);
+		if (pbucket == NULL) {
+			pbucket = mlr_malloc_or_die(sizeof(join_partition_bucket_t));
+			pbucket->precords   = sllv_alloc();
+			pbucket->first_tag  = tag;
+			pbucket->was_paired = FALSE;
+			lhmslv_put(pbuckets, slls_copy(pleft_field_values), pbucket, FREE_ENTRY_KEY);
+		}
+		sllv_append(pbucket->precords, pleft_rec);
+		slls_free(pleft_field_values);
+	}
+	fclose(pleft);
+	pstate->left_partitions[partition] = NULL;
+
+	FILE* ppairs = spill_file_open_or_die();
+	FILE* pright = pstate->right_partitions[partition];
+	rewind(pright);
+	lrec_t* pright_rec;
+	while ((pright_rec = spill_read_tagged(pright, &tag)) != NULL) {
+		slls_t* pright_field_values = mlr_reference_selected_values_from_record(pright_rec,
+			popts->pright_join_field_names);
+		join_partition_bucket_t* pbucket = lhmslv_get(pbuckets, pright_field_values);
+		slls_free(pright_field_values);
+		if (pbucket == NULL) {
+			if (popts->emit_right_unpairables)
+				spill_write_tagged(ppairs, tag, pright_rec);
+		} else {
+			pbucket->was_paired = TRUE;
+			if (popts->emit_pairables) {
+				sllv_t* ppairs_for_record = sllv_alloc();
+				mapper_join_form_pairs(pbucket->precords, pright_rec, pstate, ppairs_for_record);
+				while (ppairs_for_record->phead) {
+					lrec_t* prec = sllv_pop(ppairs_for_record);
+					spill_write_tagged(ppairs, tag, prec);
+					lrec_free(prec);
+				}
+				sllv_free(ppairs_for_record);
+			}
+		}
+		lrec_free(pright_rec);
+	}
+	fclose(pright);
+	pstate->right_partitions[partition] = NULL;
+	pstate->pair_outputs[partition] = ppairs;
+
+	FILE* pleft_output = popts->emit_left_unpairables ? spill_file_open_or_die() : NULL;
+	for (lhmslve_t* pe = pbuckets->phead; pe != NULL; pe = pe->pnext) {
+		join_partition_bucket_t* pbucket = pe->pvvalue;
+		while (pbucket->precords->phead) {
+			lrec_t* prec = sllv_pop(pbucket->precords);
+			if (pleft_output != NULL && !pbucket->was_paired)
+				spill_write_tagged(pleft_output, pbucket->first_tag, prec);
+			lrec_free(prec);
+		}
+		sllv_free(pbucket->precords);
+		free(pbucket);
+	}
+	lhmslv_free(pbuckets);
+	pstate->left_outputs[partition] = pleft_output;
+}
+
+// ----------------------------------------------------------------
+// A min-heap of runs on their current tags. Within each file tags are nondecreasing, and equal tags
+// occur within one file only, so the merge keeps each file's order.
+static int join_run_advance(join_run_t* prun) {
+	prun->prec = spill_read_tagged(prun->fp, &prun->tag);
+	if (prun->prec == NULL) {
+		fclose(prun->fp);
+		prun->fp = NULL;
+		return FALSE;
+	}
+	return TRUE;
+}
+
+static void join_runs_sift_down(join_run_t* runs, int num_runs, int i) {
+	while (TRUE) {
+		int l = 2*i + 1;
+		int r = l + 1;
+		int m = i;
+		if (l < num_runs && runs[l].tag < runs[m].tag)
+			m = l;
+		if (r < num_runs && runs[r].tag < runs[m].tag)
+			m = r;
+		if (m == i)
+			break;
+		join_run_t temp = runs[m];
+		runs[m] = runs[i];
+		runs[i] = temp;
+		i = m;
+	}
+}
+
+// Takes ownership of the files.
+static void join_runs_start(mapper_join_state_t* pstate, FILE** files, int num_files) {
+	free(pstate->runs);
+	pstate->runs = mlr_malloc_or_die(num_files * sizeof(join_run_t));
+	pstate->num_runs = 0;
+	for (int i = 0; i < num_files; i++) {
+		join_run_t* prun = &pstate->runs[pstate->num_runs];
+		prun->fp = files[i];
+		files[i] = NULL;
+		if (prun->fp == NULL)
+			continue;
+		rewind(prun->fp);
+		if (join_run_advance(prun))
+			pstate->num_runs++;
+	}
+	for (int i = pstate->num_runs/2 - 1; i >= 0; i--)
+		join_runs_sift_down(pstate->runs, pstate->num_runs, i);
+}
+
+static lrec_t* join_runs_pop(mapper_join_state_t* pstate) {
+	if (pstate->num_runs == 0)
+		return NULL;
+	join_run_t* ptop = &pstate->runs[0];
+	lrec_t* prec = ptop->prec;
+	if (!join_run_advance(ptop))
+		*ptop = pstate->runs[--pstate->num_runs];
+	join_runs_sift_down(pstate->runs, pstate->num_runs, 0);
+	return prec;
+}
+
+// ----------------------------------------------------------------
+static void close_spill_files(FILE** files, int num_files) {
+	if (files == NULL)
+		return;
+	for (int i = 0; i < num_files; i++)
+		if (files[i] != NULL)
+			fclose(files[i]);
+	free(files);
+}
+
+static void mapper_join_free_partitioning(mapper_join_state_t* pstate) {
+	if (pstate->num_partitions == 0)
+		return;
+	close_spill_files(pstate->left_partitions, pstate->num_partitions);
+	close_spill_files(pstate->right_partitions, pstate->num_partitions);
+	close_spill_files(pstate->pair_outputs, pstate->num_partitions + 1);
+	close_spill_files(pstate->left_outputs, pstate->num_partitions);
+	if (pstate->pleft_unpaired_spill != NULL)
+		fclose(pstate->pleft_unpaired_spill);
+	if (pstate->pright_unpaired_spill != NULL)
+		fclose(pstate->pright_unpaired_spill);
+	for (int i = 0; i < pstate->num_runs; i++) {
+		fclose(pstate->runs[i].fp);
+		lrec_free(pstate->runs[i].prec);
+	}
+	free(pstate->runs);
+}
+
+// ================================================================
+// INDEXED LEFT FILE
+//
+// With --index, the first run builds the index from the in-memory buckets
+// after reading the left file as usual; later runs map it instead. Lookups
+// then decode only the left records which pair, plus, with --ul, the
+// unpaired ones at end of stream. See containers/join_index.h.
+
+static void sb_append_field(string_builder_t* psb, char* name, char* value) {
+	sb_append_string(psb, name);
+	sb_append_char(psb, '=');
+	sb_append_string(psb, (value == NULL) ? "" : value);
+	sb_append_char(psb, '\n');
+}
+
+// Everything the index contents depend on besides the left file itself.
+static char* mapper_join_index_signature(mapper_join_opts_t* popts) {
+	cli_reader_opts_t* preader_opts = &popts->reader_opts;
+	string_builder_t* psb = sb_alloc(256);
+	sb_append_field(psb, "ifmt", preader_opts->ifile_fmt);
+	sb_append_field(psb, "irs", preader_opts->irs);
+	sb_append_field(psb, "ifs", preader_opts->ifs);
+	sb_append_field(psb, "ips", preader_opts->ips);
+	sb_append_field(psb, "jflatsep", preader_opts->input_json_flatten_separator);
+	sb_append_field(psb, "repifs", preader_opts->allow_repeat_ifs ? "1" : "0");
+	sb_append_field(psb, "repips", preader_opts->allow_repeat_ips ? "1" : "0");
+	sb_append_field(psb, "implicit-header", preader_opts->use_implicit_csv_header ? "1" : "0");
+	for (sllse_t* pe = popts->pleft_join_field_names->phead; pe != NULL; pe = pe->pnext)
+		sb_append_field(psb, "l", pe->value);
+	char* signature = sb_finish(psb);
+	sb_free(psb);
+	return signature;
+}
+
+static void mapper_join_open_or_build_index(mapper_join_state_t* pstate) {
+	mapper_join_opts_t* popts = pstate->popts;
+	struct stat source_stat;
+	if (stat(popts->left_file_name, &source_stat) != 0) {
+		perror("stat");
+		fprintf(stderr, "%s: could not stat \"%s\".\n", MLR_GLOBALS.bargv0, popts->left_file_name);
+		exit(1);
+	}
+	char* signature = mapper_join_index_signature(popts);
+
+	pstate->pjoin_index = join_index_open(popts->index_file_name, &source_stat, signature);
+	if (pstate->pjoin_index != NULL) {
+		pstate->pindex_bucket_paired = mlr_malloc_or_die(pstate->pjoin_index->num_buckets + 1);
+		memset(pstate->pindex_bucket_paired, 0, pstate->pjoin_index->num_buckets + 1);
+		// Non-NULL marks the left file as ingested.
+		pstate->pleft_buckets_by_join_field_values = lhmslv_alloc();
+	} else {
+		ingest_left_file(pstate);
+		join_index_write(popts->index_file_name, &source_stat, signature,
+			pstate->pleft_buckets_by_join_field_values, pstate->pleft_unpaired_records);
+	}
+	free(signature);
+}
+
+static sllv_t* mapper_join_process_indexed(lrec_t* pright_rec, context_t* pctx, mapper_join_state_t* pstate) {
+	mapper_join_opts_t* popts = pstate->popts;
+	join_index_t* pindex = pstate->pjoin_index;
+
+	if (pright_rec == NULL) { // End of input record stream
+		sllv_t* poutrecs = sllv_alloc();
+		if (popts->emit_left_unpairables) {
+			for (unsigned long long i = 0; i < pindex->num_buckets; i++)
+				if (!pstate->pindex_bucket_paired[i])
+					join_index_append_bucket_records(pindex, i, poutrecs);
+			join_index_append_unkeyed_records(pindex, poutrecs);
+		}
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+
+	long long bucket_index = -1;
+	slls_t* pright_field_values = mlr_reference_selected_values_from_record(pright_rec, popts->pright_join_field_names);
+	if (pright_field_values != NULL) {
+		bucket_index = join_index_find(pindex, pright_field_values);
+		slls_free(pright_field_values);
+	}
+
+	if (bucket_index < 0) {
+		if (popts->emit_right_unpairables) {
+			return sllv_single(pright_rec);
+		} else {
+			lrec_free(pright_rec);
+			return NULL;
+		}
+	}
+
+	pstate->pindex_bucket_paired[bucket_index] = TRUE;
+	sllv_t* pout_recs = NULL;
+	if (popts->emit_pairables) {
+		pout_recs = sllv_alloc();
+		sllv_t* pleft_records = sllv_alloc();
+		join_index_append_bucket_records(pindex, bucket_index, pleft_records);
+		mapper_join_form_pairs(pleft_records, pright_rec, pstate, pout_recs);
+		while (pleft_records->phead)
+			lrec_free(sllv_pop(pleft_records));
+		sllv_free(pleft_records);
+	}
+	lrec_free(pright_rec);
+	return pout_recs;
 }
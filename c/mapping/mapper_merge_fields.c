@@ -14,6 +14,7 @@
 #include "containers/lhmsll.h"
 #include "containers/mixutil.h"
 #include "containers/mlrval.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "mapping/stats1_accumulators.h"
 
@@ -50,21 +51,32 @@ typedef struct _mapper_merge_fields_state_t {
 	char*    output_field_basename;
 	int      allow_int_float;
 	int      do_interpolated_percentiles;
+	int      do_approx_percentiles;
 	int      keep_input_fields;
 	string_builder_t* psb;
+	merge_by_t do_which;
+	schema_cache_t* pschema_cache;
 } mapper_merge_fields_state_t;
 
+// Per-schema plan for -r and -c: for each field position, the name of the output the field is merged into
+// (the short name for -c, or the output basename for -r), or NULL if the field is not merged.
+typedef struct _merge_fields_plan_t {
+	int    field_count;
+	char** short_names;
+} merge_fields_plan_t;
+
 // ----------------------------------------------------------------
 static void      mapper_merge_fields_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_merge_fields_alloc(slls_t* paccumulator_names, merge_by_t do_which,
 	slls_t* pvalue_field_names, char* output_field_basename, int allow_int_float, int do_interpolated_percentiles,
-	int keep_input_fields);
+	int do_approx_percentiles, int keep_input_fields);
 static void      mapper_merge_fields_free(mapper_t* pmapper);
 static sllv_t*   mapper_merge_fields_process_by_name_list(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_merge_fields_process_by_name_regex(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_merge_fields_process_by_collapsing(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      merge_fields_plan_free(void* pvplan);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_merge_fields_setup = {
@@ -80,7 +92,8 @@ static void mapper_merge_fields_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Computes univariate statistics for each input record, accumulated across\n");
 	fprintf(o, "specified fields.\n");
 	fprintf(o, "Options:\n");
-	fprintf(o, "-a {sum,count,...}  Names of accumulators. One or more of:\n");
+	fprintf(o, "-a {sum,count,...}  Names of accumulators: p10 p25.2 p50 p98 p100 etc., approximate\n");
+	fprintf(o, "                    percentiles p10~ p99~ etc., and/or one or more of:\n");
 	for (int i = 0; i < stats1_acc_lookup_table_length; i++) {
 		fprintf(o, "  %-9s %s\n", stats1_acc_lookup_table[i].name, stats1_acc_lookup_table[i].desc);
 	}
@@ -91,6 +104,8 @@ static void mapper_merge_fields_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "            after removing substrings will be accumulated together. Please see\n");
 	fprintf(o, "            examples below.\n");
 	fprintf(o, "-i          Use interpolated percentiles, like R's type=7; default like type=1.\n");
+	fprintf(o, "--approx    Compute all percentiles approximately, as if named p10~ etc.\n");
+	fprintf(o, "            Please see %s stats1 --help for their accuracy.\n", argv0);
 	fprintf(o, "-o {name}   Output field basename for -f/-r.\n");
 	fprintf(o, "-k          Keep the input fields which contributed to the output statistics;\n");
 	fprintf(o, "            the default is to omit them.\n");
@@ -115,6 +130,7 @@ static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv
 	char*      output_field_basename       = NULL;
 	int        allow_int_float             = TRUE;
 	int        do_interpolated_percentiles = FALSE;
+	int        do_approx_percentiles       = FALSE;
 	int        keep_input_fields           = FALSE;
 	merge_by_t do_which                    = MERGE_UNSPECIFIED;
 
@@ -184,6 +200,9 @@ static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv
 		} else if (streq(argv[argi], "-i")) {
 			do_interpolated_percentiles = TRUE;
 			argi += 1;
+		} else if (streq(argv[argi], "--approx")) {
+			do_approx_percentiles = TRUE;
+			argi += 1;
 		} else {
 			mapper_merge_fields_usage(stderr, argv[0], verb);
 			return NULL;
@@ -209,13 +228,13 @@ static mapper_t* mapper_merge_fields_parse_cli(int* pargi, int argc, char** argv
 	*pargi = argi;
 	return mapper_merge_fields_alloc(paccumulator_names, do_which,
 		pvalue_field_names, output_field_basename, allow_int_float, do_interpolated_percentiles,
-		keep_input_fields);
+		do_approx_percentiles, keep_input_fields);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_merge_fields_alloc(slls_t* paccumulator_names, merge_by_t do_which,
 	slls_t* pvalue_field_names, char* output_field_basename, int allow_int_float, int do_interpolated_percentiles,
-	int keep_input_fields)
+	int do_approx_percentiles, int keep_input_fields)
 {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
@@ -226,15 +245,18 @@ static mapper_t* mapper_merge_fields_alloc(slls_t* paccumulator_names, merge_by_
 	pstate->pvalue_field_regexes = sllv_alloc();
 	for (sllse_t* pa = pvalue_field_names->phead; pa != NULL; pa = pa->pnext) {
 		char* value_field_name = pa->value;
-		regex_t* pvalue_field_regex = mlr_malloc_or_die(sizeof(regex_t));
-		regcomp_or_die(pvalue_field_regex, value_field_name, 0);
+		fast_regex_t* pvalue_field_regex = mlr_malloc_or_die(sizeof(fast_regex_t));
+		fast_regcomp_or_die(pvalue_field_regex, value_field_name, 0);
 		sllv_append(pstate->pvalue_field_regexes, pvalue_field_regex);
 	}
 	pstate->output_field_basename       = output_field_basename;
 	pstate->allow_int_float             = allow_int_float;
 	pstate->do_interpolated_percentiles = do_interpolated_percentiles;
+	pstate->do_approx_percentiles       = do_approx_percentiles;
 	pstate->keep_input_fields           = keep_input_fields;
 	pstate->psb                         = sb_alloc(SB_ALLOC_LENGTH);
+	pstate->do_which                    = do_which;
+	pstate->pschema_cache               = schema_cache_alloc(merge_fields_plan_free);
 
 	pmapper->pvstate = pstate;
 	pmapper->pprocess_func = (do_which == MERGE_BY_NAME_LIST) ? mapper_merge_fields_process_by_name_list :
@@ -250,16 +272,61 @@ static void mapper_merge_fields_free(mapper_t* pmapper) {
 	slls_free(pstate->paccumulator_names);
 	slls_free(pstate->pvalue_field_names);
 	for (sllve_t* pa = pstate->pvalue_field_regexes->phead; pa != NULL; pa = pa->pnext) {
-		regex_t* pvalue_field_regex = pa->pvvalue;
-		regfree(pvalue_field_regex);
+		fast_regex_t* pvalue_field_regex = pa->pvvalue;
+		fast_regfree(pvalue_field_regex);
 		free(pvalue_field_regex);
 	}
 	sllv_free(pstate->pvalue_field_regexes);
 	sb_free(pstate->psb);
+	schema_cache_free(pstate->pschema_cache);
 	free(pstate);
 	free(pmapper);
 }
 
+// ----------------------------------------------------------------
+static merge_fields_plan_t* mapper_merge_fields_get_plan(mapper_merge_fields_state_t* pstate, lrec_t* pinrec) {
+	merge_fields_plan_t* pplan = schema_cache_get(pstate->pschema_cache, pinrec);
+	if (pplan != NULL)
+		return pplan;
+
+	pplan = mlr_malloc_or_die(sizeof(merge_fields_plan_t));
+	pplan->field_count = pinrec->field_count;
+	pplan->short_names = mlr_malloc_or_die((pinrec->field_count + 1) * sizeof(char*));
+	int j = 0;
+	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext, j++) {
+		char* field_name = pe->key;
+		pplan->short_names[j] = NULL;
+		for (sllve_t* pb = pstate->pvalue_field_regexes->phead; pb != NULL; pb = pb->pnext) {
+			fast_regex_t* pvalue_field_regex = pb->pvvalue;
+			if (pstate->do_which == MERGE_BY_NAME_REGEX) {
+				if (fast_regmatch_or_die(pvalue_field_regex, field_name, 0, NULL)) {
+					pplan->short_names[j] = mlr_strdup_or_die(pstate->output_field_basename);
+					break;
+				}
+			} else if (fast_regex_may_match(pvalue_field_regex, field_name)) {
+				int matched = FALSE;
+				char* short_name = regex_sub(field_name, &pvalue_field_regex->regex, pstate->psb, "",
+					&matched, NULL);
+				if (matched) {
+					pplan->short_names[j] = short_name;
+					break;
+				}
+			}
+		}
+	}
+
+	schema_cache_put(pstate->pschema_cache, pinrec, pplan);
+	return pplan;
+}
+
+static void merge_fields_plan_free(void* pvplan) {
+	merge_fields_plan_t* pplan = pvplan;
+	for (int j = 0; j < pplan->field_count; j++)
+		free(pplan->short_names[j]);
+	free(pplan->short_names);
+	free(pplan);
+}
+
 // ================================================================
 static sllv_t* mapper_merge_fields_process_by_name_list(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec == NULL) // end of input stream
@@ -274,7 +341,8 @@ static sllv_t* mapper_merge_fields_process_by_name_list(lrec_t* pinrec, context_
 	lhmsv_t* poutaccs = lhmsv_alloc();
 
 	make_stats1_accs(pstate->output_field_basename, pstate->paccumulator_names,
-	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pinaccs, poutaccs);
+	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pstate->do_approx_percentiles,
+	    pinaccs, poutaccs);
 
 	for (sllse_t* pb = pstate->pvalue_field_names->phead; pb != NULL; pb = pb->pnext) {
 		char* field_name = pb->value;
@@ -349,59 +417,58 @@ static sllv_t* mapper_merge_fields_process_by_name_regex(lrec_t* pinrec, context
 	lhmsv_t* poutaccs = lhmsv_alloc();
 
 	make_stats1_accs(pstate->output_field_basename, pstate->paccumulator_names,
-	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pinaccs, poutaccs);
+	    pstate->allow_int_float, pstate->do_interpolated_percentiles, pstate->do_approx_percentiles,
+	    pinaccs, poutaccs);
 
-	for (lrece_t* pb = pinrec->phead; pb != NULL; /* increment inside loop */ ) {
+	merge_fields_plan_t* pplan = mapper_merge_fields_get_plan(pstate, pinrec);
+	int j = 0;
+	for (lrece_t* pb = pinrec->phead; pb != NULL; /* increment inside loop */ j++) {
 		char* field_name = pb->key;
-		int matched = FALSE;
-		for (sllve_t* pc = pstate->pvalue_field_regexes->phead; pc != NULL && !matched; pc = pc->pnext) {
-			regex_t* pvalue_field_regex = pc->pvvalue;
-			matched = regmatch_or_die(pvalue_field_regex, field_name, 0, NULL);
-			if (matched) {
-				char* value_field_sval = lrec_get(pinrec, field_name);
-				if (value_field_sval != NULL) { // Key not present
-					int have_dval = FALSE;
-					int have_nval = FALSE;
-					double value_field_dval = -999.0;
-					mv_t   value_field_nval = mv_absent();
-
-					if (*value_field_sval != 0) { // Key present with null value
-						for (lhmsve_t* pd = pinaccs->phead; pd != NULL; pd = pd->pnext) {
-							stats1_acc_t* pacc = pd->pvvalue;
-
-							if (pacc->pdingest_func != NULL) {
-								if (!have_dval) {
-									value_field_dval = mlr_double_from_string_or_die(value_field_sval);
-									have_dval = TRUE;
-								}
-								pacc->pdingest_func(pacc->pvstate, value_field_dval);
-							}
-							if (pacc->pningest_func != NULL) {
-								if (!have_nval) {
-									value_field_nval = pstate->allow_int_float
-										? mv_scan_number_or_die(value_field_sval)
-										: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
-									have_nval = TRUE;
-								}
-								pacc->pningest_func(pacc->pvstate, &value_field_nval);
+		int matched = pplan->short_names[j] != NULL;
+		if (matched) {
+			char* value_field_sval = lrec_get(pinrec, field_name);
+			if (value_field_sval != NULL) { // Key not present
+				int have_dval = FALSE;
+				int have_nval = FALSE;
+				double value_field_dval = -999.0;
+				mv_t   value_field_nval = mv_absent();
+
+				if (*value_field_sval != 0) { // Key present with null value
+					for (lhmsve_t* pd = pinaccs->phead; pd != NULL; pd = pd->pnext) {
+						stats1_acc_t* pacc = pd->pvvalue;
+
+						if (pacc->pdingest_func != NULL) {
+							if (!have_dval) {
+								value_field_dval = mlr_double_from_string_or_die(value_field_sval);
+								have_dval = TRUE;
 							}
-							if (pacc->psingest_func != NULL) {
-								pacc->psingest_func(pacc->pvstate, value_field_sval);
+							pacc->pdingest_func(pacc->pvstate, value_field_dval);
+						}
+						if (pacc->pningest_func != NULL) {
+							if (!have_nval) {
+								value_field_nval = pstate->allow_int_float
+									? mv_scan_number_or_die(value_field_sval)
+									: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
+								have_nval = TRUE;
 							}
+							pacc->pningest_func(pacc->pvstate, &value_field_nval);
+						}
+						if (pacc->psingest_func != NULL) {
+							pacc->psingest_func(pacc->pvstate, value_field_sval);
 						}
 					}
+				}
 
-					if (!pstate->keep_input_fields) {
-						// We are modifying the lrec while iterating over it.
-						lrece_t* pnext = pb->pnext;
-						lrec_unlink_and_free(pinrec, pb);
-						pb = pnext;
-					} else {
-						pb = pb->pnext;
-					}
+				if (!pstate->keep_input_fields) {
+					// We are modifying the lrec while iterating over it.
+					lrece_t* pnext = pb->pnext;
+					lrec_unlink_and_free(pinrec, pb);
+					pb = pnext;
 				} else {
 					pb = pb->pnext;
 				}
+			} else {
+				pb = pb->pnext;
 			}
 		}
 		if (!matched)
@@ -441,77 +508,75 @@ static sllv_t* mapper_merge_fields_process_by_collapsing(lrec_t* pinrec, context
 	lhmsv_t* short_names_to_in_acc_maps = lhmsv_alloc();
 	lhmsv_t* short_names_to_out_acc_maps = lhmsv_alloc();
 
-	for (lrece_t* pa = pinrec->phead; pa != NULL; /* increment inside loop */ ) {
+	merge_fields_plan_t* pplan = mapper_merge_fields_get_plan(pstate, pinrec);
+	int j = 0;
+	for (lrece_t* pa = pinrec->phead; pa != NULL; /* increment inside loop */ j++) {
 		char* field_name = pa->key;
-		int matched = FALSE;
-		for (sllve_t* pb = pstate->pvalue_field_regexes->phead; pb != NULL && !matched; pb = pb->pnext) {
-			regex_t* pvalue_field_regex = pb->pvvalue;
-			char* short_name = regex_sub(field_name, pvalue_field_regex, pstate->psb, "", &matched, NULL);
-			if (matched) {
-				lhmsv_t* in_acc_map_for_short_name = lhmsv_get(short_names_to_in_acc_maps, short_name);
-				lhmsv_t* out_acc_map_for_short_name = lhmsv_get(short_names_to_out_acc_maps, short_name);
-				if (out_acc_map_for_short_name == NULL) { // First such
-
-					in_acc_map_for_short_name = lhmsv_alloc();
-					out_acc_map_for_short_name = lhmsv_alloc();
-
-					make_stats1_accs(short_name, pstate->paccumulator_names,
-						pstate->allow_int_float, pstate->do_interpolated_percentiles,
-						in_acc_map_for_short_name, out_acc_map_for_short_name);
-
-					lhmsv_put(short_names_to_in_acc_maps, mlr_strdup_or_die(short_name), in_acc_map_for_short_name,
-						FREE_ENTRY_KEY);
-					lhmsv_put(short_names_to_out_acc_maps, mlr_strdup_or_die(short_name), out_acc_map_for_short_name,
-						FREE_ENTRY_KEY);
+		char* short_name = pplan->short_names[j];
+		int matched = short_name != NULL;
+		if (matched) {
+			lhmsv_t* in_acc_map_for_short_name = lhmsv_get(short_names_to_in_acc_maps, short_name);
+			lhmsv_t* out_acc_map_for_short_name = lhmsv_get(short_names_to_out_acc_maps, short_name);
+			if (out_acc_map_for_short_name == NULL) { // First such
 
-				}
+				in_acc_map_for_short_name = lhmsv_alloc();
+				out_acc_map_for_short_name = lhmsv_alloc();
 
-				char* value_field_sval = lrec_get(pinrec, field_name);
-				if (value_field_sval != NULL) { // Key present
+				make_stats1_accs(short_name, pstate->paccumulator_names,
+					pstate->allow_int_float, pstate->do_interpolated_percentiles, pstate->do_approx_percentiles,
+					in_acc_map_for_short_name, out_acc_map_for_short_name);
 
-					if (*value_field_sval != 0) { // Key present with non-null value
-						for (lhmsve_t* pd = in_acc_map_for_short_name->phead; pd != NULL; pd = pd->pnext) {
-							stats1_acc_t* pacc = pd->pvvalue;
+				lhmsv_put(short_names_to_in_acc_maps, mlr_strdup_or_die(short_name), in_acc_map_for_short_name,
+					FREE_ENTRY_KEY);
+				lhmsv_put(short_names_to_out_acc_maps, mlr_strdup_or_die(short_name), out_acc_map_for_short_name,
+					FREE_ENTRY_KEY);
 
-							int have_dval = FALSE;
-							int have_nval = FALSE;
-							double value_field_dval = -999.0;
-							mv_t   value_field_nval = mv_absent();
+			}
 
-							if (pacc->pdingest_func != NULL) {
-								if (!have_dval) {
-									value_field_dval = mlr_double_from_string_or_die(value_field_sval);
-									have_dval = TRUE;
-								}
-								pacc->pdingest_func(pacc->pvstate, value_field_dval);
-							}
-							if (pacc->pningest_func != NULL) {
-								if (!have_nval) {
-									value_field_nval = pstate->allow_int_float
-										? mv_scan_number_or_die(value_field_sval)
-										: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
-									have_nval = TRUE;
-								}
-								pacc->pningest_func(pacc->pvstate, &value_field_nval);
+			char* value_field_sval = lrec_get(pinrec, field_name);
+			if (value_field_sval != NULL) { // Key present
+
+				if (*value_field_sval != 0) { // Key present with non-null value
+					for (lhmsve_t* pd = in_acc_map_for_short_name->phead; pd != NULL; pd = pd->pnext) {
+						stats1_acc_t* pacc = pd->pvvalue;
+
+						int have_dval = FALSE;
+						int have_nval = FALSE;
+						double value_field_dval = -999.0;
+						mv_t   value_field_nval = mv_absent();
+
+						if (pacc->pdingest_func != NULL) {
+							if (!have_dval) {
+								value_field_dval = mlr_double_from_string_or_die(value_field_sval);
+								have_dval = TRUE;
 							}
-							if (pacc->psingest_func != NULL) {
-								pacc->psingest_func(pacc->pvstate, value_field_sval);
+							pacc->pdingest_func(pacc->pvstate, value_field_dval);
+						}
+						if (pacc->pningest_func != NULL) {
+							if (!have_nval) {
+								value_field_nval = pstate->allow_int_float
+									? mv_scan_number_or_die(value_field_sval)
+									: mv_from_float(mlr_double_from_string_or_die(value_field_sval));
+								have_nval = TRUE;
 							}
+							pacc->pningest_func(pacc->pvstate, &value_field_nval);
+						}
+						if (pacc->psingest_func != NULL) {
+							pacc->psingest_func(pacc->pvstate, value_field_sval);
 						}
 					}
+				}
 
-					if (!pstate->keep_input_fields) {
-						// We are modifying the lrec while iterating over it.
-						lrece_t* pnext = pa->pnext;
-						lrec_unlink_and_free(pinrec, pa);
-						pa = pnext;
-					} else {
-						pa = pa->pnext;
-					}
+				if (!pstate->keep_input_fields) {
+					// We are modifying the lrec while iterating over it.
+					lrece_t* pnext = pa->pnext;
+					lrec_unlink_and_free(pinrec, pa);
+					pa = pnext;
 				} else {
 					pa = pa->pnext;
 				}
-				free(short_name);
+			} else {
+				pa = pa->pnext;
 			}
 		}
 		if (!matched)
@@ -2,11 +2,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
 #include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
 #include "containers/sllv.h"
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "containers/space_saving.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -19,6 +22,7 @@ typedef struct _mapper_most_or_least_frequent_state_t {
 	long long   max_output_length;
 	int         descending;
 	int         show_counts;
+	space_saving_t* psummary; // For --approx, else NULL
 } mapper_most_or_least_frequent_state_t;
 
 static void mapper_most_frequent_usage(FILE*  o, char* argv0, char* verb);
@@ -29,10 +33,11 @@ static mapper_t* mapper_least_frequent_parse_cli(int* pargi, int argc, char** ar
 static mapper_t* mapper_most_or_least_frequent_parse_cli(int* pargi, int argc, char** argv, int descending);
 
 static mapper_t* mapper_most_or_least_frequent_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
-	long long max_output_length, int descending, int show_counts);
+	long long max_output_length, int descending, int show_counts, int approx_capacity);
 static void      mapper_most_or_least_frequent_free(mapper_t* pmapper);
 
 static sllv_t*   mapper_most_or_least_frequent_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_most_frequent_process_approx(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 // qsort callbacks
 static int descending_vcmp(const void* pva, const void* pvb);
@@ -67,6 +72,12 @@ static void mapper_most_frequent_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "-f {one or more comma-separated field names}. Required flag.\n");
 	fprintf(o, "-n {count}. Optional flag defaulting to %lld.\n", DEFAULT_MAX_OUTPUT_LENGTH);
 	fprintf(o, "-b          Suppress counts; show only field values.\n");
+	fprintf(o, "--approx {k} Count approximately, in memory for k distinct values rather than\n");
+	fprintf(o, "            for all of them, using the Space-Saving algorithm. k should be a few\n");
+	fprintf(o, "            times -n. Counts may be overestimates: each is output with a\n");
+	fprintf(o, "            count_error field, and the true count is between count - count_error\n");
+	fprintf(o, "            and count. Any values occurring in more than 1/k of the records\n");
+	fprintf(o, "            are reported.\n");
 	fprintf(o, "See also \"%s %s\".\n", argv0, "least");
 }
 
@@ -97,6 +108,10 @@ static mapper_t* mapper_most_or_least_frequent_parse_cli(int* pargi, int argc, c
 	slls_t*   pgroup_by_field_names = NULL;
 	long long max_output_length     = DEFAULT_MAX_OUTPUT_LENGTH;
 	int       show_counts           = TRUE;
+	char*     approx_capacity_arg   = NULL; // Exact unless --approx
+	void (*pusage_func)(FILE* o, char* argv0, char* verb) = descending
+		? mapper_most_frequent_usage
+		: mapper_least_frequent_usage;
 
 	char* verb = argv[(*pargi)++];
 
@@ -104,23 +119,38 @@ static mapper_t* mapper_most_or_least_frequent_parse_cli(int* pargi, int argc, c
 	ap_define_string_list_flag(pstate, "-f", &pgroup_by_field_names);
 	ap_define_long_long_flag(pstate,   "-n", &max_output_length);
 	ap_define_false_flag(pstate,       "-b", &show_counts);
+	if (descending)
+		ap_define_string_flag(pstate,  "--approx", &approx_capacity_arg);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
-		mapper_most_frequent_usage(stderr, argv[0], verb);
+		pusage_func(stderr, argv[0], verb);
 		return NULL;
 	}
 
 	if (pgroup_by_field_names == NULL) {
-		mapper_most_frequent_usage(stderr, argv[0], verb);
+		pusage_func(stderr, argv[0], verb);
 		return NULL;
 	}
+	long long approx_capacity = 0LL;
+	if (approx_capacity_arg != NULL) {
+		if (!mlr_try_int_from_string(approx_capacity_arg, &approx_capacity)
+			|| approx_capacity <= 0LL || approx_capacity > INT_MAX)
+		{
+			fprintf(stderr, "%s %s: --approx capacity must be a positive integer; got \"%s\".\n",
+				MLR_GLOBALS.bargv0, verb, approx_capacity_arg);
+			pusage_func(stderr, argv[0], verb);
+			return NULL;
+		}
+	}
 
-	return mapper_most_or_least_frequent_alloc(pstate, pgroup_by_field_names, max_output_length, descending, show_counts);
+	return mapper_most_or_least_frequent_alloc(pstate, pgroup_by_field_names, max_output_length, descending,
+		show_counts, approx_capacity);
 }
 
 // ----------------------------------------------------------------
+// An approx_capacity of 0 means exact counting.
 static mapper_t* mapper_most_or_least_frequent_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
-	long long max_output_length, int descending, int show_counts)
+	long long max_output_length, int descending, int show_counts, int approx_capacity)
 {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
@@ -132,9 +162,12 @@ static mapper_t* mapper_most_or_least_frequent_alloc(ap_state_t* pargp, slls_t*
 	pstate->max_output_length     = max_output_length;
 	pstate->descending            = descending;
 	pstate->show_counts           = show_counts;
+	pstate->psummary              = (approx_capacity > 0) ? space_saving_alloc(approx_capacity) : NULL;
 
 	pmapper->pvstate       = pstate;
-	pmapper->pprocess_func = mapper_most_or_least_frequent_process;
+	pmapper->pprocess_func = (pstate->psummary != NULL)
+		? mapper_most_frequent_process_approx
+		: mapper_most_or_least_frequent_process;
 	pmapper->pfree_func    = mapper_most_or_least_frequent_free;
 
 	return pmapper;
@@ -149,6 +182,7 @@ static void mapper_most_or_least_frequent_free(mapper_t* pmapper) {
 		free(pcount);
 	}
 	lhmslv_free(pstate->pcounts_by_group);
+	space_saving_free(pstate->psummary);
 	pstate->pgroup_by_field_names = NULL;
 	pstate->pcounts_by_group = NULL;
 	ap_free(pstate->pargp);
@@ -216,6 +250,45 @@ static sllv_t* mapper_most_or_least_frequent_process(lrec_t* pinrec, context_t*
 	}
 }
 
+// ----------------------------------------------------------------
+static sllv_t* mapper_most_frequent_process_approx(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_most_or_least_frequent_state_t* pstate = pvstate;
+
+	if (pinrec != NULL) { // Not end of input record stream
+		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
+			pstate->pgroup_by_field_names);
+		if (pgroup_by_field_values != NULL) {
+			space_saving_add(pstate->psummary, pgroup_by_field_values);
+			slls_free(pgroup_by_field_values);
+		}
+		lrec_free(pinrec);
+		return NULL;
+
+	} else { // End of input record stream
+		space_saving_counter_t** pcounters = space_saving_sorted_counters(pstate->psummary);
+		sllv_t* poutrecs = sllv_alloc();
+		int input_length = pstate->psummary->num_counters;
+		int output_length = (input_length < pstate->max_output_length) ? input_length : pstate->max_output_length;
+		for (int i = 0; i < output_length; i++) {
+			lrec_t* poutrec = lrec_unbacked_alloc();
+			sllse_t* pb = pstate->pgroup_by_field_names->phead;
+			sllse_t* pc = pcounters[i]->pvalues->phead;
+			for ( ; pb != NULL && pc != NULL; pb = pb->pnext, pc = pc->pnext) {
+				lrec_put(poutrec, pb->value, pc->value, NO_FREE);
+			}
+			if (pstate->show_counts) {
+				lrec_put(poutrec, "count", mlr_alloc_string_from_ull(pcounters[i]->count), FREE_ENTRY_VALUE);
+				lrec_put(poutrec, "count_error", mlr_alloc_string_from_ull(pcounters[i]->error), FREE_ENTRY_VALUE);
+			}
+			sllv_append(poutrecs, poutrec);
+		}
+		sllv_append(poutrecs, NULL);
+
+		free(pcounters);
+		return poutrecs;
+	}
+}
+
 static int descending_vcmp(const void* pva, const void* pvb) {
 	const sort_pair_t* pa = pva;
 	const sort_pair_t* pb = pvb;
@@ -22,7 +22,7 @@ typedef struct _mapper_nest_state_t {
 
 	lhmslv_t* other_keys_to_other_values_to_buckets;
 	string_builder_t* psb;
-	regex_t regex;
+	fast_regex_t regex;
 } mapper_nest_state_t;
 
 typedef struct _nest_bucket_t {
@@ -203,7 +203,7 @@ static mapper_t* mapper_nest_alloc(ap_state_t* pargp, char* argv0,
 	pstate->psb = sb_alloc(SB_ALLOC_LENGTH);
 	char* pattern = mlr_malloc_or_die(strlen(field_name) + 12);
 	sprintf(pattern, "^%s_[0-9]+$", field_name);
-	regcomp_or_die(&pstate->regex, pattern, REG_NOSUB);
+	fast_regcomp_or_die(&pstate->regex, pattern, REG_NOSUB);
 	free(pattern);
 
 	pmapper->pfree_func = mapper_nest_free;
@@ -230,7 +230,7 @@ static void mapper_nest_free(mapper_t* pmapper) {
 	sb_free(pstate->psb);
 	free(pstate->nested_fs);
 	free(pstate->nested_ps);
-	regfree(&pstate->regex);
+	fast_regfree(&pstate->regex);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -248,6 +248,8 @@ static sllv_t* mapper_nest_explode_values_across_fields(lrec_t* pinrec, context_
 		return sllv_single(pinrec);
 	}
 	lrece_t* porig = pentry;
+	// Split a copy, since strtok writes into it and the value may be shared with copies of the record.
+	field_value = mlr_strdup_or_die(field_value);
 
 	char* sep = pstate->nested_fs;
 	int i = 1;
@@ -260,6 +262,7 @@ static sllv_t* mapper_nest_explode_values_across_fields(lrec_t* pinrec, context_
 		pentry = lrec_put_after(pinrec, pentry, new_key, mlr_strdup_or_die(piece), FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
 	}
 	lrec_unlink_and_free(pinrec, porig);
+	free(field_value);
 	return sllv_single(pinrec);;
 }
 
@@ -273,7 +276,7 @@ static sllv_t* mapper_nest_implode_values_across_fields(lrec_t* pinrec, context_
 	lrece_t* pprev = NULL;
 	int field_count = 0;
 	for (lrece_t* pe = pinrec->phead; pe != NULL; /* increment in loop */) {
-		if (regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
+		if (fast_regmatch_or_die(&pstate->regex, pe->key, 0, NULL)) {
 			if (field_count > 0)
 				sb_append_string(pstate->psb, pstate->nested_fs);
 			sb_append_string(pstate->psb, pe->value);
@@ -312,6 +315,8 @@ static sllv_t* mapper_nest_explode_values_across_records(lrec_t* pinrec, context
 		return sllv_single(pinrec);
 	}
 
+	field_value = mlr_strdup_or_die(field_value); // See above
+
 	sllv_t* poutrecs = sllv_alloc();
 	char* sep = pstate->nested_fs;
 	int i = 1;
@@ -320,6 +325,7 @@ static sllv_t* mapper_nest_explode_values_across_records(lrec_t* pinrec, context
 		lrec_put(poutrec, pstate->field_name, mlr_strdup_or_die(piece), FREE_ENTRY_VALUE);
 		sllv_append(poutrecs, poutrec);
 	}
+	free(field_value);
 	lrec_free(pinrec);
 	return poutrecs;
 }
@@ -399,6 +405,7 @@ static sllv_t* mapper_nest_explode_pairs_across_fields(lrec_t* pinrec, context_t
 		return sllv_single(pinrec);
 	}
 	lrece_t* porig = pentry;
+	field_value = mlr_strdup_or_die(field_value); // See above
 
 	char* sep = pstate->nested_fs;
 	for (char* piece = strtok(field_value, sep); piece != NULL; piece = strtok(NULL, sep)) {
@@ -414,6 +421,7 @@ static sllv_t* mapper_nest_explode_pairs_across_fields(lrec_t* pinrec, context_t
 		}
 	}
 	lrec_unlink_and_free(pinrec, porig);
+	free(field_value);
 
 	return sllv_single(pinrec);
 }
@@ -429,6 +437,8 @@ static sllv_t* mapper_nest_explode_pairs_across_records(lrec_t* pinrec, context_
 		return sllv_single(pinrec);
 	}
 
+	field_value = mlr_strdup_or_die(field_value); // See above
+
 	sllv_t* poutrecs = sllv_alloc();
 	char* sep = pstate->nested_fs;
 	for (char* piece = strtok(field_value, sep); piece != NULL; piece = strtok(NULL, sep)) {
@@ -450,6 +460,7 @@ static sllv_t* mapper_nest_explode_pairs_across_records(lrec_t* pinrec, context_
 		sllv_append(poutrecs, poutrec);
 	}
 
+	free(field_value);
 	lrec_free(pinrec);
 	return poutrecs;
 }
@@ -433,6 +433,14 @@ static void mapper_put_or_filter_free(mapper_t* pmapper) {
 	free(pmapper);
 }
 
+// For the stream driver: end blocks may print, so they see the records before any are written by the driver.
+int mapper_put_or_filter_has_end_blocks(mapper_t* pmapper) {
+	if (pmapper->pfree_func != mapper_put_or_filter_free)
+		return FALSE;
+	mapper_put_or_filter_state_t* pstate = pmapper->pvstate;
+	return pstate->pcst->pend_blocks->length > 0;
+}
+
 // ----------------------------------------------------------------
 // The typed-overlay holds intermediate values such as in
 //
@@ -453,25 +461,25 @@ static void mapper_put_or_filter_free(mapper_t* pmapper) {
 // * Worse, all lhmslv group-by operations (used by many Miller verbs) would likewise suffer a performance regression.
 //
 // ----------------------------------------------------------------
-// The regex-capture string-array holds copies of regex matches, e.g. in
+// The regex-captures hold offsets of regex matches into a copy of the matched string, e.g. in
 //
 //   echo name=abc_def | mlr put '$name =~ "(.*)_(.*)"; $left = "\1"; $right = "\2"'
 //
 // produces a record with left=abc and right=def.
 //
-// There is an important trick here with the length of the string-array:
+// There is an important trick here with the length of the regex-captures:
 //
 // * It is set here to null.
 //
 // * It is passed by reference to the lrec-evaluator tree. In particular, the matches and does-not-match functions
-//   (which implement the =~ and !=~ operators) allocate it (or resize it, as necessary) and populate it.
+//   (which implement the =~ and !=~ operators) allocate it (or reuse it) and populate it.
 //
-// * If the matches/does-not-match functions are entered, even with no matches, the regex-captures string-array
-//   will be resized to have length 0.
+// * If the matches/does-not-match functions are entered, even with no matches, the regex-captures
+//   will be set to have length 0.
 //
 // * When the lrec-evaluator's from-literal function is invoked, the interpolate_regex_captures function can quickly
-//   check to see if the regex-captures array is null and thereby know that a time-consuming scan for \1, \2, \3, etc.
-//   does not need to be done. On the other hand, if the regex-captures array is non-null and has length
+//   check to see if the regex-captures are null and thereby know that a time-consuming scan for \1, \2, \3, etc.
+//   does not need to be done. On the other hand, if the regex-captures are non-null and have length
 //   zero, then \0 .. \9 should all be replaced with the empty string.
 //
 // ----------------------------------------------------------------
@@ -490,7 +498,7 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 	int should_emit_rec = TRUE;
 
 	if (pstate->at_begin) {
-		string_array_t* pregex_captures = NULL; // May be set to non-null on evaluation
+		regex_captures_t* pregex_captures = NULL; // May be set to non-null on evaluation
 
 		variables_t variables = (variables_t) {
 			.pinrec           = NULL,
@@ -513,13 +521,13 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 			.pwriter_opts             = pstate->pwriter_opts,
 		};
 
-		string_array_free(pregex_captures);
+		regex_captures_free(pregex_captures);
 		mlr_dsl_cst_handle_top_level_statement_blocks(pstate->pcst->pbegin_blocks, &variables, &cst_outputs);
 		pstate->at_begin = FALSE;
 	}
 
 	if (pinrec == NULL) { // End of input stream
-		string_array_t* pregex_captures = NULL; // May be set to non-null on evaluation
+		regex_captures_t* pregex_captures = NULL; // May be set to non-null on evaluation
 
 		variables_t variables = (variables_t) {
 			.pinrec           = NULL,
@@ -544,13 +552,13 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 
 		mlr_dsl_cst_handle_top_level_statement_blocks(pstate->pcst->pend_blocks, &variables, &cst_outputs);
 
-		string_array_free(pregex_captures);
+		regex_captures_free(pregex_captures);
 		sllv_append(poutrecs, NULL);
 		return poutrecs;
 	}
 
 	lhmsmv_t* ptyped_overlay = lhmsmv_alloc();
-	string_array_t* pregex_captures = NULL; // May be set to non-null on evaluation
+	regex_captures_t* pregex_captures = NULL; // May be set to non-null on evaluation
 
 	should_emit_rec = TRUE;
 
@@ -595,7 +603,7 @@ static sllv_t* mapper_put_or_filter_process(lrec_t* pinrec, context_t* pctx, voi
 		}
 	}
 	lhmsmv_free(ptyped_overlay);
-	string_array_free(pregex_captures);
+	regex_captures_free(pregex_captures);
 
 	if (should_emit_rec && !pstate->put_output_disabled) {
 		sllv_append(poutrecs, pinrec);
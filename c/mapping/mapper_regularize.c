@@ -2,10 +2,18 @@
 #include "containers/lhmslv.h"
 #include "containers/sllv.h"
 #include "containers/mixutil.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 
+// Per-schema plan: either pass the record through as-is, or reorder it to the previously encountered order.
+typedef struct _regularize_plan_t {
+	int     is_identity;
+	slls_t* poriginal_field_names; // Owned by the sorted-to-original map
+} regularize_plan_t;
+
 typedef struct _mapper_regularize_state_t {
 	lhmslv_t* psorted_to_original;
+	schema_cache_t* pschema_cache;
 } mapper_regularize_state_t;
 
 static void      mapper_regularize_usage(FILE* o, char* argv0, char* verb);
@@ -46,6 +54,7 @@ static mapper_t* mapper_regularize_alloc() {
 
 	mapper_regularize_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_regularize_state_t));
 	pstate->psorted_to_original = lhmslv_alloc();
+	pstate->pschema_cache = schema_cache_alloc(free);
 
 	pmapper->pvstate       = (void*)pstate;
 	pmapper->pprocess_func = mapper_regularize_process;
@@ -61,30 +70,54 @@ static void mapper_regularize_free(mapper_t* pmapper) {
 		slls_free(pe->pvvalue);
 	}
 	lhmslv_free(pstate->psorted_to_original);
+	schema_cache_free(pstate->pschema_cache);
 	free(pstate);
 	free(pmapper);
 }
 
 // ----------------------------------------------------------------
+static regularize_plan_t* mapper_regularize_make_plan(mapper_regularize_state_t* pstate, lrec_t* pinrec) {
+	regularize_plan_t* pplan = mlr_malloc_or_die(sizeof(regularize_plan_t));
+	slls_t* current_sorted_field_names = mlr_reference_keys_from_record(pinrec);
+	slls_sort(current_sorted_field_names);
+	slls_t* previous_sorted_field_names = lhmslv_get(pstate->psorted_to_original, current_sorted_field_names);
+	if (previous_sorted_field_names == NULL) {
+		previous_sorted_field_names = slls_copy(current_sorted_field_names);
+		pplan->is_identity = TRUE;
+		pplan->poriginal_field_names = mlr_copy_keys_from_record(pinrec);
+		lhmslv_put(pstate->psorted_to_original, previous_sorted_field_names, pplan->poriginal_field_names,
+			FREE_ENTRY_KEY);
+	} else {
+		pplan->poriginal_field_names = previous_sorted_field_names;
+		pplan->is_identity = TRUE;
+		sllse_t* pe = pplan->poriginal_field_names->phead;
+		for (lrece_t* pf = pinrec->phead; pf != NULL; pf = pf->pnext, pe = pe->pnext) {
+			if (!streq(pf->key, pe->value)) {
+				pplan->is_identity = FALSE;
+				break;
+			}
+		}
+	}
+	slls_free(current_sorted_field_names);
+	return pplan;
+}
+
 static sllv_t* mapper_regularize_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	if (pinrec != NULL) {
 		mapper_regularize_state_t* pstate = (mapper_regularize_state_t*)pvstate;
-		slls_t* current_sorted_field_names = mlr_reference_keys_from_record(pinrec);
-		slls_sort(current_sorted_field_names);
-		slls_t* previous_sorted_field_names = lhmslv_get(pstate->psorted_to_original, current_sorted_field_names);
-		if (previous_sorted_field_names == NULL) {
-			previous_sorted_field_names = slls_copy(current_sorted_field_names);
-			lhmslv_put(pstate->psorted_to_original, previous_sorted_field_names, mlr_copy_keys_from_record(pinrec),
-				FREE_ENTRY_KEY);
-			slls_free(current_sorted_field_names);
+		regularize_plan_t* pplan = schema_cache_get(pstate->pschema_cache, pinrec);
+		if (pplan == NULL) {
+			pplan = mapper_regularize_make_plan(pstate, pinrec);
+			schema_cache_put(pstate->pschema_cache, pinrec, pplan);
+		}
+		if (pplan->is_identity) {
 			return sllv_single(pinrec);
 		} else {
 			lrec_t* poutrec = lrec_unbacked_alloc();
-			for (sllse_t* pe = previous_sorted_field_names->phead; pe != NULL; pe = pe->pnext) {
+			for (sllse_t* pe = pplan->poriginal_field_names->phead; pe != NULL; pe = pe->pnext) {
 				lrec_put(poutrec, pe->value, mlr_strdup_or_die(lrec_get(pinrec, pe->value)), FREE_ENTRY_VALUE);
 			}
 			lrec_free(pinrec);
-			slls_free(current_sorted_field_names);
 			return sllv_single(poutrec);
 		}
 	}
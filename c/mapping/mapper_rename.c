@@ -3,13 +3,14 @@
 #include "lib/string_builder.h"
 #include "containers/lhmss.h"
 #include "containers/sllv.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
 #define RENAME_SB_ALLOC_LENGTH 16
 
 typedef struct _regex_pair_t {
-	regex_t regex;
+	fast_regex_t regex;
 	char*   replacement;
 } regex_pair_t;
 
@@ -19,6 +20,9 @@ typedef struct _mapper_rename_state_t {
 	sllv_t*  pregex_pairs;
 	string_builder_t* psb;
 	int      do_gsub;
+	// For -r, the renames done on a record depend only on its field names. They are recorded per schema as
+	// a list of alternating old and new names, and replayed on subsequent records with the same schema.
+	schema_cache_t* pschema_cache;
 } mapper_rename_state_t;
 
 static void      mapper_rename_usage(FILE* o, char* argv0, char* verb);
@@ -28,6 +32,7 @@ static mapper_t* mapper_rename_alloc(ap_state_t* pargp, lhmss_t* pold_to_new, in
 static void      mapper_rename_free(mapper_t* pmapper);
 static sllv_t*   mapper_rename_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t*   mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_rename_plan_free(void* pvplan);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_rename_setup = {
@@ -118,19 +123,21 @@ static mapper_t* mapper_rename_alloc(ap_state_t* pargp, lhmss_t* pold_to_new, in
 			char* replacement  = pe->value;
 
 			regex_pair_t* ppair = mlr_malloc_or_die(sizeof(regex_pair_t));
-			regcomp_or_die_quoted(&ppair->regex, regex_string, 0);
+			fast_regcomp_or_die_quoted(&ppair->regex, regex_string, 0);
 			ppair->replacement = replacement;
 			sllv_append(pstate->pregex_pairs, ppair);
 		}
 
-		pstate->psb     = sb_alloc(RENAME_SB_ALLOC_LENGTH);
-		pstate->do_gsub = do_gsub;
+		pstate->psb           = sb_alloc(RENAME_SB_ALLOC_LENGTH);
+		pstate->do_gsub       = do_gsub;
+		pstate->pschema_cache = schema_cache_alloc(mapper_rename_plan_free);
 	} else {
 		pmapper->pprocess_func = mapper_rename_process;
 		pstate->pold_to_new    = pold_to_new;
 		pstate->pregex_pairs   = NULL;
 		pstate->psb            = NULL;
 		pstate->do_gsub        = FALSE;
+		pstate->pschema_cache  = NULL;
 	}
 	pmapper->pfree_func = mapper_rename_free;
 
@@ -144,13 +151,14 @@ static void mapper_rename_free(mapper_t* pmapper) {
 	if (pstate->pregex_pairs != NULL) {
 		for (sllve_t* pe = pstate->pregex_pairs->phead; pe != NULL; pe = pe->pnext) {
 			regex_pair_t* ppair = pe->pvvalue;
-			regfree(&ppair->regex);
+			fast_regfree(&ppair->regex);
 			// replacement is in pthe old_to_new list, already freed
 			free(ppair);
 		}
 		sllv_free(pstate->pregex_pairs);
 	}
 	sb_free(pstate->psb);
+	schema_cache_free(pstate->pschema_cache);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -178,28 +186,41 @@ static sllv_t* mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void
 	if (pinrec != NULL) {
 		mapper_rename_state_t* pstate = (mapper_rename_state_t*)pvstate;
 
+		slls_t* pplan = schema_cache_get(pstate->pschema_cache, pinrec);
+		if (pplan != NULL) {
+			for (sllse_t* pe = pplan->phead; pe != NULL; pe = pe->pnext->pnext)
+				lrec_rename(pinrec, pe->value, mlr_strdup_or_die(pe->pnext->value), TRUE);
+			return sllv_single(pinrec);
+		}
+
+		pplan = slls_alloc();
+		schema_cache_put(pstate->pschema_cache, pinrec, pplan);
 		for (sllve_t* pe = pstate->pregex_pairs->phead; pe != NULL; pe = pe->pnext) {
 			regex_pair_t* ppair = pe->pvvalue;
-			regex_t* pregex = &ppair->regex;
+			regex_t* pregex = &ppair->regex.regex;
 			char* replacement = ppair->replacement;
 			for (lrece_t* pf = pinrec->phead; pf != NULL; pf = pf->pnext) {
 				int matched = FALSE;
 				int all_captured = FALSE;
 				char* old_name = pf->key;
+				if (!fast_regex_may_match(&ppair->regex, old_name))
+					continue;
+				char* new_name = NULL;
+				int new_needs_freeing = TRUE;
 				if (pstate->do_gsub) {
 					char free_flags = NO_FREE;
-					char* new_name = regex_gsub(old_name, pregex, pstate->psb, replacement, &matched,
+					new_name = regex_gsub(old_name, pregex, pstate->psb, replacement, &matched,
 						&all_captured, &free_flags);
-					int new_needs_freeing = FALSE;
-					if (free_flags & FREE_ENTRY_VALUE)
-						new_needs_freeing = TRUE;
-					if (matched)
-						lrec_rename(pinrec, old_name, new_name, new_needs_freeing);
+					if (!(free_flags & FREE_ENTRY_VALUE))
+						new_needs_freeing = FALSE;
 				} else {
-					char* new_name = regex_sub(old_name, pregex, pstate->psb, replacement, &matched,
+					new_name = regex_sub(old_name, pregex, pstate->psb, replacement, &matched,
 						&all_captured);
-					if (matched)
-						lrec_rename(pinrec, old_name, new_name, TRUE);
+				}
+				if (matched) {
+					slls_append_with_free(pplan, mlr_strdup_or_die(old_name));
+					slls_append_with_free(pplan, mlr_strdup_or_die(new_name));
+					lrec_rename(pinrec, old_name, new_name, new_needs_freeing);
 				}
 			}
 		}
@@ -210,3 +231,7 @@ static sllv_t* mapper_rename_regex_process(lrec_t* pinrec, context_t* pctx, void
 		return sllv_single(NULL);
 	}
 }
+
+static void mapper_rename_plan_free(void* pvplan) {
+	slls_free(pvplan);
+}
@@ -5,6 +5,7 @@
 #include "containers/sllv.h"
 #include "containers/lhmslv.h"
 #include "containers/mixutil.h"
+#include "containers/schema_cache.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -42,6 +43,7 @@ typedef struct _mapper_reshape_state_t {
 	// for wide-to-long:
 	slls_t* input_field_names;
 	sllv_t* input_field_regexes;
+	schema_cache_t* pschema_cache; // Per-schema regex-match flags for -r
 	char* output_key_field_name;
 	char* output_value_field_name;
 
@@ -226,14 +228,16 @@ static mapper_t* mapper_reshape_alloc(
 
 	if (input_field_regex_strings == NULL) {
 		pstate->input_field_regexes = NULL;
+		pstate->pschema_cache = NULL;
 	} else {
 		pstate->input_field_regexes = sllv_alloc();
 		for (sllse_t* pe = input_field_regex_strings->phead; pe != NULL; pe = pe->pnext) {
-			regex_t* pregex = mlr_malloc_or_die(sizeof(regex_t));
-			regcomp_or_die(pregex, pe->value, 0);
+			fast_regex_t* pregex = mlr_malloc_or_die(sizeof(fast_regex_t));
+			fast_regcomp_or_die(pregex, pe->value, 0);
 			sllv_append(pstate->input_field_regexes, pregex);
 		}
 		slls_free(input_field_regex_strings);
+		pstate->pschema_cache = schema_cache_alloc(free);
 	}
 
 	if (split_out_key_field_name == NULL) {
@@ -266,12 +270,13 @@ static void mapper_reshape_free(mapper_t* pmapper) {
 
 	if (pstate->input_field_regexes != NULL) {
 		for (sllve_t* pe = pstate->input_field_regexes->phead; pe != NULL; pe = pe->pnext) {
-			regex_t* pregex = pe->pvvalue;
-			regfree(pregex);
+			fast_regex_t* pregex = pe->pvvalue;
+			fast_regfree(pregex);
 			free(pregex);
 		}
 		sllv_free(pstate->input_field_regexes);
 	}
+	schema_cache_free(pstate->pschema_cache);
 
 	if (pstate->other_keys_to_other_values_to_buckets != NULL) {
 		for (lhmslve_t* pe = pstate->other_keys_to_other_values_to_buckets->phead; pe != NULL; pe = pe->pnext) {
@@ -339,16 +344,30 @@ static sllv_t* mapper_reshape_wide_to_long_regex_process(lrec_t* pinrec, context
 	sllv_t* poutrecs = sllv_alloc();
 	lhmss_t* pairs = lhmss_alloc();
 
-	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext) {
-		for (sllve_t* pf = pstate->input_field_regexes->phead; pf != NULL; pf = pf->pnext) {
-			regex_t* pregex = pf->pvvalue;
-			if (regmatch_or_die(pregex, pe->key, 0, NULL)) {
-				// Ownership-transfer of the about-to-be-freed key-value pairs from lrec to lhmss
-				lhmss_put(pairs, pe->key, pe->value, pe->free_flags);
-				pe->free_flags = NO_FREE;
-				break;
+	char* pmatch_flags = schema_cache_get(pstate->pschema_cache, pinrec);
+	if (pmatch_flags == NULL) {
+		pmatch_flags = mlr_malloc_or_die(pinrec->field_count + 1);
+		int j = 0;
+		for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext, j++) {
+			pmatch_flags[j] = FALSE;
+			for (sllve_t* pf = pstate->input_field_regexes->phead; pf != NULL; pf = pf->pnext) {
+				fast_regex_t* pregex = pf->pvvalue;
+				if (fast_regmatch_or_die(pregex, pe->key, 0, NULL)) {
+					pmatch_flags[j] = TRUE;
+					break;
+				}
 			}
 		}
+		schema_cache_put(pstate->pschema_cache, pinrec, pmatch_flags);
+	}
+
+	int j = 0;
+	for (lrece_t* pe = pinrec->phead; pe != NULL; pe = pe->pnext, j++) {
+		if (pmatch_flags[j]) {
+			// Ownership-transfer of the about-to-be-freed key-value pairs from lrec to lhmss
+			lhmss_put(pairs, pe->key, pe->value, pe->free_flags);
+			pe->free_flags = NO_FREE;
+		}
 	}
 
 	// Unset the lrec keys after iterating over them, rather than during
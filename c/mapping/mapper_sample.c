@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
 #include "lib/mlrutil.h"
 #include "lib/mtrand.h"
 #include "containers/sllv.h"
@@ -29,6 +30,14 @@ typedef struct _mapper_sample_state_t {
 	slls_t* pgroup_by_field_names;
 	unsigned long long sample_count;
 	lhmslv_t* pbuckets_by_group;
+
+	// Without -g: Li's Algorithm L. Once the reservoir is full, the gap to the next record to be kept is drawn
+	// directly, so the records in between are discarded without drawing random numbers -- or, by the stream
+	// driver, without being parsed at all.
+	sample_bucket_t*   punkeyed_bucket;
+	unsigned long long num_seen;
+	unsigned long long next_kept;  // One-up record number of the next record to be kept
+	double             w;
 } mapper_sample_state_t;
 
 static void      mapper_sample_usage(FILE* o, char* argv0, char* verb);
@@ -38,6 +47,8 @@ static mapper_t* mapper_sample_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_
 	unsigned long long sample_count);
 static void      mapper_sample_free(mapper_t* pmapper);
 static sllv_t*   mapper_sample_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t*   mapper_sample_process_unkeyed(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static void      mapper_sample_draw_next_kept(mapper_sample_state_t* pstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_sample_setup = {
@@ -53,6 +64,8 @@ static void mapper_sample_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Reservoir sampling (subsampling without replacement), optionally by category.\n");
 	fprintf(o, "-k {count}    Required: number of records to output, total, or by group if using -g.\n");
 	fprintf(o, "-g {a,b,c}    Optional: group-by-field names for samples.\n");
+	fprintf(o, "Without -g, as the first verb on memory-mapped DKVP or NIDX input, records not\n");
+	fprintf(o, "sampled are skipped without being parsed (i.e. is fast).\n");
 	fprintf(o, "See also %s bootstrap and %s shuffle.\n", argv0, argv0);
 }
 
@@ -92,10 +105,19 @@ static mapper_t* mapper_sample_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_
 	pstate->pgroup_by_field_names = pgroup_by_field_names;
 	pstate->sample_count          = sample_count;
 	pstate->pbuckets_by_group     = lhmslv_alloc();
+	pstate->punkeyed_bucket       = NULL;
+	pstate->num_seen              = 0LL;
+	pstate->next_kept             = 0LL;
+	pstate->w                     = 1.0;
 
 	pmapper->pvstate              = pstate;
-	pmapper->pprocess_func        = mapper_sample_process;
 	pmapper->pfree_func           = mapper_sample_free;
+	if (pgroup_by_field_names->length == 0) {
+		pstate->punkeyed_bucket = sample_bucket_alloc(sample_count);
+		pmapper->pprocess_func = mapper_sample_process_unkeyed;
+	} else {
+		pmapper->pprocess_func = mapper_sample_process;
+	}
 
 	return pmapper;
 }
@@ -110,6 +132,8 @@ static void mapper_sample_free(mapper_t* pmapper) {
 		sample_bucket_free(pbucket);
 	}
 	lhmslv_free(pstate->pbuckets_by_group);
+	if (pstate->punkeyed_bucket != NULL)
+		sample_bucket_free(pstate->punkeyed_bucket);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -151,6 +175,78 @@ static sllv_t* mapper_sample_process(lrec_t* pinrec, context_t* pctx, void* pvst
 	}
 }
 
+// ----------------------------------------------------------------
+// Each record is kept with probability k/n as for the per-group algorithm below, but, given the reservoir's
+// weight w, the number of records skipped before the next kept one is geometric, so it is drawn at once.
+static sllv_t* mapper_sample_process_unkeyed(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_sample_state_t* pstate = pvstate;
+	sample_bucket_t* pbucket = pstate->punkeyed_bucket;
+	if (pinrec != NULL) {
+		pstate->num_seen++;
+		if (pbucket->nused < pbucket->nalloc) {
+			pbucket->plrecs[pbucket->nused++] = pinrec;
+			if (pbucket->nused == pbucket->nalloc)
+				mapper_sample_draw_next_kept(pstate);
+		} else if (pstate->num_seen == pstate->next_kept) {
+			int r = get_mtrand_int31() % pbucket->nalloc;
+			lrec_free(pbucket->plrecs[r]);
+			pbucket->plrecs[r] = pinrec;
+			mapper_sample_draw_next_kept(pstate);
+		} else {
+			lrec_free(pinrec);
+		}
+		return NULL;
+	}
+	else {
+		sllv_t* poutrecs = sllv_alloc();
+		for (int i = 0; i < pbucket->nused; i++) {
+			sllv_append(poutrecs, pbucket->plrecs[i]);
+			pbucket->plrecs[i] = NULL;
+		}
+		pbucket->nused = 0;
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
+
+// Draws from (0,1] since logarithms are taken.
+static double mapper_sample_uniform() {
+	return 1.0 - get_mtrand_double();
+}
+
+static void mapper_sample_draw_next_kept(mapper_sample_state_t* pstate) {
+	double k = pstate->sample_count;
+	if (pstate->num_seen == pstate->sample_count)
+		pstate->w = exp(log(mapper_sample_uniform()) / k);
+	else
+		pstate->w *= exp(log(mapper_sample_uniform()) / k);
+	double gap = floor(log(mapper_sample_uniform()) / log(1.0 - pstate->w));
+	// The gap is +inf when w rounds to 1.
+	if (!(gap < 1e18))
+		gap = 1e18;
+	pstate->next_kept = pstate->num_seen + (unsigned long long)gap + 1LL;
+}
+
+// For the stream driver: the number of upcoming records which will be discarded, which it may skip without
+// parsing, reporting the number actually skipped since input may end first.
+int mapper_sample_is_unkeyed(mapper_t* pmapper) {
+	return pmapper->pprocess_func == mapper_sample_process_unkeyed;
+}
+
+unsigned long long mapper_sample_get_skippable(mapper_t* pmapper) {
+	mapper_sample_state_t* pstate = pmapper->pvstate;
+	if (pstate->sample_count == 0LL)
+		return LLONG_MAX;
+	if (pstate->punkeyed_bucket->nused < pstate->punkeyed_bucket->nalloc)
+		return 0LL;
+	return pstate->next_kept - pstate->num_seen - 1LL;
+}
+
+void mapper_sample_note_skipped(mapper_t* pmapper, unsigned long long num_skipped) {
+	mapper_sample_state_t* pstate = pmapper->pvstate;
+	pstate->num_seen += num_skipped;
+}
+
 // ----------------------------------------------------------------
 sample_bucket_t* sample_bucket_alloc(int nalloc) {
 	sample_bucket_t* pbucket = mlr_malloc_or_die(sizeof(sample_bucket_t));
@@ -8,6 +8,9 @@
 #include "containers/slls.h"
 #include "containers/lhmslv.h"
 #include "containers/mixutil.h"
+#include "containers/lrec_spill.h"
+#include "containers/lrec_store.h"
+#include "containers/sort_key.h"
 #include "mapping/mappers.h"
 
 // ================================================================
@@ -25,57 +28,134 @@
 //   having those sort-key values, in the order encountered.
 //
 // * For each of those unique sort-key-value combinations, we also parse the
-//   numerical fields at this point into an array of union-string-double.
-//   E.g. the list ["red", "1.0"] maps to the array ["red", 1.0].
+//   numerical fields at this point and encode the values as a normalized sort
+//   key (see sort_key.h): a byte string which memcmps in sort order, with
+//   the descending fields complemented. E.g. the list ["red", "1.0"] maps to
+//   the bytes of "red", a NUL, then the complemented bytes of 1.0.
 //
-// * The pairing of parsed-value array the linked list of same-key-value records
+// * The pairing of sort key and the linked list of same-key-value records
 //   is called a *bucket*. E.g the records
 //     {"a":"red","b":"circle","x":"1.0","y":"3.9"}
 //     {"a":"red","b":"square","x":"1.0","z":"5.7", "q":"even"}
 //   would both land in the ["red","1.0"] bucket.
 //
 // * Buckets are retained in a hash map: the key is the string-list of the form
-//   ["red","1.0"] and the value is the pairing of parsed-value array ["red",1.0]
-//   ane linked list of records.
+//   ["red","1.0"] and the value is the pairing of sort key and linked list of
+//   records.
 //
 // * Once all the input records are ingested into this hash map, we copy the
-//   bucket-pointers into an array and sort it: this being the pairing of
-//   parsed-value array and linked list of records. The comparator callback for
-//   the sort walks through the parsed-value arrays one slot at a time,
-//   looking at the first difference, e.g. if one has "a"="red" and the other
-//   has "a"="blue". If the first field matches then the sort moves to the
-//   second field, and so on.
+//   bucket-pointers, with their sort keys, into an array and sort it by sort
+//   key. The sort is stable, so buckets with equal sort keys stay in the order
+//   first encountered.
 //
 // * Recall in particular that string keys ["a":"red","x":"1"] and
 //   ["a":"red","x":"1.0"] map to different buckets, but will sort equally.
 //
+// * With --max-memory, once the retained records exceed the limit, the buckets
+//   are sorted as above and written out, in order, to a spill file as a sorted
+//   run; the hash map is then emptied and ingestion continues. Records missing
+//   sort keys are appended to a spill file of their own. At end of stream the
+//   runs, along with the final in-memory one, are k-way merged using a min-heap
+//   keyed on each run's next record. Ties go to the earlier run so records
+//   with equal sort keys keep their input order, as they do within a bucket.
+//   (Equal values spelled differently, e.g. "1" and "1.0", are then grouped
+//   by spelling within each run rather than across the whole stream.)
+//   The merged output is returned in batches (see more_output in context.h)
+//   so it is never all in memory at once. To bound the number of open spill
+//   files, runs are merged level by level as in any external merge sort: when
+//   the newest runs include SORT_MERGE_FAN_IN of the same level, they are
+//   merged into one of the next level. Each record is then rewritten about
+//   log-base-fan-in of the number of runs times, and fewer than the fan-in runs
+//   of each level are open.
+//
+// * "sort ... then head ..." is replaced at CLI-parse time, where the output
+//   would be the same, by a fused top-n mapper (see mapper_sort_fuse_head
+//   below) which retains only n records per head group.
+//
+// * Records are compacted as they are retained (see lrec_compact in lrec.h),
+//   so those cut down upstream don't keep their whole input lines.
+//
+// * group-by keeps its records in an lrec_store (see lrec_store.h), which
+//   spills them with --max-memory, since it needn't sort or merge them.
+//
 // ================================================================
 
 #define SORT_NUMERIC    0x80
 #define SORT_DESCENDING 0x40
 
+#define SORT_MERGE_FAN_IN     16
+#define SORT_MERGE_BATCH_SIZE 1000
+
+#define TOP_SPELLINGS_MIN_MAX 1024
+
+typedef struct _sort_bucket_t {
+	sort_key_t* psort_key;
+	sllv_t*     precords;
+} sort_bucket_t;
+
+// A sorted run for the end-of-stream merge: either a spill file or the final in-memory records.
+typedef struct _sort_run_t {
+	FILE*       fp;
+	sllv_t*     precords;
+	int         index;     // Creation order, for tie-breaking
+	int         level;     // Zero for a spill, else one more than the runs merged into it
+	lrec_t*     prec;      // Next record, or NULL when the run is exhausted
+	sort_key_t* psort_key; // Of prec
+} sort_run_t;
+
 typedef struct _mapper_sort_state_t {
 	// Input parameters
 	slls_t* pkey_field_names; // Fields to sort on
 	int*    sort_params;      // Lexical/numeric; ascending/descending
 	int do_sort;              // If false, just do group-by
-	// Sort state: buckets of like records.
+	long long max_memory;     // Spill threshold in bytes; zero for none
+	// Sort state: buckets of like records
 	lhmslv_t* pbuckets_by_key_field_values;
 	sllv_t*   precords_missing_sort_keys;
+	// External-sort state
+	long long    memory;             // Estimated bytes of records retained in memory
+	sort_run_t** runs;               // Spilled runs; then, at end of stream, the min-heap of non-exhausted runs
+	int          num_runs;
+	int          num_runs_created;
+	FILE*        pmissing_spill;     // Spilled records missing sort keys, or NULL if none
+	int          merging;
+	// Group-by state: records by group-by values, then those missing them
+	lrec_store_t* pstore;
 } mapper_sort_state_t;
 
-// Each sort key is string or number; use union to save space.
-typedef struct _typed_sort_key_t {
-	union {
-		char*  s;
-		double d;
-	} u;
-} typed_sort_key_t;
-
-typedef struct _sort_bucket_t {
-	typed_sort_key_t* typed_sort_keys;
-	sllv_t*           precords;
-} sort_bucket_t;
+// Fused sort-then-head. Each head group keeps its least records as a bounded max-heap, and its first
+// records missing sort keys, up to the head count for each.
+typedef struct _top_spelling_t {
+	unsigned long long first_sequence; // Of the first record with these sort-field values as-is
+	unsigned long long num_retained;
+} top_spelling_t;
+
+typedef struct _top_entry_t {
+	sort_key_t*     psort_key; // Sort key, spelling, then arrival sequence number, so no two entries are equal
+	lrec_t*         prec;
+	top_spelling_t* pspelling; // NULL unless tracking spellings
+} top_entry_t;
+
+typedef struct _top_group_t {
+	top_entry_t*       heap;
+	unsigned long long num_entries;
+	unsigned long long alloc_entries;
+	top_entry_t*       missing;  // Keyed on arrival sequence number only
+	unsigned long long num_missing;
+	unsigned long long alloc_missing;
+} top_group_t;
+
+typedef struct _mapper_sort_head_state_t {
+	slls_t*            pkey_field_names;
+	int*               sort_params;
+	unsigned long long head_count;
+	slls_t*            pgroup_by_field_names;
+	lhmslv_t*          pgroups;
+	lhmslv_t*          pspellings;     // Sort-field values as-is to top_spelling_t; NULL if all lexical
+	unsigned long long max_spellings;  // Size at which to drop those no longer retained
+	unsigned long long sequence;
+	sort_key_t*        pscratch_key;
+} mapper_sort_head_state_t;
 
 // ----------------------------------------------------------------
 static void      mapper_sort_usage(FILE* o, char* argv0, char* verb);
@@ -84,19 +164,22 @@ static mapper_t* mapper_sort_parse_cli(int* pargi, int argc, char** argv,
 static void      mapper_group_by_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_group_by_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
-static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, int do_sort);
+static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, int do_sort, long long max_memory);
 static void      mapper_sort_free(mapper_t* pmapper);
 static sllv_t*   mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
-
-static typed_sort_key_t* parse_sort_keys(slls_t* pkey_field_values, int* sort_params, context_t* pctx);
-
-// qsort is non-reentrant but qsort_r isn't portable. But since Miller is
-// single-threaded, even if we've got one sort chained to another, only one is
-// active at a time. We adopt the convention that we set the sort params
-// right before the sort.
-static int* pcmp_sort_params  = NULL;
-static int  cmp_params_length = 0;
-static int pbucket_comparator(const void* pva, const void* pvb);
+static sllv_t*   mapper_sort_process_merge(context_t* pctx, mapper_sort_state_t* pstate);
+static sllv_t*   mapper_group_by_process(lrec_t* pinrec, context_t* pctx, mapper_sort_state_t* pstate);
+static sort_bucket_t** mapper_sort_sorted_buckets(mapper_sort_state_t* pstate);
+static void      mapper_sort_spill(mapper_sort_state_t* pstate, context_t* pctx);
+static void      mapper_sort_merge_full_levels(mapper_sort_state_t* pstate, context_t* pctx);
+static void      sort_run_advance(sort_run_t* prun, mapper_sort_state_t* pstate, context_t* pctx);
+static lrec_t*   sort_runs_pop(sort_run_t** heap, int* pnum_runs, mapper_sort_state_t* pstate, context_t* pctx);
+static void      sort_runs_start(sort_run_t** heap, int num_runs, mapper_sort_state_t* pstate, context_t* pctx);
+static void      sort_run_free(sort_run_t* prun);
+
+static void encode_sort_key(sort_key_t* psort_key, slls_t* pkey_field_values, int* sort_params, context_t* pctx);
+static void      mapper_sort_head_free(mapper_t* pmapper);
+static sllv_t*   mapper_sort_head_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 // ----------------------------------------------------------------
 mapper_setup_t mapper_sort_setup = {
@@ -122,6 +205,13 @@ static void mapper_sort_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "  -nf {comma-separated field names}  Numerical ascending; nulls sort last\n");
 	fprintf(o, "  -r  {comma-separated field names}  Lexical descending\n");
 	fprintf(o, "  -nr {comma-separated field names}  Numerical descending; nulls sort first\n");
+	fprintf(o, "  --max-memory {size}  Keep at most about this much record data in memory, e.g.\n");
+	fprintf(o, "                       500000000, 500m, or 2g. Beyond that, sorted runs are spilled\n");
+	fprintf(o, "                       to temp files in $TMPDIR (default /tmp) and merged at end\n");
+	fprintf(o, "                       of stream. Default: no limit.\n");
+	fprintf(o, "                       Once records are spilled, the merge is output in\n");
+	fprintf(o, "                       batches, so prints in end blocks of a put or filter after\n");
+	fprintf(o, "                       this verb come after the first batches rather than before.\n");
 	fprintf(o, "Sorts records primarily by the first specified field, secondarily by the second\n");
 	fprintf(o, "field, and so on.  Any records not having all specified sort keys will appear\n");
 	fprintf(o, "at the end of the output, in the order they were encountered, regardless of the\n");
@@ -144,6 +234,7 @@ static mapper_t* mapper_sort_parse_cli(int* pargi, int argc, char** argv,
 	*pargi += 1;
 	slls_t* pnames = slls_alloc();
 	slls_t* pflags = slls_alloc();
+	long long max_memory = 0LL;
 
 	while ((argc - *pargi) >= 1 && argv[*pargi][0] == '-') {
 		if ((argc - *pargi) < 2)
@@ -152,7 +243,10 @@ static mapper_t* mapper_sort_parse_cli(int* pargi, int argc, char** argv,
 		char* value = argv[*pargi+1];
 		*pargi += 2;
 
-		if (streq(flag, "-f")) {
+		if (streq(flag, "--max-memory")) {
+			max_memory = mlr_memory_size_from_string_or_die(verb, value);
+			continue;
+		} else if (streq(flag, "-f")) {
 		} else if (streq(flag, "-n")) {
 		} else if (streq(flag, "-nf")) {
 		} else if (streq(flag, "-r")) {
@@ -189,34 +283,49 @@ static mapper_t* mapper_sort_parse_cli(int* pargi, int argc, char** argv,
 	}
 	slls_free(pflags);
 
-	return mapper_sort_alloc(pnames, opt_array, TRUE);
+	return mapper_sort_alloc(pnames, opt_array, TRUE, max_memory);
 }
 
 // ----------------------------------------------------------------
 static void mapper_group_by_usage(FILE* o, char* argv0, char* verb) {
-	fprintf(o, "Usage: %s %s {comma-separated field names}\n", argv0, verb);
+	fprintf(o, "Usage: %s %s [options] {comma-separated field names}\n", argv0, verb);
 	fprintf(o, "Outputs records in batches having identical values at specified field names.\n");
+	fprintf(o, "Options:\n");
+	fprintf(o, "--max-memory {size}  Keep at most about this much record data in memory, e.g.\n");
+	fprintf(o, "                     500000000, 500m, or 2g. Beyond that, records are spilled to\n");
+	fprintf(o, "                     temp files in $TMPDIR (default /tmp). Default: no limit.\n");
+	fprintf(o, "                     Once records are spilled, they are output in batches, so\n");
+	fprintf(o, "                     prints in end blocks of a put or filter after this verb\n");
+	fprintf(o, "                     come after the first batches rather than before them.\n");
 }
 
 static mapper_t* mapper_group_by_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __)
 {
-	if ((argc - *pargi) < 2) {
-		mapper_group_by_usage(stderr, argv[0], argv[*pargi]);
+	char* verb = argv[*pargi];
+	*pargi += 1;
+	long long max_memory = 0LL;
+
+	if ((argc - *pargi) >= 2 && streq(argv[*pargi], "--max-memory")) {
+		max_memory = mlr_memory_size_from_string_or_die(verb, argv[*pargi+1]);
+		*pargi += 2;
+	}
+	if ((argc - *pargi) < 1) {
+		mapper_group_by_usage(stderr, argv[0], verb);
 		return NULL;
 	}
 
-	slls_t* pnames = slls_from_line(argv[*pargi+1], ',', FALSE);
+	slls_t* pnames = slls_from_line(argv[*pargi], ',', FALSE);
 	int* opt_array = mlr_malloc_or_die(pnames->length * sizeof(int));
 	for (int i = 0; i < pnames->length; i++)
 		opt_array[i] = 0;
 
-	*pargi += 2;
-	return mapper_sort_alloc(pnames, opt_array, FALSE);
+	*pargi += 1;
+	return mapper_sort_alloc(pnames, opt_array, FALSE, max_memory);
 }
 
 // ----------------------------------------------------------------
-static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, int do_sort) {
+static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, int do_sort, long long max_memory) {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
 	mapper_sort_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_sort_state_t));
@@ -226,6 +335,14 @@ static mapper_t* mapper_sort_alloc(slls_t* pkey_field_names, int* sort_params, i
 	pstate->pbuckets_by_key_field_values = lhmslv_alloc();
 	pstate->precords_missing_sort_keys   = sllv_alloc();
 	pstate->do_sort                      = do_sort;
+	pstate->max_memory                   = max_memory;
+	pstate->memory                       = 0LL;
+	pstate->runs                         = NULL;
+	pstate->num_runs                     = 0;
+	pstate->num_runs_created             = 0;
+	pstate->pmissing_spill               = NULL;
+	pstate->merging                      = FALSE;
+	pstate->pstore                       = do_sort ? NULL : lrec_store_alloc(max_memory);
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_sort_process;
@@ -242,12 +359,18 @@ static void mapper_sort_free(mapper_t* pmapper) {
 	// lhmslv_free will free the hashmap keys; we need to free the void-star hashmap values.
 	for (lhmslve_t* pa = pstate->pbuckets_by_key_field_values->phead; pa != NULL; pa = pa->pnext) {
 		sort_bucket_t* pbucket = pa->pvvalue;
-		free(pbucket->typed_sort_keys);
+		sort_key_free(pbucket->psort_key);
 		free(pbucket);
 		// precords freed in emitter
 	}
 	lhmslv_free(pstate->pbuckets_by_key_field_values);
 	sllv_free(pstate->precords_missing_sort_keys);
+	for (int i = 0; i < pstate->num_runs; i++)
+		sort_run_free(pstate->runs[i]);
+	free(pstate->runs);
+	if (pstate->pmissing_spill != NULL)
+		fclose(pstate->pmissing_spill);
+	lrec_store_free(pstate->pstore);
 	free(pstate->sort_params);
 	free(pstate);
 	free(pmapper);
@@ -256,8 +379,13 @@ static void mapper_sort_free(mapper_t* pmapper) {
 // ----------------------------------------------------------------
 static sllv_t* mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_sort_state_t* pstate = pvstate;
-	if (pinrec != NULL) {
+	if (!pstate->do_sort) {
+		return mapper_group_by_process(pinrec, pctx, pstate);
+	} else if (pinrec != NULL) {
 		// Consume another input record.
+		lrec_compact(pinrec);
+		if (pstate->max_memory > 0LL)
+			pstate->memory += lrec_memory_footprint(pinrec);
 		slls_t* pkey_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pkey_field_names);
 		if (pkey_field_values == NULL) {
 			sllv_append(pstate->precords_missing_sort_keys, pinrec);
@@ -266,7 +394,8 @@ static sllv_t* mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 			if (pbucket == NULL) { // New key-field-value: new bucket and hash-map entry
 				slls_t* pkey_field_values_copy = slls_copy(pkey_field_values);
 				sort_bucket_t* pbucket = mlr_malloc_or_die(sizeof(sort_bucket_t));
-				pbucket->typed_sort_keys = parse_sort_keys(pkey_field_values_copy, pstate->sort_params, pctx);
+				pbucket->psort_key = sort_key_alloc();
+				encode_sort_key(pbucket->psort_key, pkey_field_values_copy, pstate->sort_params, pctx);
 				pbucket->precords = sllv_alloc();
 				sllv_append(pbucket->precords, pinrec);
 				lhmslv_put(pstate->pbuckets_by_key_field_values, pkey_field_values_copy, pbucket,
@@ -276,40 +405,20 @@ static sllv_t* mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 			}
 			slls_free(pkey_field_values);
 		}
+		if (pstate->max_memory > 0LL && pstate->memory > pstate->max_memory)
+			mapper_sort_spill(pstate, pctx);
 		return NULL;
-	} else if (!pstate->do_sort) {
-		// End of input stream: do output for group-by
-		sllv_t* poutput = sllv_alloc();
-		for (lhmslve_t* pe = pstate->pbuckets_by_key_field_values->phead; pe != NULL; pe = pe->pnext) {
-			sort_bucket_t* pbucket = pe->pvvalue;
-			sllv_transfer(poutput, pbucket->precords);
-			sllv_free(pbucket->precords);
-		}
-		sllv_transfer(poutput, pstate->precords_missing_sort_keys);
-		sllv_append(poutput, NULL);
-		return poutput;
+	} else if (pstate->merging || pstate->num_runs > 0 || pstate->pmissing_spill != NULL) {
+		// End of input stream, having spilled
+		return mapper_sort_process_merge(pctx, pstate);
 	} else {
 		// End of input stream: sort bucket labels
 		int num_buckets = pstate->pbuckets_by_key_field_values->num_occupied;
-		sort_bucket_t** pbucket_array = mlr_malloc_or_die(num_buckets * sizeof(sort_bucket_t*));
-
-		// Copy bucket-pointers to an array for qsort
-		int i = 0;
-		for (lhmslve_t* pe = pstate->pbuckets_by_key_field_values->phead; pe != NULL; pe = pe->pnext, i++) {
-			pbucket_array[i] = pe->pvvalue;
-		}
-
-		pcmp_sort_params  = pstate->sort_params;
-		cmp_params_length = pstate->pkey_field_names->length;
-
-		qsort(pbucket_array, num_buckets, sizeof(sort_bucket_t*), pbucket_comparator);
-
-		pcmp_sort_params  = NULL;
-		cmp_params_length = 0;
+		sort_bucket_t** pbucket_array = mapper_sort_sorted_buckets(pstate);
 
 		// Emit each bucket's record
 		sllv_t* poutput = sllv_alloc();
-		for (i = 0; i < num_buckets; i++) {
+		for (int i = 0; i < num_buckets; i++) {
 			sllv_t* plist = pbucket_array[i]->precords;
 			sllv_transfer(poutput, plist);
 			sllv_free(plist);
@@ -321,54 +430,550 @@ static sllv_t* mapper_sort_process(lrec_t* pinrec, context_t* pctx, void* pvstat
 	}
 }
 
-static int pbucket_comparator(const void* pva, const void* pvb) {
-	// We are sorting an array of sort_bucket_t*.
-	const sort_bucket_t** pba = (const sort_bucket_t**)pva;
-	const sort_bucket_t** pbb = (const sort_bucket_t**)pvb;
-	typed_sort_key_t* akeys = (*pba)->typed_sort_keys;
-	typed_sort_key_t* bkeys = (*pbb)->typed_sort_keys;
-	for (int i = 0; i < cmp_params_length; i++) {
-		int sort_param = pcmp_sort_params[i];
-		if (sort_param & SORT_NUMERIC) {
-			double a = akeys[i].u.d;
-			double b = bkeys[i].u.d;
-			if (isnan(a)) { // null input value
-				if (!isnan(b)) {
-					return (sort_param & SORT_DESCENDING) ? -1 : 1;
-				}
-			} else if (isnan(b)) {
-					return (sort_param & SORT_DESCENDING) ? 1 : -1;
-			} else {
-				double d = a - b;
-				int s = (d < 0) ? -1 : (d > 0) ? 1 : 0;
-				if (s != 0)
-					return (sort_param & SORT_DESCENDING) ? -s : s;
+// Group-by retains records, spilling them with --max-memory, but needn't sort or merge them.
+static sllv_t* mapper_group_by_process(lrec_t* pinrec, context_t* pctx, mapper_sort_state_t* pstate) {
+	if (pinrec != NULL) {
+		slls_t* pkey_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pkey_field_names);
+		lrec_store_append(pstate->pstore, lrec_store_get_group(pstate->pstore, pkey_field_values), pinrec);
+		slls_free(pkey_field_values);
+		return NULL;
+	} else {
+		return lrec_store_next_batch(pstate->pstore, FALSE, pctx);
+	}
+}
+
+// Returns the buckets, in sort order, as an array for the caller to free.
+static sort_bucket_t** mapper_sort_sorted_buckets(mapper_sort_state_t* pstate) {
+	int num_buckets = pstate->pbuckets_by_key_field_values->num_occupied;
+	sort_item_t* items = mlr_malloc_or_die(num_buckets * sizeof(sort_item_t));
+	int i = 0;
+	for (lhmslve_t* pe = pstate->pbuckets_by_key_field_values->phead; pe != NULL; pe = pe->pnext, i++) {
+		sort_bucket_t* pbucket = pe->pvvalue;
+		items[i].pkey    = pbucket->psort_key;
+		items[i].pvvalue = pbucket;
+	}
+
+	sort_items(items, num_buckets);
+
+	sort_bucket_t** pbucket_array = mlr_malloc_or_die(num_buckets * sizeof(sort_bucket_t*));
+	for (i = 0; i < num_buckets; i++)
+		pbucket_array[i] = items[i].pvvalue;
+	free(items);
+	return pbucket_array;
+}
+
+// ----------------------------------------------------------------
+static sort_run_t* sort_run_alloc(FILE* fp, sllv_t* precords, int index, int level) {
+	sort_run_t* prun = mlr_malloc_or_die(sizeof(sort_run_t));
+	prun->fp              = fp;
+	prun->precords        = precords;
+	prun->index           = index;
+	prun->level           = level;
+	prun->prec            = NULL;
+	prun->psort_key       = sort_key_alloc();
+	return prun;
+}
+
+static void sort_run_free(sort_run_t* prun) {
+	if (prun->fp != NULL)
+		fclose(prun->fp);
+	if (prun->precords != NULL) {
+		for (sllve_t* pe = prun->precords->phead; pe != NULL; pe = pe->pnext)
+			lrec_free(pe->pvvalue);
+		sllv_free(prun->precords);
+	}
+	if (prun->prec != NULL)
+		lrec_free(prun->prec);
+	sort_key_free(prun->psort_key);
+	free(prun);
+}
+
+static void mapper_sort_add_run(mapper_sort_state_t* pstate, sort_run_t* prun) {
+	pstate->runs = mlr_realloc_or_die(pstate->runs, (pstate->num_runs + 1) * sizeof(sort_run_t*));
+	pstate->runs[pstate->num_runs++] = prun;
+}
+
+// Writes the buckets out as a sorted run, and the records missing sort keys to their own spill file.
+static void mapper_sort_spill(mapper_sort_state_t* pstate, context_t* pctx) {
+	int num_buckets = pstate->pbuckets_by_key_field_values->num_occupied;
+	if (num_buckets > 0) {
+		sort_bucket_t** pbucket_array = mapper_sort_sorted_buckets(pstate);
+		FILE* fp = spill_file_open_or_die();
+		for (int i = 0; i < num_buckets; i++) {
+			sllv_t* plist = pbucket_array[i]->precords;
+			for (sllve_t* pe = plist->phead; pe != NULL; pe = pe->pnext) {
+				lrec_spill_write(fp, pe->pvvalue);
+				lrec_free(pe->pvvalue);
 			}
-		} else {
-			int s = strcmp(akeys[i].u.s, bkeys[i].u.s);
-			if (s != 0)
-				return (sort_param & SORT_DESCENDING) ? -s : s;
+			sllv_free(plist);
+			sort_key_free(pbucket_array[i]->psort_key);
+			free(pbucket_array[i]);
+		}
+		free(pbucket_array);
+		lhmslv_free(pstate->pbuckets_by_key_field_values);
+		pstate->pbuckets_by_key_field_values = lhmslv_alloc();
+
+		rewind(fp);
+		mapper_sort_add_run(pstate, sort_run_alloc(fp, NULL, pstate->num_runs_created++, 0));
+		mapper_sort_merge_full_levels(pstate, pctx);
+	}
+
+	if (pstate->precords_missing_sort_keys->length > 0) {
+		if (pstate->pmissing_spill == NULL)
+			pstate->pmissing_spill = spill_file_open_or_die();
+		lrec_t* prec;
+		while ((prec = sllv_pop(pstate->precords_missing_sort_keys)) != NULL) {
+			lrec_spill_write(pstate->pmissing_spill, prec);
+			lrec_free(prec);
 		}
 	}
-	return 0;
+
+	pstate->memory = 0LL;
+}
+
+// Merges the newest SORT_MERGE_FAN_IN runs into one while they are all of the same level. Levels never
+// increase along the list of runs, and there are fewer than the fan-in of any one level, so the merged run
+// has a level of its own. It also takes the place of the runs merged into it for tie-breaking, as its
+// records all came after those of earlier runs and before those of later ones.
+static void mapper_sort_merge_full_levels(mapper_sort_state_t* pstate, context_t* pctx) {
+	while (pstate->num_runs >= SORT_MERGE_FAN_IN) {
+		sort_run_t** pnewest = &pstate->runs[pstate->num_runs - SORT_MERGE_FAN_IN];
+		int level = pnewest[0]->level;
+		if (pnewest[SORT_MERGE_FAN_IN - 1]->level != level)
+			break;
+		FILE* fp = spill_file_open_or_die();
+		int index = pnewest[0]->index;
+
+		int num_merging = SORT_MERGE_FAN_IN;
+		sort_runs_start(pnewest, num_merging, pstate, pctx);
+		lrec_t* prec;
+		while ((prec = sort_runs_pop(pnewest, &num_merging, pstate, pctx)) != NULL) {
+			lrec_spill_write(fp, prec);
+			lrec_free(prec);
+		}
+		pstate->num_runs -= SORT_MERGE_FAN_IN;
+
+		rewind(fp);
+		mapper_sort_add_run(pstate, sort_run_alloc(fp, NULL, index, level + 1));
+	}
+}
+
+// ----------------------------------------------------------------
+// End of stream after spilling: the records still in memory are the final run. Output is the merge of
+// all runs, then the records missing sort keys in arrival order, i.e. spilled ones first.
+static sllv_t* mapper_sort_process_merge(context_t* pctx, mapper_sort_state_t* pstate) {
+	if (!pstate->merging) {
+		pstate->merging = TRUE;
+		int num_buckets = pstate->pbuckets_by_key_field_values->num_occupied;
+		if (num_buckets > 0) {
+			sort_bucket_t** pbucket_array = mapper_sort_sorted_buckets(pstate);
+			sllv_t* precords = sllv_alloc();
+			for (int i = 0; i < num_buckets; i++) {
+				sllv_t* plist = pbucket_array[i]->precords;
+				sllv_transfer(precords, plist);
+				sllv_free(plist);
+			}
+			free(pbucket_array);
+			mapper_sort_add_run(pstate, sort_run_alloc(NULL, precords, pstate->num_runs_created++, 0));
+		}
+		sort_runs_start(pstate->runs, pstate->num_runs, pstate, pctx);
+		if (pstate->pmissing_spill != NULL)
+			rewind(pstate->pmissing_spill);
+	}
+
+	sllv_t* poutrecs = sllv_alloc();
+	while (poutrecs->length < SORT_MERGE_BATCH_SIZE) {
+		lrec_t* prec = sort_runs_pop(pstate->runs, &pstate->num_runs, pstate, pctx);
+		if (prec == NULL && pstate->pmissing_spill != NULL) {
+			prec = lrec_spill_read(pstate->pmissing_spill);
+			if (prec == NULL) {
+				fclose(pstate->pmissing_spill);
+				pstate->pmissing_spill = NULL;
+			}
+		}
+		if (prec == NULL)
+			prec = sllv_pop(pstate->precords_missing_sort_keys);
+		if (prec == NULL) {
+			sllv_append(poutrecs, NULL); // Signal end of output-record stream.
+			return poutrecs;
+		}
+		sllv_append(poutrecs, prec);
+	}
+	pctx->more_output = TRUE;
+	return poutrecs;
+}
+
+// ----------------------------------------------------------------
+// Replaces the run's current record, which the caller has taken, with the next one.
+static void sort_run_advance(sort_run_t* prun, mapper_sort_state_t* pstate, context_t* pctx) {
+	prun->prec = (prun->fp != NULL) ? lrec_spill_read(prun->fp) : sllv_pop(prun->precords);
+	if (prun->prec != NULL) {
+		slls_t* pkey_field_values = mlr_reference_selected_values_from_record(prun->prec,
+			pstate->pkey_field_names);
+		sort_key_clear(prun->psort_key);
+		encode_sort_key(prun->psort_key, pkey_field_values, pstate->sort_params, pctx);
+		slls_free(pkey_field_values);
+	}
+}
+
+static int sort_run_less(sort_run_t* pa, sort_run_t* pb, mapper_sort_state_t* pstate) {
+	int s = sort_key_compare(pa->psort_key, pb->psort_key);
+	return s < 0 || (s == 0 && pa->index < pb->index);
 }
 
-// E.g. parse the list ["red","1.0"] into the array ["red",1.0].
-static typed_sort_key_t* parse_sort_keys(slls_t* pkey_field_values, int* sort_params, context_t* pctx) {
-	typed_sort_key_t* typed_sort_keys = mlr_malloc_or_die(pkey_field_values->length * sizeof(typed_sort_key_t));
+static void sort_runs_sift_down(sort_run_t** heap, int num_runs, int i, mapper_sort_state_t* pstate) {
+	while (TRUE) {
+		int l = 2*i + 1;
+		int r = l + 1;
+		int m = i;
+		if (l < num_runs && sort_run_less(heap[l], heap[m], pstate))
+			m = l;
+		if (r < num_runs && sort_run_less(heap[r], heap[m], pstate))
+			m = r;
+		if (m == i)
+			break;
+		sort_run_t* ptemp = heap[i];
+		heap[i] = heap[m];
+		heap[m] = ptemp;
+		i = m;
+	}
+}
+
+// Loads each run's first record and arranges the runs as a min-heap. Runs are never empty.
+static void sort_runs_start(sort_run_t** heap, int num_runs, mapper_sort_state_t* pstate, context_t* pctx) {
+	for (int i = 0; i < num_runs; i++)
+		sort_run_advance(heap[i], pstate, pctx);
+	for (int i = num_runs/2 - 1; i >= 0; i--)
+		sort_runs_sift_down(heap, num_runs, i, pstate);
+}
+
+// Returns the least record across all runs, or NULL when all are exhausted. Exhausted runs are freed.
+static lrec_t* sort_runs_pop(sort_run_t** heap, int* pnum_runs, mapper_sort_state_t* pstate, context_t* pctx) {
+	if (*pnum_runs == 0)
+		return NULL;
+	sort_run_t* prun = heap[0];
+	lrec_t* prec = prun->prec;
+	sort_run_advance(prun, pstate, pctx);
+	if (prun->prec == NULL) {
+		sort_run_free(prun);
+		heap[0] = heap[--*pnum_runs];
+	}
+	sort_runs_sift_down(heap, *pnum_runs, 0, pstate);
+	return prec;
+}
+
+// E.g. encode the list ["red","1.0"], for sort -f a -nr x, as the bytes of "red", a NUL, and the
+// complemented bytes of 1.0.
+static void encode_sort_key(sort_key_t* psort_key, slls_t* pkey_field_values, int* sort_params, context_t* pctx) {
 	int i = 0;
 	for (sllse_t* pe = pkey_field_values->phead; pe != NULL; pe = pe->pnext, i++) {
+		int descending = sort_params[i] & SORT_DESCENDING;
 		if (sort_params[i] & SORT_NUMERIC) {
+			double d;
 			if (*pe->value == 0) { // null input value
-				typed_sort_keys[i].u.d = nan("");
-			} else if (!mlr_try_float_from_string(pe->value, &typed_sort_keys[i].u.d)) {
+				d = nan("");
+			} else if (!mlr_try_float_from_string(pe->value, &d)) {
 				fprintf(stderr, "%s: couldn't parse \"%s\" as number in file \"%s\" record %lld.\n",
 					MLR_GLOBALS.bargv0, pe->value, pctx->filename, pctx->fnr);
 				exit(1);
 			}
+			sort_key_append_double(psort_key, d, descending);
 		} else {
-			typed_sort_keys[i].u.s = pe->value;
+			sort_key_append_string(psort_key, pe->value, descending);
 		}
 	}
-	return typed_sort_keys;
+}
+
+// ================================================================
+// FUSED SORT-THEN-HEAD
+//
+// Sort outputs records in order of sort key, then bucket (i.e. first arrival
+// of the sort-field values as-is), then arrival; then records missing sort
+// keys in arrival order. Head passes the first n of those, per group if it
+// has -g. The fused mapper gets the same output, in the same order, while
+// retaining at most n of each per group rather than the whole stream: each
+// group keeps a max-heap of its n least records, where a record replaces the
+// heap top if less than it, and keeps its first n records missing sort keys.
+// At end of stream, a group's records missing sort keys fill in after its
+// sorted ones, up to n in all.
+//
+// With all sort fields lexical, the values as-is are the sort key, so the
+// bucket needn't be part of it. With numeric ones, e.g. "1" and "1.0", the
+// bucket's first arrival is found from a map of the spellings of the values
+// retained. A spelling none of whose records is retained may be forgotten:
+// one of its records was passed over for n lesser ones, as will be any later
+// record of it, whatever its first arrival. Equal numbers spelled differently
+// in different head groups would need every spelling kept, so that case, and
+// sort --max-memory, whose runs group spellings only within each run, aren't
+// fused.
+
+// For the CLI parser: returns NULL if the mapper is not a sort (group-by uses the same code), or is one
+// not fused as above, else a fused sort-then-head mapper. The caller frees the original sort and head mappers.
+mapper_t* mapper_sort_fuse_head(mapper_t* psort_mapper, unsigned long long head_count,
+	slls_t* pgroup_by_field_names)
+{
+	if (psort_mapper->pprocess_func != mapper_sort_process)
+		return NULL;
+	mapper_sort_state_t* psort_state = psort_mapper->pvstate;
+	if (!psort_state->do_sort || psort_state->max_memory > 0LL)
+		return NULL;
+	int num_params = psort_state->pkey_field_names->length;
+	int any_numeric = FALSE;
+	for (int i = 0; i < num_params; i++)
+		if (psort_state->sort_params[i] & SORT_NUMERIC)
+			any_numeric = TRUE;
+	if (any_numeric && pgroup_by_field_names->length > 0)
+		return NULL;
+
+	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
+	mapper_sort_head_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_sort_head_state_t));
+
+	pstate->pkey_field_names      = slls_copy(psort_state->pkey_field_names);
+	pstate->sort_params           = mlr_malloc_or_die(num_params * sizeof(int));
+	memcpy(pstate->sort_params, psort_state->sort_params, num_params * sizeof(int));
+	pstate->head_count            = head_count;
+	pstate->pgroup_by_field_names = slls_copy(pgroup_by_field_names);
+	pstate->pgroups               = lhmslv_alloc();
+	pstate->pspellings            = any_numeric ? lhmslv_alloc() : NULL;
+	pstate->max_spellings         = TOP_SPELLINGS_MIN_MAX;
+	pstate->sequence              = 0LL;
+	pstate->pscratch_key          = sort_key_alloc();
+
+	pmapper->pvstate       = pstate;
+	pmapper->pprocess_func = mapper_sort_head_process;
+	pmapper->pfree_func    = mapper_sort_head_free;
+
+	return pmapper;
+}
+
+static void top_group_free(top_group_t* pgroup) {
+	for (unsigned long long i = 0; i < pgroup->num_entries; i++) {
+		sort_key_free(pgroup->heap[i].psort_key);
+		lrec_free(pgroup->heap[i].prec);
+	}
+	for (unsigned long long i = 0; i < pgroup->num_missing; i++) {
+		sort_key_free(pgroup->missing[i].psort_key);
+		lrec_free(pgroup->missing[i].prec);
+	}
+	free(pgroup->heap);
+	free(pgroup->missing);
+	free(pgroup);
+}
+
+static void mapper_sort_head_free(mapper_t* pmapper) {
+	mapper_sort_head_state_t* pstate = pmapper->pvstate;
+	slls_free(pstate->pkey_field_names);
+	free(pstate->sort_params);
+	slls_free(pstate->pgroup_by_field_names);
+	// lhmslv_free will free the hashmap keys; we need to free the void-star hashmap values.
+	for (lhmslve_t* pe = pstate->pgroups->phead; pe != NULL; pe = pe->pnext)
+		top_group_free(pe->pvvalue);
+	lhmslv_free(pstate->pgroups);
+	if (pstate->pspellings != NULL) {
+		for (lhmslve_t* pe = pstate->pspellings->phead; pe != NULL; pe = pe->pnext)
+			free(pe->pvvalue);
+		lhmslv_free(pstate->pspellings);
+	}
+	sort_key_free(pstate->pscratch_key);
+	free(pstate);
+	free(pmapper);
+}
+
+// ----------------------------------------------------------------
+static void top_entries_append(top_entry_t** pentries, unsigned long long* pnum_entries,
+	unsigned long long* palloc_entries, sort_key_t* psort_key, lrec_t* prec, top_spelling_t* pspelling)
+{
+	if (*pnum_entries >= *palloc_entries) {
+		*palloc_entries = (*palloc_entries == 0LL) ? 16LL : 2 * *palloc_entries;
+		*pentries = mlr_realloc_or_die(*pentries, *palloc_entries * sizeof(top_entry_t));
+	}
+	top_entry_t* pentry = &(*pentries)[(*pnum_entries)++];
+	pentry->psort_key = sort_key_alloc();
+	sort_key_copy(pentry->psort_key, psort_key);
+	pentry->prec = prec;
+	pentry->pspelling = pspelling;
+}
+
+// Returns the spelling for the sort-field values, with the given arrival if new. When the map is full, first
+// drops those with no records retained.
+static top_spelling_t* top_spelling_get(mapper_sort_head_state_t* pstate, slls_t* pkey_field_values,
+	unsigned long long sequence)
+{
+	top_spelling_t* pspelling = lhmslv_get(pstate->pspellings, pkey_field_values);
+	if (pspelling != NULL)
+		return pspelling;
+
+	if (pstate->pspellings->num_occupied >= pstate->max_spellings) {
+		lhmslv_t* pretained = lhmslv_alloc();
+		for (lhmslve_t* pe = pstate->pspellings->phead; pe != NULL; pe = pe->pnext) {
+			top_spelling_t* pother = pe->pvvalue;
+			if (pother->num_retained > 0LL)
+				lhmslv_put(pretained, slls_copy(pe->key), pother, FREE_ENTRY_KEY);
+			else
+				free(pother);
+		}
+		lhmslv_free(pstate->pspellings);
+		pstate->pspellings = pretained;
+		pstate->max_spellings = 2 * pretained->num_occupied + TOP_SPELLINGS_MIN_MAX;
+	}
+
+	pspelling = mlr_malloc_or_die(sizeof(top_spelling_t));
+	pspelling->first_sequence = sequence;
+	pspelling->num_retained = 0LL;
+	lhmslv_put(pstate->pspellings, slls_copy(pkey_field_values), pspelling, FREE_ENTRY_KEY);
+	return pspelling;
+}
+
+static void top_heap_sift_up(top_entry_t* heap, unsigned long long i) {
+	while (i > 0) {
+		unsigned long long parent = (i - 1) / 2;
+		if (sort_key_compare(heap[parent].psort_key, heap[i].psort_key) >= 0)
+			break;
+		top_entry_t temp = heap[parent];
+		heap[parent] = heap[i];
+		heap[i] = temp;
+		i = parent;
+	}
+}
+
+static void top_heap_sift_down(top_entry_t* heap, unsigned long long n) {
+	unsigned long long i = 0;
+	while (TRUE) {
+		unsigned long long l = 2*i + 1;
+		unsigned long long r = l + 1;
+		unsigned long long m = i;
+		if (l < n && sort_key_compare(heap[l].psort_key, heap[m].psort_key) > 0)
+			m = l;
+		if (r < n && sort_key_compare(heap[r].psort_key, heap[m].psort_key) > 0)
+			m = r;
+		if (m == i)
+			break;
+		top_entry_t temp = heap[m];
+		heap[m] = heap[i];
+		heap[i] = temp;
+		i = m;
+	}
+}
+
+// ----------------------------------------------------------------
+static sllv_t* mapper_sort_head_emit(mapper_sort_head_state_t* pstate);
+
+static sllv_t* mapper_sort_head_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_sort_head_state_t* pstate = pvstate;
+	if (pinrec == NULL)
+		return mapper_sort_head_emit(pstate);
+
+	unsigned long long sequence = pstate->sequence++;
+	// Sort parses the values of every record having the sort keys, whether or not head passes it on.
+	sort_key_t* psort_key = pstate->pscratch_key;
+	sort_key_clear(psort_key);
+	slls_t* pkey_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pkey_field_names);
+	if (pkey_field_values != NULL)
+		encode_sort_key(psort_key, pkey_field_values, pstate->sort_params, pctx);
+
+	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec,
+		pstate->pgroup_by_field_names);
+	if (pgroup_by_field_values == NULL || pstate->head_count == 0LL) {
+		slls_free(pkey_field_values);
+		slls_free(pgroup_by_field_values);
+		lrec_free(pinrec);
+		return NULL;
+	}
+	top_group_t* pgroup = lhmslv_get(pstate->pgroups, pgroup_by_field_values);
+	if (pgroup == NULL) {
+		pgroup = mlr_malloc_or_die(sizeof(top_group_t));
+		memset(pgroup, 0, sizeof(top_group_t));
+		lhmslv_put(pstate->pgroups, slls_copy(pgroup_by_field_values), pgroup, FREE_ENTRY_KEY);
+	}
+	slls_free(pgroup_by_field_values);
+
+	if (pkey_field_values == NULL) {
+		if (pgroup->num_missing < pstate->head_count) {
+			sort_key_append_ull(psort_key, sequence);
+			top_entries_append(&pgroup->missing, &pgroup->num_missing, &pgroup->alloc_missing, psort_key, pinrec,
+				NULL);
+		} else {
+			lrec_free(pinrec);
+		}
+		return NULL;
+	}
+	top_spelling_t* pspelling = NULL;
+	if (pstate->pspellings != NULL) {
+		pspelling = top_spelling_get(pstate, pkey_field_values, sequence);
+		sort_key_append_ull(psort_key, pspelling->first_sequence);
+	}
+	sort_key_append_ull(psort_key, sequence);
+	slls_free(pkey_field_values);
+
+	if (pgroup->num_entries < pstate->head_count) {
+		top_entries_append(&pgroup->heap, &pgroup->num_entries, &pgroup->alloc_entries, psort_key, pinrec,
+			pspelling);
+		top_heap_sift_up(pgroup->heap, pgroup->num_entries - 1);
+		if (pspelling != NULL)
+			pspelling->num_retained++;
+	} else if (sort_key_compare(psort_key, pgroup->heap[0].psort_key) < 0) {
+		lrec_free(pgroup->heap[0].prec);
+		if (pgroup->heap[0].pspelling != NULL)
+			pgroup->heap[0].pspelling->num_retained--;
+		sort_key_copy(pgroup->heap[0].psort_key, psort_key);
+		pgroup->heap[0].prec = pinrec;
+		pgroup->heap[0].pspelling = pspelling;
+		if (pspelling != NULL)
+			pspelling->num_retained++;
+		top_heap_sift_down(pgroup->heap, pgroup->num_entries);
+	} else {
+		lrec_free(pinrec);
+	}
+	return NULL;
+}
+
+// Sorted records from all groups, then records missing sort keys, each in the order the sort would have
+// output them.
+static sllv_t* mapper_sort_head_emit(mapper_sort_head_state_t* pstate) {
+	unsigned long long num_sorted = 0LL, num_missing = 0LL;
+	for (lhmslve_t* pe = pstate->pgroups->phead; pe != NULL; pe = pe->pnext) {
+		top_group_t* pgroup = pe->pvvalue;
+		num_sorted += pgroup->num_entries;
+		num_missing += pgroup->num_missing;
+	}
+	sort_item_t* sorted_items  = mlr_malloc_or_die((num_sorted + 1) * sizeof(sort_item_t));
+	sort_item_t* missing_items = mlr_malloc_or_die((num_missing + 1) * sizeof(sort_item_t));
+
+	int ns = 0, nm = 0;
+	for (lhmslve_t* pe = pstate->pgroups->phead; pe != NULL; pe = pe->pnext) {
+		top_group_t* pgroup = pe->pvvalue;
+		for (unsigned long long i = 0; i < pgroup->num_entries; i++, ns++) {
+			sorted_items[ns].pkey    = pgroup->heap[i].psort_key;
+			sorted_items[ns].pvvalue = pgroup->heap[i].prec;
+		}
+		unsigned long long num_allowed = pstate->head_count - pgroup->num_entries;
+		for (unsigned long long i = 0; i < pgroup->num_missing; i++) {
+			if (i < num_allowed) {
+				missing_items[nm].pkey    = pgroup->missing[i].psort_key;
+				missing_items[nm].pvvalue = pgroup->missing[i].prec;
+				nm++;
+			} else {
+				sort_key_free(pgroup->missing[i].psort_key);
+				lrec_free(pgroup->missing[i].prec);
+			}
+		}
+		pgroup->num_entries = 0LL;
+		pgroup->num_missing = 0LL;
+	}
+	sort_items(sorted_items, ns);
+	sort_items(missing_items, nm);
+
+	sllv_t* poutrecs = sllv_alloc();
+	for (int i = 0; i < ns; i++) {
+		sllv_append(poutrecs, sorted_items[i].pvvalue);
+		sort_key_free(sorted_items[i].pkey);
+	}
+	for (int i = 0; i < nm; i++) {
+		sllv_append(poutrecs, missing_items[i].pvvalue);
+		sort_key_free(missing_items[i].pkey);
+	}
+	free(sorted_items);
+	free(missing_items);
+	sllv_append(poutrecs, NULL); // Signal end of output-record stream.
+	return poutrecs;
 }
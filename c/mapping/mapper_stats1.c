@@ -27,13 +27,17 @@ typedef struct _mapper_stats1_state_t {
 	int             do_iterative_stats;
 	int             allow_int_float;
 	int             do_interpolated_percentiles;
+	int             do_approx_percentiles;
+	int             do_scale;
+	double          sample_rate;            // from the context, for do_scale
 } mapper_stats1_state_t;
 
 static void      mapper_stats1_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_names, string_array_t* pvalue_field_names,
-	slls_t* pgroup_by_field_names, int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles);
+	slls_t* pgroup_by_field_names, int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles,
+	int do_approx_percentiles, int do_scale);
 static void      mapper_stats1_free(mapper_t* pmapper);
 static sllv_t*   mapper_stats1_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static void      mapper_stats1_ingest(lrec_t* pinrec, mapper_stats1_state_t* pstate);
@@ -60,7 +64,8 @@ static void mapper_stats1_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Computes univariate statistics for one or more given fields, accumulated across\n");
 	fprintf(o, "the input record stream.\n");
 	fprintf(o, "Options:\n");
-	fprintf(o, "-a {sum,count,...}  Names of accumulators: p10 p25.2 p50 p98 p100 etc. and/or\n");
+	fprintf(o, "-a {sum,count,...}  Names of accumulators: p10 p25.2 p50 p98 p100 etc., approximate\n");
+	fprintf(o, "                    percentiles p10~ p99~ etc., and/or\n");
 	fprintf(o, "                    one or more of:\n");
 	for (int i = 0; i < stats1_acc_lookup_table_length; i++) {
 		fprintf(o, "  %-9s %s\n", stats1_acc_lookup_table[i].name, stats1_acc_lookup_table[i].desc);
@@ -68,10 +73,13 @@ static void mapper_stats1_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "-f {a,b,c}  Value-field names on which to compute statistics\n");
 	fprintf(o, "-g {d,e,f}  Optional group-by-field names\n");
 	fprintf(o, "-i          Use interpolated percentiles, like R's type=7; default like type=1.\n");
+	fprintf(o, "--approx    Compute all percentiles approximately, as if named p10~ etc.\n");
 	fprintf(o, "-s          Print iterative stats. Useful in tail -f contexts (in which\n");
 	fprintf(o, "            case please avoid pprint-format output since end of input\n");
 	fprintf(o, "            stream will never be seen).\n");
 	fprintf(o, "-F          Computes integerable things (e.g. count) in floating point.\n");
+	fprintf(o, "--scale     Divide count and sum by the fraction of input read, with the main\n");
+	fprintf(o, "            option --sample-fraction, estimating them for all the input.\n");
 	fprintf(o, "Example: %s %s -a min,p10,p50,p90,max -f value -g size,shape\n", argv0, verb);
 	fprintf(o, "Example: %s %s -a count,mode -f size\n", argv0, verb);
 	fprintf(o, "Example: %s %s -a count,mode -f size -g shape\n", argv0, verb);
@@ -82,6 +90,11 @@ static void mapper_stats1_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "* count and mode allow text input; the rest require numeric input.\n");
 	fprintf(o, "  In particular, 1 and 1.0 are distinct text for count and mode.\n");
 	fprintf(o, "* When there are mode ties, the first-encountered datum wins.\n");
+	fprintf(o, "* Exact percentiles keep all values in memory. Approximate percentiles use a\n");
+	fprintf(o, "  t-digest of at most about 10KB per group and value field. They are exact at\n");
+	fprintf(o, "  p0 and p100; elsewhere their rank error is typically under 0.1%% of the\n");
+	fprintf(o, "  count, and smaller toward the tails, e.g. p1 or p99.\n");
+	fprintf(o, "  They are always interpolated, and are floating-point.\n");
 }
 
 static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
@@ -93,6 +106,8 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	int             do_iterative_stats          = FALSE;
 	int             allow_int_float             = TRUE;
 	int             do_interpolated_percentiles = FALSE;
+	int             do_approx_percentiles       = FALSE;
+	int             do_scale                    = FALSE;
 
 	char* verb = argv[(*pargi)++];
 
@@ -103,6 +118,8 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_true_flag(pstate,         "-s", &do_iterative_stats);
 	ap_define_false_flag(pstate,        "-F", &allow_int_float);
 	ap_define_true_flag(pstate,         "-i", &do_interpolated_percentiles);
+	ap_define_true_flag(pstate,         "--approx", &do_approx_percentiles);
+	ap_define_true_flag(pstate,         "--scale", &do_scale);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_stats1_usage(stderr, argv[0], verb);
@@ -115,12 +132,13 @@ static mapper_t* mapper_stats1_parse_cli(int* pargi, int argc, char** argv,
 	}
 
 	return mapper_stats1_alloc(pstate, paccumulator_names, pvalue_field_names, pgroup_by_field_names,
-		do_iterative_stats, allow_int_float, do_interpolated_percentiles);
+		do_iterative_stats, allow_int_float, do_interpolated_percentiles, do_approx_percentiles, do_scale);
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_names, string_array_t* pvalue_field_names,
-	slls_t* pgroup_by_field_names, int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles)
+	slls_t* pgroup_by_field_names, int do_iterative_stats, int allow_int_float, int do_interpolated_percentiles,
+	int do_approx_percentiles, int do_scale)
 {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
@@ -135,6 +153,9 @@ static mapper_t* mapper_stats1_alloc(ap_state_t* pargp, slls_t* paccumulator_nam
 	pstate->do_iterative_stats          = do_iterative_stats;
 	pstate->allow_int_float             = allow_int_float;
 	pstate->do_interpolated_percentiles = do_interpolated_percentiles;
+	pstate->do_approx_percentiles       = do_approx_percentiles;
+	pstate->do_scale                    = do_scale;
+	pstate->sample_rate                 = 1.0;
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_stats1_process;
@@ -224,6 +245,7 @@ static void mapper_stats1_free(mapper_t* pmapper) {
 // In the non-iterative case, produce output only at the end of the input stream.
 static sllv_t* mapper_stats1_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_stats1_state_t* pstate = pvstate;
+	pstate->sample_rate = pctx->sample_rate;
 	if (pinrec != NULL) {
 		mapper_stats1_ingest(pinrec, pstate);
 		if (pstate->do_iterative_stats) {
@@ -286,7 +308,8 @@ static void mapper_stats1_ingest(lrec_t* pinrec, mapper_stats1_state_t* pstate)
 		char* presence = lhmsv_get(acc_field_to_acc_state_in, fake_acc_name_for_setups);
 		if (presence == NULL) {
 			make_stats1_accs(value_field_name, pstate->paccumulator_names, pstate->allow_int_float,
-				pstate->do_interpolated_percentiles, acc_field_to_acc_state_in, acc_field_to_acc_state_out);
+				pstate->do_interpolated_percentiles, pstate->do_approx_percentiles,
+				acc_field_to_acc_state_in, acc_field_to_acc_state_out);
 			lhmsv_put(acc_field_to_acc_state_in, fake_acc_name_for_setups, fake_acc_name_for_setups, NO_FREE);
 		}
 
@@ -371,6 +394,22 @@ static sllv_t* mapper_stats1_emit_all(mapper_stats1_state_t* pstate) {
 	return poutrecs;
 }
 
+// ----------------------------------------------------------------
+// Records read with --sample-fraction each stand for 1/rate input records, so that's the expected ratio of
+// full-input count or sum to sampled.
+static void mapper_stats1_scale(mapper_stats1_state_t* pstate, lrec_t* poutrec, char* value_field_name,
+	char* stats1_acc_name)
+{
+	char* output_field_name = mlr_paste_3_strings(value_field_name, "_", stats1_acc_name);
+	char* sval = lrec_get(poutrec, output_field_name);
+	if (sval != NULL) {
+		mv_t scaled = mv_from_float(mlr_double_from_string_or_die(sval) / pstate->sample_rate);
+		lrec_put(poutrec, output_field_name, mv_alloc_format_val(&scaled), FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+	} else {
+		free(output_field_name);
+	}
+}
+
 // ----------------------------------------------------------------
 static lrec_t* mapper_stats1_emit(mapper_stats1_state_t* pstate, lrec_t* poutrec,
 	char* value_field_name, lhmsv_t* acc_field_to_acc_state_out)
@@ -383,6 +422,11 @@ static lrec_t* mapper_stats1_emit(mapper_stats1_state_t* pstate, lrec_t* poutrec
 		stats1_acc_t* pstats1_acc = lhmsv_get(acc_field_to_acc_state_out, stats1_acc_name);
 		MLR_INTERNAL_CODING_ERROR_IF(pstats1_acc == NULL);
 		pstats1_acc->pemit_func(pstats1_acc->pvstate, value_field_name, stats1_acc_name, FALSE, poutrec);
+		if (pstate->do_scale && pstate->sample_rate != 1.0
+			&& (streq(stats1_acc_name, "count") || streq(stats1_acc_name, "sum")))
+		{
+			mapper_stats1_scale(pstate, poutrec, value_field_name, stats1_acc_name);
+		}
 	}
 	return poutrec;
 }
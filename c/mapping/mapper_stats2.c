@@ -12,6 +12,7 @@
 #include "containers/lhmslv.h"
 #include "containers/lhms2v.h"
 #include "containers/lhmsv.h"
+#include "containers/lrec_store.h"
 #include "containers/mixutil.h"
 #include "containers/dvector.h"
 #include "mapping/mappers.h"
@@ -45,7 +46,7 @@ typedef struct _mapper_stats2_state_t {
 	string_array_t* pvalue_field_name_pairs;
 	slls_t*   pgroup_by_field_names;
 	lhmslv_t* acc_groups;
-	lhmslv_t* record_groups;
+	lrec_store_t* precords; // With --fit, records by group until end of stream
 	int       do_verbose;
 	int       do_iterative_stats;
 	int       do_hold_and_fit;
@@ -59,14 +60,16 @@ static mapper_t* mapper_stats2_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_stats2_alloc(ap_state_t* pargp, slls_t* paccumulator_names,
 	string_array_t* pvalue_field_name_pairs, slls_t* pgroup_by_field_names,
-	int do_verbose, int do_iterative_stats, int do_hold_and_fit);
+	int do_verbose, int do_iterative_stats, int do_hold_and_fit, long long max_memory);
 static void      mapper_stats2_free(mapper_t* pmapper);
 static sllv_t*   mapper_stats2_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static void      mapper_stats2_ingest(lrec_t* pinrec, context_t* pctx, mapper_stats2_state_t* pstate);
 static sllv_t*   mapper_stats2_emit_all(mapper_stats2_state_t* pstate);
 static void      mapper_stats2_emit(mapper_stats2_state_t* pstate, lrec_t* pinrec,
 	char* value_field_name_1, char* value_field_name_2, lhmsv_t* pacc_fields_to_acc_state);
-static sllv_t*   mapper_stats2_fit_all(mapper_stats2_state_t* pstate);
+static sllv_t*   mapper_stats2_fit_all(mapper_stats2_state_t* pstate, context_t* pctx);
+static void      mapper_stats2_fit(lhms2v_t* pgroup_to_acc_field, lrec_t* prec);
+static sllv_t*   mapper_stats2_process_fitting(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
 static stats2_acc_t* make_stats2            (char* value_field_name_1, char* value_field_name_2, char* stats2_acc_name, int do_verbose);
 static stats2_acc_t* stats2_linreg_pca_alloc(char* value_field_name_1, char* value_field_name_2, char* stats2_acc_name, int do_verbose);
@@ -121,8 +124,16 @@ static void mapper_stats2_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "               stream will never be seen).\n");
 	fprintf(o, "--fit          Rather than printing regression parameters, applies them to\n");
 	fprintf(o, "               the input data to compute new fit fields. All input records are\n");
-	fprintf(o, "               held in memory until end of input stream. Has effect only for\n");
-	fprintf(o, "               linreg-ols, linreg-pca, and logireg.\n");
+	fprintf(o, "               held in memory until end of input stream, unless this is the\n");
+	fprintf(o, "               first verb, without -g, and the inputs are files: then they\n");
+	fprintf(o, "               are read twice instead. Has effect only for linreg-ols,\n");
+	fprintf(o, "               linreg-pca, and logireg.\n");
+	fprintf(o, "--max-memory {size}  With --fit: keep at most about this much record data in\n");
+	fprintf(o, "               memory, e.g. 500000000, 500m, or 2g. Beyond that, held records\n");
+	fprintf(o, "               are spilled to temp files in $TMPDIR (default /tmp). Default:\n");
+	fprintf(o, "               no limit. Once records are spilled, they are output in batches,\n");
+	fprintf(o, "               so prints in end blocks of a put or filter after this verb come\n");
+	fprintf(o, "               after the first batches rather than before them.\n");
 	fprintf(o, "Only one of -s or --fit may be used.\n");
 	fprintf(o, "Example: %s %s -a linreg-pca -f x,y\n", argv0, verb);
 	fprintf(o, "Example: %s %s -a linreg-ols,r2 -f x,y -g size,shape\n", argv0, verb);
@@ -139,6 +150,7 @@ static mapper_t* mapper_stats2_parse_cli(int* pargi, int argc, char** argv,
 	int             do_iterative_stats    = FALSE;
 	int             do_hold_and_fit       = FALSE;
 	int             allow_int_float       = TRUE;
+	char*           max_memory_string     = NULL;
 
 	char* verb = argv[(*pargi)++];
 
@@ -149,6 +161,7 @@ static mapper_t* mapper_stats2_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_true_flag(pstate,         "-v",    &do_verbose);
 	ap_define_true_flag(pstate,         "-s",    &do_iterative_stats);
 	ap_define_true_flag(pstate,         "--fit", &do_hold_and_fit);
+	ap_define_string_flag(pstate,       "--max-memory", &max_memory_string);
 	// The -F isn't used for stats2: all arithmetic here is floating-point. Yet
 	// it is supported for step and stats1 for all applicable stats1/step
 	// accumulators, so we accept here as well for all applicable stats2
@@ -173,13 +186,14 @@ static mapper_t* mapper_stats2_parse_cli(int* pargi, int argc, char** argv,
 	}
 
 	return mapper_stats2_alloc(pstate, paccumulator_names, pvalue_field_names, pgroup_by_field_names,
-		do_verbose, do_iterative_stats, do_hold_and_fit);
+		do_verbose, do_iterative_stats, do_hold_and_fit,
+		max_memory_string == NULL ? 0LL : mlr_memory_size_from_string_or_die(verb, max_memory_string));
 }
 
 // ----------------------------------------------------------------
 static mapper_t* mapper_stats2_alloc(ap_state_t* pargp, slls_t* paccumulator_names,
 	string_array_t* pvalue_field_name_pairs, slls_t* pgroup_by_field_names,
-	int do_verbose, int do_iterative_stats, int do_hold_and_fit)
+	int do_verbose, int do_iterative_stats, int do_hold_and_fit, long long max_memory)
 {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
@@ -189,7 +203,7 @@ static mapper_t* mapper_stats2_alloc(ap_state_t* pargp, slls_t* paccumulator_nam
 	pstate->pvalue_field_name_pairs  = pvalue_field_name_pairs; // caller validates length is even
 	pstate->pgroup_by_field_names    = pgroup_by_field_names;
 	pstate->acc_groups               = lhmslv_alloc();
-	pstate->record_groups            = lhmslv_alloc();
+	pstate->precords                 = lrec_store_alloc(max_memory);
 	pstate->do_verbose               = do_verbose;
 	pstate->do_iterative_stats       = do_iterative_stats;
 	pstate->do_hold_and_fit          = do_hold_and_fit;
@@ -221,11 +235,7 @@ static void mapper_stats2_free(mapper_t* pmapper) {
 		lhms2v_free(pgroup_to_acc_field);
 	}
 	lhmslv_free(pstate->acc_groups);
-	for (lhmslve_t* pd = pstate->record_groups->phead; pd != NULL; pd = pd->pnext) {
-		sllv_t* plist = pd->pvvalue;
-		sllv_free(plist);
-	}
-	lhmslv_free(pstate->record_groups);
+	lrec_store_free(pstate->precords);
 	ap_free(pstate->pargp);
 	free(pstate);
 	free(pmapper);
@@ -283,7 +293,7 @@ static sllv_t* mapper_stats2_process(lrec_t* pinrec, context_t* pctx, void* pvst
 		if (!pstate->do_hold_and_fit) {
 			return mapper_stats2_emit_all(pstate);
 		} else {
-			return mapper_stats2_fit_all(pstate);
+			return mapper_stats2_fit_all(pstate, pctx);
 		}
 	} else {
 		return NULL;
@@ -304,15 +314,6 @@ static void mapper_stats2_ingest(lrec_t* pinrec, context_t* pctx, mapper_stats2_
 		lhmslv_put(pstate->acc_groups, slls_copy(pgroup_by_field_values), pgroup_to_acc_field, FREE_ENTRY_KEY);
 	}
 
-	if (pstate->do_hold_and_fit) { // Retain the input record in memory, for fitting and delivery at end of stream
-		sllv_t* group_to_records = lhmslv_get(pstate->record_groups, pgroup_by_field_values);
-		if (group_to_records == NULL) {
-			group_to_records = sllv_alloc();
-			lhmslv_put(pstate->record_groups, slls_copy(pgroup_by_field_values), group_to_records, FREE_ENTRY_KEY);
-		}
-		sllv_append(group_to_records, pinrec);
-	}
-
 	// for [["x","y"]]
 	int n = pstate->pvalue_field_name_pairs->length;
 	for (int i = 0; i < n; i += 2) {
@@ -363,6 +364,10 @@ static void mapper_stats2_ingest(lrec_t* pinrec, context_t* pctx, mapper_stats2_
 		}
 	}
 
+	if (pstate->do_hold_and_fit) { // Retain the input record, for fitting and delivery at end of stream
+		lrec_store_append(pstate->precords, lrec_store_get_group(pstate->precords, pgroup_by_field_values),
+			pinrec);
+	}
 	slls_free(pgroup_by_field_values);
 }
 
@@ -417,44 +422,75 @@ static void mapper_stats2_emit(mapper_stats2_state_t* pstate, lrec_t* poutrec,
 }
 
 // ----------------------------------------------------------------
-static sllv_t* mapper_stats2_fit_all(mapper_stats2_state_t* pstate) {
-	sllv_t* poutrecs = sllv_alloc();
+static sllv_t* mapper_stats2_fit_all(mapper_stats2_state_t* pstate, context_t* pctx) {
+	sllv_t* poutrecs = lrec_store_next_batch(pstate->precords, FALSE, pctx);
+	for (sllve_t* pe = poutrecs->phead; pe != NULL && pe->pvvalue != NULL; pe = pe->pnext) {
+		lrec_t* prec = pe->pvvalue;
+		slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(prec,
+			pstate->pgroup_by_field_names);
+		mapper_stats2_fit(lhmslv_get(pstate->acc_groups, pgroup_by_field_values), prec);
+		slls_free(pgroup_by_field_values);
+	}
+	return poutrecs;
+}
 
-	for (lhmslve_t* pa = pstate->acc_groups->phead; pa != NULL; pa = pa->pnext) {
-		slls_t* pgroup_by_field_values = pa->key;
-		sllv_t* precords = lhmslv_get(pstate->record_groups, pgroup_by_field_values);
-
-		while (precords->phead) {
-			lrec_t* prec = sllv_pop(precords);
-
-			lhms2v_t* pgroup_to_acc_field = pa->pvvalue;
-
-			// For "x","y"
-			for (lhms2ve_t* pd = pgroup_to_acc_field->phead; pd != NULL; pd = pd->pnext) {
-				char*    value_field_name_1 = pd->key1;
-				char*    value_field_name_2 = pd->key2;
-				lhmsv_t* pacc_fields_to_acc_state = pd->pvvalue;
-
-				// For "linreg-ols", "logireg"
-				for (lhmsve_t* pe = pacc_fields_to_acc_state->phead; pe != NULL; pe = pe->pnext) {
-					stats2_acc_t* pstats2_acc = pe->pvvalue;
-					if (pstats2_acc->pfit_func != NULL) {
-						char* sx = lrec_get(prec, value_field_name_1);
-						char* sy = lrec_get(prec, value_field_name_2);
-						if (sx != NULL && sy != NULL) {
-							double x = mlr_double_from_string_or_die(sx);
-							double y = mlr_double_from_string_or_die(sy);
-							pstats2_acc->pfit_func(pstats2_acc->pvstate, x, y, prec);
-						}
-					}
+static void mapper_stats2_fit(lhms2v_t* pgroup_to_acc_field, lrec_t* prec) {
+	// For "x","y"
+	for (lhms2ve_t* pd = pgroup_to_acc_field->phead; pd != NULL; pd = pd->pnext) {
+		char*    value_field_name_1 = pd->key1;
+		char*    value_field_name_2 = pd->key2;
+		lhmsv_t* pacc_fields_to_acc_state = pd->pvvalue;
+
+		// For "linreg-ols", "logireg"
+		for (lhmsve_t* pe = pacc_fields_to_acc_state->phead; pe != NULL; pe = pe->pnext) {
+			stats2_acc_t* pstats2_acc = pe->pvvalue;
+			if (pstats2_acc->pfit_func != NULL) {
+				char* sx = lrec_get(prec, value_field_name_1);
+				char* sy = lrec_get(prec, value_field_name_2);
+				if (sx != NULL && sy != NULL) {
+					double x = mlr_double_from_string_or_die(sx);
+					double y = mlr_double_from_string_or_die(sy);
+					pstats2_acc->pfit_func(pstats2_acc->pvstate, x, y, prec);
 				}
 			}
-
-			sllv_append(poutrecs, prec);
 		}
 	}
-	sllv_append(poutrecs, NULL);
-	return poutrecs;
+}
+
+// ----------------------------------------------------------------
+// For the stream driver's two-pass reading: with --fit but without -g, the first pass only accumulates, and
+// the second fits each record as it goes by, in input order as when they're held. With -g the held records
+// are output group by group, which a second pass can't do.
+int mapper_stats2_start_first_pass(mapper_t* pmapper) {
+	if (pmapper->pprocess_func != mapper_stats2_process)
+		return FALSE;
+	mapper_stats2_state_t* pstate = pmapper->pvstate;
+	if (!pstate->do_hold_and_fit || pstate->pgroup_by_field_names->length != 0)
+		return FALSE;
+	pstate->do_hold_and_fit = FALSE;
+	return TRUE;
+}
+
+void mapper_stats2_start_second_pass(mapper_t* pmapper) {
+	pmapper->pprocess_func = mapper_stats2_process_fitting;
+}
+
+static sllv_t* mapper_stats2_process_fitting(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_stats2_state_t* pstate = pvstate;
+	if (pinrec == NULL)
+		return sllv_single(NULL);
+
+	slls_t* pgroup_by_field_values = mlr_reference_selected_values_from_record(pinrec, pstate->pgroup_by_field_names);
+	lhms2v_t* pgroup_to_acc_field = (pgroup_by_field_values == NULL)
+		? NULL
+		: lhmslv_get(pstate->acc_groups, pgroup_by_field_values);
+	slls_free(pgroup_by_field_values);
+	if (pgroup_to_acc_field == NULL) {
+		lrec_free(pinrec);
+		return NULL;
+	}
+	mapper_stats2_fit(pgroup_to_acc_field, pinrec);
+	return sllv_single(pinrec);
 }
 
 // ================================================================
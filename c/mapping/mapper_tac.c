@@ -1,16 +1,17 @@
 #include <stdio.h>
 #include "lib/mlrutil.h"
 #include "containers/sllv.h"
+#include "containers/lrec_store.h"
 #include "mapping/mappers.h"
 
 typedef struct _mapper_tac_state_t {
-	sllv_t* records;
+	lrec_store_t* pstore;
 } mapper_tac_state_t;
 
 static void      mapper_tac_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_tac_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
-static mapper_t* mapper_tac_alloc();
+static mapper_t* mapper_tac_alloc(long long max_memory);
 static void      mapper_tac_free(mapper_t* pmapper);
 static sllv_t*   mapper_tac_process(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
@@ -24,8 +25,19 @@ mapper_setup_t mapper_tac_setup = {
 
 // ----------------------------------------------------------------
 static void mapper_tac_usage(FILE* o, char* argv0, char* verb) {
-	fprintf(o, "Usage: %s %s\n", argv0, verb);
+	fprintf(o, "Usage: %s %s [options]\n", argv0, verb);
 	fprintf(o, "Prints records in reverse order from the order in which they were encountered.\n");
+	fprintf(o, "As the first verb on a single memory-mapped DKVP, NIDX, or CSV-lite file with\n");
+	fprintf(o, "a single header, reads the file backward rather than retaining the records,\n");
+	fprintf(o, "which then stream through the verbs after it unless a put or filter among them\n");
+	fprintf(o, "has end blocks.\n");
+	fprintf(o, "Options:\n");
+	fprintf(o, "--max-memory {size}  Keep at most about this much record data in memory, e.g.\n");
+	fprintf(o, "                     500000000, 500m, or 2g. Beyond that, records are spilled to\n");
+	fprintf(o, "                     temp files in $TMPDIR (default /tmp). Default: no limit.\n");
+	fprintf(o, "                     Once records are spilled, they are output in batches, so\n");
+	fprintf(o, "                     prints in end blocks of a put or filter after this verb\n");
+	fprintf(o, "                     come after the first batches rather than before them.\n");
 }
 
 static mapper_t* mapper_tac_parse_cli(int* pargi, int argc, char** argv,
@@ -35,17 +47,28 @@ static mapper_t* mapper_tac_parse_cli(int* pargi, int argc, char** argv,
 		mapper_tac_usage(stderr, argv[0], argv[*pargi]);
 		return NULL;
 	}
-	mapper_t* pmapper = mapper_tac_alloc();
+	char* verb = argv[*pargi];
 	*pargi += 1;
-	return pmapper;
+	long long max_memory = 0LL;
+
+	while ((argc - *pargi) >= 1 && argv[*pargi][0] == '-') {
+		if (streq(argv[*pargi], "--max-memory") && (argc - *pargi) >= 2) {
+			max_memory = mlr_memory_size_from_string_or_die(verb, argv[*pargi+1]);
+			*pargi += 2;
+		} else {
+			mapper_tac_usage(stderr, argv[0], verb);
+			return NULL;
+		}
+	}
+	return mapper_tac_alloc(max_memory);
 }
 
 // ----------------------------------------------------------------
-static mapper_t* mapper_tac_alloc() {
+static mapper_t* mapper_tac_alloc(long long max_memory) {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
 	mapper_tac_state_t* pstate = mlr_malloc_or_die(sizeof(mapper_tac_state_t));
-	pstate->records = sllv_alloc();
+	pstate->pstore = lrec_store_alloc(max_memory);
 
 	pmapper->pvstate       = pstate;
 	pmapper->pprocess_func = mapper_tac_process;
@@ -54,10 +77,14 @@ static mapper_t* mapper_tac_alloc() {
 	return pmapper;
 }
 
+// For the stream driver: records read last to first needn't pass through here.
+int mapper_is_tac(mapper_t* pmapper) {
+	return pmapper->pfree_func == mapper_tac_free;
+}
+
 static void mapper_tac_free(mapper_t* pmapper) {
 	mapper_tac_state_t* pstate = pmapper->pvstate;
-	// Free the container
-	sllv_free(pstate->records);
+	lrec_store_free(pstate->pstore);
 	free(pstate);
 	free(pmapper);
 }
@@ -66,15 +93,11 @@ static void mapper_tac_free(mapper_t* pmapper) {
 static sllv_t* mapper_tac_process(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_tac_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
-		// The caller will free the outrecs
-		sllv_append(pstate->records, pinrec);
+		lrec_store_append(pstate->pstore, lrec_store_get_group(pstate->pstore, NULL), pinrec);
 		return NULL;
 	}
 	else {
-		sllv_reverse(pstate->records);
-		sllv_append(pstate->records, NULL);
-		sllv_t* retval = pstate->records;
-		pstate->records = sllv_alloc();
-		return retval;
+		// The caller will free the outrecs
+		return lrec_store_next_batch(pstate->pstore, TRUE, pctx);
 	}
 }
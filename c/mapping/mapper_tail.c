@@ -39,6 +39,8 @@ static void mapper_tail_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "-n {count}    Tail count to print; default 10\n");
 	fprintf(o, "-g {a,b,c}    Optional group-by-field names for tail counts\n");
 	fprintf(o, "Passes through the last n records, optionally by category.\n");
+	fprintf(o, "Without -g, as the first verb on a single memory-mapped DKVP or NIDX file,\n");
+	fprintf(o, "reads only the last n records (i.e. is fast).\n");
 }
 
 static mapper_t* mapper_tail_parse_cli(int* pargi, int argc, char** argv,
@@ -79,6 +81,16 @@ static mapper_t* mapper_tail_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_na
 	return pmapper;
 }
 
+// For the stream driver: without -g, only the last records of the input need to be read.
+int mapper_tail_get_params(mapper_t* pmapper, unsigned long long* ptail_count, slls_t** ppgroup_by_field_names) {
+	if (pmapper->pfree_func != mapper_tail_free)
+		return FALSE;
+	mapper_tail_state_t* pstate = pmapper->pvstate;
+	*ptail_count            = pstate->tail_count;
+	*ppgroup_by_field_names = pstate->pgroup_by_field_names;
+	return TRUE;
+}
+
 static void mapper_tail_free(mapper_t* pmapper) {
 	mapper_tail_state_t* pstate = pmapper->pvstate;
 	if (pstate->pgroup_by_field_names != NULL)
@@ -226,6 +226,9 @@ static sllv_t* mapper_top_emit(mapper_top_state_t* pstate, context_t* pctx) {
 	sllv_t* poutrecs = sllv_alloc();
 
 	for (lhmslve_t* pa = pstate->groups->phead; pa != NULL; pa = pa->pnext) {
+		lhmsv_t* pgroup = pa->pvvalue;
+		for (lhmsve_t* pb = pgroup->phead; pb != NULL; pb = pb->pnext)
+			top_keeper_sort(pb->pvvalue);
 
 		// Above we required that there was only one value field in the
 		// show-full-records case. That's for two reasons: (1) here, we print
@@ -3,10 +3,13 @@
 #include <string.h>
 #include <math.h>
 #include "lib/mlrutil.h"
+#include "lib/mlr_globals.h"
 #include "containers/sllv.h"
 #include "containers/lhmslv.h"
 #include "containers/lhmsv.h"
 #include "containers/mixutil.h"
+#include "containers/bloom_filter.h"
+#include "containers/hyperloglog.h"
 #include "mapping/mappers.h"
 #include "cli/argparse.h"
 
@@ -16,6 +19,7 @@ typedef struct _mapper_uniq_state_t {
 	int show_counts;
 	int show_num_distinct_only;
 	lhmslv_t* pcounts_by_group;
+	hll_t* phll; // For -n --approx, else NULL
 } mapper_uniq_state_t;
 
 static void      mapper_uniq_usage(FILE* o, char* argv0, char* verb);
@@ -25,10 +29,13 @@ static void      mapper_count_distinct_usage(FILE* o, char* argv0, char* verb);
 static mapper_t* mapper_count_distinct_parse_cli(int* pargi, int argc, char** argv,
 	cli_reader_opts_t* _, cli_writer_opts_t* __);
 static mapper_t* mapper_uniq_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
-	int show_counts, int show_num_distinct_only);
+	int show_counts, int show_num_distinct_only, int approx_precision);
 static void      mapper_uniq_free(mapper_t* pmapper);
+static void      mapper_uniq_check_approx_or_die(char* verb, int do_approx, int show_num_distinct_only,
+	int precision);
 
 static sllv_t* mapper_uniq_process_num_distinct_only(lrec_t* pinrec, context_t* pctx, void* pvstate);
+static sllv_t* mapper_uniq_process_num_distinct_approx(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t* mapper_uniq_process_with_counts(lrec_t* pinrec, context_t* pctx, void* pvstate);
 static sllv_t* mapper_uniq_process_no_counts(lrec_t* pinrec, context_t* pctx, void* pvstate);
 
@@ -52,6 +59,12 @@ static void mapper_count_distinct_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "Usage: %s %s [options]\n", argv0, verb);
 	fprintf(o, "-f {a,b,c}    Field names for distinct count.\n");
 	fprintf(o, "-n            Show only the number of distinct values.\n");
+	fprintf(o, "--approx      With -n, estimate the number of distinct values using a\n");
+	fprintf(o, "              HyperLogLog sketch, in fixed memory rather than keeping them all.\n");
+	fprintf(o, "--precision {p} Sketch precision for --approx, from %d to %d; default %d.\n",
+		HLL_MIN_PRECISION, HLL_MAX_PRECISION, HLL_DEFAULT_PRECISION);
+	fprintf(o, "              Uses 2^p bytes, with relative standard error about 1.04/sqrt(2^p),\n");
+	fprintf(o, "              e.g. 0.8%% by default.\n");
 	fprintf(o, "Prints number of records having distinct values for specified field names.\n");
 	fprintf(o, "Same as uniq -c.\n");
 }
@@ -62,12 +75,16 @@ static mapper_t* mapper_count_distinct_parse_cli(int* pargi, int argc, char** ar
 {
 	slls_t* pfield_names = NULL;
 	int     show_num_distinct_only = FALSE;
+	int     do_approx = FALSE;
+	int     precision = HLL_DEFAULT_PRECISION;
 
 	char* verb = argv[(*pargi)++];
 
 	ap_state_t* pstate = ap_alloc();
 	ap_define_string_list_flag(pstate, "-f", &pfield_names);
 	ap_define_true_flag(pstate,        "-n", &show_num_distinct_only);
+	ap_define_true_flag(pstate,        "--approx", &do_approx);
+	ap_define_int_flag(pstate,         "--precision", &precision);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_count_distinct_usage(stderr, argv[0], verb);
@@ -78,8 +95,9 @@ static mapper_t* mapper_count_distinct_parse_cli(int* pargi, int argc, char** ar
 		mapper_count_distinct_usage(stderr, argv[0], verb);
 		return NULL;
 	}
+	mapper_uniq_check_approx_or_die(verb, do_approx, show_num_distinct_only, precision);
 
-	return mapper_uniq_alloc(pstate, pfield_names, TRUE, show_num_distinct_only);
+	return mapper_uniq_alloc(pstate, pfield_names, TRUE, show_num_distinct_only, do_approx ? precision : 0);
 }
 
 // ----------------------------------------------------------------
@@ -88,6 +106,12 @@ static void mapper_uniq_usage(FILE* o, char* argv0, char* verb) {
 	fprintf(o, "-g {d,e,f}    Group-by-field names for uniq counts.\n");
 	fprintf(o, "-c            Show repeat counts in addition to unique values.\n");
 	fprintf(o, "-n            Show only the number of distinct values.\n");
+	fprintf(o, "--approx      With -n, estimate the number of distinct values using a\n");
+	fprintf(o, "              HyperLogLog sketch, in fixed memory rather than keeping them all.\n");
+	fprintf(o, "--precision {p} Sketch precision for --approx, from %d to %d; default %d.\n",
+		HLL_MIN_PRECISION, HLL_MAX_PRECISION, HLL_DEFAULT_PRECISION);
+	fprintf(o, "              Uses 2^p bytes, with relative standard error about 1.04/sqrt(2^p),\n");
+	fprintf(o, "              e.g. 0.8%% by default.\n");
 	fprintf(o, "Prints distinct values for specified field names. With -c, same as\n");
 	fprintf(o, "count-distinct. For uniq, -f is a synonym for -g.\n");
 }
@@ -98,6 +122,8 @@ static mapper_t* mapper_uniq_parse_cli(int* pargi, int argc, char** argv,
 	slls_t* pgroup_by_field_names = NULL;
 	int     show_counts = FALSE;
 	int     show_num_distinct_only = FALSE;
+	int     do_approx = FALSE;
+	int     precision = HLL_DEFAULT_PRECISION;
 
 	char* verb = argv[(*pargi)++];
 
@@ -106,6 +132,8 @@ static mapper_t* mapper_uniq_parse_cli(int* pargi, int argc, char** argv,
 	ap_define_string_list_flag(pstate, "-g", &pgroup_by_field_names);
 	ap_define_true_flag(pstate,        "-c", &show_counts);
 	ap_define_true_flag(pstate,        "-n", &show_num_distinct_only);
+	ap_define_true_flag(pstate,        "--approx", &do_approx);
+	ap_define_int_flag(pstate,         "--precision", &precision);
 
 	if (!ap_parse(pstate, verb, pargi, argc, argv)) {
 		mapper_uniq_usage(stderr, argv[0], verb);
@@ -116,13 +144,33 @@ static mapper_t* mapper_uniq_parse_cli(int* pargi, int argc, char** argv,
 		mapper_uniq_usage(stderr, argv[0], verb);
 		return NULL;
 	}
+	mapper_uniq_check_approx_or_die(verb, do_approx, show_num_distinct_only, precision);
 
-	return mapper_uniq_alloc(pstate, pgroup_by_field_names, show_counts, show_num_distinct_only);
+	return mapper_uniq_alloc(pstate, pgroup_by_field_names, show_counts, show_num_distinct_only,
+		do_approx ? precision : 0);
+}
+
+// --approx only estimates the count, so it requires -n.
+static void mapper_uniq_check_approx_or_die(char* verb, int do_approx, int show_num_distinct_only,
+	int precision)
+{
+	if (!do_approx)
+		return;
+	if (!show_num_distinct_only) {
+		fprintf(stderr, "%s %s: --approx requires -n.\n", MLR_GLOBALS.bargv0, verb);
+		exit(1);
+	}
+	if (precision < HLL_MIN_PRECISION || precision > HLL_MAX_PRECISION) {
+		fprintf(stderr, "%s %s: --precision must be from %d to %d; got %d.\n",
+			MLR_GLOBALS.bargv0, verb, HLL_MIN_PRECISION, HLL_MAX_PRECISION, precision);
+		exit(1);
+	}
 }
 
 // ----------------------------------------------------------------
+// An approx_precision of 0 means exact counting.
 static mapper_t* mapper_uniq_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_names,
-	int show_counts, int show_num_distinct_only)
+	int show_counts, int show_num_distinct_only, int approx_precision)
 {
 	mapper_t* pmapper = mlr_malloc_or_die(sizeof(mapper_t));
 
@@ -133,9 +181,12 @@ static mapper_t* mapper_uniq_alloc(ap_state_t* pargp, slls_t* pgroup_by_field_na
 	pstate->show_counts            = show_counts;
 	pstate->show_num_distinct_only = show_num_distinct_only;
 	pstate->pcounts_by_group       = lhmslv_alloc();
+	pstate->phll                   = (approx_precision > 0) ? hll_alloc(approx_precision) : NULL;
 
 	pmapper->pvstate = pstate;
-	if (show_num_distinct_only)
+	if (pstate->phll != NULL)
+		pmapper->pprocess_func = mapper_uniq_process_num_distinct_approx;
+	else if (show_num_distinct_only)
 		pmapper->pprocess_func = mapper_uniq_process_num_distinct_only;
 	else if (show_counts)
 		pmapper->pprocess_func = mapper_uniq_process_with_counts;
@@ -155,6 +206,7 @@ static void mapper_uniq_free(mapper_t* pmapper) {
 		free(pcount);
 	}
 	lhmslv_free(pstate->pcounts_by_group);
+	hll_free(pstate->phll);
 	pstate->pgroup_by_field_names = NULL;
 	pstate->pcounts_by_group = NULL;
 	ap_free(pstate->pargp);
@@ -194,6 +246,39 @@ static sllv_t* mapper_uniq_process_num_distinct_only(lrec_t* pinrec, context_t*
 	}
 }
 
+// The sketch takes a hash of each record's values, straight from the record; nothing is kept per distinct
+// value. Input from several files is one stream, so one sketch counts across them all.
+static sllv_t* mapper_uniq_process_num_distinct_approx(lrec_t* pinrec, context_t* pctx, void* pvstate) {
+	mapper_uniq_state_t* pstate = pvstate;
+	if (pinrec != NULL) {
+		unsigned long long hash = BLOOM_HASH_SEED;
+		int have_all = TRUE;
+		for (sllse_t* pe = pstate->pgroup_by_field_names->phead; pe != NULL; pe = pe->pnext) {
+			char* value = lrec_get(pinrec, pe->value);
+			if (value == NULL) {
+				have_all = FALSE;
+				break;
+			}
+			hash = bloom_hash_append(hash, value);
+		}
+		if (have_all)
+			hll_add(pstate->phll, hash);
+		lrec_free(pinrec);
+		return NULL;
+	}
+	else {
+		sllv_t* poutrecs = sllv_alloc();
+
+		lrec_t* poutrec = lrec_unbacked_alloc();
+		unsigned long long count = (unsigned long long)(hll_estimate(pstate->phll) + 0.5);
+		lrec_put(poutrec, "count", mlr_alloc_string_from_ull(count), FREE_ENTRY_VALUE);
+		sllv_append(poutrecs, poutrec);
+
+		sllv_append(poutrecs, NULL);
+		return poutrecs;
+	}
+}
+
 static sllv_t* mapper_uniq_process_with_counts(lrec_t* pinrec, context_t* pctx, void* pvstate) {
 	mapper_uniq_state_t* pstate = pvstate;
 	if (pinrec != NULL) {
@@ -46,4 +46,26 @@ extern mapper_setup_t mapper_tee_setup;
 extern mapper_setup_t mapper_top_setup;
 extern mapper_setup_t mapper_uniq_setup;
 
+// For mapper-chain optimization by the CLI parser.
+int       mapper_head_get_params(mapper_t* pmapper, unsigned long long* phead_count, slls_t** ppgroup_by_field_names);
+mapper_t* mapper_sort_fuse_head(mapper_t* psort_mapper, unsigned long long head_count,
+	slls_t* pgroup_by_field_names);
+// For the stream driver's reading only the last records of an input, reading it last to first, or skipping
+// records a sampler will discard.
+int       mapper_tail_get_params(mapper_t* pmapper, unsigned long long* ptail_count, slls_t** ppgroup_by_field_names);
+int       mapper_is_tac(mapper_t* pmapper);
+int       mapper_put_or_filter_has_end_blocks(mapper_t* pmapper);
+int       mapper_sample_is_unkeyed(mapper_t* pmapper);
+unsigned long long mapper_sample_get_skippable(mapper_t* pmapper);
+void      mapper_sample_note_skipped(mapper_t* pmapper, unsigned long long num_skipped);
+
+// For the stream driver's two-pass reading of inputs which can be read again, e.g. regular files: a first verb
+// which would otherwise hold its input until end of stream instead only aggregates over a first pass, emitting
+// nothing, then sees the input again as usual. The first-pass calls return FALSE, changing nothing, if the
+// mapper can't do this.
+int       mapper_histogram_start_first_pass(mapper_t* pmapper);
+void      mapper_histogram_start_second_pass(mapper_t* pmapper);
+int       mapper_stats2_start_first_pass(mapper_t* pmapper);
+void      mapper_stats2_start_second_pass(mapper_t* pmapper);
+
 #endif // MAPPERS_H
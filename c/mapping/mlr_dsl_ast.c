@@ -21,6 +21,7 @@ mlr_dsl_ast_node_t* mlr_dsl_ast_node_alloc(char* text, mlr_dsl_ast_node_type_t t
 	pnode->vardef_subframe_relative_index = MD_UNUSED_INDEX;
 	pnode->vardef_subframe_index          = MD_UNUSED_INDEX;
 	pnode->vardef_frame_relative_index    = MD_UNUSED_INDEX;
+	pnode->vardef_type_mask               = TYPE_MASK_ANY;
 	pnode->subframe_var_count             = MD_UNUSED_INDEX;
 	pnode->max_subframe_depth             = MD_UNUSED_INDEX;
 	pnode->max_var_depth                  = MD_UNUSED_INDEX;
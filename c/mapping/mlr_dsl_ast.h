@@ -110,6 +110,7 @@ typedef struct _mlr_dsl_ast_node_t {
 	int vardef_subframe_relative_index; // pass 1 output: which index in subframe
 	int vardef_subframe_index;          // pass 1 output: which subframe the variable is defined in
 	int vardef_frame_relative_index;    // pass 2 output: index relative to full stack frame
+	int vardef_type_mask;               // pass 1 output: declared type of the variable, for static typing
 
 	// For bind-stack allocation only in statement-block nodes: unused for any other node types.
 	int subframe_var_count;
@@ -107,11 +107,14 @@
 // ================================================================
 // Pass-1 stack-frame container: simply a hashmap from name to position on the
 // frame relative to the curly-braced statement block (top-level, for-loop,
-// if-statement, else-statement, etc.).
+// if-statement, else-statement, etc.). Declared types are tracked alongside so
+// that local-variable reads can be annotated with them, for the benefit of
+// type-specialized evaluators.
 
 typedef struct _stkalc_subframe_t {
 	int var_count;
 	lhmsi_t* pnames_to_indices;
+	lhmsi_t* pnames_to_type_masks;
 } stkalc_subframe_t;
 
 // ----------------------------------------------------------------
@@ -125,7 +128,11 @@ static int  stkalc_subframe_test_and_get(stkalc_subframe_t* pframe, char* name,
 
 static int  stkalc_subframe_get(stkalc_subframe_t* pframe, char* name);
 
-static int  stkalc_subframe_add(stkalc_subframe_t* pframe, char* name);
+static int  stkalc_subframe_add(stkalc_subframe_t* pframe, char* name, int type_mask);
+
+static int  stkalc_subframe_get_type_mask(stkalc_subframe_t* pframe, char* name);
+
+static int  definition_node_type_to_type_mask(mlr_dsl_ast_node_t* pnode);
 
 // ================================================================
 // Pass-1 frame-group container: a linked list with current frame at the head
@@ -157,7 +164,7 @@ static stkalc_subframe_t* stkalc_subframe_group_pop(stkalc_subframe_group_t* pfr
 // is).
 
 static void stkalc_subframe_group_mutate_node_for_define(stkalc_subframe_group_t* pframe_group,
-	mlr_dsl_ast_node_t* pnode, char* desc, int trace);
+	mlr_dsl_ast_node_t* pnode, int type_mask, char* desc, int trace);
 
 static void stkalc_subframe_group_mutate_node_for_write(stkalc_subframe_group_t* pframe_group,
 	mlr_dsl_ast_node_t* pnode, char* desc, int trace);
@@ -277,7 +284,8 @@ static void pass_1_for_func_subr_block(mlr_dsl_ast_node_t* pnode, int trace) {
 	mlr_dsl_ast_node_t* plist_node = pnode->pchildren->phead->pnext->pvvalue;
 	for (sllve_t* pe = pdef_name_node->pchildren->phead; pe != NULL; pe = pe->pnext) {
 		mlr_dsl_ast_node_t* pparameter_node = pe->pvvalue;
-		stkalc_subframe_group_mutate_node_for_define(pframe_group, pparameter_node, "PARAMETER", trace);
+		stkalc_subframe_group_mutate_node_for_define(pframe_group, pparameter_node,
+			definition_node_type_to_type_mask(pparameter_node), "PARAMETER", trace);
 	}
 	pass_1_for_statement_block(plist_node, pframe_group, &max_subframe_depth, trace);
 	pnode->subframe_var_count = pframe->var_count;
@@ -439,7 +447,8 @@ static void pass_1_for_local_definition(mlr_dsl_ast_node_t* pnode, stkalc_subfra
 		pass_1_for_node(pvaluenode, pframe_group, pmax_subframe_depth, trace);
 	}
 	// Do the LHS after the RHS, in case 'var nonesuch = nonesuch'
-	stkalc_subframe_group_mutate_node_for_define(pframe_group, pnamenode, "DEFINE", trace);
+	stkalc_subframe_group_mutate_node_for_define(pframe_group, pnamenode,
+		definition_node_type_to_type_mask(pnode), "DEFINE", trace);
 }
 
 // ----------------------------------------------------------------
@@ -479,8 +488,10 @@ static void pass_1_for_srec_for_loop(mlr_dsl_ast_node_t* pnode, stkalc_subframe_
 
 	mlr_dsl_ast_node_t* pknode = pvarsnode->pchildren->phead->pvvalue;
 	mlr_dsl_ast_node_t* pvnode = pvarsnode->pchildren->phead->pnext->pvvalue;
-	stkalc_subframe_group_mutate_node_for_define(pframe_group, pknode, "FOR-BIND", trace);
-	stkalc_subframe_group_mutate_node_for_define(pframe_group, pvnode, "FOR-BIND", trace);
+	stkalc_subframe_group_mutate_node_for_define(pframe_group, pknode,
+		definition_node_type_to_type_mask(pknode), "FOR-BIND", trace);
+	stkalc_subframe_group_mutate_node_for_define(pframe_group, pvnode,
+		definition_node_type_to_type_mask(pvnode), "FOR-BIND", trace);
 
 	pass_1_for_statement_block(pblocknode, pframe_group, pmax_subframe_depth, trace);
 	pnode->subframe_var_count = pnext_subframe->var_count;
@@ -528,7 +539,8 @@ static void pass_1_for_map_key_only_for_loop(mlr_dsl_ast_node_t* pnode, stkalc_s
 	if (*pmax_subframe_depth < pframe_group->plist->length)
 		*pmax_subframe_depth = pframe_group->plist->length;
 
-	stkalc_subframe_group_mutate_node_for_define(pframe_group, pkeynode, "FOR-BIND", trace);
+	stkalc_subframe_group_mutate_node_for_define(pframe_group, pkeynode,
+		definition_node_type_to_type_mask(pkeynode), "FOR-BIND", trace);
 	pass_1_for_statement_block(pblocknode, pframe_group, pmax_subframe_depth, trace);
 	pnode->subframe_var_count = pnext_subframe->var_count;
 
@@ -580,9 +592,11 @@ static void pass_1_for_map_for_loop(mlr_dsl_ast_node_t* pnode, stkalc_subframe_g
 
 	for (sllve_t* pe = pkeysnode->pchildren->phead; pe != NULL; pe = pe->pnext) {
 		mlr_dsl_ast_node_t* pkeynode = pe->pvvalue;
-		stkalc_subframe_group_mutate_node_for_define(pframe_group, pkeynode, "FOR-BIND", trace);
+		stkalc_subframe_group_mutate_node_for_define(pframe_group, pkeynode,
+		definition_node_type_to_type_mask(pkeynode), "FOR-BIND", trace);
 	}
-	stkalc_subframe_group_mutate_node_for_define(pframe_group, pvalnode, "FOR-BIND", trace);
+	stkalc_subframe_group_mutate_node_for_define(pframe_group, pvalnode,
+		definition_node_type_to_type_mask(pvalnode), "FOR-BIND", trace);
 	pass_1_for_statement_block(pblocknode, pframe_group, pmax_subframe_depth, trace);
 	pnode->subframe_var_count = pnext_subframe->var_count;
 
@@ -665,6 +679,7 @@ static stkalc_subframe_t* stkalc_subframe_alloc() {
 	stkalc_subframe_t* pframe = mlr_malloc_or_die(sizeof(stkalc_subframe_t));
 	pframe->var_count = 0;
 	pframe->pnames_to_indices = lhmsi_alloc();
+	pframe->pnames_to_type_masks = lhmsi_alloc();
 	return pframe;
 }
 
@@ -672,6 +687,7 @@ static void stkalc_subframe_free(stkalc_subframe_t* pframe) {
 	if (pframe == NULL)
 		return;
 	lhmsi_free(pframe->pnames_to_indices);
+	lhmsi_free(pframe->pnames_to_type_masks);
 	free(pframe);
 }
 
@@ -683,19 +699,46 @@ static int stkalc_subframe_get(stkalc_subframe_t* pframe, char* name) {
 	return lhmsi_get(pframe->pnames_to_indices, name);
 }
 
-static int stkalc_subframe_add(stkalc_subframe_t* pframe, char* name) {
+static int stkalc_subframe_add(stkalc_subframe_t* pframe, char* name, int type_mask) {
 	int rv = pframe->var_count;
 	lhmsi_put(pframe->pnames_to_indices, name, pframe->var_count, NO_FREE);
+	lhmsi_put(pframe->pnames_to_type_masks, name, type_mask, NO_FREE);
 	pframe->var_count++;
 	return rv;
 }
 
+static int stkalc_subframe_get_type_mask(stkalc_subframe_t* pframe, char* name) {
+	return lhmsi_get(pframe->pnames_to_type_masks, name);
+}
+
+// Declared type of a local-variable or parameter definition. For-loop bindings
+// and other untyped definitions are left as TYPE_MASK_ANY.
+static int definition_node_type_to_type_mask(mlr_dsl_ast_node_t* pnode) {
+	switch (pnode->type) {
+	case MD_AST_NODE_TYPE_MAP_LOCAL_DEFINITION:
+		return TYPE_MASK_MAP;
+	case MD_AST_NODE_TYPE_NUMERIC_LOCAL_DEFINITION:
+	case MD_AST_NODE_TYPE_INT_LOCAL_DEFINITION:
+	case MD_AST_NODE_TYPE_FLOAT_LOCAL_DEFINITION:
+	case MD_AST_NODE_TYPE_BOOLEAN_LOCAL_DEFINITION:
+	case MD_AST_NODE_TYPE_STRING_LOCAL_DEFINITION:
+	case MD_AST_NODE_TYPE_NUMERIC_PARAMETER_DEFINITION:
+	case MD_AST_NODE_TYPE_INT_PARAMETER_DEFINITION:
+	case MD_AST_NODE_TYPE_FLOAT_PARAMETER_DEFINITION:
+	case MD_AST_NODE_TYPE_BOOLEAN_PARAMETER_DEFINITION:
+	case MD_AST_NODE_TYPE_STRING_PARAMETER_DEFINITION:
+		return mlr_dsl_ast_node_type_to_type_mask(pnode->type);
+	default:
+		return TYPE_MASK_ANY;
+	}
+}
+
 // ================================================================
 static stkalc_subframe_group_t* stkalc_subframe_group_alloc(stkalc_subframe_t* pframe, int trace) {
 	stkalc_subframe_group_t* pframe_group = mlr_malloc_or_die(sizeof(stkalc_subframe_group_t));
 	pframe_group->plist = sllv_alloc();
 	sllv_push(pframe_group->plist, pframe);
-	stkalc_subframe_add(pframe, "");
+	stkalc_subframe_add(pframe, "", TYPE_MASK_ABSENT);
 	if (trace) {
 		leader_print(pframe_group->plist->length);
 		printf("ADD FOR ABSENT s @ %du%d\n", 0, 0);
@@ -723,7 +766,7 @@ static stkalc_subframe_t* stkalc_subframe_group_pop(stkalc_subframe_group_t* pfr
 
 // 'var x = 1' always applies to the current subframe.
 static void stkalc_subframe_group_mutate_node_for_define(stkalc_subframe_group_t* pframe_group,
-	mlr_dsl_ast_node_t* pnode, char* desc, int trace)
+	mlr_dsl_ast_node_t* pnode, int type_mask, char* desc, int trace)
 {
 	stkalc_subframe_t* pframe = pframe_group->plist->phead->pvvalue;
 	pnode->vardef_subframe_index = pframe_group->plist->length - 1;
@@ -732,8 +775,9 @@ static void stkalc_subframe_group_mutate_node_for_define(stkalc_subframe_group_t
 			MLR_GLOBALS.bargv0, pnode->text);
 		exit(1);
 	} else {
-		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text);
+		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text, type_mask);
 	}
+	pnode->vardef_type_mask = type_mask;
 	if (trace) {
 		leader_print(pframe_group->plist->length);
 		printf("ADD %s %s @ %ds%d\n", desc, pnode->text,
@@ -764,7 +808,7 @@ static void stkalc_subframe_group_mutate_node_for_write(stkalc_subframe_group_t*
 	if (!found) {
 		pnode->vardef_subframe_index = pframe_group->plist->length - 1;
 		stkalc_subframe_t* pframe = pframe_group->plist->phead->pvvalue;
-		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text);
+		pnode->vardef_subframe_relative_index = stkalc_subframe_add(pframe, pnode->text, TYPE_MASK_ANY);
 		op = "ADD";
 	}
 
@@ -792,6 +836,7 @@ static void stkalc_subframe_group_mutate_node_for_read(stkalc_subframe_group_t*
 	for (sllve_t* pe = pframe_group->plist->phead; pe != NULL; pe = pe->pnext, pnode->vardef_subframe_index--) {
 		stkalc_subframe_t* pframe = pe->pvvalue;
 		if (stkalc_subframe_test_and_get(pframe, pnode->text, &pnode->vardef_subframe_relative_index)) {
+			pnode->vardef_type_mask = stkalc_subframe_get_type_mask(pframe, pnode->text);
 			found = TRUE;
 			break;
 		}
@@ -801,6 +846,7 @@ static void stkalc_subframe_group_mutate_node_for_read(stkalc_subframe_group_t*
 	if (!found) {
 		stkalc_subframe_t* plast = pframe_group->plist->ptail->pvvalue;
 		pnode->vardef_subframe_relative_index = stkalc_subframe_get(plast, "");
+		pnode->vardef_type_mask = TYPE_MASK_ABSENT;
 		pnode->vardef_subframe_index = 0;
 		op = "ABSENT";
 	}
@@ -9,16 +9,16 @@
 // * Typed-overlay values are read in favor to the lrec: e.g. if the lrec has "x"=>"abc" and the typed overlay
 //   has "x"=>3.7 then the evaluators will be presented with 3.7 for the value of the field named "x".
 //
-// * The =~ and !=~ operators populate the regex-captures array from \1, \2, etc. in the regex; the from-literal
+// * The =~ and !=~ operators populate the regex-captures from \1, \2, etc. in the regex; the from-literal
 //   evaluator interpolates those into output. Example:
 //
 //   o echo x=abc_def | mlr put '$name =~ "(.*)_(.*)"; $left = "\1"; $right = "\2"'
 //
-//   o The =~ resizes the regex-captures array to length 3 (1-up length 2), then copies "abc" to index 1
-//     and "def" to index 2.
+//   o The =~ sets the regex-captures length to 3 (1-up length 2), with offsets of "abc" at index 1
+//     and "def" at index 2 into its copy of the input string.
 //
 //   o The second expression writes "left"=>"abc" to the typed-overlay map; the third expression writes "right"=>"def"
-//     to the typed-overlay map. The \1 and \2 get "abc" and "def" interpolated from the regex-captures array.
+//     to the typed-overlay map. The \1 and \2 get "abc" and "def" interpolated from the regex-captures.
 //
 //   o It is up to mapper_put to write "left"=>"abc" and "right"=>"def" into the lrec.
 //
@@ -46,7 +46,7 @@ typedef struct _variables_t {
 	lrec_t*          pinrec;
 	lhmsmv_t*        ptyped_overlay;
 	mlhmmv_t*        poosvars;
-	string_array_t** ppregex_captures;
+	regex_captures_t** ppregex_captures;
 	context_t*       pctx;
 	local_stack_t*   plocal_stack;
 	loop_stack_t*    ploop_stack;
@@ -95,6 +95,10 @@ rval_evaluator_t* rval_evaluator_alloc_from_f_ff_func(mv_binary_func_t* pfunc,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 rval_evaluator_t* rval_evaluator_alloc_from_x_xx_func(mv_binary_func_t* pfunc,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
+// Same as the above but with statically inferred argument types (MT_INT, etc.; -1 if unknown), used to
+// look up the disposition-matrix leaf once at alloc time rather than per evaluation.
+rval_evaluator_t* rval_evaluator_alloc_from_x_xx_typed_func(mv_binary_func_t* pfunc, int type1, int type2,
+	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 rval_evaluator_t* rval_evaluator_alloc_from_x_xx_nullable_func(mv_binary_func_t* pfunc,
 	rval_evaluator_t* parg1, rval_evaluator_t* parg2);
 rval_evaluator_t* rval_evaluator_alloc_from_f_fff_func(mv_ternary_func_t* pfunc,
@@ -439,6 +439,116 @@ rval_evaluator_t* rval_evaluator_alloc_from_x_xx_func(mv_binary_func_t* pfunc,
 	return pevaluator;
 }
 
+// ----------------------------------------------------------------
+// Type-specialized binary operators. When both argument types are known ahead
+// of time (from local-variable type declarations, literals, or other typed
+// subexpressions) the disposition-matrix lookup is done once at alloc time, and
+// for float arithmetic the operation is done inline. The types are still
+// checked at runtime since the static types are best guesses: e.g. a
+// declared-int local may be absent, or integer addition may overflow to float.
+// On mismatch the general disposition-matrix function is used.
+
+typedef struct _rval_evaluator_x_xx_typed_state_t {
+	mv_binary_func_t* pleaf_func;
+	mv_binary_func_t* pfunc;
+	int               type1;
+	int               type2;
+	rval_evaluator_t* parg1;
+	rval_evaluator_t* parg2;
+} rval_evaluator_x_xx_typed_state_t;
+
+static mv_t rval_evaluator_x_xx_typed_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_x_xx_typed_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars);
+
+	if (val1.type == pstate->type1 && val2.type == pstate->type2)
+		return pstate->pleaf_func(&val1, &val2);
+	else
+		return pstate->pfunc(&val1, &val2);
+}
+
+static mv_t rval_evaluator_f_ff_plus_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_x_xx_typed_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars);
+
+	if (val1.type == MT_FLOAT && val2.type == MT_FLOAT)
+		return mv_from_float(val1.u.fltv + val2.u.fltv);
+	else
+		return pstate->pfunc(&val1, &val2);
+}
+
+static mv_t rval_evaluator_f_ff_minus_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_x_xx_typed_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars);
+
+	if (val1.type == MT_FLOAT && val2.type == MT_FLOAT)
+		return mv_from_float(val1.u.fltv - val2.u.fltv);
+	else
+		return pstate->pfunc(&val1, &val2);
+}
+
+static mv_t rval_evaluator_f_ff_times_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_x_xx_typed_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars);
+
+	if (val1.type == MT_FLOAT && val2.type == MT_FLOAT)
+		return mv_from_float(val1.u.fltv * val2.u.fltv);
+	else
+		return pstate->pfunc(&val1, &val2);
+}
+
+static mv_t rval_evaluator_f_ff_divide_func(void* pvstate, variables_t* pvars) {
+	rval_evaluator_x_xx_typed_state_t* pstate = pvstate;
+	mv_t val1 = pstate->parg1->pprocess_func(pstate->parg1->pvstate, pvars);
+	mv_t val2 = pstate->parg2->pprocess_func(pstate->parg2->pvstate, pvars);
+
+	if (val1.type == MT_FLOAT && val2.type == MT_FLOAT)
+		return mv_from_float(val1.u.fltv / val2.u.fltv);
+	else
+		return pstate->pfunc(&val1, &val2);
+}
+
+static void rval_evaluator_x_xx_typed_free(rval_evaluator_t* pevaluator) {
+	rval_evaluator_x_xx_typed_state_t* pstate = pevaluator->pvstate;
+	pstate->parg1->pfree_func(pstate->parg1);
+	pstate->parg2->pfree_func(pstate->parg2);
+	free(pstate);
+	free(pevaluator);
+}
+
+rval_evaluator_t* rval_evaluator_alloc_from_x_xx_typed_func(mv_binary_func_t* pfunc, int type1, int type2,
+	rval_evaluator_t* parg1, rval_evaluator_t* parg2)
+{
+	mv_binary_func_t* pleaf_func = mv_get_binary_disposition(pfunc, type1, type2);
+	if (pleaf_func == NULL)
+		return rval_evaluator_alloc_from_x_xx_func(pfunc, parg1, parg2);
+
+	rval_evaluator_x_xx_typed_state_t* pstate = mlr_malloc_or_die(sizeof(rval_evaluator_x_xx_typed_state_t));
+	pstate->pleaf_func = pleaf_func;
+	pstate->pfunc      = pfunc;
+	pstate->type1      = type1;
+	pstate->type2      = type2;
+	pstate->parg1      = parg1;
+	pstate->parg2      = parg2;
+
+	rval_evaluator_t* pevaluator = mlr_malloc_or_die(sizeof(rval_evaluator_t));
+	pevaluator->pvstate = pstate;
+	pevaluator->pprocess_func = rval_evaluator_x_xx_typed_func;
+	if (type1 == MT_FLOAT && type2 == MT_FLOAT) {
+		if      (pfunc == x_xx_plus_func)   pevaluator->pprocess_func = rval_evaluator_f_ff_plus_func;
+		else if (pfunc == x_xx_minus_func)  pevaluator->pprocess_func = rval_evaluator_f_ff_minus_func;
+		else if (pfunc == x_xx_times_func)  pevaluator->pprocess_func = rval_evaluator_f_ff_times_func;
+		else if (pfunc == x_xx_divide_func) pevaluator->pprocess_func = rval_evaluator_f_ff_divide_func;
+	}
+	pevaluator->pfree_func = rval_evaluator_x_xx_typed_free;
+
+	return pevaluator;
+}
+
 // ----------------------------------------------------------------
 // This is for min/max which can return non-null when one argument is null --
 // in comparison to other functions which return null if *any* argument is
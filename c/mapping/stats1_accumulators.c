@@ -10,6 +10,7 @@
 #include "containers/lhmss.h"
 #include "containers/lhmsll.h"
 #include "containers/percentile_keeper.h"
+#include "containers/tdigest.h"
 #include "containers/mlrval.h"
 #include "mapping/stats1_accumulators.h"
 
@@ -19,10 +20,12 @@ void make_stats1_accs(
 	slls_t*  paccumulator_names,          // input
 	int      allow_int_float,             // input
 	int      do_interpolated_percentiles, // input
+	int      do_approx_percentiles,       // input
 	lhmsv_t* acc_field_to_acc_state_in,   // output
 	lhmsv_t* acc_field_to_acc_state_out)  // output
 {
 	stats1_acc_t* ppercentile_acc = NULL;
+	stats1_acc_t* papprox_percentile_acc = NULL;
 	for (sllse_t* pc = paccumulator_names->phead; pc != NULL; pc = pc->pnext) {
 		// for "sum", "count"
 		char* stats1_acc_name = pc->value;
@@ -31,7 +34,19 @@ void make_stats1_accs(
 		// names p0,p25,p50,p75,p100.  The input accumulators are unique: only one
 		// percentile-keeper. There are multiple output accumulators: each references the same
 		// underlying percentile-keeper but with distinct parameters.  Hence the "_in" and "_out" maps.
-		if (is_percentile_acc_name(stats1_acc_name)) {
+		// Likewise approximate percentiles share one t-digest.
+		if (is_percentile_acc_name(stats1_acc_name)
+			&& (do_approx_percentiles || is_approx_percentile_acc_name(stats1_acc_name)))
+		{
+			if (papprox_percentile_acc == NULL) {
+				papprox_percentile_acc = stats1_approx_percentile_alloc(value_field_name, stats1_acc_name,
+					allow_int_float, do_interpolated_percentiles);
+				lhmsv_put(acc_field_to_acc_state_in, stats1_acc_name, papprox_percentile_acc, NO_FREE);
+			} else {
+				stats1_approx_percentile_reuse(papprox_percentile_acc);
+			}
+			lhmsv_put(acc_field_to_acc_state_out, stats1_acc_name, papprox_percentile_acc, NO_FREE);
+		} else if (is_percentile_acc_name(stats1_acc_name)) {
 			if (ppercentile_acc == NULL) {
 				ppercentile_acc = stats1_percentile_alloc(value_field_name, stats1_acc_name, allow_int_float,
 					do_interpolated_percentiles);
@@ -69,12 +84,19 @@ stats1_acc_t* make_stats1_acc(char* value_field_name, char* stats1_acc_name, int
 	return NULL;
 }
 
+// E.g. "p99", or "p99~" for approximate.
 int is_percentile_acc_name(char* stats1_acc_name) {
 	double percentile;
 	// sscanf(stats1_acc_name, "p%lf", &percentile) allows "p74x" et al. which isn't ok.
 	if (stats1_acc_name[0] != 'p')
 		return FALSE;
-	if (!mlr_try_float_from_string(&stats1_acc_name[1], &percentile))
+	char* number = mlr_strdup_or_die(&stats1_acc_name[1]);
+	int length = strlen(number);
+	if (length > 0 && number[length-1] == '~')
+		number[length-1] = 0;
+	int ok = mlr_try_float_from_string(number, &percentile);
+	free(number);
+	if (!ok)
 		return FALSE;
 	if (percentile < 0.0 || percentile > 100.0) {
 		fprintf(stderr, "%s stats1: percentile \"%s\" outside range [0,100].\n",
@@ -84,6 +106,11 @@ int is_percentile_acc_name(char* stats1_acc_name) {
 	return TRUE;
 }
 
+int is_approx_percentile_acc_name(char* stats1_acc_name) {
+	int length = strlen(stats1_acc_name);
+	return length > 0 && stats1_acc_name[length-1] == '~';
+}
+
 // ----------------------------------------------------------------
 typedef struct _stats1_count_state_t {
 	mv_t counter;
@@ -630,3 +657,65 @@ void stats1_percentile_reuse(stats1_acc_t* pstats1_acc) {
 	stats1_percentile_state_t* pstate = pstats1_acc->pvstate;
 	pstate->reference_count++;
 }
+
+// ----------------------------------------------------------------
+// Approximate percentiles: shared like the exact ones, but with a t-digest in bounded memory rather than
+// all the values. Always interpolated.
+typedef struct _stats1_approx_percentile_state_t {
+	tdigest_t* pdigest;
+	lhmss_t* poutput_field_names;
+	int reference_count;
+} stats1_approx_percentile_state_t;
+static void stats1_approx_percentile_dingest(void* pvstate, double val) {
+	stats1_approx_percentile_state_t* pstate = pvstate;
+	tdigest_ingest(pstate->pdigest, val);
+}
+static void stats1_approx_percentile_emit(void* pvstate, char* value_field_name, char* stats1_acc_name, int copy_data, lrec_t* poutrec) {
+	stats1_approx_percentile_state_t* pstate = pvstate;
+
+	mv_t v = mv_absent();
+	if (pstate->pdigest->count > 0.0) {
+		double p;
+		(void)sscanf(stats1_acc_name, "p%lf", &p); // Assuming this was range-checked earlier on to be in [0,100].
+		v = mv_from_float(tdigest_percentile(pstate->pdigest, p));
+	}
+	char* s = mv_alloc_format_val(&v);
+	char* output_field_name = lhmss_get(pstate->poutput_field_names, stats1_acc_name);
+	if (output_field_name == NULL) {
+		output_field_name = mlr_paste_3_strings(value_field_name, "_", stats1_acc_name);
+		lhmss_put(pstate->poutput_field_names, mlr_strdup_or_die(stats1_acc_name),
+			output_field_name, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+	}
+	lrec_put(poutrec, mlr_strdup_or_die(output_field_name), s, FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+}
+static void stats1_approx_percentile_free(stats1_acc_t* pstats1_acc) {
+	stats1_approx_percentile_state_t* pstate = pstats1_acc->pvstate;
+	pstate->reference_count--;
+	if (pstate->reference_count == 0) {
+		tdigest_free(pstate->pdigest);
+		lhmss_free(pstate->poutput_field_names);
+		free(pstate);
+		free(pstats1_acc);
+	}
+}
+stats1_acc_t* stats1_approx_percentile_alloc(char* value_field_name, char* stats1_acc_name, int allow_int_float,
+	int do_interpolated_percentiles)
+{
+	stats1_acc_t* pstats1_acc   = mlr_malloc_or_die(sizeof(stats1_acc_t));
+	stats1_approx_percentile_state_t* pstate = mlr_malloc_or_die(sizeof(stats1_approx_percentile_state_t));
+	pstate->pdigest             = tdigest_alloc(TDIGEST_DEFAULT_COMPRESSION);
+	pstate->poutput_field_names = lhmss_alloc();
+	pstate->reference_count     = 1;
+
+	pstats1_acc->pvstate        = (void*)pstate;
+	pstats1_acc->pdingest_func  = stats1_approx_percentile_dingest;
+	pstats1_acc->pningest_func  = NULL;
+	pstats1_acc->psingest_func  = NULL;
+	pstats1_acc->pemit_func     = stats1_approx_percentile_emit;
+	pstats1_acc->pfree_func     = stats1_approx_percentile_free;
+	return pstats1_acc;
+}
+void stats1_approx_percentile_reuse(stats1_acc_t* pstats1_acc) {
+	stats1_approx_percentile_state_t* pstate = pstats1_acc->pvstate;
+	pstate->reference_count++;
+}
@@ -60,17 +60,22 @@ stats1_acc_t* stats1_min_alloc               (char* value_field_name, char* stat
 stats1_acc_t* stats1_max_alloc               (char* value_field_name, char* stats1_acc_name, int aif, int dip);
 stats1_acc_t* stats1_percentile_alloc        (char* value_field_name, char* stats1_acc_name, int aif, int dip);
 void          stats1_percentile_reuse        (stats1_acc_t* pstats1_acc);
+stats1_acc_t* stats1_approx_percentile_alloc (char* value_field_name, char* stats1_acc_name, int aif, int dip);
+void          stats1_approx_percentile_reuse (stats1_acc_t* pstats1_acc);
 
 
 // For percentiles there is one unique accumulator given (for example) five distinct
 // names p0,p25,p50,p75,p100.  The input accumulators are unique: only one
 // percentile-keeper. There are multiple output accumulators: each references the same
 // underlying percentile-keeper but with distinct parameters.  Hence the "_in" and "_out" maps.
+// Approximate percentiles, named like p99~ or all percentiles with do_approx_percentiles, likewise share
+// one t-digest.
 void make_stats1_accs(
 	char*    value_field_name,
 	slls_t*  paccumulator_names,
 	int      allow_int_float,
 	int      do_interpolated_percentiles,
+	int      do_approx_percentiles,
 	lhmsv_t* acc_field_to_acc_state_in,
 	lhmsv_t* acc_field_to_acc_state_out);
 
@@ -81,6 +86,7 @@ stats1_acc_t* make_stats1_acc(
 	int   do_interpolated_percentiles);
 
 int is_percentile_acc_name(char* stats1_acc_name);
+int is_approx_percentile_acc_name(char* stats1_acc_name);
 
 // ----------------------------------------------------------------
 // Lookups for all but percentiles, which are a special case.
@@ -25,7 +25,7 @@ int main(int argc, char** argv) {
 	slls_t*        filenames    = popts->filenames;
 
 	int ok = do_stream_chained(prepipe, filenames, plrec_reader, pmapper_list, plrec_writer, popts->ofmt,
-		popts->nr_progress_mod);
+		popts->nr_progress_mod, popts->reader_opts.sample_fraction);
 
 	cli_opts_free(popts);
 
@@ -9,6 +9,7 @@ typedef struct _lrec_writer_csvlite_state_t {
 	char* ofs;
 	long long num_header_lines_output;
 	slls_t* plast_header_output;
+	unsigned long long last_schema_id;
 	int headerless_csv_output;
 } lrec_writer_csvlite_state_t;
 
@@ -25,6 +26,7 @@ lrec_writer_t* lrec_writer_csvlite_alloc(char* ors, char* ofs, int headerless_cs
 	pstate->ofs                     = ofs;
 	pstate->num_header_lines_output = 0LL;
 	pstate->plast_header_output     = NULL;
+	pstate->last_schema_id          = LREC_SCHEMA_UNKNOWN;
 	pstate->headerless_csv_output   = headerless_csv_output;
 
 	plrec_writer->pvstate       = (void*)pstate;
@@ -49,7 +51,9 @@ static void lrec_writer_csvlite_process(void* pvstate, FILE* output_stream, lrec
 	char* ors = pstate->ors;
 	char* ofs = pstate->ofs;
 
-	if (pstate->plast_header_output != NULL) {
+	// A record with the same schema ID as its predecessor is known to have the same header.
+	int same_schema = prec->schema_id != LREC_SCHEMA_UNKNOWN && prec->schema_id == pstate->last_schema_id;
+	if (pstate->plast_header_output != NULL && !same_schema) {
 		if (!lrec_keys_equal_list(prec, pstate->plast_header_output)) {
 			slls_free(pstate->plast_header_output);
 			pstate->plast_header_output = NULL;
@@ -72,6 +76,7 @@ static void lrec_writer_csvlite_process(void* pvstate, FILE* output_stream, lrec
 		pstate->plast_header_output = mlr_copy_keys_from_record(prec);
 		pstate->num_header_lines_output++;
 	}
+	pstate->last_schema_id = prec->schema_id;
 
 	int nf = 0;
 	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
@@ -8,6 +8,7 @@ typedef struct _lrec_writer_markdown_state_t {
 	char* ors;
 	long long num_header_lines_output;
 	slls_t* plast_header_output;
+	unsigned long long last_schema_id;
 } lrec_writer_markdown_state_t;
 
 static void lrec_writer_markdown_free(lrec_writer_t* pwriter);
@@ -22,6 +23,7 @@ lrec_writer_t* lrec_writer_markdown_alloc(char* ors) {
 	pstate->ors                     = ors;
 	pstate->num_header_lines_output = 0LL;
 	pstate->plast_header_output     = NULL;
+	pstate->last_schema_id          = LREC_SCHEMA_UNKNOWN;
 
 	plrec_writer->pvstate       = (void*)pstate;
 	plrec_writer->pprocess_func = lrec_writer_markdown_process;
@@ -44,7 +46,9 @@ static void lrec_writer_markdown_process(void* pvstate, FILE* output_stream, lre
 	lrec_writer_markdown_state_t* pstate = pvstate;
 	char* ors = pstate->ors;
 
-	if (pstate->plast_header_output != NULL) {
+	// A record with the same schema ID as its predecessor is known to have the same header.
+	int same_schema = prec->schema_id != LREC_SCHEMA_UNKNOWN && prec->schema_id == pstate->last_schema_id;
+	if (pstate->plast_header_output != NULL && !same_schema) {
 		if (!lrec_keys_equal_list(prec, pstate->plast_header_output)) {
 			slls_free(pstate->plast_header_output);
 			pstate->plast_header_output = NULL;
@@ -71,6 +75,7 @@ static void lrec_writer_markdown_process(void* pvstate, FILE* output_stream, lre
 		pstate->plast_header_output = mlr_copy_keys_from_record(prec);
 		pstate->num_header_lines_output++;
 	}
+	pstate->last_schema_id = prec->schema_id;
 
 	fputc('|', output_stream);
 	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext) {
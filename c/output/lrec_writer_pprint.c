@@ -9,6 +9,7 @@
 typedef struct _lrec_writer_pprint_state_t {
 	sllv_t*    precords;
 	slls_t*    pprev_keys;
+	unsigned long long prev_schema_id;
 	int        right_align;
 	long long  num_blocks_written;
 	char*      ors;
@@ -30,6 +31,7 @@ lrec_writer_t* lrec_writer_pprint_alloc(char* ors, char ofs, int right_align, in
 	lrec_writer_pprint_state_t* pstate = mlr_malloc_or_die(sizeof(lrec_writer_pprint_state_t));
 	pstate->precords           = sllv_alloc();
 	pstate->pprev_keys         = NULL;
+	pstate->prev_schema_id     = LREC_SCHEMA_UNKNOWN;
 	pstate->ors                = ors;
 	pstate->ofs                = ofs;
 	pstate->right_align        = right_align;
@@ -66,7 +68,9 @@ static void lrec_writer_pprint_process(void* pvstate, FILE* output_stream, lrec_
 	if (prec == NULL) {
 		drain = TRUE;
 	} else {
-		if (pstate->pprev_keys != NULL && !lrec_keys_equal_list(prec, pstate->pprev_keys)) {
+		// A record with the same schema ID as its predecessor is known to have the same keys.
+		int same_schema = prec->schema_id != LREC_SCHEMA_UNKNOWN && prec->schema_id == pstate->prev_schema_id;
+		if (pstate->pprev_keys != NULL && !same_schema && !lrec_keys_equal_list(prec, pstate->pprev_keys)) {
 			drain = TRUE;
 		}
 	}
@@ -92,6 +96,7 @@ static void lrec_writer_pprint_process(void* pvstate, FILE* output_stream, lrec_
 		sllv_append(pstate->precords, prec);
 		if (pstate->pprev_keys == NULL)
 			pstate->pprev_keys = mlr_copy_keys_from_record(prec);
+		pstate->prev_schema_id = prec->schema_id;
 	}
 }
 
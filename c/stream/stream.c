@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 
 #include "lib/mlrutil.h"
 #include "lib/mlr_globals.h"
@@ -10,11 +11,45 @@
 #include "mapping/mappers.h"
 #include "output/lrec_writers.h"
 
+// How input may be read, depending on the first verb: all records in order; only the last ones of a single
+// file, for tail; a single file last to first, for tac; or in order but skipping records, for sample.
+typedef enum _read_mode_t {
+	READ_ALL,
+	READ_LAST,
+	READ_REVERSED,
+	READ_SAMPLED,
+} read_mode_t;
+
+// Verbs which, as the first verb, can aggregate over a first pass of the input and emit over a second, rather
+// than holding all the input until end of stream. See mappers.h.
+typedef struct _two_pass_verb_t {
+	int  (*pstart_first_pass_func)(mapper_t* pmapper);
+	void (*pstart_second_pass_func)(mapper_t* pmapper);
+} two_pass_verb_t;
+
+static two_pass_verb_t two_pass_verbs[] = {
+	{ mapper_histogram_start_first_pass, mapper_histogram_start_second_pass },
+	{ mapper_stats2_start_first_pass,    mapper_stats2_start_second_pass    },
+};
+static int num_two_pass_verbs = sizeof(two_pass_verbs) / sizeof(two_pass_verbs[0]);
+
+static int do_first_pass(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_reader, sllv_t* pmapper_list,
+	context_t* pctx);
+static void do_second_pass(char* prepipe, slls_t* filenames, context_t* pctx, lrec_reader_t* plrec_reader,
+	sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream);
 static int do_file_chained(char* prepipe, char* filename, context_t* pctx,
 	lrec_reader_t* plrec_reader, sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream,
-	long long nr_progress_mod);
+	long long nr_progress_mod, read_mode_t read_mode, unsigned long long skip_count, sllv_t* pheld_outrecs);
+static int do_file_reversed(void* pvhandle, context_t* pctx, lrec_reader_t* plrec_reader, sllv_t* pmapper_list,
+	lrec_writer_t* plrec_writer, FILE* output_stream, sllv_t* pheld_outrecs);
+static read_mode_t get_read_mode(lrec_reader_t* plrec_reader, sllv_t* pmapper_list, int num_files,
+	unsigned long long* pskip_count);
 
-static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head);
+static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head,
+	lrec_writer_t* plrec_writer, FILE* output_stream);
+static sllv_t* chain_map_rest(sllv_t* outrecs, context_t* pctx, sllve_t* pmapper_list_head,
+	lrec_writer_t* plrec_writer, FILE* output_stream);
+static void write_lrecs(sllv_t* outrecs, lrec_writer_t* plrec_writer, FILE* output_stream);
 
 static void drive_lrec(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head, lrec_writer_t* plrec_writer,
 	FILE* output_stream);
@@ -25,14 +60,16 @@ static void stderr_progress_indicator(context_t* pctx, long long nr_progress_mod
 
 // ----------------------------------------------------------------
 int do_stream_chained(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_reader, sllv_t* pmapper_list,
-	lrec_writer_t* plrec_writer, char* ofmt, long long nr_progress_mod)
+	lrec_writer_t* plrec_writer, char* ofmt, long long nr_progress_mod, double sample_rate)
 {
 	FILE* output_stream = stdout;
 
 	MLR_INTERNAL_CODING_ERROR_IF(pmapper_list->length < 1); // Should not have been allowed by the CLI parser.
 
-	context_t ctx = { .nr = 0, .fnr = 0, .filenum = 0, .filename = NULL, .force_eof = FALSE };
+	context_t ctx = { .nr = 0, .fnr = 0, .filenum = 0, .filename = NULL, .force_eof = FALSE, .more_output = FALSE,
+		.sample_rate = sample_rate };
 	int ok = 1;
+	sllv_t* pheld_outrecs = sllv_alloc(); // See do_file_reversed
 	if (filenames == NULL) {
 		// No input at all
 	} else if (filenames->length == 0) {
@@ -41,16 +78,20 @@ int do_stream_chained(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_rea
 		ctx.filename = "(stdin)";
 		ctx.fnr = 0;
 		ok = do_file_chained(prepipe, "-", &ctx, plrec_reader, pmapper_list, plrec_writer, output_stream,
-			nr_progress_mod) && ok;
+			nr_progress_mod, READ_ALL, 0LL, pheld_outrecs) && ok;
+	} else if (do_first_pass(prepipe, filenames, plrec_reader, pmapper_list, &ctx)) {
+		do_second_pass(prepipe, filenames, &ctx, plrec_reader, pmapper_list, plrec_writer, output_stream);
 	} else {
 		// Read from each file name in turn
+		unsigned long long skip_count = 0LL;
+		read_mode_t read_mode = get_read_mode(plrec_reader, pmapper_list, filenames->length, &skip_count);
 		for (sllse_t* pe = filenames->phead; pe != NULL; pe = pe->pnext) {
 			char* filename = pe->value;
 			ctx.filenum++;
 			ctx.filename = filename;
 			ctx.fnr = 0;
 			ok = do_file_chained(prepipe, filename, &ctx, plrec_reader, pmapper_list,
-				plrec_writer, output_stream, nr_progress_mod) && ok;
+				plrec_writer, output_stream, nr_progress_mod, read_mode, skip_count, pheld_outrecs) && ok;
 			if (ctx.force_eof == TRUE) // e.g. mlr head
 				break;
 		}
@@ -58,7 +99,9 @@ int do_stream_chained(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_rea
 
 	// Mappers and writers receive end-of-stream notifications via null input record.
 	// Do that, now that data from all input file(s) have been exhausted.
-	drive_lrec(NULL, &ctx, pmapper_list->phead, plrec_writer, output_stream);
+	sllv_t* outrecs = chain_map(NULL, &ctx, pmapper_list->phead, plrec_writer, output_stream);
+	write_lrecs(pheld_outrecs, plrec_writer, output_stream);
+	write_lrecs(outrecs, plrec_writer, output_stream);
 
 	// Drain the pretty-printer.
 	plrec_writer->pprocess_func(plrec_writer->pvstate, output_stream, NULL);
@@ -66,10 +109,104 @@ int do_stream_chained(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_rea
 	return ok;
 }
 
+// ----------------------------------------------------------------
+// If the first verb can use two passes and the inputs can be read twice, reads them all through to it, with
+// records freed as they go and the files unmapped after, then tells it that the second pass is starting.
+// Returns FALSE, having read nothing, otherwise. The inputs must be regular files, not pipes, and read in full
+// each time: --sample-fraction would give a different sample.
+static int do_first_pass(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_reader, sllv_t* pmapper_list,
+	context_t* pctx)
+{
+	if (prepipe != NULL || pctx->sample_rate != 1.0)
+		return FALSE;
+	for (sllse_t* pe = filenames->phead; pe != NULL; pe = pe->pnext) {
+		struct stat statbuf;
+		if (stat(pe->value, &statbuf) != 0 || !S_ISREG(statbuf.st_mode))
+			return FALSE;
+	}
+
+	mapper_t* pmapper = pmapper_list->phead->pvvalue;
+	two_pass_verb_t* pverb = NULL;
+	for (int i = 0; i < num_two_pass_verbs && pverb == NULL; i++)
+		if (two_pass_verbs[i].pstart_first_pass_func(pmapper))
+			pverb = &two_pass_verbs[i];
+	if (pverb == NULL)
+		return FALSE;
+
+	for (sllse_t* pe = filenames->phead; pe != NULL; pe = pe->pnext) {
+		pctx->filenum++;
+		pctx->filename = pe->value;
+		pctx->fnr = 0;
+		void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, prepipe, pe->value);
+		plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
+		while (TRUE) {
+			lrec_t* pinrec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, pctx);
+			if (pinrec == NULL)
+				break;
+			pctx->nr++;
+			pctx->fnr++;
+			sllv_t* poutrecs = pmapper->pprocess_func(pinrec, pctx, pmapper->pvstate);
+			MLR_INTERNAL_CODING_ERROR_IF(poutrecs != NULL);
+		}
+		if (plrec_reader->prelease_func != NULL)
+			plrec_reader->prelease_func(plrec_reader->pvstate, pvhandle, prepipe);
+		else
+			plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, prepipe);
+	}
+
+	pverb->pstart_second_pass_func(pmapper);
+	return TRUE;
+}
+
+// The first verb's output would otherwise come at end of stream, so NR, FNR, and FILENAME stay at their
+// end-of-stream values from the first pass, as for tac reading backward.
+static void do_second_pass(char* prepipe, slls_t* filenames, context_t* pctx, lrec_reader_t* plrec_reader,
+	sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream)
+{
+	for (sllse_t* pe = filenames->phead; pe != NULL && !pctx->force_eof; pe = pe->pnext) {
+		void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, prepipe, pe->value);
+		plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
+		while (!pctx->force_eof) { // e.g. mlr stats2 --fit then head
+			lrec_t* pinrec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, pctx);
+			if (pinrec == NULL)
+				break;
+			drive_lrec(pinrec, pctx, pmapper_list->phead, plrec_writer, output_stream);
+		}
+		plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, prepipe);
+	}
+}
+
+// ----------------------------------------------------------------
+// Records other than the last ones need not be parsed when tail without -g is the first verb and the reader
+// can find them directly, e.g. by scanning an mmapped file backward. Likewise, tac as the first verb needn't
+// retain the records if the reader can produce them last to first, and sample without -g as the first verb
+// needn't see the records it would discard.
+static read_mode_t get_read_mode(lrec_reader_t* plrec_reader, sllv_t* pmapper_list, int num_files,
+	unsigned long long* pskip_count)
+{
+	mapper_t* pmapper = pmapper_list->phead->pvvalue;
+	slls_t* pgroup_by_field_names = NULL;
+	if (plrec_reader->padvance_func != NULL && mapper_sample_is_unkeyed(pmapper))
+		return READ_SAMPLED;
+	if (num_files != 1)
+		return READ_ALL;
+	if (plrec_reader->pskip_func != NULL
+		&& mapper_tail_get_params(pmapper, pskip_count, &pgroup_by_field_names)
+		// The tail mapper keeps one record for -n 0, as for -n 1, so that's left to it.
+		&& *pskip_count > 0LL
+		&& (pgroup_by_field_names == NULL || pgroup_by_field_names->length == 0))
+	{
+		return READ_LAST;
+	}
+	if (plrec_reader->pstart_reverse_func != NULL && mapper_is_tac(pmapper))
+		return READ_REVERSED;
+	return READ_ALL;
+}
+
 // ----------------------------------------------------------------
 static int do_file_chained(char* prepipe, char* filename, context_t* pctx,
 	lrec_reader_t* plrec_reader, sllv_t* pmapper_list, lrec_writer_t* plrec_writer, FILE* output_stream,
-	long long nr_progress_mod)
+	long long nr_progress_mod, read_mode_t read_mode, unsigned long long skip_count, sllv_t* pheld_outrecs)
 {
 	void* pvhandle = plrec_reader->popen_func(plrec_reader->pvstate, prepipe, filename);
 	progress_indicator_t* pindicator = nr_progress_mod == 0LL ? null_progress_indicator : stderr_progress_indicator;
@@ -77,7 +214,33 @@ static int do_file_chained(char* prepipe, char* filename, context_t* pctx,
 	// Start-of-file hook, e.g. expecting CSV headers on input.
 	plrec_reader->psof_func(plrec_reader->pvstate, pvhandle);
 
+	// The skipped records still count toward NR and FNR.
+	if (read_mode == READ_LAST) {
+		long long num_skipped = plrec_reader->pskip_func(plrec_reader->pvstate, pvhandle, skip_count);
+		if (num_skipped > 0LL) {
+			pctx->nr  += num_skipped;
+			pctx->fnr += num_skipped;
+		}
+	} else if (read_mode == READ_REVERSED) {
+		if (do_file_reversed(pvhandle, pctx, plrec_reader, pmapper_list, plrec_writer, output_stream,
+			pheld_outrecs))
+		{
+			plrec_reader->pclose_func(plrec_reader->pvstate, pvhandle, prepipe);
+			return 1;
+		}
+	}
+
 	while (1) {
+		if (read_mode == READ_SAMPLED) {
+			mapper_t* psampler = pmapper_list->phead->pvvalue;
+			unsigned long long num_skippable = mapper_sample_get_skippable(psampler);
+			if (num_skippable > 0LL) {
+				long long num_skipped = plrec_reader->padvance_func(plrec_reader->pvstate, pvhandle, num_skippable);
+				pctx->nr  += num_skipped;
+				pctx->fnr += num_skipped;
+				mapper_sample_note_skipped(psampler, num_skipped);
+			}
+		}
 		lrec_t* pinrec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, pctx);
 		if (pinrec == NULL)
 			break;
@@ -97,11 +260,56 @@ static int do_file_chained(char* prepipe, char* filename, context_t* pctx,
 	return 1;
 }
 
+// ----------------------------------------------------------------
+// The records go straight to the mappers after tac, as tac would send them at end of stream, so NR and FNR
+// are set to their end-of-stream values first. The output of those mappers is written as it comes, so any
+// print statements in the main blocks of put or filter after tac are interleaved with the records, as they are
+// without tac. Only if one of those has end blocks, whose prints would come before all the records from tac,
+// is the output held until end of stream. Returns FALSE if the reader can't read the file backward, e.g. a
+// CSV-lite file with schema changes, leaving it to be read forward.
+static int do_file_reversed(void* pvhandle, context_t* pctx, lrec_reader_t* plrec_reader, sllv_t* pmapper_list,
+	lrec_writer_t* plrec_writer, FILE* output_stream, sllv_t* pheld_outrecs)
+{
+	long long num_records = plrec_reader->pstart_reverse_func(plrec_reader->pvstate, pvhandle, pctx);
+	if (num_records < 0LL)
+		return FALSE;
+	pctx->nr  += num_records;
+	pctx->fnr += num_records;
+
+	sllve_t* prest = pmapper_list->phead->pnext;
+	int hold = FALSE;
+	for (sllve_t* pe = prest; pe != NULL; pe = pe->pnext)
+		if (mapper_put_or_filter_has_end_blocks(pe->pvvalue))
+			hold = TRUE;
+
+	while (plrec_reader->pprev_func(plrec_reader->pvstate, pvhandle)) {
+		lrec_t* pinrec = plrec_reader->pprocess_func(plrec_reader->pvstate, pvhandle, pctx);
+		if (pinrec == NULL)
+			break;
+		if (prest == NULL) {
+			plrec_writer->pprocess_func(plrec_writer->pvstate, output_stream, pinrec);
+		} else if (hold) {
+			sllv_t* outrecs = chain_map(pinrec, pctx, prest, plrec_writer, output_stream);
+			sllv_transfer(pheld_outrecs, outrecs);
+			sllv_free(outrecs);
+		} else {
+			drive_lrec(pinrec, pctx, prest, plrec_writer, output_stream);
+		}
+		if (pctx->force_eof == TRUE) // e.g. mlr tac then head
+			break;
+	}
+	return TRUE;
+}
+
 // ----------------------------------------------------------------
 static void drive_lrec(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head, lrec_writer_t* plrec_writer,
 	FILE* output_stream)
 {
-	sllv_t* outrecs = chain_map(pinrec, pctx, pmapper_list_head);
+	sllv_t* outrecs = chain_map(pinrec, pctx, pmapper_list_head, plrec_writer, output_stream);
+	write_lrecs(outrecs, plrec_writer, output_stream);
+}
+
+static void write_lrecs(sllv_t* outrecs, lrec_writer_t* plrec_writer, FILE* output_stream) {
 	if (outrecs != NULL) {
 		for (sllve_t* pe = outrecs->phead; pe != NULL; pe = pe->pnext) {
 			lrec_t* poutrec = pe->pvvalue;
@@ -117,10 +325,33 @@ static void drive_lrec(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_he
 // more output records.
 //
 // Return: list of lrec_t*. Input: lrec_t* and list of mapper_t*.
+//
+// A mapper returning its end-of-stream output in batches (see more_output in
+// context.h) has each batch run through the rest of the chain and written out
+// before it is asked for the next, so the full output is never held at once.
+// This keeps output order since such a mapper emits nothing earlier, so there
+// are no records pending from upstream mappers. Output printed by the rest of
+// the chain at end of stream, e.g. by put end blocks, does come after the
+// earlier batches, though, rather than before all of them.
 
-static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head) {
+static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_head,
+	lrec_writer_t* plrec_writer, FILE* output_stream)
+{
 	mapper_t* pmapper = pmapper_list_head->pvvalue;
 	sllv_t* outrecs = pmapper->pprocess_func(pinrec, pctx, pmapper->pvstate);
+	while (pinrec == NULL && pctx->more_output) {
+		pctx->more_output = FALSE;
+		write_lrecs(chain_map_rest(outrecs, pctx, pmapper_list_head, plrec_writer, output_stream),
+			plrec_writer, output_stream);
+		outrecs = pmapper->pprocess_func(NULL, pctx, pmapper->pvstate);
+	}
+	return chain_map_rest(outrecs, pctx, pmapper_list_head, plrec_writer, output_stream);
+}
+
+// Runs the outputs of one mapper through the mappers after it.
+static sllv_t* chain_map_rest(sllv_t* outrecs, context_t* pctx, sllve_t* pmapper_list_head,
+	lrec_writer_t* plrec_writer, FILE* output_stream)
+{
 	if (pmapper_list_head->pnext == NULL) {
 		return outrecs;
 	} else if (outrecs == NULL) { // end of input stream
@@ -130,7 +361,7 @@ static sllv_t* chain_map(lrec_t* pinrec, context_t* pctx, sllve_t* pmapper_list_
 
 		for (sllve_t* pe = outrecs->phead; pe != NULL; pe = pe->pnext) {
 			lrec_t* poutrec = pe->pvvalue;
-			sllv_t* nextrecsi = chain_map(poutrec, pctx, pmapper_list_head->pnext);
+			sllv_t* nextrecsi = chain_map(poutrec, pctx, pmapper_list_head->pnext, plrec_writer, output_stream);
 			sllv_transfer(nextrecs, nextrecsi);
 			sllv_free(nextrecsi);
 		}
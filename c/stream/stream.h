@@ -8,6 +8,6 @@
 #include "output/lrec_writers.h"
 
 int do_stream_chained(char* prepipe, slls_t* filenames, lrec_reader_t* plrec_reader, sllv_t* pmapper_list,
-	lrec_writer_t* plrec_writer, char* ofmt, long long nr_progress_mod);
+	lrec_writer_t* plrec_writer, char* ofmt, long long nr_progress_mod, double sample_rate);
 
 #endif // STREAM_H
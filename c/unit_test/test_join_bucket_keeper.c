@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 #include "lib/minunit.h"
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
@@ -7,6 +8,7 @@
 #include "containers/sllv.h"
 #include "input/lrec_readers.h"
 #include "containers/join_bucket_keeper.h"
+#include "containers/join_index.h"
 #include "containers/mixutil.h"
 
 int tests_run         = 0;
@@ -534,6 +536,141 @@ static char* test_het_middle_pairing() {
 	return 0;
 }
 
+// ----------------------------------------------------------------
+static join_bucket_t* make_index_test_bucket(lhmslv_t* pbuckets, char* value) {
+	join_bucket_t* pbucket = mlr_malloc_or_die(sizeof(join_bucket_t));
+	pbucket->pleft_field_values = slls_single_no_free(value);
+	pbucket->precords = sllv_alloc();
+	pbucket->was_paired = FALSE;
+	lhmslv_put(pbuckets, slls_single_no_free(value), pbucket, FREE_ENTRY_KEY);
+	return pbucket;
+}
+
+static char* test_join_index() {
+	char path[] = "/tmp/mlr-join-index-test-XXXXXX";
+	int fd = mkstemp(path);
+	mu_assert_lf(fd >= 0);
+	close(fd);
+
+	lhmslv_t* pbuckets = lhmslv_alloc();
+	join_bucket_t* pbucket1 = make_index_test_bucket(pbuckets, "pan");
+	join_bucket_t* pbucket2 = make_index_test_bucket(pbuckets, "wye");
+	sllv_append(pbucket1->precords, lrec_literal_2("id", "pan", "x", "1"));
+	sllv_append(pbucket1->precords, lrec_literal_2("id", "pan", "x", "2"));
+	sllv_append(pbucket2->precords, lrec_literal_1("id", "wye"));
+	sllv_t* punkeyed = sllv_single(lrec_literal_1("y", "3"));
+
+	struct stat source_stat;
+	memset(&source_stat, 0, sizeof(source_stat));
+	source_stat.st_size = 1234;
+	source_stat.st_mtime = 5678;
+	join_index_write(path, &source_stat, "ifmt=dkvp\nl=id\n", pbuckets, punkeyed);
+
+	mu_assert_lf(join_index_open(path, &source_stat, "ifmt=csv\nl=id\n") == NULL);
+	source_stat.st_size++;
+	mu_assert_lf(join_index_open(path, &source_stat, "ifmt=dkvp\nl=id\n") == NULL);
+	source_stat.st_size--;
+#ifndef __APPLE__
+	source_stat.st_mtim.tv_nsec++;
+	mu_assert_lf(join_index_open(path, &source_stat, "ifmt=dkvp\nl=id\n") == NULL);
+	source_stat.st_mtim.tv_nsec--;
+#endif
+	join_index_t* pindex = join_index_open(path, &source_stat, "ifmt=dkvp\nl=id\n");
+	mu_assert_lf(pindex != NULL);
+	mu_assert_lf(pindex->num_buckets == 2);
+
+	slls_t* pvalues = slls_single_no_free("wye");
+	mu_assert_lf(join_index_find(pindex, pvalues) == 1);
+	slls_free(pvalues);
+	pvalues = slls_single_no_free("zee");
+	mu_assert_lf(join_index_find(pindex, pvalues) == -1);
+	slls_free(pvalues);
+	pvalues = slls_single_no_free("pan");
+	long long bucket_index = join_index_find(pindex, pvalues);
+	slls_free(pvalues);
+	mu_assert_lf(bucket_index == 0);
+
+	sllv_t* precords = sllv_alloc();
+	join_index_append_bucket_records(pindex, bucket_index, precords);
+	join_index_append_unkeyed_records(pindex, precords);
+	mu_assert_lf(precords->length == 3);
+	lrec_t* prec = sllv_pop(precords);
+	mu_assert_lf(streq(lrec_sprint(prec, "", ",", "="), "id=pan,x=1"));
+	lrec_free(prec);
+	prec = sllv_pop(precords);
+	mu_assert_lf(streq(lrec_get(prec, "x"), "2"));
+	lrec_free(prec);
+	prec = sllv_pop(precords);
+	mu_assert_lf(streq(lrec_get(prec, "y"), "3"));
+	lrec_free(prec);
+	sllv_free(precords);
+
+	join_index_free(pindex);
+	unlink(path);
+	return NULL;
+}
+
+// A malformed record makes its bucket a miss when first used, rather than aborting when the record is decoded,
+// and removes the index so that it's rebuilt. Malformed tables make the whole index a miss. Failing to write the
+// index isn't fatal.
+static char* test_join_index_malformed() {
+	char path[] = "/tmp/mlr-join-index-test-XXXXXX";
+	int fd = mkstemp(path);
+	mu_assert_lf(fd >= 0);
+	close(fd);
+
+	lhmslv_t* pbuckets = lhmslv_alloc();
+	join_bucket_t* pbucket = make_index_test_bucket(pbuckets, "pan");
+	sllv_append(pbucket->precords, lrec_literal_2("id", "pan", "x", "1"));
+	sllv_t* punkeyed = sllv_alloc();
+	struct stat source_stat;
+	memset(&source_stat, 0, sizeof(source_stat));
+	char* signature = "ifmt=dkvp\nl=id\n";
+	join_index_write(path, &source_stat, signature, pbuckets, punkeyed);
+	join_index_write("/nonexistent/mlr-join-index-test", &source_stat, signature, pbuckets, punkeyed);
+
+	join_index_t* pindex = join_index_open(path, &source_stat, signature);
+	mu_assert_lf(pindex != NULL);
+	join_index_free(pindex);
+
+	// The first record follows the signature: make its length run past the end of the file.
+	FILE* fp = fopen(path, "r+b");
+	mu_assert_lf(fp != NULL);
+	char buffer[1024];
+	size_t length = fread(buffer, 1, sizeof(buffer), fp);
+	size_t offset = 0;
+	while (offset + strlen(signature) <= length && memcmp(&buffer[offset], signature, strlen(signature)) != 0)
+		offset++;
+	mu_assert_lf(offset + strlen(signature) <= length);
+	fseek(fp, offset + strlen(signature), SEEK_SET);
+	fputs("\xff\x7f", fp);
+	fclose(fp);
+	pindex = join_index_open(path, &source_stat, signature);
+	mu_assert_lf(pindex != NULL);
+	slls_t* pvalues = slls_single_no_free("pan");
+	mu_assert_lf(join_index_find(pindex, pvalues) == -1);
+	slls_free(pvalues);
+	sllv_t* precords = sllv_alloc();
+	join_index_append_bucket_records(pindex, 0, precords);
+	mu_assert_lf(precords->length == 0);
+	sllv_free(precords);
+	join_index_free(pindex);
+	mu_assert_lf(access(path, F_OK) != 0);
+
+	// The hash table is last: make a slot point past the bucket table.
+	join_index_write(path, &source_stat, signature, pbuckets, punkeyed);
+	fp = fopen(path, "r+b");
+	mu_assert_lf(fp != NULL);
+	unsigned long long slot = 99;
+	fseek(fp, -(long)sizeof(slot), SEEK_END);
+	fwrite(&slot, sizeof(slot), 1, fp);
+	fclose(fp);
+	mu_assert_lf(join_index_open(path, &source_stat, signature) == NULL);
+
+	unlink(path);
+	return NULL;
+}
+
 // ================================================================
 static char * run_all_tests() {
 	mu_run_test(test_left_empty_right_empty);
@@ -548,6 +685,8 @@ static char * run_all_tests() {
 	mu_run_test(test_het_unpaired_after_left_end);
 	mu_run_test(test_het_initial_pairing);
 	mu_run_test(test_het_middle_pairing);
+	mu_run_test(test_join_index);
+	mu_run_test(test_join_index_malformed);
 	printf("----------------------------------------------------------------\n");
 	return 0;
 }
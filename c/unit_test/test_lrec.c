@@ -4,6 +4,8 @@
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
 #include "containers/lrec.h"
+#include "containers/lrec_spill.h"
+#include "containers/lrec_store.h"
 #include "containers/sllv.h"
 #include "input/lrec_readers.h"
 
@@ -402,6 +404,259 @@ static char* test_lrec_put_after() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+static char* test_lrec_schema_id() {
+	slls_t* pkeys = slls_alloc();
+	slls_append_no_free(pkeys, "a");
+	slls_append_no_free(pkeys, "b");
+	header_keeper_t* pheader_keeper = header_keeper_alloc(NULL, pkeys);
+	mu_assert_lf(pheader_keeper->schema_id != LREC_SCHEMA_UNKNOWN);
+
+	lrec_t* prec = lrec_unbacked_alloc();
+	mu_assert_lf(prec->schema_id == LREC_SCHEMA_UNKNOWN);
+	lrec_put(prec, "a", "1", NO_FREE);
+	lrec_put(prec, "b", "2", NO_FREE);
+	lrec_stamp_header_schema(prec, pheader_keeper);
+	mu_assert_lf(prec->schema_id == pheader_keeper->schema_id);
+
+	// Value-only updates keep the schema.
+	lrec_put(prec, "b", "3", NO_FREE);
+	mu_assert_lf(prec->schema_id == pheader_keeper->schema_id);
+
+	lrec_t* pcopy = lrec_copy(prec);
+	mu_assert_lf(pcopy->schema_id == pheader_keeper->schema_id);
+	lrec_free(pcopy);
+
+	// Key changes invalidate it.
+	lrec_put(prec, "c", "4", NO_FREE);
+	mu_assert_lf(prec->schema_id == LREC_SCHEMA_UNKNOWN);
+	lrec_remove(prec, "c");
+	lrec_stamp_header_schema(prec, pheader_keeper);
+	mu_assert_lf(prec->schema_id == pheader_keeper->schema_id);
+	lrec_rename(prec, "a", "x", FALSE);
+	mu_assert_lf(prec->schema_id == LREC_SCHEMA_UNKNOWN);
+	lrec_rename(prec, "x", "a", FALSE);
+	lrec_stamp_header_schema(prec, pheader_keeper);
+	mu_assert_lf(prec->schema_id == pheader_keeper->schema_id);
+	lrec_move_to_head(prec, "b");
+	mu_assert_lf(prec->schema_id == LREC_SCHEMA_UNKNOWN);
+
+	// Field names not matching the header are not stamped.
+	lrec_stamp_header_schema(prec, pheader_keeper);
+	mu_assert_lf(prec->schema_id == LREC_SCHEMA_UNKNOWN);
+
+	lrec_free(prec);
+	header_keeper_free(pheader_keeper);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_lrec_spill() {
+	lrec_t* prec1 = lrec_literal_3("a", "1", "bcd", "", "e", "fghij");
+	lrec_t* prec2 = lrec_unbacked_alloc();
+	lrec_put_ext(prec2, "x", "y,z", NO_FREE, FIELD_QUOTED_ON_INPUT);
+
+	// Enough fields for a multi-byte varint payload length.
+	lrec_t* prec3 = lrec_unbacked_alloc();
+	char free_flags = 0;
+	for (int i = 1; i <= 200; i++)
+		lrec_put(prec3, make_nidx_key(i, &free_flags), "value", free_flags);
+
+	FILE* fp = spill_file_open_or_die();
+	lrec_spill_write(fp, prec1);
+	lrec_spill_write(fp, prec2);
+	spill_write_ull(fp, 0x123456789LL);
+	lrec_spill_write(fp, prec3);
+	rewind(fp);
+
+	unsigned long long tag = 0LL;
+	lrec_t* pin1 = lrec_spill_read(fp);
+	lrec_t* pin2 = lrec_spill_read(fp);
+	mu_assert_lf(spill_read_ull(fp, &tag));
+	mu_assert_lf(tag == 0x123456789LL);
+	lrec_t* pin3 = lrec_spill_read(fp);
+	mu_assert_lf(lrec_spill_read(fp) == NULL);
+	mu_assert_lf(!spill_read_ull(fp, &tag));
+	fclose(fp);
+
+	mu_assert_lf(pin1 != NULL);
+	mu_assert_lf(pin1->field_count == 3);
+	mu_assert_lf(streq(lrec_sprint(pin1, "", ",", "="), "a=1,bcd=,e=fghij"));
+	mu_assert_lf(pin2 != NULL);
+	mu_assert_lf(pin2->field_count == 1);
+	mu_assert_lf(streq(lrec_get(pin2, "x"), "y,z"));
+	mu_assert_lf(pin2->phead->quote_flags == FIELD_QUOTED_ON_INPUT);
+	mu_assert_lf(pin3 != NULL);
+	mu_assert_lf(pin3->field_count == 200);
+	mu_assert_lf(streq(pin3->ptail->key, "200"));
+	mu_assert_lf(lrec_memory_footprint(pin1) == lrec_memory_footprint(prec1));
+
+	lrec_free(prec1);
+	lrec_free(prec2);
+	lrec_free(prec3);
+	lrec_free(pin1);
+	lrec_free(pin2);
+	lrec_free(pin3);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_lrec_store() {
+	for (int max_memory = 0; max_memory <= 1; max_memory++) {
+		// With a limit of one byte, each append spills.
+		lrec_store_t* pstore = lrec_store_alloc(max_memory);
+		slls_t* pkey_a = slls_single_no_free("a");
+		slls_t* pkey_b = slls_single_no_free("b");
+		lrec_store_append(pstore, lrec_store_get_group(pstore, NULL),   lrec_literal_1("x", "1"));
+		lrec_store_append(pstore, lrec_store_get_group(pstore, pkey_b), lrec_literal_1("x", "2"));
+		lrec_store_append(pstore, lrec_store_get_group(pstore, pkey_a), lrec_literal_1("x", "3"));
+		lrec_store_append(pstore, lrec_store_get_group(pstore, pkey_b), lrec_literal_1("x", "4"));
+		lrec_store_append(pstore, lrec_store_get_group(pstore, NULL),   lrec_literal_1("x", "5"));
+		mu_assert_lf(lrec_store_get_group(pstore, pkey_b) == lrec_store_get_group(pstore, pkey_b));
+		mu_assert_lf((pstore->fp != NULL) == (max_memory > 0));
+
+		char* expected[] = { "2", "4", "3", "1", "5" };
+		for (int i = 0; i < 5; i++) {
+			lrec_t* prec = lrec_store_next(pstore);
+			mu_assert_lf(prec != NULL);
+			mu_assert_lf(streq(lrec_get(prec, "x"), expected[i]));
+			lrec_free(prec);
+		}
+		mu_assert_lf(lrec_store_next(pstore) == NULL);
+		lrec_store_free(pstore);
+
+		pstore = lrec_store_alloc(max_memory);
+		for (int i = 0; i < 5; i++)
+			lrec_store_append(pstore, lrec_store_get_group(pstore, (i % 2) ? pkey_a : NULL),
+				lrec_literal_1("x", expected[i]));
+		char* reversed[] = { "5", "3", "2", "1", "4" };
+		for (int i = 0; i < 5; i++) {
+			lrec_t* prec = lrec_store_prev(pstore);
+			mu_assert_lf(prec != NULL);
+			mu_assert_lf(streq(lrec_get(prec, "x"), reversed[i]));
+			lrec_free(prec);
+		}
+		mu_assert_lf(lrec_store_prev(pstore) == NULL);
+		lrec_store_free(pstore);
+
+		slls_free(pkey_a);
+		slls_free(pkey_b);
+	}
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_lrec_compact() {
+	char* line = mlr_strdup_or_die("a=1,bbb=2,c=3,d=4");
+	context_t ctx = { .nr = 1, .fnr = 1, .filenum = 1, .filename = "test-file" };
+	lrec_t* prec = lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE, &ctx);
+	lrec_remove(prec, "c");
+	lrec_put(prec, "d", mlr_strdup_or_die("five"), FREE_ENTRY_VALUE);
+	lrec_put(prec, mlr_strdup_or_die("e"), "6", FREE_ENTRY_KEY);
+	lrec_compact(prec);
+	mu_assert_lf(prec->psingle_line != line);
+	mu_assert_lf(streq(lrec_sprint(prec, "", ",", "="), "a=1,bbb=2,d=five,e=6"));
+	for (lrece_t* pe = prec->phead; pe != NULL; pe = pe->pnext)
+		mu_assert_lf(pe->free_flags == NO_FREE);
+	lrec_free(prec);
+
+	char* hdr_line = mlr_strdup_or_die("x,y");
+	slls_t* hdr_fields = split_csvlite_header_line_single_ifs(hdr_line, ',', FALSE);
+	header_keeper_t* pheader_keeper = header_keeper_alloc(hdr_line, hdr_fields);
+	prec = lrec_parse_stdio_csvlite_data_line_single_ifs(pheader_keeper, "test-file", 1,
+		mlr_strdup_or_die("7,8"), ',', FALSE);
+	char* header_key = prec->phead->key;
+	lrec_compact(prec);
+	mu_assert_lf(prec->phead->key == header_key);
+	mu_assert_lf(streq(lrec_sprint(prec, "", ",", "="), "x=7,y=8"));
+	lrec_free(prec);
+
+	prec = lrec_literal_1("x", "1");
+	lrec_compact(prec);
+	mu_assert_lf(prec->psingle_line == NULL);
+	lrec_free(prec);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static int lrec_sprints_as(lrec_t* prec, char* expected) {
+	char* actual = lrec_sprint(prec, "", ",", "=");
+	int rv = streq(actual, expected);
+	free(actual);
+	return rv;
+}
+
+static char* test_lrec_copy() {
+	char* line = mlr_strdup_or_die("a=1,b=2,c=3");
+	context_t ctx = { .nr = 1, .fnr = 1, .filenum = 1, .filename = "test-file" };
+	lrec_t* prec = lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE, &ctx);
+	lrec_put(prec, "d", mlr_strdup_or_die("4"), FREE_ENTRY_VALUE);
+
+	lrec_t* pcopy1 = lrec_copy(prec);
+	lrec_t* pcopy2 = lrec_copy(pcopy1);
+	mu_assert_lf(pcopy1->phead->value == prec->phead->value);
+	mu_assert_lf(pcopy2->ptail->value == prec->ptail->value);
+
+	lrec_put(prec, "a", "5", NO_FREE);
+	lrec_remove(prec, "d");
+	lrec_put(pcopy1, "b", mlr_strdup_or_die("6"), FREE_ENTRY_VALUE);
+	lrec_rename(pcopy2, "c", "e", FALSE);
+	mu_assert_lf(lrec_sprints_as(prec,   "a=5,b=2,c=3"));
+	mu_assert_lf(lrec_sprints_as(pcopy1, "a=1,b=6,c=3,d=4"));
+	mu_assert_lf(lrec_sprints_as(pcopy2, "a=1,b=2,e=3,d=4"));
+
+	// The backing lasts as long as any of them.
+	lrec_free(prec);
+	lrec_free(pcopy1);
+	mu_assert_lf(lrec_sprints_as(pcopy2, "a=1,b=2,e=3,d=4"));
+	lrec_compact(pcopy2);
+	mu_assert_lf(pcopy2->psingle_line == NULL);
+	lrec_free(pcopy2);
+
+	prec = lrec_literal_2("x", "1", "y", "2");
+	pcopy1 = lrec_copy(prec);
+	mu_assert_lf(prec->pshared_backing == NULL);
+	mu_assert_lf(pcopy1->field_count == 2);
+	mu_assert_lf(streq(lrec_get(pcopy1, "y"), "2"));
+	lrec_free(prec);
+	lrec_free(pcopy1);
+	return NULL;
+}
+
+// Fields put on a record after it has been copied are shared by its later copies: e.g. repeat then cat -n
+// then repeat.
+static char* test_lrec_copy_after_put() {
+	char* line = mlr_strdup_or_die("a=1,b=2");
+	context_t ctx = { .nr = 1, .fnr = 1, .filenum = 1, .filename = "test-file" };
+	lrec_t* prec = lrec_parse_stdio_dkvp_single_sep(line, ',', '=', FALSE, &ctx);
+
+	lrec_t* pcopy1 = lrec_copy(prec);
+	lrec_prepend(pcopy1, mlr_strdup_or_die("n"), mlr_strdup_or_die("1"), FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+	lrec_t* pcopy2 = lrec_copy(pcopy1);
+	lrec_free(pcopy1);
+	mu_assert_lf(lrec_sprints_as(pcopy2, "n=1,a=1,b=2"));
+	lrec_free(prec);
+	mu_assert_lf(lrec_sprints_as(pcopy2, "n=1,a=1,b=2"));
+
+	// Likewise for a record which owned nothing when first copied.
+	prec = lrec_literal_1("x", "1");
+	pcopy1 = lrec_copy(prec);
+	lrec_put(pcopy1, "y", mlr_strdup_or_die("2"), FREE_ENTRY_VALUE);
+	lrec_t* pcopy3 = lrec_copy(pcopy1);
+	lrec_put(pcopy1, "z", mlr_strdup_or_die("3"), FREE_ENTRY_VALUE);
+	lrec_t* pcopy4 = lrec_copy(pcopy1);
+	lrec_free(pcopy1);
+	mu_assert_lf(lrec_sprints_as(pcopy3, "x=1,y=2"));
+	mu_assert_lf(lrec_sprints_as(pcopy4, "x=1,y=2,z=3"));
+	lrec_free(pcopy3);
+	mu_assert_lf(lrec_sprints_as(pcopy4, "x=1,y=2,z=3"));
+
+	lrec_free(prec);
+	lrec_free(pcopy2);
+	lrec_free(pcopy4);
+	return NULL;
+}
+
 // ================================================================
 static char * run_all_tests() {
 	mu_run_test(test_lrec_unbacked_api);
@@ -411,6 +666,12 @@ static char * run_all_tests() {
 	mu_run_test(test_lrec_csv_api_disjoint_allocs);
 	mu_run_test(test_lrec_xtab_api);
 	mu_run_test(test_lrec_put_after);
+	mu_run_test(test_lrec_schema_id);
+	mu_run_test(test_lrec_spill);
+	mu_run_test(test_lrec_store);
+	mu_run_test(test_lrec_compact);
+	mu_run_test(test_lrec_copy);
+	mu_run_test(test_lrec_copy_after_put);
 	return 0;
 }
 
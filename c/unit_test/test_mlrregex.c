@@ -11,12 +11,25 @@ int assertions_run    = 0;
 int assertions_failed = 0;
 
 // ----------------------------------------------------------------
+// Returns capture i as a newly allocated string, for comparison.
+static char* capture_string(regex_captures_t* pregex_captures, int i) {
+	regmatch_t* pmatch = &pregex_captures->offsets[i];
+	return mlr_alloc_string_from_char_range(&pregex_captures->input[pmatch->rm_so], pmatch->rm_eo - pmatch->rm_so);
+}
+
+static int capture_equals(regex_captures_t* pregex_captures, int i, char* expected) {
+	char* actual = capture_string(pregex_captures, i);
+	int rv = streq(actual, expected);
+	free(actual);
+	return rv;
+}
+
 static char * test_save_regex_captures() {
 
 	// Capture-groups \1 through \9 supported, along with entire-string match in \0
-	const size_t nmatchmax = 10;
+	const size_t nmatchmax = REGEX_CAPTURES_MAX;
 	regmatch_t matches[nmatchmax];
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	regex_t regex;
 
 	char* input  = "abcde";
@@ -26,8 +39,7 @@ static char * test_save_regex_captures() {
 	save_regex_captures(&pregex_captures, input, matches, nmatchmax);
 	mu_assert_lf(pregex_captures != NULL);
 	mu_assert_lf(pregex_captures->length == 1);
-	mu_assert_lf(pregex_captures->strings[0] != NULL);
-	mu_assert_lf(streq(pregex_captures->strings[0], "abcde"));
+	mu_assert_lf(capture_equals(pregex_captures, 0, "abcde"));
 	regfree(&regex);
 
 	input  = "abcde";
@@ -36,8 +48,8 @@ static char * test_save_regex_captures() {
 	regmatch_or_die(&regex, input, nmatchmax, matches);
 	save_regex_captures(&pregex_captures, input, matches, nmatchmax);
 	mu_assert_lf(pregex_captures->length == 2);
-	mu_assert_lf(pregex_captures->strings[0] != NULL);
-	mu_assert_lf(streq(pregex_captures->strings[1], "bcd"));
+	mu_assert_lf(capture_equals(pregex_captures, 0, "abcde"));
+	mu_assert_lf(capture_equals(pregex_captures, 1, "bcd"));
 	regfree(&regex);
 
 	input  = "abcde";
@@ -46,10 +58,10 @@ static char * test_save_regex_captures() {
 	regmatch_or_die(&regex, input, nmatchmax, matches);
 	save_regex_captures(&pregex_captures, input, matches, nmatchmax);
 	mu_assert_lf(pregex_captures->length == 4);
-	mu_assert_lf(pregex_captures->strings[0] != NULL);
-	mu_assert_lf(streq(pregex_captures->strings[1], "b"));
-	mu_assert_lf(streq(pregex_captures->strings[2], "c"));
-	mu_assert_lf(streq(pregex_captures->strings[3], "d"));
+	mu_assert_lf(capture_equals(pregex_captures, 0, "abcde"));
+	mu_assert_lf(capture_equals(pregex_captures, 1, "b"));
+	mu_assert_lf(capture_equals(pregex_captures, 2, "c"));
+	mu_assert_lf(capture_equals(pregex_captures, 3, "d"));
 	regfree(&regex);
 
 	input  = "abcdefghij";
@@ -58,24 +70,41 @@ static char * test_save_regex_captures() {
 	regmatch_or_die(&regex, input, nmatchmax, matches);
 	save_regex_captures(&pregex_captures, input, matches, nmatchmax);
 	mu_assert_lf(pregex_captures->length == 10);
-	mu_assert_lf(pregex_captures->strings[0] != NULL);
-	mu_assert_lf(streq(pregex_captures->strings[1], "a"));
-	mu_assert_lf(streq(pregex_captures->strings[2], "b"));
-	mu_assert_lf(streq(pregex_captures->strings[3], "c"));
-	mu_assert_lf(streq(pregex_captures->strings[4], "d"));
-	mu_assert_lf(streq(pregex_captures->strings[5], "e"));
-	mu_assert_lf(streq(pregex_captures->strings[6], "f"));
-	mu_assert_lf(streq(pregex_captures->strings[7], "g"));
-	mu_assert_lf(streq(pregex_captures->strings[8], "h"));
-	mu_assert_lf(streq(pregex_captures->strings[9], "i"));
+	mu_assert_lf(capture_equals(pregex_captures, 0, "abcdefghi"));
+	mu_assert_lf(capture_equals(pregex_captures, 1, "a"));
+	mu_assert_lf(capture_equals(pregex_captures, 2, "b"));
+	mu_assert_lf(capture_equals(pregex_captures, 3, "c"));
+	mu_assert_lf(capture_equals(pregex_captures, 4, "d"));
+	mu_assert_lf(capture_equals(pregex_captures, 5, "e"));
+	mu_assert_lf(capture_equals(pregex_captures, 6, "f"));
+	mu_assert_lf(capture_equals(pregex_captures, 7, "g"));
+	mu_assert_lf(capture_equals(pregex_captures, 8, "h"));
+	mu_assert_lf(capture_equals(pregex_captures, 9, "i"));
 	regfree(&regex);
 
-	string_array_free(pregex_captures);
+	save_regex_captures_no_match(&pregex_captures);
+	mu_assert_lf(pregex_captures->length == 0);
+
+	regex_captures_free(pregex_captures);
 
 	return 0;
 }
 
 // ----------------------------------------------------------------
+static regex_captures_t* captures_from_match(char* input, char* sregex) {
+	const size_t nmatchmax = REGEX_CAPTURES_MAX;
+	regmatch_t matches[nmatchmax];
+	regex_captures_t* pregex_captures = NULL;
+	regex_t regex;
+	regcomp_or_die(&regex, sregex, 0);
+	if (regmatch_or_die(&regex, input, nmatchmax, matches))
+		save_regex_captures(&pregex_captures, input, matches, nmatchmax);
+	else
+		save_regex_captures_no_match(&pregex_captures);
+	regfree(&regex);
+	return pregex_captures;
+}
+
 static char * test_interpolate_regex_captures() {
 	int was_allocated = FALSE;
 
@@ -83,61 +112,169 @@ static char * test_interpolate_regex_captures() {
 	mu_assert_lf(streq(output, "hello"));
 	mu_assert_lf(was_allocated == FALSE);
 
-	string_array_t* psa = string_array_alloc(0);
-	output = interpolate_regex_captures("hello", psa, &was_allocated);
+	regex_captures_t* pregex_captures = captures_from_match("abc", "xyz");
+	mu_assert_lf(pregex_captures->length == 0);
+	output = interpolate_regex_captures("hello", pregex_captures, &was_allocated);
 	mu_assert_lf(streq(output, "hello"));
 	mu_assert_lf(was_allocated == FALSE);
-	string_array_free(psa);
+	output = interpolate_regex_captures("h\\1ello", pregex_captures, &was_allocated);
+	mu_assert_lf(streq(output, "hello"));
+	mu_assert_lf(was_allocated == TRUE);
+	free(output);
+	regex_captures_free(pregex_captures);
 
-	psa = string_array_from_line(mlr_strdup_or_die("X,a,b,c"), ',');
-	output = interpolate_regex_captures("hello", psa, &was_allocated);
+	pregex_captures = captures_from_match("X=abc", "X=(a)(b)(c)");
+	output = interpolate_regex_captures("hello", pregex_captures, &was_allocated);
 	mu_assert_lf(streq(output, "hello"));
 	mu_assert_lf(was_allocated == FALSE);
-	string_array_free(psa);
 
-	psa = string_array_from_line(mlr_strdup_or_die("X,a,b,c"), ',');
-	output = interpolate_regex_captures("h\\3ello", psa, &was_allocated);
+	output = interpolate_regex_captures("h\\3ello", pregex_captures, &was_allocated);
 	printf("output=[%s]\n", output);
 	mu_assert_lf(streq(output, "hcello"));
 	mu_assert_lf(was_allocated == TRUE);
-	string_array_free(psa);
+	free(output);
 
-	psa = string_array_from_line(mlr_strdup_or_die("X,a,b,c"), ',');
-	output = interpolate_regex_captures("h\\1ello", psa, &was_allocated);
+	output = interpolate_regex_captures("h\\1ello", pregex_captures, &was_allocated);
 	printf("output=[%s]\n", output);
 	mu_assert_lf(streq(output, "haello"));
 	mu_assert_lf(was_allocated == TRUE);
-	string_array_free(psa);
+	free(output);
 
-	psa = string_array_from_line(mlr_strdup_or_die("X,a,b,c"), ',');
-	output = interpolate_regex_captures("h\\4ello", psa, &was_allocated);
+	output = interpolate_regex_captures("h\\4ello", pregex_captures, &was_allocated);
 	printf("output=[%s]\n", output);
 	mu_assert_lf(streq(output, "hello"));
 	mu_assert_lf(was_allocated == TRUE);
-	string_array_free(psa);
+	free(output);
 
-	psa = string_array_from_line(mlr_strdup_or_die("X,a,b,c"), ',');
-	output = interpolate_regex_captures("h\\0ello", psa, &was_allocated);
+	output = interpolate_regex_captures("h\\0ello", pregex_captures, &was_allocated);
 	printf("output=[%s]\n", output);
-	mu_assert_lf(streq(output, "hXello"));
+	mu_assert_lf(streq(output, "hX=abcello"));
 	mu_assert_lf(was_allocated == TRUE);
-	string_array_free(psa);
+	free(output);
 
-	psa = string_array_from_line(mlr_strdup_or_die("X,a,b,c"), ',');
-	output = interpolate_regex_captures("h\\3e\\1l\\2l\\4o", psa, &was_allocated);
+	output = interpolate_regex_captures("h\\3e\\1l\\2l\\4o", pregex_captures, &was_allocated);
 	printf("output=[%s]\n", output);
 	mu_assert_lf(streq(output, "hcealblo"));
 	mu_assert_lf(was_allocated == TRUE);
-	string_array_free(psa);
+	free(output);
+	regex_captures_free(pregex_captures);
+
+	return 0;
+}
+
+// ----------------------------------------------------------------
+static char * test_regcache() {
+	regex_t* pregex1 = regcache_get_or_die("a(.)c", 0);
+	regex_t* pregex2 = regcache_get_or_die("a(.)c", 0);
+	mu_assert_lf(pregex1 == pregex2);
+
+	regex_t* pregex3 = regcache_get_or_die("a(.)c", REG_ICASE);
+	mu_assert_lf(pregex3 != pregex1);
+	mu_assert_lf(regmatch_or_die(pregex3, "ABC", 0, NULL) == TRUE);
+	mu_assert_lf(regmatch_or_die(regcache_get_or_die("a(.)c", 0), "ABC", 0, NULL) == FALSE);
+
+	// Overflow the cache and make sure evicted entries are recompiled correctly.
+	char buf[32];
+	for (int i = 0; i < 200; i++) {
+		sprintf(buf, "^x%dy$", i);
+		regex_t* pregex = regcache_get_or_die(buf, 0);
+		sprintf(buf, "x%dy", i);
+		mu_assert_lf(regmatch_or_die(pregex, buf, 0, NULL) == TRUE);
+	}
+	mu_assert_lf(regmatch_or_die(regcache_get_or_die("^x3y$", 0), "x3y", 0, NULL) == TRUE);
+	mu_assert_lf(regmatch_or_die(regcache_get_or_die("^x3y$", 0), "x4y", 0, NULL) == FALSE);
+	mu_assert_lf(regmatch_or_die(regcache_get_or_die("a(.)c", 0), "abc", 0, NULL) == TRUE);
 
 	return 0;
 }
 
+// ----------------------------------------------------------------
+static char * test_fast_regex_analysis() {
+	fast_regex_t regex;
+
+	fast_regcomp_or_die(&regex, "abc", 0);
+	mu_assert_lf(regex.num_literals == 1);
+	mu_assert_lf(streq(regex.literals[0], "abc"));
+	mu_assert_lf(regex.literal_anchors[0] == 0);
+	fast_regfree(&regex);
+
+	fast_regcomp_or_die(&regex, "^x$|^y|z$", 0);
+	mu_assert_lf(regex.num_literals == 3);
+	mu_assert_lf(regex.literal_anchors[0] == (FAST_REGEX_ANCHOR_START|FAST_REGEX_ANCHOR_END));
+	mu_assert_lf(regex.literal_anchors[1] == FAST_REGEX_ANCHOR_START);
+	mu_assert_lf(regex.literal_anchors[2] == FAST_REGEX_ANCHOR_END);
+	fast_regfree(&regex);
+
+	fast_regcomp_or_die(&regex, "^(in|out)_sum_[0-9]+$", 0);
+	mu_assert_lf(regex.num_literals == 0);
+	mu_assert_lf(streq(regex.required_literal, "_sum_"));
+	fast_regfree(&regex);
+
+	fast_regcomp_or_die(&regex, "abcx?y+z*", 0);
+	mu_assert_lf(regex.num_literals == 0);
+	mu_assert_lf(streq(regex.required_literal, "abc"));
+	fast_regfree(&regex);
+
+	fast_regcomp_or_die(&regex, "a.b|cde", 0);
+	mu_assert_lf(regex.num_literals == 0);
+	mu_assert_lf(regex.required_literal == NULL);
+	fast_regfree(&regex);
+
+	fast_regcomp_or_die_quoted(&regex, "\"abc\"i", 0);
+	mu_assert_lf(regex.num_literals == 0);
+	mu_assert_lf(regex.required_literal == NULL);
+	fast_regfree(&regex);
+
+	return 0;
+}
+
+// ----------------------------------------------------------------
+// The fast paths must agree with the regex library.
+static char * test_fast_regex_matches() {
+	char* patterns[] = {
+		"abc", "^abc", "abc$", "^abc$", "b|abc", "^a|c$", "^$", "a\\.b", "x[yz]+w", "(ab)+c",
+		"a{2}b", "a.c", "ab?c", "^(in|out)_sum", "_x$|y_", "[[:digit:]]z", "\"ABC\"i",
+	};
+	char* inputs[] = {
+		"", "abc", "xabc", "abcx", "ab", "aab", "aabc", "a\\.b", "a\\xb", "xyzw", "xw", "ababc",
+		"ac", "in_sum_1", "out_sums", "a_x", "y_a", "3z", "ABC", "b",
+	};
+	int npatterns = sizeof(patterns) / sizeof(patterns[0]);
+	int ninputs = sizeof(inputs) / sizeof(inputs[0]);
+
+	for (int i = 0; i < npatterns; i++) {
+		regex_t regex;
+		fast_regex_t fast_regex;
+		regcomp_or_die_quoted(&regex, patterns[i], 0);
+		fast_regcomp_or_die_quoted(&fast_regex, patterns[i], 0);
+		for (int j = 0; j < ninputs; j++) {
+			regmatch_t matches[3];
+			regmatch_t fast_matches[3];
+			int matched = regmatch_or_die(&regex, inputs[j], 3, matches);
+			int fast_matched = fast_regmatch_or_die(&fast_regex, inputs[j], 3, fast_matches);
+			mu_assert_lf(matched == fast_matched);
+			mu_assert_lf(fast_regex_may_match(&fast_regex, inputs[j]) || !matched);
+			if (matched) {
+				for (int k = 0; k < 3; k++) {
+					mu_assert_lf(matches[k].rm_so == fast_matches[k].rm_so);
+					mu_assert_lf(matches[k].rm_eo == fast_matches[k].rm_eo);
+				}
+			}
+		}
+		regfree(&regex);
+		fast_regfree(&fast_regex);
+	}
+
+	return 0;
+}
 
 // ================================================================
 static char * all_tests() {
 	mu_run_test(test_save_regex_captures);
 	mu_run_test(test_interpolate_regex_captures);
+	mu_run_test(test_regcache);
+	mu_run_test(test_fast_regex_analysis);
+	mu_run_test(test_fast_regex_matches);
 	return 0;
 }
 
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 #include "lib/minunit.h"
 #include "lib/mlr_globals.h"
 #include "lib/mlrutil.h"
@@ -17,7 +18,13 @@
 #include "containers/lhmsmv.h"
 #include "containers/percentile_keeper.h"
 #include "containers/top_keeper.h"
+#include "containers/schema_cache.h"
 #include "containers/dheap.h"
+#include "containers/sort_key.h"
+#include "containers/bloom_filter.h"
+#include "containers/tdigest.h"
+#include "containers/hyperloglog.h"
+#include "containers/space_saving.h"
 
 int tests_run         = 0;
 int tests_failed      = 0;
@@ -664,6 +671,78 @@ static char* test_lhmsmv() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+// Many keys, so the maps grow several times: insertion order and lookups should survive each regrowth.
+static char* test_lhms_growth() {
+	char buf[32];
+	int n = 10000;
+
+	lhmss_t* pmap = lhmss_alloc();
+	for (int i = 0; i < n; i++) {
+		sprintf(buf, "k%d", i);
+		lhmss_put(pmap, mlr_strdup_or_die(buf), mlr_strdup_or_die(buf), FREE_ENTRY_KEY|FREE_ENTRY_VALUE);
+		if ((i & (i + 1)) == 0)
+			mu_assert_lf(lhmss_check_counts(pmap));
+	}
+	for (int i = 0; i < n; i += 3) {
+		sprintf(buf, "k%d", i);
+		lhmss_put(pmap, buf, "overwritten", NO_FREE);
+	}
+	mu_assert_lf(pmap->num_occupied == n);
+	mu_assert_lf(lhmss_check_counts(pmap));
+
+	int i = 0;
+	for (lhmsse_t* pe = pmap->phead; pe != NULL; pe = pe->pnext, i++) {
+		sprintf(buf, "k%d", i);
+		mu_assert_lf(streq(pe->key, buf));
+		mu_assert_lf(streq(pe->value, (i % 3 == 0) ? "overwritten" : buf));
+	}
+	mu_assert_lf(i == n);
+	for (lhmsse_t* pe = pmap->ptail; pe != NULL; pe = pe->pprev)
+		i--;
+	mu_assert_lf(i == 0);
+
+	for (int j = 0; j < n; j++) {
+		sprintf(buf, "k%d", j);
+		mu_assert_lf(lhmss_has_key(pmap, buf));
+		sprintf(buf, "m%d", j);
+		mu_assert_lf(!lhmss_has_key(pmap, buf));
+	}
+	lhmss_free(pmap);
+
+	// Small maps are scanned until they outgrow LHM_MAX_UNINDEXED entries.
+	char* names[] = { "a", "b", "c", "d", "e", "f", "g", "h", "i" };
+	lhmsi_t* pimap = lhmsi_alloc();
+	for (int j = 0; j < 9; j++) {
+		lhmsi_put(pimap, names[j], j, NO_FREE);
+		mu_assert_lf((pimap->index.ctrl == NULL) == (j < LHM_MAX_UNINDEXED));
+		mu_assert_lf(lhmsi_check_counts(pimap));
+	}
+	for (int j = 0; j < 9; j++)
+		mu_assert_lf(lhmsi_get(pimap, names[j]) == j);
+	mu_assert_lf(!lhmsi_has_key(pimap, "z"));
+	lhmsi_free(pimap);
+
+	lhmsv_t* pvmap = lhmsv_alloc();
+	for (int round = 0; round < 2; round++) {
+		for (int j = 0; j < 100; j++) {
+			sprintf(buf, "%d", j);
+			lhmsv_put(pvmap, mlr_strdup_or_die(buf), pvmap, FREE_ENTRY_KEY);
+		}
+		mu_assert_lf(pvmap->num_occupied == 100);
+		mu_assert_lf(lhmsv_get(pvmap, "99") == pvmap);
+		mu_assert_lf(lhmsv_check_counts(pvmap));
+		lhmsv_clear(pvmap);
+		mu_assert_lf(pvmap->num_occupied == 0);
+		mu_assert_lf(pvmap->phead == NULL);
+		mu_assert_lf(!lhmsv_has_key(pvmap, "99"));
+		mu_assert_lf(lhmsv_check_counts(pvmap));
+	}
+	lhmsv_free(pvmap);
+
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_percentile_keeper() {
 
@@ -712,6 +791,64 @@ static char* test_percentile_keeper() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+// Selection must agree with sorting, for each storage type, for percentiles asked in any order, and
+// after further ingests.
+static int test_double_cmp(const void* pva, const void* pvb) {
+	const double* pa = pva;
+	const double* pb = pvb;
+	return (*pa < *pb) ? -1 : (*pa > *pb) ? 1 : 0;
+}
+
+static char* test_percentile_keeper_selection() {
+	int n = 20000;
+	double* sorted = mlr_malloc_or_die(n * sizeof(double));
+	double percentiles[] = {50.0, 0.0, 99.0, 25.0, 100.0, 1.0, 75.0, 50.0, 33.3};
+	int num_percentiles = sizeof(percentiles)/sizeof(percentiles[0]);
+
+	for (int storage = PK_STORE_INTS; storage <= PK_STORE_MIXED; storage++) {
+		percentile_keeper_t* ppercentile_keeper = percentile_keeper_alloc();
+		unsigned long long state = 12345;
+		for (int i = 0; i < n; i++) {
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			long long v = (long long)((state >> 33) % 5000); // Plenty of duplicates
+			sorted[i] = (double)v;
+			if (storage == PK_STORE_INTS || (storage == PK_STORE_MIXED && (i % 2) == 1))
+				percentile_keeper_ingest(ppercentile_keeper, mv_from_int(v));
+			else
+				percentile_keeper_ingest(ppercentile_keeper, mv_from_float((double)v));
+			if (i == n/2) {
+				// Emit midway, then keep ingesting.
+				mv_t q = percentile_keeper_emit_non_interpolated(ppercentile_keeper, 50.0);
+				mu_assert_lf(q.type == MT_INT || q.type == MT_FLOAT);
+			}
+		}
+		mu_assert_lf(ppercentile_keeper->storage == storage);
+		qsort(sorted, n, sizeof(double), test_double_cmp);
+
+		for (int j = 0; j < num_percentiles; j++) {
+			double p = percentiles[j];
+			mv_t q = percentile_keeper_emit_non_interpolated(ppercentile_keeper, p);
+			int index = p*n/100.0;
+			if (index >= n)
+				index = n-1;
+			double value = (q.type == MT_INT) ? (double)q.u.intv : q.u.fltv;
+			mu_assert_lf(value == sorted[index]);
+
+			q = percentile_keeper_emit_linearly_interpolated(ppercentile_keeper, p);
+			double findex = (p/100.0)*(n-1);
+			int iindex = (int)findex;
+			double expected = (iindex >= n-1) ? sorted[n-1]
+				: sorted[iindex] + (findex - iindex) * (sorted[iindex+1] - sorted[iindex]);
+			value = (q.type == MT_INT) ? (double)q.u.intv : q.u.fltv;
+			mu_assert_lf(fabs(value - expected) < 1e-9);
+		}
+		percentile_keeper_free(ppercentile_keeper);
+	}
+	free(sorted);
+	return NULL;
+}
+
 // ----------------------------------------------------------------
 static char* test_top_keeper() {
 	int capacity = 3;
@@ -720,12 +857,14 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->size == 0);
 
 	top_keeper_add(ptop_keeper, mv_from_float(5.0), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 1);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
 	mu_assert_lf(ptop_keeper->top_values[0].u.fltv == 5.0);
 
 	top_keeper_add(ptop_keeper, mv_from_float(6.0), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 2);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
@@ -734,6 +873,7 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[1].u.fltv == 5.0);
 
 	top_keeper_add(ptop_keeper, mv_from_int(4), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 3);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
@@ -744,6 +884,7 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[2].u.intv == 4.0);
 
 	top_keeper_add(ptop_keeper, mv_from_int(2), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 3);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_FLOAT);
@@ -754,6 +895,7 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[2].u.intv == 4.0);
 
 	top_keeper_add(ptop_keeper, mv_from_int(7), NULL);
+	top_keeper_sort(ptop_keeper);
 	top_keeper_print(ptop_keeper);
 	mu_assert_lf(ptop_keeper->size == 3);
 	mu_assert_lf(ptop_keeper->top_values[0].type == MT_INT);
@@ -764,9 +906,76 @@ static char* test_top_keeper() {
 	mu_assert_lf(ptop_keeper->top_values[2].u.fltv == 5.0);
 
 	top_keeper_free(ptop_keeper);
+
+	// Against a sort, past the initial allocation and with many duplicates.
+	capacity = 100;
+	ptop_keeper = top_keeper_alloc(capacity);
+	int counts[50];
+	memset(counts, 0, sizeof(counts));
+	for (int i = 0; i < 1000; i++) {
+		int v = (i * 7919) % 50;
+		counts[v]++;
+		top_keeper_add(ptop_keeper, mv_from_int(v), NULL);
+	}
+	top_keeper_sort(ptop_keeper);
+	mu_assert_lf(ptop_keeper->size == capacity);
+	int v = 49, nv = counts[49];
+	for (int i = 0; i < capacity; i++, nv--) {
+		if (nv == 0)
+			nv = counts[--v];
+		mu_assert_lf(ptop_keeper->top_values[i].u.intv == v);
+		if (i > 0 && ptop_keeper->top_values[i-1].u.intv == v)
+			mu_assert_lf(ptop_keeper->top_sequences[i-1] < ptop_keeper->top_sequences[i]);
+	}
+	top_keeper_free(ptop_keeper);
+
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+static char* test_schema_cache() {
+	schema_cache_t* pcache = schema_cache_alloc(free);
+
+	lrec_t* prec1 = lrec_literal_2("a", "1", "b", "2");
+	lrec_t* prec2 = lrec_literal_2("a", "3", "b", "4");
+	lrec_t* prec3 = lrec_literal_2("b", "5", "a", "6");
+	lrec_t* prec4 = lrec_literal_3("a", "7", "b", "8", "c", "9");
+
+	mu_assert_lf(schema_cache_get(pcache, prec1) == NULL);
+	schema_cache_put(pcache, prec1, mlr_strdup_or_die("plan ab"));
+	mu_assert_lf(streq(schema_cache_get(pcache, prec1), "plan ab"));
+	mu_assert_lf(streq(schema_cache_get(pcache, prec2), "plan ab"));
+	mu_assert_lf(schema_cache_get(pcache, prec3) == NULL);
+	mu_assert_lf(schema_cache_get(pcache, prec4) == NULL);
+	mu_assert_lf(lrec_schema_hash(prec1) == lrec_schema_hash(prec2));
+	mu_assert_lf(lrec_schema_hash(prec1) != lrec_schema_hash(prec3));
+
+	schema_cache_put(pcache, prec3, mlr_strdup_or_die("plan ba"));
+	mu_assert_lf(streq(schema_cache_get(pcache, prec3), "plan ba"));
+	mu_assert_lf(streq(schema_cache_get(pcache, prec2), "plan ab"));
+	mu_assert_lf(streq(schema_cache_get(pcache, prec3), "plan ba"));
+
+	// Overflow the cache and make sure eviction keeps it consistent.
+	char buf[32];
+	for (int i = 0; i < 3 * SCHEMA_CACHE_CAPACITY; i++) {
+		sprintf(buf, "k%d", i);
+		lrec_t* prec = lrec_literal_1(buf, "v");
+		if (schema_cache_get(pcache, prec) == NULL)
+			schema_cache_put(pcache, prec, mlr_strdup_or_die(buf));
+		mu_assert_lf(streq(schema_cache_get(pcache, prec), buf));
+		lrec_free(prec);
+	}
+	mu_assert_lf(pcache->num_entries == SCHEMA_CACHE_CAPACITY);
+	mu_assert_lf(schema_cache_get(pcache, prec1) == NULL);
+
+	lrec_free(prec1);
+	lrec_free(prec2);
+	lrec_free(prec3);
+	lrec_free(prec4);
+	schema_cache_free(pcache);
+	return 0;
+}
+
 // ----------------------------------------------------------------
 static char* test_dheap() {
 
@@ -837,6 +1046,278 @@ static char* test_dheap() {
 	return NULL;
 }
 
+// ----------------------------------------------------------------
+static sort_key_t* make_test_sort_key(char* s, double d, int descending) {
+	sort_key_t* pkey = sort_key_alloc();
+	sort_key_append_string(pkey, s, FALSE);
+	sort_key_append_double(pkey, d, descending);
+	return pkey;
+}
+
+static int test_sort_key_sign(int s) {
+	return (s < 0) ? -1 : (s > 0) ? 1 : 0;
+}
+
+static char* test_sort_key() {
+	// Lexical, ascending and descending.
+	char* strings[] = { "", "a", "ab", "abc", "b", "\xc3\xa9" };
+	int num_strings = sizeof(strings) / sizeof(strings[0]);
+	for (int i = 0; i < num_strings; i++) {
+		for (int j = 0; j < num_strings; j++) {
+			for (int descending = 0; descending <= 1; descending++) {
+				sort_key_t* pa = sort_key_alloc();
+				sort_key_t* pb = sort_key_alloc();
+				sort_key_append_string(pa, strings[i], descending);
+				sort_key_append_string(pb, strings[j], descending);
+				int expected = test_sort_key_sign(strcmp(strings[i], strings[j]));
+				if (descending)
+					expected = -expected;
+				mu_assert_lf(test_sort_key_sign(sort_key_compare(pa, pb)) == expected);
+				sort_key_free(pa);
+				sort_key_free(pb);
+			}
+		}
+	}
+
+	// Numeric: nulls last ascending and first descending; -0.0 equals 0.0.
+	double numbers[] = { -1e300, -2.5, -1.0, -0.0, 0.0, 1e-300, 1.0, 2.5, 1e300 };
+	int num_numbers = sizeof(numbers) / sizeof(numbers[0]);
+	for (int i = 0; i <= num_numbers; i++) {
+		for (int j = 0; j <= num_numbers; j++) {
+			double a = (i < num_numbers) ? numbers[i] : nan("");
+			double b = (j < num_numbers) ? numbers[j] : nan("");
+			int expected =
+				(i == num_numbers && j == num_numbers) ? 0 :
+				(i == num_numbers) ? 1 :
+				(j == num_numbers) ? -1 :
+				(a < b) ? -1 : (a > b) ? 1 : 0;
+			for (int descending = 0; descending <= 1; descending++) {
+				sort_key_t* pa = make_test_sort_key("x", a, descending);
+				sort_key_t* pb = make_test_sort_key("x", b, descending);
+				mu_assert_lf(test_sort_key_sign(sort_key_compare(pa, pb)) == (descending ? -expected : expected));
+				sort_key_free(pa);
+				sort_key_free(pb);
+			}
+		}
+	}
+
+	// Multi-field keys: the first field decides unless equal.
+	sort_key_t* pa = make_test_sort_key("abc", 1.0, FALSE);
+	sort_key_t* pb = make_test_sort_key("ab", 2.0, FALSE);
+	sort_key_t* pc = make_test_sort_key("abc", 0.5, FALSE);
+	mu_assert_lf(sort_key_compare(pb, pa) < 0);
+	mu_assert_lf(sort_key_compare(pc, pa) < 0);
+	sort_key_clear(pc);
+	sort_key_append_string(pc, "abc", FALSE);
+	sort_key_append_double(pc, 1.0, FALSE);
+	mu_assert_lf(sort_key_compare(pc, pa) == 0);
+	sort_key_free(pa);
+	sort_key_free(pb);
+	sort_key_free(pc);
+
+	// Sequence numbers break ties between copies of a key.
+	pa = make_test_sort_key("abc", 1.0, TRUE);
+	pb = sort_key_alloc();
+	sort_key_copy(pb, pa);
+	mu_assert_lf(sort_key_compare(pa, pb) == 0);
+	sort_key_append_ull(pa, 256LL);
+	sort_key_append_ull(pb, 255LL);
+	mu_assert_lf(sort_key_compare(pb, pa) < 0);
+	sort_key_free(pa);
+	sort_key_free(pb);
+
+	// Sorting is stable, including across merge passes.
+	int num_items = 1000;
+	sort_item_t* items = mlr_malloc_or_die(num_items * sizeof(sort_item_t));
+	int* payloads = mlr_malloc_or_die(num_items * sizeof(int));
+	for (int i = 0; i < num_items; i++) {
+		payloads[i] = i;
+		items[i].pkey = make_test_sort_key("long enough to pass the prefix", (i * 7919) % 13, TRUE);
+		items[i].pvvalue = &payloads[i];
+	}
+	sort_items(items, num_items);
+	for (int i = 1; i < num_items; i++) {
+		int s = sort_key_compare(items[i-1].pkey, items[i].pkey);
+		mu_assert_lf(s < 0 || (s == 0 && *(int*)items[i-1].pvvalue < *(int*)items[i].pvvalue));
+	}
+	mu_assert_lf(((7919 * *(int*)items[0].pvvalue) % 13) == 12);
+	for (int i = 0; i < num_items; i++)
+		sort_key_free(items[i].pkey);
+	free(items);
+	free(payloads);
+
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static unsigned long long test_bloom_hash(char* a, char* b) {
+	return bloom_hash_append(bloom_hash_append(BLOOM_HASH_SEED, a), b);
+}
+
+static char* test_bloom_filter() {
+	int num_elements = 1000;
+	bloom_filter_t* pfilter = bloom_filter_alloc(num_elements);
+	char buf[32];
+	for (int i = 0; i < num_elements; i++) {
+		sprintf(buf, "%d", i);
+		bloom_filter_add(pfilter, test_bloom_hash("present", buf));
+	}
+
+	// No false negatives.
+	for (int i = 0; i < num_elements; i++) {
+		sprintf(buf, "%d", i);
+		mu_assert_lf(bloom_filter_may_contain(pfilter, test_bloom_hash("present", buf)));
+	}
+
+	// Tuples are hashed with terminators.
+	mu_assert_lf(test_bloom_hash("ab", "c") != test_bloom_hash("a", "bc"));
+
+	// About 1% false positives; allow some slack.
+	int num_false_positives = 0;
+	for (int i = 0; i < 10000; i++) {
+		sprintf(buf, "%d", i);
+		if (bloom_filter_may_contain(pfilter, test_bloom_hash("absent", buf)))
+			num_false_positives++;
+	}
+	mu_assert_lf(num_false_positives < 300);
+
+	bloom_filter_free(pfilter);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_tdigest() {
+	tdigest_t* pdigest = tdigest_alloc(TDIGEST_DEFAULT_COMPRESSION);
+	for (int i = 1; i <= 5; i++)
+		tdigest_ingest(pdigest, (double)i);
+	mu_assert_lf(tdigest_percentile(pdigest, 0.0) == 1.0);
+	mu_assert_lf(tdigest_percentile(pdigest, 50.0) == 3.0);
+	mu_assert_lf(tdigest_percentile(pdigest, 100.0) == 5.0);
+	tdigest_free(pdigest);
+
+	// A permutation of 0..n-1, so the exact p-th percentile is about p*n/100.
+	int n = 1000000;
+	pdigest = tdigest_alloc(TDIGEST_DEFAULT_COMPRESSION);
+	for (long long i = 0; i < n; i++)
+		tdigest_ingest(pdigest, (double)((i * 7919LL) % n));
+	mu_assert_lf(pdigest->alloc_size <= pdigest->max_size);
+	double percentiles[] = {0.1, 1.0, 10.0, 25.0, 50.0, 75.0, 90.0, 99.0, 99.9};
+	for (int i = 0; i < sizeof(percentiles)/sizeof(percentiles[0]); i++) {
+		double p = percentiles[i];
+		double error = fabs(tdigest_percentile(pdigest, p) - p * n / 100.0) / n;
+		double tail = (p < 50.0 ? p : 100.0 - p) / 100.0;
+		mu_assert_lf(error < 0.001);
+		mu_assert_lf(error < 0.1 * tail);
+	}
+	mu_assert_lf(tdigest_percentile(pdigest, 0.0) == 0.0);
+	mu_assert_lf(tdigest_percentile(pdigest, 100.0) == n - 1);
+	mu_assert_lf(pdigest->num_merged <= TDIGEST_DEFAULT_COMPRESSION + 2);
+	tdigest_free(pdigest);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static unsigned long long test_hll_hash(int i) {
+	char buf[32];
+	sprintf(buf, "%d", i);
+	return bloom_hash_append(BLOOM_HASH_SEED, buf);
+}
+
+static char* test_hyperloglog() {
+	hll_t* phll = hll_alloc(HLL_DEFAULT_PRECISION);
+	mu_assert_lf(hll_estimate(phll) == 0.0);
+
+	// Small counts are nearly exact; duplicates don't count.
+	for (int i = 0; i < 10; i++) {
+		hll_add(phll, test_hll_hash(i));
+		hll_add(phll, test_hll_hash(i));
+	}
+	mu_assert_lf(fabs(hll_estimate(phll) - 10.0) < 0.5);
+
+	// Large counts are within a few standard errors (0.8% at precision 14).
+	int counts[] = {1000, 100000, 1000000};
+	int n = 10;
+	for (int j = 0; j < sizeof(counts)/sizeof(counts[0]); j++) {
+		for ( ; n < counts[j]; n++)
+			hll_add(phll, test_hll_hash(n));
+		double relative_error = fabs(hll_estimate(phll) - n) / n;
+		mu_assert_lf(relative_error < 0.03);
+	}
+
+	// Merging sketches of disjoint halves estimates the union.
+	hll_t* pa = hll_alloc(HLL_DEFAULT_PRECISION);
+	hll_t* pb = hll_alloc(HLL_DEFAULT_PRECISION);
+	for (int i = 0; i < n; i++)
+		hll_add((i % 2) ? pa : pb, test_hll_hash(i));
+	hll_merge(pa, pb);
+	mu_assert_lf(memcmp(pa->registers, phll->registers, phll->num_registers) == 0);
+
+	hll_free(pa);
+	hll_free(pb);
+	hll_free(phll);
+	return NULL;
+}
+
+// ----------------------------------------------------------------
+static char* test_space_saving() {
+	// Value i occurs about n/(i+1) times: a few heavy hitters and a long tail which forces evictions.
+	int num_values = 2000;
+	int capacity = 50;
+	long long* true_counts = mlr_malloc_or_die(num_values * sizeof(long long));
+	memset(true_counts, 0, num_values * sizeof(long long));
+	space_saving_t* psummary = space_saving_alloc(capacity);
+	char buf[32];
+	unsigned long long state = 1;
+	long long n = 200000;
+	for (long long j = 0; j < n; j++) {
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		double u = (double)(state >> 11) / (double)(1ULL << 53);
+		int i = (int)(exp(u * log((double)num_values + 1.0))) - 1;
+		if (i >= num_values)
+			i = num_values - 1;
+		true_counts[i]++;
+		sprintf(buf, "%d", i);
+		slls_t* pvalues = slls_single_no_free(buf);
+		space_saving_add(psummary, pvalues);
+		slls_free(pvalues);
+	}
+	mu_assert_lf(psummary->num_counters == capacity);
+
+	space_saving_counter_t** pcounters = space_saving_sorted_counters(psummary);
+	for (int k = 0; k < capacity; k++) {
+		int i = atoi(pcounters[k]->pvalues->phead->value);
+		// True counts are bracketed by the reported bounds.
+		mu_assert_lf(true_counts[i] <= pcounters[k]->count);
+		mu_assert_lf(true_counts[i] >= pcounters[k]->count - pcounters[k]->error);
+		if (k > 0)
+			mu_assert_lf(pcounters[k]->count <= pcounters[k-1]->count);
+	}
+	// Anything above n/capacity is monitored.
+	for (int i = 0; i < num_values; i++) {
+		if (true_counts[i] > n / capacity) {
+			int found = FALSE;
+			for (int k = 0; k < capacity; k++)
+				if (atoi(pcounters[k]->pvalues->phead->value) == i)
+					found = TRUE;
+			mu_assert_lf(found);
+		}
+	}
+	// The table still finds every monitored value after the evictions.
+	for (int k = 0; k < capacity; k++) {
+		unsigned long long count = pcounters[k]->count;
+		slls_t* pvalues = slls_copy(pcounters[k]->pvalues);
+		space_saving_add(psummary, pvalues);
+		slls_free(pvalues);
+		mu_assert_lf(pcounters[k]->count == count + 1);
+	}
+	mu_assert_lf(psummary->num_counters == capacity);
+
+	free(pcounters);
+	free(true_counts);
+	space_saving_free(psummary);
+	return NULL;
+}
+
 // ================================================================
 static char * run_all_tests() {
 	mu_run_test(test_slls);
@@ -851,9 +1332,17 @@ static char * run_all_tests() {
 	mu_run_test(test_lhms2v);
 	mu_run_test(test_lhmslv);
 	mu_run_test(test_lhmsmv);
+	mu_run_test(test_lhms_growth);
 	mu_run_test(test_percentile_keeper);
+	mu_run_test(test_percentile_keeper_selection);
 	mu_run_test(test_top_keeper);
+	mu_run_test(test_schema_cache);
 	mu_run_test(test_dheap);
+	mu_run_test(test_sort_key);
+	mu_run_test(test_bloom_filter);
+	mu_run_test(test_tdigest);
+	mu_run_test(test_hyperloglog);
+	mu_run_test(test_space_saving);
 	return 0;
 }
 
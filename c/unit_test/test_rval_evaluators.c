@@ -24,7 +24,7 @@ static char * test_caps() {
 	lrec_t* prec = lrec_unbacked_alloc();
 	lhmsmv_t* ptyped_overlay = lhmsmv_alloc();
 	mlhmmv_t* poosvars = mlhmmv_alloc();
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	loop_stack_t* ploop_stack = loop_stack_alloc();
 
 	variables_t variables = (variables_t) {
@@ -76,7 +76,7 @@ static char * test_strings() {
 	lrec_t* prec = lrec_unbacked_alloc();
 	lhmsmv_t* ptyped_overlay = lhmsmv_alloc();
 	mlhmmv_t* poosvars = mlhmmv_alloc();
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	loop_stack_t* ploop_stack = loop_stack_alloc();
 
 	lrec_put(prec, "s", "abc", NO_FREE);
@@ -153,7 +153,7 @@ static char * test_numbers() {
 	lrec_t* prec = lrec_unbacked_alloc();
 	lhmsmv_t* ptyped_overlay = lhmsmv_alloc();
 	mlhmmv_t* poosvars = mlhmmv_alloc();
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	loop_stack_t* ploop_stack = loop_stack_alloc();
 
 	lrec_put(prec, "x", "4.5", NO_FREE);
@@ -241,7 +241,7 @@ static char * test_logical_and() {
 	lrec_t* prec = NULL;
 	lhmsmv_t* ptyped_overlay = NULL;
 	mlhmmv_t* poosvars = NULL;
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	loop_stack_t* ploop_stack = loop_stack_alloc();
 
 	variables_t variables = (variables_t) {
@@ -304,7 +304,7 @@ static char * test_logical_or() {
 	lrec_t* prec = NULL;
 	lhmsmv_t* ptyped_overlay = NULL;
 	mlhmmv_t* poosvars = NULL;
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	loop_stack_t* ploop_stack = loop_stack_alloc();
 
 	variables_t variables = (variables_t) {
@@ -367,7 +367,7 @@ static char * test_logical_xor() {
 	lrec_t* prec = NULL;
 	lhmsmv_t* ptyped_overlay = NULL;
 	mlhmmv_t* poosvars = NULL;
-	string_array_t* pregex_captures = NULL;
+	regex_captures_t* pregex_captures = NULL;
 	loop_stack_t* ploop_stack = loop_stack_alloc();
 
 	variables_t variables = (variables_t) {